@@ -6,7 +6,7 @@
 #include <audioapi/android/core/utils/ffmpegBackend/FFmpegFileWriter.h>
 #endif // RN_AUDIO_API_FFMPEG_DISABLED
 
-#include <audioapi/android/core/utils/miniaudioBackend/MiniAudioFileWriter.h>
+#include <audioapi/android/core/utils/losslessBackend/LosslessFileWriterBackend.h>
 #include <audioapi/core/sources/RecorderAdapterNode.h>
 #include <audioapi/core/utils/Constants.h>
 #include <audioapi/core/utils/Locker.h>
@@ -15,7 +15,6 @@
 #include <audioapi/utils/AudioBuffer.h>
 #include <audioapi/utils/AudioFileProperties.h>
 #include <audioapi/utils/CircularAudioArray.h>
-#include <audioapi/utils/CircularOverflowableAudioArray.h>
 
 #include <memory>
 #include <string>
@@ -219,15 +218,17 @@ Result<std::string, std::string> AndroidAudioRecorder::enableFileOutput(
     std::shared_ptr<AudioFileProperties> properties) {
   std::scoped_lock fileWriterLock(fileWriterMutex_);
 
-  if (properties->format == AudioFileProperties::Format::WAV) {
-    fileWriter_ = std::make_shared<MiniAudioFileWriter>(audioEventHandlerRegistry_, properties);
+  if (properties->format == AudioFileProperties::Format::WAV ||
+      properties->format == AudioFileProperties::Format::FLAC) {
+    fileWriter_ =
+        std::make_shared<LosslessFileWriterBackend>(audioEventHandlerRegistry_, properties);
   } else {
 #if !RN_AUDIO_API_FFMPEG_DISABLED
     fileWriter_ = std::make_shared<android::ffmpeg::FFmpegAudioFileWriter>(
         audioEventHandlerRegistry_, properties);
 #else
     return Result<std::string, std::string>::Err(
-        "FFmpeg backend is disabled. Cannot create file writer for the requested format. Use WAV format instead.");
+        "FFmpeg backend is disabled. Cannot create file writer for the requested format. Use WAV or FLAC format instead.");
 #endif
   }
 
@@ -292,10 +293,16 @@ Result<NoneType, std::string> AndroidAudioRecorder::setOnAudioReadyCallback(
     float sampleRate,
     size_t bufferLength,
     int channelCount,
-    uint64_t callbackId) {
+    uint64_t callbackId,
+    size_t bufferPoolSize) {
   std::scoped_lock callbackLock(callbackMutex_);
   dataCallback_ = std::make_shared<AndroidRecorderCallback>(
-      audioEventHandlerRegistry_, sampleRate, bufferLength, channelCount, callbackId);
+      audioEventHandlerRegistry_,
+      sampleRate,
+      bufferLength,
+      channelCount,
+      callbackId,
+      bufferPoolSize);
 
   if (!isIdle()) {
     std::static_pointer_cast<AndroidRecorderCallback>(dataCallback_)
@@ -378,10 +385,7 @@ oboe::DataCallbackResult AndroidAudioRecorder::onAudioReady(
     if (auto adapterLock = Locker::tryLock(adapterNodeMutex_)) {
       auto const data = static_cast<float *>(audioData);
       deinterleavingBuffer_->deinterleaveFrom(data, numFrames);
-
-      for (size_t ch = 0; ch < streamChannelCount_; ++ch) {
-        adapterNode_->buff_[ch]->write(*deinterleavingBuffer_->getChannel(ch), numFrames);
-      }
+      adapterNode_->buff_->write(*deinterleavingBuffer_, numFrames);
     }
   }
 
@@ -44,7 +44,8 @@ class AndroidAudioRecorder : public oboe::AudioStreamCallback, public AudioRecor
       float sampleRate,
       size_t bufferLength,
       int channelCount,
-      uint64_t callbackId) override;
+      uint64_t callbackId,
+      size_t bufferPoolSize) override;
   void clearOnAudioReadyCallback() override;
 
   void connect(const std::shared_ptr<RecorderAdapterNode> &node) override;
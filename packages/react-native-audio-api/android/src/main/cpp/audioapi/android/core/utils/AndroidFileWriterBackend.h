@@ -24,7 +24,7 @@ class AndroidFileWriterBackend : public AudioFileWriter {
     const std::shared_ptr<AudioFileProperties> &fileProperties);
 
   virtual OpenFileResult openFile(float streamSampleRate, int32_t streamChannelCount, int32_t streamMaxBufferSize, const std::string &fileNameOverride) = 0;
-  void writeAudioData(void *data, int numFrames);
+  virtual void writeAudioData(void *data, int numFrames);
 
   std::string getFilePath() const override { return filePath_; }
   double getCurrentDuration() const override { return static_cast<double>(framesWritten_.load(std::memory_order_acquire)) / streamSampleRate_; }
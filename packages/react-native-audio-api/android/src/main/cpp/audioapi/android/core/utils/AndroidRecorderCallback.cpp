@@ -5,7 +5,7 @@
 #include <audioapi/libs/miniaudio/miniaudio.h>
 #include <audioapi/utils/AudioArray.h>
 #include <audioapi/utils/AudioBuffer.h>
-#include <audioapi/utils/CircularAudioArray.h>
+#include <audioapi/utils/CircularAudioBuffer.h>
 
 #include <algorithm>
 #include <memory>
@@ -22,18 +22,21 @@ namespace audioapi {
 /// @param bufferLength The user desired buffer length
 /// @param channelCount The user desired channel count
 /// @param callbackId The callback identifier
+/// @param bufferPoolSize Number of buffers reused for the emitted chunks, 0 to allocate each one
 AndroidRecorderCallback::AndroidRecorderCallback(
     const std::shared_ptr<AudioEventHandlerRegistry> &audioEventHandlerRegistry,
     float sampleRate,
     size_t bufferLength,
     int channelCount,
-    uint64_t callbackId)
+    uint64_t callbackId,
+    size_t bufferPoolSize)
     : AudioRecorderCallback(
           audioEventHandlerRegistry,
           sampleRate,
           bufferLength,
           channelCount,
-          callbackId) {}
+          callbackId,
+          bufferPoolSize) {}
 
 AndroidRecorderCallback::~AndroidRecorderCallback() {
   if (converter_ != nullptr) {
@@ -47,9 +50,7 @@ AndroidRecorderCallback::~AndroidRecorderCallback() {
     processingBufferLength_ = 0;
   }
 
-  for (size_t i = 0; i < circularBuffer_.size(); ++i) {
-    circularBuffer_[i]->zero();
-  }
+  circularBuffer_->clear();
 }
 
 /// @brief Prepares the recorder callback by initializing the data converter and allocating necessary buffers.
@@ -112,7 +113,7 @@ Result<NoneType, std::string> AndroidRecorderCallback::prepare(
 }
 
 void AndroidRecorderCallback::cleanup() {
-  if (circularBuffer_[0]->getNumberOfAvailableFrames() > 0) {
+  if (circularBuffer_->getNumberOfAvailableFrames() > 0) {
     emitAudioData(true);
   }
 
@@ -127,9 +128,7 @@ void AndroidRecorderCallback::cleanup() {
     processingBufferLength_ = 0;
   }
 
-  for (size_t i = 0; i < circularBuffer_.size(); ++i) {
-    circularBuffer_[i]->zero();
-  }
+  circularBuffer_->clear();
   offloader_.reset();
 }
 
@@ -151,10 +150,7 @@ void AndroidRecorderCallback::receiveAudioData(void *data, int numFrames) {
 void AndroidRecorderCallback::deinterleaveAndPushAudioData(void *data, int numFrames) {
   auto *inputData = static_cast<float *>(data);
   deinterleavingBuffer_->deinterleaveFrom(inputData, numFrames);
-
-  for (size_t ch = 0; ch < channelCount_; ++ch) {
-    circularBuffer_[ch]->push_back(*deinterleavingBuffer_->getChannel(ch), numFrames);
-  }
+  circularBuffer_->write(*deinterleavingBuffer_, numFrames);
 }
 
 /// @brief The handler function for the callback thread. It continuously receives audio data,
@@ -168,7 +164,7 @@ void AndroidRecorderCallback::taskOffloaderFunction(CallbackData callbackData) {
       streamChannelCount_ == channelCount_) {
     deinterleaveAndPushAudioData(data, numFrames);
 
-    if (circularBuffer_[0]->getNumberOfAvailableFrames() >= bufferLength_) {
+    if (circularBuffer_->getNumberOfAvailableFrames() >= bufferLength_) {
       emitAudioData();
     }
     return;
@@ -182,7 +178,7 @@ void AndroidRecorderCallback::taskOffloaderFunction(CallbackData callbackData) {
 
   deinterleaveAndPushAudioData(processingBuffer_, static_cast<int>(outputFrameCount));
 
-  if (circularBuffer_[0]->getNumberOfAvailableFrames() >= bufferLength_) {
+  if (circularBuffer_->getNumberOfAvailableFrames() >= bufferLength_) {
     emitAudioData();
   }
 }
@@ -11,7 +11,6 @@ namespace audioapi {
 
 class AudioBuffer;
 class AudioArray;
-class CircularAudioArray;
 class AudioEventHandlerRegistry;
 
 struct CallbackData {
@@ -26,7 +25,8 @@ class AndroidRecorderCallback : public AudioRecorderCallback {
       float sampleRate,
       size_t bufferLength,
       int channelCount,
-      uint64_t callbackId);
+      uint64_t callbackId,
+      size_t bufferPoolSize);
   ~AndroidRecorderCallback() override;
 
   Result<NoneType, std::string>
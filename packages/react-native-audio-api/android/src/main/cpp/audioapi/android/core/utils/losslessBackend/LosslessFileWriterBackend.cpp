@@ -0,0 +1,73 @@
+#include <audioapi/android/core/utils/FileOptions.h>
+#include <audioapi/android/core/utils/losslessBackend/LosslessFileWriterBackend.h>
+
+#include <memory>
+#include <string>
+
+namespace audioapi {
+
+LosslessFileWriterBackend::LosslessFileWriterBackend(
+    const std::shared_ptr<AudioEventHandlerRegistry> &audioEventHandlerRegistry,
+    const std::shared_ptr<AudioFileProperties> &fileProperties)
+    : AndroidFileWriterBackend(audioEventHandlerRegistry, fileProperties),
+      writer_(audioEventHandlerRegistry, fileProperties) {}
+
+/// @brief Opens the audio file for writing.
+/// this method should be called only on the JS thread.
+/// @param streamSampleRate The sample rate of the incoming audio stream.
+/// @param streamChannelCount The channel count of the incoming audio stream.
+/// @param streamMaxBufferSize The maximum buffer size of the incoming audio stream.
+/// @return The status of the file opening operation.
+OpenFileResult LosslessFileWriterBackend::openFile(
+    float streamSampleRate,
+    int32_t streamChannelCount,
+    int32_t streamMaxBufferSize,
+    const std::string &fileNameOverride) {
+  streamSampleRate_ = streamSampleRate;
+  streamChannelCount_ = streamChannelCount;
+  streamMaxBufferSize_ = streamMaxBufferSize;
+
+  auto filePathResult = android::fileoptions::getFilePath(fileProperties_, fileNameOverride);
+
+  if (!filePathResult.is_ok()) {
+    return OpenFileResult::Err(filePathResult.unwrap_err());
+  }
+
+  auto result = writer_.openFile(filePathResult.unwrap(), streamSampleRate, streamChannelCount);
+
+  if (result.is_ok()) {
+    filePath_ = result.unwrap();
+    isFileOpen_.store(true, std::memory_order_release);
+  }
+
+  return result;
+}
+
+/// @brief Closes the audio file.
+/// It should be called only on the JS thread.
+/// @return The status of the file closing operation.
+CloseFileResult LosslessFileWriterBackend::closeFile() {
+  isFileOpen_.store(false, std::memory_order_release);
+  filePath_ = "";
+  return writer_.closeFile();
+}
+
+void LosslessFileWriterBackend::writeAudioData(void *data, int numFrames) {
+  writer_.writeAudioData(static_cast<const float *>(data), static_cast<size_t>(numFrames));
+}
+
+double LosslessFileWriterBackend::getCurrentDuration() const {
+  return writer_.getCurrentDuration();
+}
+
+void LosslessFileWriterBackend::setOnErrorCallback(uint64_t callbackId) {
+  AndroidFileWriterBackend::setOnErrorCallback(callbackId);
+  writer_.setOnErrorCallback(callbackId);
+}
+
+void LosslessFileWriterBackend::clearOnErrorCallback() {
+  AndroidFileWriterBackend::clearOnErrorCallback();
+  writer_.clearOnErrorCallback();
+}
+
+} // namespace audioapi
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <audioapi/android/core/utils/AndroidFileWriterBackend.h>
+#include <audioapi/core/utils/LosslessFileWriter.h>
+
+#include <memory>
+#include <string>
+
+namespace audioapi {
+
+/// @brief Writes WAV and FLAC files with the shared native encoders, without FFmpeg.
+class LosslessFileWriterBackend : public AndroidFileWriterBackend {
+ public:
+  explicit LosslessFileWriterBackend(
+      const std::shared_ptr<AudioEventHandlerRegistry> &audioEventHandlerRegistry,
+      const std::shared_ptr<AudioFileProperties> &fileProperties);
+
+  OpenFileResult openFile(float streamSampleRate, int32_t streamChannelCount, int32_t streamMaxBufferSize, const std::string &fileNameOverride) override;
+  CloseFileResult closeFile() override;
+  void writeAudioData(void *data, int numFrames) override;
+
+  double getCurrentDuration() const override;
+
+  void setOnErrorCallback(uint64_t callbackId) override;
+  void clearOnErrorCallback() override;
+
+ private:
+  LosslessFileWriter writer_;
+
+  // audio is handed to the writer, which buffers it on its own
+  void taskOffloaderFunction(WriterData data) override {}
+};
+
+} // namespace audioapi
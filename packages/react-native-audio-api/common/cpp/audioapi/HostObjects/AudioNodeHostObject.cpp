@@ -25,7 +25,12 @@ AudioNodeHostObject::AudioNodeHostObject(const std::shared_ptr<AudioNode> &node,
 // "key function" for the audio classes - this allow for RTTI to work
 // properly across dynamic library boundaries (i.e. dynamic_cast that is used by
 // isHostObject method), android specific issue
-AudioNodeHostObject::~AudioNodeHostObject() = default;
+AudioNodeHostObject::~AudioNodeHostObject() {
+  // the JS handle is gone, the audio thread reclaims the node once it is not playing
+  if (node_ != nullptr) {
+    node_->release();
+  }
+}
 
 JSI_PROPERTY_GETTER_IMPL(AudioNodeHostObject, numberOfInputs) {
   return {node_->getNumberOfInputs()};
@@ -29,6 +29,8 @@ class AudioNodeHostObject : public JsiHostObject {
   JSI_HOST_FUNCTION_DECL(disconnect);
 
  protected:
+  friend class BaseAudioContextHostObject;
+
   std::shared_ptr<AudioNode> node_;
 };
 } // namespace audioapi
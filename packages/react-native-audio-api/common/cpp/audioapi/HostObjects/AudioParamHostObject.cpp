@@ -4,6 +4,7 @@
 #include <audioapi/utils/AudioArray.h>
 
 #include <memory>
+#include <span>
 #include <utility>
 
 namespace audioapi {
@@ -23,7 +24,8 @@ AudioParamHostObject::AudioParamHostObject(const std::shared_ptr<AudioParam> &pa
       JSI_EXPORT_FUNCTION(AudioParamHostObject, setTargetAtTime),
       JSI_EXPORT_FUNCTION(AudioParamHostObject, setValueCurveAtTime),
       JSI_EXPORT_FUNCTION(AudioParamHostObject, cancelScheduledValues),
-      JSI_EXPORT_FUNCTION(AudioParamHostObject, cancelAndHoldAtTime));
+      JSI_EXPORT_FUNCTION(AudioParamHostObject, cancelAndHoldAtTime),
+      JSI_EXPORT_FUNCTION(AudioParamHostObject, scheduleEvents));
 
   addSetters(JSI_EXPORT_PROPERTY_SETTER(AudioParamHostObject, value));
 }
@@ -81,7 +83,7 @@ JSI_HOST_FUNCTION_IMPL(AudioParamHostObject, setValueCurveAtTime) {
   auto arrayBuffer =
       args[0].getObject(runtime).getPropertyAsObject(runtime, "buffer").getArrayBuffer(runtime);
   auto rawValues = reinterpret_cast<float *>(arrayBuffer.data(runtime));
-  auto length = static_cast<int>(arrayBuffer.size(runtime));
+  auto length = static_cast<int>(arrayBuffer.size(runtime) / sizeof(float));
   auto values = std::make_unique<AudioArray>(rawValues, length);
 
   double startTime = args[1].getNumber();
@@ -102,4 +104,22 @@ JSI_HOST_FUNCTION_IMPL(AudioParamHostObject, cancelAndHoldAtTime) {
   return jsi::Value::undefined();
 }
 
+JSI_HOST_FUNCTION_IMPL(AudioParamHostObject, scheduleEvents) {
+  param_->scheduleEvents(getEvents(runtime, args[0]));
+  return jsi::Value::undefined();
+}
+
+std::span<const double> AudioParamHostObject::getEvents(
+    jsi::Runtime &runtime,
+    const jsi::Value &value) {
+  auto array = value.getObject(runtime);
+  auto arrayBuffer = array.getPropertyAsObject(runtime, "buffer").getArrayBuffer(runtime);
+  auto byteOffset = static_cast<size_t>(array.getProperty(runtime, "byteOffset").getNumber());
+  auto byteLength = static_cast<size_t>(array.getProperty(runtime, "byteLength").getNumber());
+
+  return {
+      reinterpret_cast<const double *>(arrayBuffer.data(runtime) + byteOffset),
+      byteLength / sizeof(double)};
+}
+
 } // namespace audioapi
@@ -5,6 +5,7 @@
 #include <jsi/jsi.h>
 #include <cstddef>
 #include <memory>
+#include <span>
 #include <utility>
 #include <vector>
 
@@ -31,10 +32,15 @@ class AudioParamHostObject : public JsiHostObject {
   JSI_HOST_FUNCTION_DECL(setValueCurveAtTime);
   JSI_HOST_FUNCTION_DECL(cancelScheduledValues);
   JSI_HOST_FUNCTION_DECL(cancelAndHoldAtTime);
+  JSI_HOST_FUNCTION_DECL(scheduleEvents);
 
  private:
   friend class AudioNodeHostObject;
+  friend class BaseAudioContextHostObject;
 
   std::shared_ptr<AudioParam> param_;
+
+  /// @brief Views the doubles of a Float64Array, which can start anywhere in its buffer.
+  static std::span<const double> getEvents(jsi::Runtime &runtime, const jsi::Value &value);
 };
 } // namespace audioapi
@@ -1,3 +1,4 @@
+#include <audioapi/HostObjects/AudioParamHostObject.h>
 #include <audioapi/HostObjects/BaseAudioContextHostObject.h>
 #include <audioapi/HostObjects/analysis/AnalyserNodeHostObject.h>
 #include <audioapi/HostObjects/destinations/AudioDestinationNodeHostObject.h>
@@ -21,14 +22,82 @@
 #include <audioapi/HostObjects/sources/WorkletSourceNodeHostObject.h>
 #include <audioapi/HostObjects/utils/JsEnumParser.h>
 #include <audioapi/HostObjects/utils/NodeOptionsParser.h>
+#include <audioapi/core/AudioParam.h>
 #include <audioapi/core/BaseAudioContext.h>
+#include <audioapi/core/sources/AudioScheduledSourceNode.h>
+#include <audioapi/core/utils/AudioGraphManager.h>
 
 #include <memory>
+#include <stdexcept>
+#include <string>
 #include <utility>
 #include <vector>
 
 namespace audioapi {
 
+namespace {
+
+std::shared_ptr<AudioNodeHostObject> createSubgraphNode(
+    jsi::Runtime &runtime,
+    const std::shared_ptr<BaseAudioContext> &context,
+    const std::string &type,
+    const jsi::Object &options) {
+  if (type == "oscillator") {
+    return std::make_shared<OscillatorNodeHostObject>(
+        context, option_parser::parseOscillatorOptions(runtime, options));
+  }
+  if (type == "constantSource") {
+    return std::make_shared<ConstantSourceNodeHostObject>(
+        context, option_parser::parseConstantSourceOptions(runtime, options));
+  }
+  if (type == "bufferSource") {
+    return std::make_shared<AudioBufferSourceNodeHostObject>(
+        context, option_parser::parseAudioBufferSourceOptions(runtime, options));
+  }
+  if (type == "gain") {
+    return std::make_shared<GainNodeHostObject>(
+        context, option_parser::parseGainOptions(runtime, options));
+  }
+  if (type == "stereoPanner") {
+    return std::make_shared<StereoPannerNodeHostObject>(
+        context, option_parser::parseStereoPannerOptions(runtime, options));
+  }
+  if (type == "biquadFilter") {
+    return std::make_shared<BiquadFilterNodeHostObject>(
+        context, option_parser::parseBiquadFilterOptions(runtime, options));
+  }
+  if (type == "delay") {
+    return std::make_shared<DelayNodeHostObject>(
+        context, option_parser::parseDelayOptions(runtime, options));
+  }
+
+  throw std::invalid_argument("Unknown subgraph node type: " + type);
+}
+
+/// @brief Reads the index of a node of the subgraph, checked before the cast, as negative and NaN
+/// numbers can not be converted to size_t.
+size_t getSubgraphNodeIndex(const jsi::Value &value, size_t nodesCount, const char *message) {
+  auto index = value.getNumber();
+
+  if (!(index >= 0.0 && index < static_cast<double>(nodesCount))) {
+    throw std::out_of_range(message);
+  }
+
+  return static_cast<size_t>(index);
+}
+
+jsi::Object voicePoolStatsToObject(jsi::Runtime &runtime, const VoicePool::Stats &stats) {
+  auto result = jsi::Object(runtime);
+  result.setProperty(runtime, "hits", static_cast<double>(stats.hits));
+  result.setProperty(runtime, "misses", static_cast<double>(stats.misses));
+  result.setProperty(runtime, "recycled", static_cast<double>(stats.recycled));
+  result.setProperty(runtime, "available", static_cast<double>(stats.available));
+  result.setProperty(runtime, "capacity", static_cast<double>(stats.capacity));
+  return result;
+}
+
+} // namespace
+
 BaseAudioContextHostObject::BaseAudioContextHostObject(
     const std::shared_ptr<BaseAudioContext> &context,
     jsi::Runtime *runtime,
@@ -63,7 +132,13 @@ BaseAudioContextHostObject::BaseAudioContextHostObject(
       JSI_EXPORT_FUNCTION(BaseAudioContextHostObject, createPeriodicWave),
       JSI_EXPORT_FUNCTION(BaseAudioContextHostObject, createConvolver),
       JSI_EXPORT_FUNCTION(BaseAudioContextHostObject, createAnalyser),
-      JSI_EXPORT_FUNCTION(BaseAudioContextHostObject, createWaveShaper));
+      JSI_EXPORT_FUNCTION(BaseAudioContextHostObject, createWaveShaper),
+      JSI_EXPORT_FUNCTION(BaseAudioContextHostObject, scheduleParamEvents),
+      JSI_EXPORT_FUNCTION(BaseAudioContextHostObject, createSubgraph),
+      JSI_EXPORT_FUNCTION(BaseAudioContextHostObject, beginGraphBatch),
+      JSI_EXPORT_FUNCTION(BaseAudioContextHostObject, commitGraphBatch),
+      JSI_EXPORT_FUNCTION(BaseAudioContextHostObject, getVoicePoolStats),
+      JSI_EXPORT_FUNCTION(BaseAudioContextHostObject, setVoicePoolCapacity));
 }
 
 // Explicitly define destructors here, as they to exist in order to act as a
@@ -102,10 +177,13 @@ JSI_HOST_FUNCTION_IMPL(BaseAudioContextHostObject, createWorkletSourceNode) {
     workletRuntime = context_->getRuntimeRegistry().audioRuntime;
   }
 
-  auto workletSourceNode =
-      context_->createWorkletSourceNode(shareableWorklet, workletRuntime, shouldLockRuntime);
+  auto lookahead = static_cast<size_t>(args[2].getNumber());
+  auto blockSize = static_cast<size_t>(args[3].getNumber());
+
+  auto workletSourceNode = context_->createWorkletSourceNode(
+      shareableWorklet, workletRuntime, shouldLockRuntime, lookahead, blockSize);
   auto workletSourceNodeHostObject =
-      std::make_shared<WorkletSourceNodeHostObject>(workletSourceNode);
+      std::make_shared<WorkletSourceNodeHostObject>(workletSourceNode, context_->getSampleRate());
   return jsi::Object::createFromHostObject(runtime, workletSourceNodeHostObject);
 #endif
   return jsi::Value::undefined();
@@ -126,10 +204,17 @@ JSI_HOST_FUNCTION_IMPL(BaseAudioContextHostObject, createWorkletNode) {
   }
   auto bufferLength = static_cast<size_t>(args[2].getNumber());
   auto inputChannelCount = static_cast<size_t>(args[3].getNumber());
+  auto lookahead = static_cast<size_t>(args[4].getNumber());
 
   auto workletNode = context_->createWorkletNode(
-      shareableWorklet, workletRuntime, bufferLength, inputChannelCount, shouldLockRuntime);
-  auto workletNodeHostObject = std::make_shared<WorkletNodeHostObject>(workletNode);
+      shareableWorklet,
+      workletRuntime,
+      bufferLength,
+      inputChannelCount,
+      shouldLockRuntime,
+      lookahead);
+  auto workletNodeHostObject =
+      std::make_shared<WorkletNodeHostObject>(workletNode, context_->getSampleRate());
   auto jsiObject = jsi::Object::createFromHostObject(runtime, workletNodeHostObject);
   jsiObject.setExternalMemoryPressure(
       runtime,
@@ -153,10 +238,14 @@ JSI_HOST_FUNCTION_IMPL(BaseAudioContextHostObject, createWorkletProcessingNode)
     workletRuntime = context_->getRuntimeRegistry().audioRuntime;
   }
 
-  auto workletProcessingNode =
-      context_->createWorkletProcessingNode(shareableWorklet, workletRuntime, shouldLockRuntime);
-  auto workletProcessingNodeHostObject =
-      std::make_shared<WorkletProcessingNodeHostObject>(workletProcessingNode);
+  auto lookahead = static_cast<size_t>(args[2].getNumber());
+  auto blockSize = static_cast<size_t>(args[3].getNumber());
+  auto channelCount = static_cast<int>(args[4].getNumber());
+
+  auto workletProcessingNode = context_->createWorkletProcessingNode(
+      shareableWorklet, workletRuntime, shouldLockRuntime, lookahead, blockSize, channelCount);
+  auto workletProcessingNodeHostObject = std::make_shared<WorkletProcessingNodeHostObject>(
+      workletProcessingNode, context_->getSampleRate());
   return jsi::Object::createFromHostObject(runtime, workletProcessingNodeHostObject);
 #endif
   return jsi::Value::undefined();
@@ -164,7 +253,8 @@ JSI_HOST_FUNCTION_IMPL(BaseAudioContextHostObject, createWorkletProcessingNode)
 
 JSI_HOST_FUNCTION_IMPL(BaseAudioContextHostObject, createRecorderAdapter) {
   auto recorderAdapter = context_->createRecorderAdapter();
-  auto recorderAdapterHostObject = std::make_shared<RecorderAdapterNodeHostObject>(recorderAdapter);
+  auto recorderAdapterHostObject =
+      std::make_shared<RecorderAdapterNodeHostObject>(recorderAdapter, context_->getSampleRate());
   return jsi::Object::createFromHostObject(runtime, recorderAdapterHostObject);
 }
 
@@ -312,4 +402,135 @@ JSI_HOST_FUNCTION_IMPL(BaseAudioContextHostObject, createWaveShaper) {
       std::make_shared<WaveShaperNodeHostObject>(context_, waveShaperOptions);
   return jsi::Object::createFromHostObject(runtime, waveShaperHostObject);
 }
+JSI_HOST_FUNCTION_IMPL(BaseAudioContextHostObject, scheduleParamEvents) {
+  auto paramsArray = args[0].getObject(runtime).asArray(runtime);
+  auto paramsCount = paramsArray.size(runtime);
+
+  std::vector<AudioParam *> params;
+  params.reserve(paramsCount);
+
+  for (size_t i = 0; i < paramsCount; i++) {
+    auto paramHostObject = paramsArray.getValueAtIndex(runtime, i)
+                               .getObject(runtime)
+                               .getHostObject<AudioParamHostObject>(runtime);
+    params.push_back(paramHostObject->param_.get());
+  }
+
+  AudioParam::scheduleEvents(params, AudioParamHostObject::getEvents(runtime, args[1]));
+  return jsi::Value::undefined();
+}
+
+JSI_HOST_FUNCTION_IMPL(BaseAudioContextHostObject, createSubgraph) {
+  auto subgraph = args[0].getObject(runtime);
+  auto nodeTemplates = subgraph.getPropertyAsObject(runtime, "nodes").asArray(runtime);
+  auto nodesCount = nodeTemplates.size(runtime);
+
+  auto nodes = jsi::Array(runtime, nodesCount);
+  std::vector<std::shared_ptr<AudioNodeHostObject>> nodeHostObjects;
+  nodeHostObjects.reserve(nodesCount);
+
+  // every node and connection of the subgraph reaches the audio thread in one event, and none
+  // does if building the subgraph throws, the nodes are then released with their handles
+  AudioGraphManager::Transaction transaction(*context_->getGraphManager());
+
+  for (size_t i = 0; i < nodesCount; i++) {
+    auto nodeTemplate = nodeTemplates.getValueAtIndex(runtime, i).getObject(runtime);
+    auto type = nodeTemplate.getProperty(runtime, "type").asString(runtime).utf8(runtime);
+    auto optionsValue = nodeTemplate.getProperty(runtime, "options");
+    auto options =
+        optionsValue.isObject() ? optionsValue.getObject(runtime) : jsi::Object(runtime);
+
+    auto nodeHostObject = createSubgraphNode(runtime, context_, type, options);
+    nodes.setValueAtIndex(runtime, i, jsi::Object::createFromHostObject(runtime, nodeHostObject));
+    nodeHostObjects.push_back(std::move(nodeHostObject));
+  }
+
+  auto connectionsValue = subgraph.getProperty(runtime, "connections");
+  auto connections = connectionsValue.isObject()
+      ? connectionsValue.getObject(runtime).asArray(runtime)
+      : jsi::Array(runtime, 0);
+
+  // a connection is [from, to] or [from, to, paramName], where from is the index of a node of
+  // the subgraph and to is the index of another one or a node or param that already exists
+  for (size_t i = 0, count = connections.size(runtime); i < count; i++) {
+    auto connection = connections.getValueAtIndex(runtime, i).getObject(runtime).asArray(runtime);
+    auto from = getSubgraphNodeIndex(
+        connection.getValueAtIndex(runtime, 0),
+        nodesCount,
+        "Subgraph connection from a node out of range");
+    auto to = connection.getValueAtIndex(runtime, 1);
+
+    auto &source = nodeHostObjects[from]->node_;
+
+    if (to.isObject()) {
+      auto destination = to.getObject(runtime);
+      if (destination.isHostObject<AudioParamHostObject>(runtime)) {
+        source->connect(destination.getHostObject<AudioParamHostObject>(runtime)->param_);
+      } else {
+        source->connect(destination.getHostObject<AudioNodeHostObject>(runtime)->node_);
+      }
+      continue;
+    }
+
+    auto toIndex =
+        getSubgraphNodeIndex(to, nodesCount, "Subgraph connection to a node out of range");
+
+    auto paramValue =
+        connection.size(runtime) > 2 ? connection.getValueAtIndex(runtime, 2) : jsi::Value();
+    if (paramValue.isString()) {
+      auto paramName = paramValue.asString(runtime).utf8(runtime);
+      auto param = nodes.getValueAtIndex(runtime, toIndex)
+                       .getObject(runtime)
+                       .getPropertyAsObject(runtime, paramName.c_str())
+                       .getHostObject<AudioParamHostObject>(runtime);
+      source->connect(param->param_);
+    } else {
+      source->connect(nodeHostObjects[toIndex]->node_);
+    }
+  }
+
+  auto startValue = subgraph.getProperty(runtime, "start");
+  if (startValue.isNumber()) {
+    auto when = startValue.getNumber();
+    for (auto &nodeHostObject : nodeHostObjects) {
+      if (auto sourceNode =
+              std::dynamic_pointer_cast<AudioScheduledSourceNode>(nodeHostObject->node_)) {
+        sourceNode->start(when);
+      }
+    }
+  }
+
+  return nodes;
+}
+
+JSI_HOST_FUNCTION_IMPL(BaseAudioContextHostObject, beginGraphBatch) {
+  context_->getGraphManager()->beginBatch();
+  return jsi::Value::undefined();
+}
+
+JSI_HOST_FUNCTION_IMPL(BaseAudioContextHostObject, commitGraphBatch) {
+  context_->getGraphManager()->commitBatch();
+  return jsi::Value::undefined();
+}
+
+JSI_HOST_FUNCTION_IMPL(BaseAudioContextHostObject, getVoicePoolStats) {
+  auto &voicePool = context_->getGraphManager()->getVoicePool();
+
+  auto oscillatorStats = voicePool.getStats(VoiceType::OSCILLATOR);
+  auto bufferSourceStats = voicePool.getStats(VoiceType::BUFFER_SOURCE);
+
+  auto result = jsi::Object(runtime);
+  result.setProperty(runtime, "oscillator", voicePoolStatsToObject(runtime, oscillatorStats));
+  result.setProperty(runtime, "bufferSource", voicePoolStatsToObject(runtime, bufferSourceStats));
+  return result;
+}
+
+JSI_HOST_FUNCTION_IMPL(BaseAudioContextHostObject, setVoicePoolCapacity) {
+  auto type = js_enum_parser::voiceTypeFromString(args[0].getString(runtime).utf8(runtime));
+  auto capacity = static_cast<size_t>(args[1].getNumber());
+
+  context_->getGraphManager()->getVoicePool().setCapacity(type, capacity);
+  return jsi::Value::undefined();
+}
+
 } // namespace audioapi
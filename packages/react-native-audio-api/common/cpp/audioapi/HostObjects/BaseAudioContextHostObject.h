@@ -47,6 +47,12 @@ class BaseAudioContextHostObject : public JsiHostObject {
   JSI_HOST_FUNCTION_DECL(createConvolver);
   JSI_HOST_FUNCTION_DECL(createWaveShaper);
   JSI_HOST_FUNCTION_DECL(createDelay);
+  JSI_HOST_FUNCTION_DECL(scheduleParamEvents);
+  JSI_HOST_FUNCTION_DECL(createSubgraph);
+  JSI_HOST_FUNCTION_DECL(beginGraphBatch);
+  JSI_HOST_FUNCTION_DECL(commitGraphBatch);
+  JSI_HOST_FUNCTION_DECL(getVoicePoolStats);
+  JSI_HOST_FUNCTION_DECL(setVoicePoolCapacity);
 
  protected:
   std::shared_ptr<BaseAudioContext> context_;
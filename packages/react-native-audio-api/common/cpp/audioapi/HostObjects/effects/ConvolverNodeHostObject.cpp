@@ -44,7 +44,7 @@ JSI_HOST_FUNCTION_IMPL(ConvolverNodeHostObject, setBuffer) {
   }
 
   auto bufferHostObject = args[0].getObject(runtime).asHostObject<AudioBufferHostObject>(runtime);
-  convolverNode->setBuffer(bufferHostObject->audioBuffer_);
+  convolverNode->setBuffer(bufferHostObject->getAudioBuffer());
   thisValue.asObject(runtime).setExternalMemoryPressure(
       runtime, bufferHostObject->getSizeInBytes() + 16);
   return jsi::Value::undefined();
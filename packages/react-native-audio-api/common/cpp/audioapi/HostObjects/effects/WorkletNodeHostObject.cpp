@@ -0,0 +1,27 @@
+#include <audioapi/HostObjects/effects/WorkletNodeHostObject.h>
+
+#include <audioapi/core/effects/WorkletNode.h>
+#include <memory>
+
+namespace audioapi {
+
+WorkletNodeHostObject::WorkletNodeHostObject(
+    const std::shared_ptr<WorkletNode> &node,
+    float sampleRate)
+    : AudioNodeHostObject(node), sampleRate_(sampleRate) {
+  addFunctions(JSI_EXPORT_FUNCTION(WorkletNodeHostObject, getStats));
+}
+
+JSI_HOST_FUNCTION_IMPL(WorkletNodeHostObject, getStats) {
+  auto workletNode = std::static_pointer_cast<WorkletNode>(node_);
+  auto stats = workletNode->getLookaheadStats();
+
+  auto jsStats = jsi::Object(runtime);
+  jsStats.setProperty(runtime, "latency", static_cast<double>(stats.latencyFrames) / sampleRate_);
+  jsStats.setProperty(runtime, "underrunCount", static_cast<double>(stats.underruns));
+  jsStats.setProperty(runtime, "renderedBlockCount", static_cast<double>(stats.renderedBlocks));
+  jsStats.setProperty(runtime, "skippedBlockCount", static_cast<double>(stats.skippedBlocks));
+  return jsStats;
+}
+
+} // namespace audioapi
@@ -11,7 +11,13 @@ using namespace facebook;
 
 class WorkletNodeHostObject : public AudioNodeHostObject {
  public:
-  explicit WorkletNodeHostObject(const std::shared_ptr<WorkletNode> &node)
-      : AudioNodeHostObject(node) {}
+  explicit WorkletNodeHostObject(
+      const std::shared_ptr<WorkletNode> &node,
+      float sampleRate);
+
+  JSI_HOST_FUNCTION_DECL(getStats);
+
+ private:
+  float sampleRate_;
 };
 } // namespace audioapi
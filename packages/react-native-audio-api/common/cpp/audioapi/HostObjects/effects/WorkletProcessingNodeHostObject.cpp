@@ -0,0 +1,27 @@
+#include <audioapi/HostObjects/effects/WorkletProcessingNodeHostObject.h>
+
+#include <audioapi/core/effects/WorkletProcessingNode.h>
+#include <memory>
+
+namespace audioapi {
+
+WorkletProcessingNodeHostObject::WorkletProcessingNodeHostObject(
+    const std::shared_ptr<WorkletProcessingNode> &node,
+    float sampleRate)
+    : AudioNodeHostObject(node), sampleRate_(sampleRate) {
+  addFunctions(JSI_EXPORT_FUNCTION(WorkletProcessingNodeHostObject, getStats));
+}
+
+JSI_HOST_FUNCTION_IMPL(WorkletProcessingNodeHostObject, getStats) {
+  auto workletProcessingNode = std::static_pointer_cast<WorkletProcessingNode>(node_);
+  auto stats = workletProcessingNode->getLookaheadStats();
+
+  auto jsStats = jsi::Object(runtime);
+  jsStats.setProperty(runtime, "latency", static_cast<double>(stats.latencyFrames) / sampleRate_);
+  jsStats.setProperty(runtime, "underrunCount", static_cast<double>(stats.underruns));
+  jsStats.setProperty(runtime, "renderedBlockCount", static_cast<double>(stats.renderedBlocks));
+  jsStats.setProperty(runtime, "skippedBlockCount", static_cast<double>(stats.skippedBlocks));
+  return jsStats;
+}
+
+} // namespace audioapi
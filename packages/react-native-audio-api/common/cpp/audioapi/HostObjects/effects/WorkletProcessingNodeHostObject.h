@@ -11,7 +11,13 @@ using namespace facebook;
 
 class WorkletProcessingNodeHostObject : public AudioNodeHostObject {
  public:
-  explicit WorkletProcessingNodeHostObject(const std::shared_ptr<WorkletProcessingNode> &node)
-      : AudioNodeHostObject(node) {}
+  explicit WorkletProcessingNodeHostObject(
+      const std::shared_ptr<WorkletProcessingNode> &node,
+      float sampleRate);
+
+  JSI_HOST_FUNCTION_DECL(getStats);
+
+ private:
+  float sampleRate_;
 };
 } // namespace audioapi
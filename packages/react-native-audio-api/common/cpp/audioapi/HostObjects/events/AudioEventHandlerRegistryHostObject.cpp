@@ -12,7 +12,9 @@ AudioEventHandlerRegistryHostObject::AudioEventHandlerRegistryHostObject(
 
   addFunctions(
       JSI_EXPORT_FUNCTION(AudioEventHandlerRegistryHostObject, addAudioEventListener),
-      JSI_EXPORT_FUNCTION(AudioEventHandlerRegistryHostObject, removeAudioEventListener));
+      JSI_EXPORT_FUNCTION(AudioEventHandlerRegistryHostObject, addAudioEventBatchListener),
+      JSI_EXPORT_FUNCTION(AudioEventHandlerRegistryHostObject, removeAudioEventListener),
+      JSI_EXPORT_FUNCTION(AudioEventHandlerRegistryHostObject, getEventStats));
 }
 
 JSI_HOST_FUNCTION_IMPL(AudioEventHandlerRegistryHostObject, addAudioEventListener) {
@@ -24,6 +26,16 @@ JSI_HOST_FUNCTION_IMPL(AudioEventHandlerRegistryHostObject, addAudioEventListene
   return jsi::String::createFromUtf8(runtime, std::to_string(listenerId));
 }
 
+JSI_HOST_FUNCTION_IMPL(AudioEventHandlerRegistryHostObject, addAudioEventBatchListener) {
+  auto eventName = args[0].getString(runtime).utf8(runtime);
+  auto callback = std::make_shared<jsi::Function>(args[1].getObject(runtime).getFunction(runtime));
+
+  auto listenerId = eventHandlerRegistry_->registerBatchHandler(
+      js_enum_parser::audioEventFromString(eventName), callback);
+
+  return jsi::String::createFromUtf8(runtime, std::to_string(listenerId));
+}
+
 JSI_HOST_FUNCTION_IMPL(AudioEventHandlerRegistryHostObject, removeAudioEventListener) {
   auto eventName = args[0].getString(runtime).utf8(runtime);
   uint64_t listenerId = std::stoull(args[1].getString(runtime).utf8(runtime));
@@ -33,4 +45,22 @@ JSI_HOST_FUNCTION_IMPL(AudioEventHandlerRegistryHostObject, removeAudioEventList
   return jsi::Value::undefined();
 }
 
+JSI_HOST_FUNCTION_IMPL(AudioEventHandlerRegistryHostObject, getEventStats) {
+  auto stats = eventHandlerRegistry_->getStats();
+
+  auto counters = jsi::Object(runtime);
+  for (const auto &[eventName, eventCounters] : stats.counters) {
+    auto eventObject = jsi::Object(runtime);
+    eventObject.setProperty(runtime, "dispatched", static_cast<double>(eventCounters.dispatched));
+    eventObject.setProperty(runtime, "coalesced", static_cast<double>(eventCounters.coalesced));
+    counters.setProperty(
+        runtime, js_enum_parser::audioEventToString(eventName).c_str(), eventObject);
+  }
+
+  auto result = jsi::Object(runtime);
+  result.setProperty(runtime, "events", counters);
+  result.setProperty(runtime, "dropped", static_cast<double>(stats.dropped));
+  return result;
+}
+
 } // namespace audioapi
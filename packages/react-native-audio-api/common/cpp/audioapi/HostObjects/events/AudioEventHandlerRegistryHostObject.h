@@ -20,7 +20,9 @@ class AudioEventHandlerRegistryHostObject : public JsiHostObject {
       const std::shared_ptr<AudioEventHandlerRegistry> &eventHandlerRegistry);
 
   JSI_HOST_FUNCTION_DECL(addAudioEventListener);
+  JSI_HOST_FUNCTION_DECL(addAudioEventBatchListener);
   JSI_HOST_FUNCTION_DECL(removeAudioEventListener);
+  JSI_HOST_FUNCTION_DECL(getEventStats);
 
  private:
   std::shared_ptr<AudioEventHandlerRegistry> eventHandlerRegistry_;
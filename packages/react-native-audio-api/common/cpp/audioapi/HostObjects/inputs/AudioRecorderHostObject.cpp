@@ -152,9 +152,11 @@ JSI_HOST_FUNCTION_IMPL(AudioRecorderHostObject, setOnAudioReady) {
   auto channelCount = static_cast<int>(options.getProperty(runtime, "channelCount").getNumber());
   uint64_t callbackId =
       std::stoull(options.getProperty(runtime, "callbackId").getString(runtime).utf8(runtime));
+  auto bufferPoolSize =
+      static_cast<size_t>(options.getProperty(runtime, "bufferPoolSize").getNumber());
 
-  auto result =
-      audioRecorder_->setOnAudioReadyCallback(sampleRate, bufferLength, channelCount, callbackId);
+  auto result = audioRecorder_->setOnAudioReadyCallback(
+      sampleRate, bufferLength, channelCount, callbackId, bufferPoolSize);
   auto jsResult = jsi::Object(runtime);
 
   jsResult.setProperty(
@@ -1,47 +1,94 @@
 #include <audioapi/HostObjects/sources/AudioBufferHostObject.h>
 
+#include <audioapi/HostObjects/utils/JsEnumParser.h>
+#include <audioapi/core/utils/DecodedAudioCache.h>
 #include <audioapi/utils/AudioArrayBuffer.hpp>
 #include <audioapi/utils/AudioBuffer.h>
+#include <audioapi/utils/CompactAudioBuffer.h>
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 
 namespace audioapi {
 
-AudioBufferHostObject::AudioBufferHostObject(const std::shared_ptr<AudioBuffer> &audioBuffer)
-    : audioBuffer_(audioBuffer) {
+AudioBufferHostObject::AudioBufferHostObject(
+    const std::shared_ptr<AudioBuffer> &audioBuffer,
+    bool isShared)
+    : audioBuffer_(audioBuffer), isShared_(isShared) {
   addGetters(
       JSI_EXPORT_PROPERTY_GETTER(AudioBufferHostObject, sampleRate),
       JSI_EXPORT_PROPERTY_GETTER(AudioBufferHostObject, length),
       JSI_EXPORT_PROPERTY_GETTER(AudioBufferHostObject, duration),
-      JSI_EXPORT_PROPERTY_GETTER(AudioBufferHostObject, numberOfChannels));
+      JSI_EXPORT_PROPERTY_GETTER(AudioBufferHostObject, numberOfChannels),
+      JSI_EXPORT_PROPERTY_GETTER(AudioBufferHostObject, storageFormat));
 
   addFunctions(
       JSI_EXPORT_FUNCTION(AudioBufferHostObject, getChannelData),
       JSI_EXPORT_FUNCTION(AudioBufferHostObject, copyFromChannel),
-      JSI_EXPORT_FUNCTION(AudioBufferHostObject, copyToChannel));
+      JSI_EXPORT_FUNCTION(AudioBufferHostObject, copyToChannel),
+      JSI_EXPORT_FUNCTION(AudioBufferHostObject, setStorageFormat));
+}
+
+AudioBufferHostObject::AudioBufferHostObject(
+    const std::shared_ptr<CompactAudioBuffer> &compactBuffer)
+    : AudioBufferHostObject(std::shared_ptr<AudioBuffer>(nullptr)) {
+  compactBuffer_ = compactBuffer;
 }
 
 AudioBufferHostObject::AudioBufferHostObject(AudioBufferHostObject &&other) noexcept
-    : JsiHostObject(std::move(other)), audioBuffer_(std::move(other.audioBuffer_)) {}
+    : JsiHostObject(std::move(other)),
+      audioBuffer_(std::move(other.audioBuffer_)),
+      compactBuffer_(std::move(other.compactBuffer_)),
+      isShared_(other.isShared_) {}
+
+std::shared_ptr<AudioBuffer> AudioBufferHostObject::getAudioBuffer() const {
+  return compactBuffer_ ? compactBuffer_->toAudioBuffer() : audioBuffer_;
+}
+
+void AudioBufferHostObject::detachSharedBuffer() {
+  if (isShared_) {
+    audioBuffer_ = DecodedAudioCache::detach(audioBuffer_);
+    isShared_ = false;
+  }
+}
+
+void AudioBufferHostObject::materialize() {
+  if (compactBuffer_) {
+    audioBuffer_ = compactBuffer_->toAudioBuffer();
+    compactBuffer_.reset();
+  }
+}
 
 JSI_PROPERTY_GETTER_IMPL(AudioBufferHostObject, sampleRate) {
-  return {audioBuffer_->getSampleRate()};
+  return {compactBuffer_ ? compactBuffer_->getSampleRate() : audioBuffer_->getSampleRate()};
 }
 
 JSI_PROPERTY_GETTER_IMPL(AudioBufferHostObject, length) {
-  return {static_cast<double>(audioBuffer_->getSize())};
+  auto size = compactBuffer_ ? compactBuffer_->getSize() : audioBuffer_->getSize();
+  return {static_cast<double>(size)};
 }
 
 JSI_PROPERTY_GETTER_IMPL(AudioBufferHostObject, duration) {
-  return {audioBuffer_->getDuration()};
+  return {compactBuffer_ ? compactBuffer_->getDuration() : audioBuffer_->getDuration()};
 }
 
 JSI_PROPERTY_GETTER_IMPL(AudioBufferHostObject, numberOfChannels) {
-  return { static_cast<int>(audioBuffer_->getNumberOfChannels()) };
+  auto numberOfChannels = compactBuffer_ ? compactBuffer_->getNumberOfChannels()
+                                         : audioBuffer_->getNumberOfChannels();
+  return { static_cast<int>(numberOfChannels) };
+}
+
+JSI_PROPERTY_GETTER_IMPL(AudioBufferHostObject, storageFormat) {
+  auto format = compactBuffer_ ? compactBuffer_->getFormat() : SampleFormat::FLOAT32;
+  return jsi::String::createFromUtf8(runtime, js_enum_parser::sampleFormatToString(format));
 }
 
 JSI_HOST_FUNCTION_IMPL(AudioBufferHostObject, getChannelData) {
+  // compact samples have no float view, and the view of a shared buffer could be written to
+  materialize();
+  detachSharedBuffer();
+
   auto channel = static_cast<int>(args[0].getNumber());
   auto audioArrayBuffer = audioBuffer_->getSharedChannel(channel);
   auto arrayBuffer = jsi::ArrayBuffer(runtime, audioArrayBuffer);
@@ -62,6 +109,14 @@ JSI_HOST_FUNCTION_IMPL(AudioBufferHostObject, copyFromChannel) {
   auto channelNumber = static_cast<int>(args[1].getNumber());
   auto startInChannel = static_cast<size_t>(args[2].getNumber());
 
+  if (compactBuffer_) {
+    auto size = compactBuffer_->getSize();
+    auto available = size - std::min(startInChannel, size);
+    compactBuffer_->copyChannelTo(
+        channelNumber, destination, startInChannel, std::min(length, available));
+    return jsi::Value::undefined();
+  }
+
   audioBuffer_->getChannel(channelNumber)->copyTo(destination, startInChannel, 0, length);
 
   return jsi::Value::undefined();
@@ -75,9 +130,30 @@ JSI_HOST_FUNCTION_IMPL(AudioBufferHostObject, copyToChannel) {
   auto channelNumber = static_cast<int>(args[1].getNumber());
   auto startInChannel = static_cast<size_t>(args[2].getNumber());
 
+  materialize();
+  detachSharedBuffer();
   audioBuffer_->getChannel(channelNumber)->copy(source, 0, startInChannel, length);
 
   return jsi::Value::undefined();
 }
 
+JSI_HOST_FUNCTION_IMPL(AudioBufferHostObject, setStorageFormat) {
+  auto format = js_enum_parser::sampleFormatFromString(args[0].asString(runtime).utf8(runtime));
+  auto currentFormat = compactBuffer_ ? compactBuffer_->getFormat() : SampleFormat::FLOAT32;
+
+  if (format == currentFormat) {
+    return jsi::Value::undefined();
+  }
+
+  materialize();
+  if (format != SampleFormat::FLOAT32) {
+    // a shared buffer is left to its other owners
+    compactBuffer_ = std::make_shared<CompactAudioBuffer>(*audioBuffer_, format);
+    audioBuffer_.reset();
+    isShared_ = false;
+  }
+
+  return jsi::Value::undefined();
+}
+
 } // namespace audioapi
@@ -2,6 +2,8 @@
 
 #include <audioapi/jsi/JsiHostObject.h>
 #include <audioapi/utils/AudioBuffer.h>
+#include <audioapi/utils/CompactAudioBuffer.h>
+#include <audioapi/utils/PagedAudioFile.h>
 
 #include <jsi/jsi.h>
 #include <cstddef>
@@ -14,9 +16,17 @@ using namespace facebook;
 
 class AudioBufferHostObject : public JsiHostObject {
  public:
+  // exactly one of them is set, depending on the storage format
   std::shared_ptr<AudioBuffer> audioBuffer_;
+  std::shared_ptr<CompactAudioBuffer> compactBuffer_;
 
-  explicit AudioBufferHostObject(const std::shared_ptr<AudioBuffer> &audioBuffer);
+  /// @param isShared The buffer is shared with other owners, like the decoded audio cache,
+  /// and is copied before the first getChannelData or copyToChannel, so writes never reach
+  /// the other owners.
+  explicit AudioBufferHostObject(
+      const std::shared_ptr<AudioBuffer> &audioBuffer,
+      bool isShared = false);
+  explicit AudioBufferHostObject(const std::shared_ptr<CompactAudioBuffer> &compactBuffer);
   AudioBufferHostObject(const AudioBufferHostObject &) = delete;
   AudioBufferHostObject &operator=(const AudioBufferHostObject &) = delete;
   AudioBufferHostObject(AudioBufferHostObject &&other) noexcept;
@@ -24,11 +34,20 @@ class AudioBufferHostObject : public JsiHostObject {
     if (this != &other) {
       JsiHostObject::operator=(std::move(other));
       audioBuffer_ = std::move(other.audioBuffer_);
+      compactBuffer_ = std::move(other.compactBuffer_);
+      isShared_ = other.isShared_;
     }
     return *this;
   }
 
   [[nodiscard]] inline size_t getSizeInBytes() const {
+    if (compactBuffer_) {
+      return compactBuffer_->getSizeInBytes();
+    }
+    // only a window of a paged buffer is kept in memory
+    if (const auto &pagedFile = audioBuffer_->getPagedFile()) {
+      return pagedFile->getMaxResidentSizeInBytes();
+    }
     return audioBuffer_->getSize() * audioBuffer_->getNumberOfChannels() * sizeof(float);
   }
 
@@ -36,9 +55,22 @@ class AudioBufferHostObject : public JsiHostObject {
   JSI_PROPERTY_GETTER_DECL(length);
   JSI_PROPERTY_GETTER_DECL(duration);
   JSI_PROPERTY_GETTER_DECL(numberOfChannels);
+  JSI_PROPERTY_GETTER_DECL(storageFormat);
 
   JSI_HOST_FUNCTION_DECL(getChannelData);
   JSI_HOST_FUNCTION_DECL(copyFromChannel);
   JSI_HOST_FUNCTION_DECL(copyToChannel);
+  JSI_HOST_FUNCTION_DECL(setStorageFormat);
+
+  /// @brief The audio as a float buffer, converted from compact storage if needed.
+  /// @note Compact audio is converted into a new buffer, the storage format is kept.
+  [[nodiscard]] std::shared_ptr<AudioBuffer> getAudioBuffer() const;
+
+ private:
+  bool isShared_;
+
+  void detachSharedBuffer();
+  /// @brief Switches compact storage back to a float buffer JS can write to.
+  void materialize();
 };
 } // namespace audioapi
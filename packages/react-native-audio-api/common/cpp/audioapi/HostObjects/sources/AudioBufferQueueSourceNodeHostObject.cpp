@@ -69,7 +69,9 @@ JSI_HOST_FUNCTION_IMPL(AudioBufferQueueSourceNodeHostObject, enqueueBuffer) {
   auto audioBufferHostObject =
       args[0].getObject(runtime).asHostObject<AudioBufferHostObject>(runtime);
 
-  auto bufferId = audioBufferQueueSourceNode->enqueueBuffer(audioBufferHostObject->audioBuffer_);
+  auto bufferId = audioBufferHostObject->compactBuffer_
+      ? audioBufferQueueSourceNode->enqueueBuffer(audioBufferHostObject->compactBuffer_)
+      : audioBufferQueueSourceNode->enqueueBuffer(audioBufferHostObject->audioBuffer_);
 
   return jsi::String::createFromUtf8(runtime, bufferId);
 }
@@ -57,13 +57,16 @@ JSI_PROPERTY_GETTER_IMPL(AudioBufferSourceNodeHostObject, loopSkip) {
 
 JSI_PROPERTY_GETTER_IMPL(AudioBufferSourceNodeHostObject, buffer) {
   auto audioBufferSourceNode = std::static_pointer_cast<AudioBufferSourceNode>(node_);
-  auto buffer = audioBufferSourceNode->getBuffer();
+  std::shared_ptr<AudioBufferHostObject> bufferHostObject;
 
-  if (!buffer) {
+  if (auto compactBuffer = audioBufferSourceNode->getCompactBuffer()) {
+    bufferHostObject = std::make_shared<AudioBufferHostObject>(compactBuffer);
+  } else if (auto buffer = audioBufferSourceNode->getBuffer()) {
+    bufferHostObject = std::make_shared<AudioBufferHostObject>(buffer);
+  } else {
     return jsi::Value::null();
   }
 
-  auto bufferHostObject = std::make_shared<AudioBufferHostObject>(buffer);
   auto jsiObject = jsi::Object::createFromHostObject(runtime, bufferHostObject);
   jsiObject.setExternalMemoryPressure(runtime, bufferHostObject->getSizeInBytes() + 16);
   return jsiObject;
@@ -137,7 +140,11 @@ JSI_HOST_FUNCTION_IMPL(AudioBufferSourceNodeHostObject, setBuffer) {
   auto bufferHostObject = args[0].getObject(runtime).asHostObject<AudioBufferHostObject>(runtime);
   thisValue.asObject(runtime).setExternalMemoryPressure(
       runtime, bufferHostObject->getSizeInBytes() + 16);
-  audioBufferSourceNode->setBuffer(bufferHostObject->audioBuffer_);
+  if (bufferHostObject->compactBuffer_) {
+    audioBufferSourceNode->setBuffer(bufferHostObject->compactBuffer_);
+  } else {
+    audioBufferSourceNode->setBuffer(bufferHostObject->audioBuffer_);
+  }
   return jsi::Value::undefined();
 }
 
@@ -0,0 +1,32 @@
+#include <audioapi/HostObjects/sources/RecorderAdapterNodeHostObject.h>
+
+#include <audioapi/core/sources/RecorderAdapterNode.h>
+#include <memory>
+
+namespace audioapi {
+
+RecorderAdapterNodeHostObject::RecorderAdapterNodeHostObject(
+    const std::shared_ptr<RecorderAdapterNode> &node,
+    float sampleRate)
+    : AudioNodeHostObject(node), sampleRate_(sampleRate) {
+  addFunctions(JSI_EXPORT_FUNCTION(RecorderAdapterNodeHostObject, getStats));
+}
+
+JSI_HOST_FUNCTION_IMPL(RecorderAdapterNodeHostObject, getStats) {
+  auto recorderAdapterNode = std::static_pointer_cast<RecorderAdapterNode>(node_);
+  auto stats = recorderAdapterNode->getBufferStats();
+
+  auto toDuration = [this](uint64_t frames) {
+    return static_cast<double>(frames) / sampleRate_;
+  };
+
+  auto jsStats = jsi::Object(runtime);
+  jsStats.setProperty(runtime, "bufferedDuration", toDuration(stats.availableFrames));
+  jsStats.setProperty(runtime, "recordedDuration", toDuration(stats.writtenFrames));
+  jsStats.setProperty(runtime, "playedDuration", toDuration(stats.readFrames));
+  jsStats.setProperty(runtime, "overflowDuration", toDuration(stats.overflowFrames));
+  jsStats.setProperty(runtime, "underflowDuration", toDuration(stats.underflowFrames));
+  return jsStats;
+}
+
+} // namespace audioapi
@@ -14,11 +14,16 @@ class AudioRecorderHostObject;
 
 class RecorderAdapterNodeHostObject : public AudioNodeHostObject {
  public:
-  explicit RecorderAdapterNodeHostObject(const std::shared_ptr<RecorderAdapterNode> &node)
-      : AudioNodeHostObject(node) {}
+  explicit RecorderAdapterNodeHostObject(
+      const std::shared_ptr<RecorderAdapterNode> &node,
+      float sampleRate);
+
+  JSI_HOST_FUNCTION_DECL(getStats);
 
  private:
   friend class AudioRecorderHostObject;
+
+  float sampleRate_;
 };
 
 } // namespace audioapi
@@ -12,8 +12,12 @@ namespace audioapi {
 StreamerNodeHostObject::StreamerNodeHostObject(
     const std::shared_ptr<BaseAudioContext> &context,
     const StreamerOptions &options)
-    : AudioScheduledSourceNodeHostObject(context->createStreamer(options), options) {
-  addFunctions(JSI_EXPORT_FUNCTION(StreamerNodeHostObject, initialize));
+    : AudioScheduledSourceNodeHostObject(context->createStreamer(options), options),
+      sampleRate_(context->getSampleRate()) {
+  addFunctions(
+      JSI_EXPORT_FUNCTION(StreamerNodeHostObject, initialize),
+      JSI_EXPORT_FUNCTION(StreamerNodeHostObject, getStats),
+      JSI_EXPORT_FUNCTION(StreamerNodeHostObject, seek));
   addGetters(JSI_EXPORT_PROPERTY_GETTER(StreamerNodeHostObject, streamPath));
 }
 
@@ -33,4 +37,24 @@ JSI_HOST_FUNCTION_IMPL(StreamerNodeHostObject, initialize) {
 #endif
 }
 
+JSI_HOST_FUNCTION_IMPL(StreamerNodeHostObject, getStats) {
+  auto streamerNode = std::static_pointer_cast<StreamerNode>(node_);
+  auto stats = streamerNode->getStats();
+
+  auto jsStats = jsi::Object(runtime);
+  jsStats.setProperty(
+      runtime, "bufferedDuration", static_cast<double>(stats.bufferedFrames) / sampleRate_);
+  jsStats.setProperty(runtime, "underrunCount", static_cast<double>(stats.underruns));
+  jsStats.setProperty(
+      runtime, "underrunDuration", static_cast<double>(stats.underrunFrames) / sampleRate_);
+  jsStats.setProperty(runtime, "isBuffering", stats.isBuffering);
+  return jsStats;
+}
+
+JSI_HOST_FUNCTION_IMPL(StreamerNodeHostObject, seek) {
+  auto streamerNode = std::static_pointer_cast<StreamerNode>(node_);
+  streamerNode->seek(args[0].getNumber());
+  return jsi::Value::undefined();
+}
+
 } // namespace audioapi
@@ -24,8 +24,11 @@ class StreamerNodeHostObject : public AudioScheduledSourceNodeHostObject {
 
   JSI_PROPERTY_GETTER_DECL(streamPath);
   JSI_HOST_FUNCTION_DECL(initialize);
+  JSI_HOST_FUNCTION_DECL(getStats);
+  JSI_HOST_FUNCTION_DECL(seek);
 
  private:
   static constexpr size_t SIZE = 4'000'000; // 4MB
+  float sampleRate_;
 };
 } // namespace audioapi
@@ -0,0 +1,27 @@
+#include <audioapi/HostObjects/sources/WorkletSourceNodeHostObject.h>
+
+#include <audioapi/core/sources/WorkletSourceNode.h>
+#include <memory>
+
+namespace audioapi {
+
+WorkletSourceNodeHostObject::WorkletSourceNodeHostObject(
+    const std::shared_ptr<WorkletSourceNode> &node,
+    float sampleRate)
+    : AudioScheduledSourceNodeHostObject(node), sampleRate_(sampleRate) {
+  addFunctions(JSI_EXPORT_FUNCTION(WorkletSourceNodeHostObject, getStats));
+}
+
+JSI_HOST_FUNCTION_IMPL(WorkletSourceNodeHostObject, getStats) {
+  auto workletSourceNode = std::static_pointer_cast<WorkletSourceNode>(node_);
+  auto stats = workletSourceNode->getLookaheadStats();
+
+  auto jsStats = jsi::Object(runtime);
+  jsStats.setProperty(runtime, "latency", static_cast<double>(stats.latencyFrames) / sampleRate_);
+  jsStats.setProperty(runtime, "underrunCount", static_cast<double>(stats.underruns));
+  jsStats.setProperty(runtime, "renderedBlockCount", static_cast<double>(stats.renderedBlocks));
+  jsStats.setProperty(runtime, "skippedBlockCount", static_cast<double>(stats.skippedBlocks));
+  return jsStats;
+}
+
+} // namespace audioapi
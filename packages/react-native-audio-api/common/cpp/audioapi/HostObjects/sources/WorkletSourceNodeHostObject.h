@@ -11,7 +11,13 @@ using namespace facebook;
 
 class WorkletSourceNodeHostObject : public AudioScheduledSourceNodeHostObject {
  public:
-  explicit WorkletSourceNodeHostObject(const std::shared_ptr<WorkletSourceNode> &node)
-      : AudioScheduledSourceNodeHostObject(node) {}
+  explicit WorkletSourceNodeHostObject(
+      const std::shared_ptr<WorkletSourceNode> &node,
+      float sampleRate);
+
+  JSI_HOST_FUNCTION_DECL(getStats);
+
+ private:
+  float sampleRate_;
 };
 } // namespace audioapi
@@ -1,23 +1,64 @@
 #include <audioapi/HostObjects/sources/AudioBufferHostObject.h>
 #include <audioapi/HostObjects/utils/AudioDecoderHostObject.h>
 #include <audioapi/core/utils/AudioDecoder.h>
+#include <audioapi/core/utils/Constants.h>
+#include <audioapi/core/utils/DecodedAudioCache.h>
+#include <audioapi/core/utils/ParallelAudioDecoder.h>
 #include <audioapi/jsi/JsiPromise.h>
 
 #include <jsi/jsi.h>
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <thread>
 #include <utility>
 
 namespace audioapi {
+
+namespace {
+
+std::shared_ptr<DecodedAudioCache> getDecodedAudioCache() {
+  // shared by every decoder, so cached audio outlives the screens creating decoders
+  static auto cache =
+      std::make_shared<DecodedAudioCache>(DECODED_AUDIO_CACHE_DEFAULT_BUDGET_IN_BYTES);
+  return cache;
+}
+
+void settlePromise(
+    const Promise &promise,
+    const std::shared_ptr<AudioBuffer> &buffer,
+    const std::string &errorMessage,
+    bool isShared) {
+  if (!buffer) {
+    promise.reject(errorMessage);
+    return;
+  }
+
+  // buffers held by the cache or other callers are copied before JS writes to them
+  auto audioBufferHostObject = std::make_shared<AudioBufferHostObject>(buffer, isShared);
+  promise.resolve([audioBufferHostObject = std::move(audioBufferHostObject)](
+                      jsi::Runtime &runtime) -> jsi::Value {
+    auto jsiObject = jsi::Object::createFromHostObject(runtime, audioBufferHostObject);
+    jsiObject.setExternalMemoryPressure(runtime, audioBufferHostObject->getSizeInBytes());
+    return jsiObject;
+  });
+}
+
+} // namespace
+
 AudioDecoderHostObject::AudioDecoderHostObject(
     jsi::Runtime *runtime,
-    const std::shared_ptr<react::CallInvoker> &callInvoker) {
+    const std::shared_ptr<react::CallInvoker> &callInvoker)
+    : cache_(getDecodedAudioCache()) {
   promiseVendor_ = std::make_shared<PromiseVendor>(runtime, callInvoker);
   addFunctions(
       JSI_EXPORT_FUNCTION(AudioDecoderHostObject, decodeWithPCMInBase64),
       JSI_EXPORT_FUNCTION(AudioDecoderHostObject, decodeWithFilePath),
-      JSI_EXPORT_FUNCTION(AudioDecoderHostObject, decodeWithMemoryBlock));
+      JSI_EXPORT_FUNCTION(AudioDecoderHostObject, decodeWithFilePathPaged),
+      JSI_EXPORT_FUNCTION(AudioDecoderHostObject, decodeWithMemoryBlock),
+      JSI_EXPORT_FUNCTION(AudioDecoderHostObject, getCacheStats),
+      JSI_EXPORT_FUNCTION(AudioDecoderHostObject, setCacheBudget),
+      JSI_EXPORT_FUNCTION(AudioDecoderHostObject, clearCache));
 }
 
 JSI_HOST_FUNCTION_IMPL(AudioDecoderHostObject, decodeWithMemoryBlock) {
@@ -28,53 +69,135 @@ JSI_HOST_FUNCTION_IMPL(AudioDecoderHostObject, decodeWithMemoryBlock) {
 
   auto sampleRate = args[1].getNumber();
 
-  auto promise = promiseVendor_->createAsyncPromise([data, size, sampleRate]() -> PromiseResolver {
-    auto result = AudioDecoder::decodeWithMemoryBlock(data, size, sampleRate);
+  auto promise = promiseVendor_->createAsyncPromise(
+      [cache = cache_, data, size, sampleRate](Promise &&promise) {
+        static const std::string errorMessage = "Failed to decode audio data.";
 
-    if (!result) {
-      return [](jsi::Runtime &runtime) -> std::variant<jsi::Value, std::string> {
-        return std::string("Failed to decode audio data.");
-      };
-    }
+        // hashing the encoded bytes is done off the JS thread as well
+        auto key = DecodedAudioCache::makeMemoryKey(data, size, static_cast<float>(sampleRate));
+        auto lookup = cache->lookup(key);
 
-    auto audioBufferHostObject = std::make_shared<AudioBufferHostObject>(result);
+        if (lookup.buffer) {
+          settlePromise(promise, lookup.buffer, errorMessage, true);
+          return;
+        }
 
-    return [audioBufferHostObject = std::move(audioBufferHostObject)](
-               jsi::Runtime &runtime) -> std::variant<jsi::Value, std::string> {
-      auto jsiObject = jsi::Object::createFromHostObject(runtime, audioBufferHostObject);
-      jsiObject.setExternalMemoryPressure(runtime, audioBufferHostObject->getSizeInBytes());
-      return jsiObject;
-    };
-  });
+        if (lookup.pending) {
+          lookup.pending->then([promise](const std::shared_ptr<AudioBuffer> &buffer) {
+            settlePromise(promise, buffer, errorMessage, true);
+          });
+          return;
+        }
+
+        auto result = AudioDecoder::decodeWithMemoryBlock(data, size, sampleRate);
+        auto isShared = cache->complete(key, result);
+        settlePromise(promise, result, errorMessage, isShared);
+      },
+      TaskPriority::BULK);
   return promise;
 }
 
 JSI_HOST_FUNCTION_IMPL(AudioDecoderHostObject, decodeWithFilePath) {
+  static const std::string errorMessage = "Failed to decode audio data source.";
+
   auto sourcePath = args[0].getString(runtime).utf8(runtime);
   auto sampleRate = args[1].getNumber();
 
-  auto promise = promiseVendor_->createAsyncPromise([sourcePath, sampleRate]() -> PromiseResolver {
-    auto result = AudioDecoder::decodeWithFilePath(sourcePath, sampleRate);
+  auto key = DecodedAudioCache::makeFileKey(sourcePath, static_cast<float>(sampleRate));
+  auto lookup = cache_->lookup(key);
 
-    if (!result) {
-      return [](jsi::Runtime &runtime) -> std::variant<jsi::Value, std::string> {
-        return std::string("Failed to decode audio data source.");
-      };
-    }
+  // cached or already being decoded by another call, nothing to decode
+  if (!lookup.isOwner) {
+    return promiseVendor_->createAsyncPromise([lookup = std::move(lookup)](Promise &&promise) {
+      if (lookup.buffer) {
+        settlePromise(promise, lookup.buffer, errorMessage, true);
+        return;
+      }
 
-    auto audioBufferHostObject = std::make_shared<AudioBufferHostObject>(result);
+      lookup.pending->then([promise](const std::shared_ptr<AudioBuffer> &buffer) {
+        settlePromise(promise, buffer, errorMessage, true);
+      });
+    });
+  }
+
+  // long seekable files are split into ranges decoded on the workers of the pool,
+  // anything else is decoded sequentially once every part has returned
+  auto parallelDecoder = std::make_shared<ParallelAudioDecoder>(
+      sourcePath, static_cast<float>(sampleRate), PROMISE_VENDOR_THREAD_POOL_WORKER_COUNT);
+
+  auto promise = promiseVendor_->createParallelAsyncPromise(
+      // probed on a worker, short and unsupported files are not split at all
+      [parallelDecoder]() { return parallelDecoder->split(); },
+      [parallelDecoder](size_t part) { parallelDecoder->decodePart(part); },
+      [cache = cache_, key, parallelDecoder, sourcePath, sampleRate]() -> PromiseResolver {
+        auto result = parallelDecoder->getResult();
+        if (!result) {
+          result = AudioDecoder::decodeWithFilePath(sourcePath, sampleRate);
+        }
+        auto isShared = cache->complete(key, result);
 
-    return [audioBufferHostObject = std::move(audioBufferHostObject)](
-               jsi::Runtime &runtime) -> std::variant<jsi::Value, std::string> {
-      auto jsiObject = jsi::Object::createFromHostObject(runtime, audioBufferHostObject);
-      jsiObject.setExternalMemoryPressure(runtime, audioBufferHostObject->getSizeInBytes());
-      return jsiObject;
-    };
-  });
+        if (!result) {
+          return [](jsi::Runtime &runtime) -> std::variant<jsi::Value, std::string> {
+            return errorMessage;
+          };
+        }
 
+        auto audioBufferHostObject = std::make_shared<AudioBufferHostObject>(result, isShared);
+
+        return [audioBufferHostObject = std::move(audioBufferHostObject)](
+                   jsi::Runtime &runtime) -> std::variant<jsi::Value, std::string> {
+          auto jsiObject = jsi::Object::createFromHostObject(runtime, audioBufferHostObject);
+          jsiObject.setExternalMemoryPressure(runtime, audioBufferHostObject->getSizeInBytes());
+          return jsiObject;
+        };
+      },
+      TaskPriority::BULK);
+
+  return promise;
+}
+
+JSI_HOST_FUNCTION_IMPL(AudioDecoderHostObject, decodeWithFilePathPaged) {
+  auto sourcePath = args[0].getString(runtime).utf8(runtime);
+  auto sampleRate = args[1].getNumber();
+  // platform directories are looked up on the JS thread
+  auto directory = AudioDecoder::getPagedFileDirectory();
+
+  // paged buffers hold little memory, so they bypass the decoded audio cache and are never
+  // shared, a copy on write would pull the whole file into memory
+  auto promise = promiseVendor_->createAsyncPromise(
+      [sourcePath, sampleRate, directory](Promise &&promise) {
+        auto result = AudioDecoder::decodeWithFilePath(sourcePath, sampleRate, directory);
+        settlePromise(promise, result, "Failed to decode audio data source.", false);
+      },
+      TaskPriority::BULK);
   return promise;
 }
 
+JSI_HOST_FUNCTION_IMPL(AudioDecoderHostObject, getCacheStats) {
+  auto stats = cache_->getStats();
+
+  auto jsStats = jsi::Object(runtime);
+  jsStats.setProperty(runtime, "hits", static_cast<double>(stats.hits));
+  jsStats.setProperty(runtime, "misses", static_cast<double>(stats.misses));
+  jsStats.setProperty(runtime, "inFlightJoins", static_cast<double>(stats.inFlightJoins));
+  jsStats.setProperty(runtime, "evictions", static_cast<double>(stats.evictions));
+  jsStats.setProperty(runtime, "entries", static_cast<double>(stats.entries));
+  jsStats.setProperty(runtime, "sizeInBytes", static_cast<double>(stats.sizeInBytes));
+  jsStats.setProperty(runtime, "budgetInBytes", static_cast<double>(stats.budgetInBytes));
+  return jsStats;
+}
+
+JSI_HOST_FUNCTION_IMPL(AudioDecoderHostObject, setCacheBudget) {
+  auto budgetInBytes = static_cast<size_t>(std::max(args[0].getNumber(), 0.0));
+  cache_->setBudget(budgetInBytes);
+  return jsi::Value::undefined();
+}
+
+JSI_HOST_FUNCTION_IMPL(AudioDecoderHostObject, clearCache) {
+  cache_->clear();
+  return jsi::Value::undefined();
+}
+
 JSI_HOST_FUNCTION_IMPL(AudioDecoderHostObject, decodeWithPCMInBase64) {
   auto b64 = args[0].getString(runtime).utf8(runtime);
   auto inputSampleRate = args[1].getNumber();
@@ -100,7 +223,8 @@ JSI_HOST_FUNCTION_IMPL(AudioDecoderHostObject, decodeWithPCMInBase64) {
           jsiObject.setExternalMemoryPressure(runtime, audioBufferHostObject->getSizeInBytes());
           return jsiObject;
         };
-      });
+      },
+      TaskPriority::BULK);
 
   return promise;
 }
@@ -2,6 +2,7 @@
 
 #include <audioapi/HostObjects/sources/AudioBufferHostObject.h>
 #include <audioapi/core/utils/AudioDecoder.h>
+#include <audioapi/core/utils/DecodedAudioCache.h>
 #include <audioapi/jsi/JsiPromise.h>
 
 #include <jsi/jsi.h>
@@ -20,9 +21,14 @@ class AudioDecoderHostObject : public JsiHostObject {
       const std::shared_ptr<react::CallInvoker> &callInvoker);
   JSI_HOST_FUNCTION_DECL(decodeWithMemoryBlock);
   JSI_HOST_FUNCTION_DECL(decodeWithFilePath);
+  JSI_HOST_FUNCTION_DECL(decodeWithFilePathPaged);
   JSI_HOST_FUNCTION_DECL(decodeWithPCMInBase64);
+  JSI_HOST_FUNCTION_DECL(getCacheStats);
+  JSI_HOST_FUNCTION_DECL(setCacheBudget);
+  JSI_HOST_FUNCTION_DECL(clearCache);
 
  private:
   std::shared_ptr<PromiseVendor> promiseVendor_;
+  std::shared_ptr<DecodedAudioCache> cache_;
 };
 } // namespace audioapi
@@ -13,29 +13,89 @@ namespace audioapi {
 
 AudioStretcherHostObject::AudioStretcherHostObject(
     jsi::Runtime *runtime,
-    const std::shared_ptr<react::CallInvoker> &callInvoker) {
+    const std::shared_ptr<react::CallInvoker> &callInvoker)
+    : callInvoker_(callInvoker), jobs_(std::make_shared<Jobs>()) {
   promiseVendor_ = std::make_shared<PromiseVendor>(runtime, callInvoker);
-  addFunctions(JSI_EXPORT_FUNCTION(AudioStretcherHostObject, changePlaybackSpeed));
+  addFunctions(
+      JSI_EXPORT_FUNCTION(AudioStretcherHostObject, changePlaybackSpeed),
+      JSI_EXPORT_FUNCTION(AudioStretcherHostObject, cancel));
 }
 
 JSI_HOST_FUNCTION_IMPL(AudioStretcherHostObject, changePlaybackSpeed) {
-  auto audioBuffer = args[0].getObject(runtime).asHostObject<AudioBufferHostObject>(runtime);
+  auto audioBuffer =
+      args[0].getObject(runtime).asHostObject<AudioBufferHostObject>(runtime)->getAudioBuffer();
   auto playbackSpeed = static_cast<float>(args[1].asNumber());
+  auto jobId = static_cast<uint64_t>(args[3].asNumber());
 
-  auto promise = promiseVendor_->createAsyncPromise([=]() -> PromiseResolver {
-    auto result = AudioStretcher::changePlaybackSpeed(*audioBuffer->audioBuffer_, playbackSpeed);
+  auto cancelled = std::make_shared<std::atomic<bool>>(false);
+  Job job{.cancelled = cancelled};
+  bool hasProgress = args[2].isObject() && args[2].getObject(runtime).isFunction(runtime);
+  if (hasProgress) {
+    job.onProgress = args[2].getObject(runtime).getFunction(runtime);
+  }
+  jobs_->insert_or_assign(jobId, std::move(job));
 
-    if (result == nullptr) {
-      return [](jsi::Runtime &runtime) {
-        return std::string("Failed to change audio playback speed.");
-      };
-    }
-    return [result](jsi::Runtime &runtime) {
-      auto audioBufferHostObject = std::make_shared<AudioBufferHostObject>(result);
-      return jsi::Object::createFromHostObject(runtime, audioBufferHostObject);
-    };
-  });
+  auto callInvoker = callInvoker_;
+  std::weak_ptr<Jobs> weakJobs = jobs_;
+
+  auto promise = promiseVendor_->createAsyncPromise(
+      [=]() -> PromiseResolver {
+        float lastReportedProgress = 0.0f;
+        // only the progress value crosses over, the callback is looked up on the JS thread
+        auto reportProgress = [&](float progress) {
+          if (!hasProgress ||
+              (progress - lastReportedProgress < kProgressStep && progress < 1.0f)) {
+            return;
+          }
+
+          lastReportedProgress = progress;
+          callInvoker->invokeAsync([weakJobs, jobId, progress](jsi::Runtime &runtime) {
+            auto jobs = weakJobs.lock();
+            if (jobs == nullptr) {
+              return;
+            }
+            auto it = jobs->find(jobId);
+            if (it != jobs->end() && it->second.onProgress.has_value()) {
+              it->second.onProgress->call(runtime, static_cast<double>(progress));
+            }
+          });
+        };
+        auto isCancelled = [&]() { return cancelled->load(std::memory_order_acquire); };
+
+        auto result = AudioStretcher::changePlaybackSpeed(
+            *audioBuffer, playbackSpeed, reportProgress, isCancelled);
+
+        return [result, weakJobs, jobId](
+                   jsi::Runtime &runtime) -> std::variant<jsi::Value, std::string> {
+          if (auto jobs = weakJobs.lock()) {
+            jobs->erase(jobId);
+          }
+
+          if (result == nullptr) {
+            return std::string("Playback speed change was cancelled.");
+          }
+          auto audioBufferHostObject = std::make_shared<AudioBufferHostObject>(result);
+          return jsi::Object::createFromHostObject(runtime, audioBufferHostObject);
+        };
+      },
+      TaskPriority::BULK);
   return promise;
 }
 
+JSI_HOST_FUNCTION_IMPL(AudioStretcherHostObject, cancel) {
+  // without an id every job in flight is cancelled
+  if (count == 0 || args[0].isUndefined()) {
+    for (auto &[jobId, job] : *jobs_) {
+      job.cancelled->store(true, std::memory_order_release);
+    }
+    return jsi::Value::undefined();
+  }
+
+  auto it = jobs_->find(static_cast<uint64_t>(args[0].asNumber()));
+  if (it != jobs_->end()) {
+    it->second.cancelled->store(true, std::memory_order_release);
+  }
+  return jsi::Value::undefined();
+}
+
 } // namespace audioapi
@@ -5,9 +5,13 @@
 #include <audioapi/jsi/JsiPromise.h>
 
 #include <jsi/jsi.h>
+#include <atomic>
+#include <cstdint>
 #include <memory>
+#include <optional>
 #include <string>
 #include <thread>
+#include <unordered_map>
 #include <utility>
 
 namespace audioapi {
@@ -19,8 +23,24 @@ class AudioStretcherHostObject : public JsiHostObject {
       jsi::Runtime *runtime,
       const std::shared_ptr<react::CallInvoker> &callInvoker);
   JSI_HOST_FUNCTION_DECL(changePlaybackSpeed);
+  JSI_HOST_FUNCTION_DECL(cancel);
 
  private:
+  struct Job {
+    // set by cancel, the job stops at the next chunk
+    std::shared_ptr<std::atomic<bool>> cancelled;
+    std::optional<jsi::Function> onProgress;
+  };
+  // jobs in flight by the id JS started them with, only touched on the JS thread, so the
+  // progress callbacks are never released on a worker
+  using Jobs = std::unordered_map<uint64_t, Job>;
+
+  // progress is reported to JS at most once per this fraction of the input
+  static constexpr float kProgressStep = 0.01f;
+
   std::shared_ptr<PromiseVendor> promiseVendor_;
+  std::shared_ptr<react::CallInvoker> callInvoker_;
+  // the workers hold it weakly, so it is always destroyed with the host object on the JS thread
+  std::shared_ptr<Jobs> jobs_;
 };
 } // namespace audioapi
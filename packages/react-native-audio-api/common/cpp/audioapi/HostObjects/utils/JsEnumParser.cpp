@@ -175,6 +175,59 @@ namespace audioapi::js_enum_parser {
     throw std::invalid_argument("Unknown audio event: " + event);
   }
 
+  std::string audioEventToString(AudioEvent event) {
+    switch (event) {
+      case AudioEvent::PLAYBACK_NOTIFICATION_PLAY:
+        return "playbackNotificationPlay";
+      case AudioEvent::PLAYBACK_NOTIFICATION_PAUSE:
+        return "playbackNotificationPause";
+      case AudioEvent::PLAYBACK_NOTIFICATION_STOP:
+        return "playbackNotificationStop";
+      case AudioEvent::PLAYBACK_NOTIFICATION_NEXT_TRACK:
+        return "playbackNotificationNextTrack";
+      case AudioEvent::PLAYBACK_NOTIFICATION_PREVIOUS_TRACK:
+        return "playbackNotificationPreviousTrack";
+      case AudioEvent::PLAYBACK_NOTIFICATION_SKIP_FORWARD:
+        return "playbackNotificationSkipForward";
+      case AudioEvent::PLAYBACK_NOTIFICATION_SKIP_BACKWARD:
+        return "playbackNotificationSkipBackward";
+      case AudioEvent::PLAYBACK_NOTIFICATION_SEEK_FORWARD:
+        return "playbackNotificationSeekForward";
+      case AudioEvent::PLAYBACK_NOTIFICATION_SEEK_BACKWARD:
+        return "playbackNotificationSeekBackward";
+      case AudioEvent::PLAYBACK_NOTIFICATION_SEEK_TO:
+        return "playbackNotificationSeekTo";
+      case AudioEvent::PLAYBACK_NOTIFICATION_DISMISSED:
+        return "playbackNotificationDismissed";
+      case AudioEvent::RECORDING_NOTIFICATION_RESUME:
+        return "recordingNotificationResume";
+      case AudioEvent::RECORDING_NOTIFICATION_PAUSE:
+        return "recordingNotificationPause";
+      case AudioEvent::ROUTE_CHANGE:
+        return "routeChange";
+      case AudioEvent::INTERRUPTION:
+        return "interruption";
+      case AudioEvent::VOLUME_CHANGE:
+        return "volumeChange";
+      case AudioEvent::DUCK:
+        return "duck";
+      case AudioEvent::ENDED:
+        return "ended";
+      case AudioEvent::LOOP_ENDED:
+        return "loopEnded";
+      case AudioEvent::AUDIO_READY:
+        return "audioReady";
+      case AudioEvent::POSITION_CHANGED:
+        return "positionChanged";
+      case AudioEvent::BUFFER_ENDED:
+        return "bufferEnded";
+      case AudioEvent::RECORDER_ERROR:
+        return "recorderError";
+      default:
+        throw std::invalid_argument("Unknown audio event");
+    }
+  }
+
   std::string contextStateToString(ContextState state) {
     switch (state) {
       case ContextState::SUSPENDED:
@@ -211,4 +264,37 @@ namespace audioapi::js_enum_parser {
                 throw std::invalid_argument("Unknown channel interpretation");
         }
     }
+
+  SampleFormat sampleFormatFromString(const std::string &format) {
+    if (format == "float32")
+      return SampleFormat::FLOAT32;
+    if (format == "int16")
+      return SampleFormat::INT16;
+    if (format == "float16")
+      return SampleFormat::FLOAT16;
+
+    throw std::invalid_argument("Unknown storage format: " + format);
+  }
+
+  std::string sampleFormatToString(SampleFormat format) {
+    switch (format) {
+      case SampleFormat::FLOAT32:
+        return "float32";
+      case SampleFormat::INT16:
+        return "int16";
+      case SampleFormat::FLOAT16:
+        return "float16";
+      default:
+        throw std::invalid_argument("Unknown storage format");
+    }
+  }
+
+  VoiceType voiceTypeFromString(const std::string &type) {
+    if (type == "oscillator")
+      return VoiceType::OSCILLATOR;
+    if (type == "bufferSource")
+      return VoiceType::BUFFER_SOURCE;
+
+    throw std::invalid_argument("Unknown voice pool node type: " + type);
+  }
 } // namespace audioapi::js_enum_parser
@@ -7,6 +7,8 @@
 #include <audioapi/core/types/ContextState.h>
 #include <audioapi/core/types/OscillatorType.h>
 #include <audioapi/core/types/OverSampleType.h>
+#include <audioapi/core/types/SampleFormat.h>
+#include <audioapi/core/utils/VoicePool.h>
 #include <audioapi/events/AudioEvent.h>
 #include <string>
 
@@ -20,7 +22,11 @@ OscillatorType oscillatorTypeFromString(const std::string &type);
 std::string filterTypeToString(BiquadFilterType type);
 BiquadFilterType filterTypeFromString(const std::string &type);
 AudioEvent audioEventFromString(const std::string &event);
+std::string audioEventToString(AudioEvent event);
 std::string contextStateToString(ContextState state);
 std::string channelCountModeToString(ChannelCountMode mode);
 std::string channelInterpretationToString(ChannelInterpretation interpretation);
+std::string sampleFormatToString(SampleFormat format);
+SampleFormat sampleFormatFromString(const std::string &format);
+VoiceType voiceTypeFromString(const std::string &type);
 } // namespace audioapi::js_enum_parser
@@ -81,7 +81,7 @@ ConvolverOptions parseConvolverOptions(jsi::Runtime &runtime, const jsi::Object
     auto bufferHostObject = optionsObject.getProperty(runtime, "buffer")
                                 .getObject(runtime)
                                 .asHostObject<AudioBufferHostObject>(runtime);
-    options.buffer = bufferHostObject->audioBuffer_;
+    options.buffer = bufferHostObject->getAudioBuffer();
   }
   return options;
 }
@@ -247,6 +247,7 @@ AudioBufferSourceOptions parseAudioBufferSourceOptions(
                                 .getObject(runtime)
                                 .asHostObject<AudioBufferHostObject>(runtime);
     options.buffer = bufferHostObject->audioBuffer_;
+    options.compactBuffer = bufferHostObject->compactBuffer_;
   }
 
   auto loopValue = optionsObject.getProperty(runtime, "loop");
@@ -273,6 +274,16 @@ StreamerOptions parseStreamerOptions(jsi::Runtime &runtime, const jsi::Object &o
     options.streamPath =
         optionsObject.getProperty(runtime, "streamPath").asString(runtime).utf8(runtime);
   }
+
+  auto prebufferDurationValue = optionsObject.getProperty(runtime, "prebufferDuration");
+  if (prebufferDurationValue.isNumber()) {
+    options.prebufferDuration = static_cast<float>(prebufferDurationValue.getNumber());
+  }
+
+  auto lowWaterDurationValue = optionsObject.getProperty(runtime, "lowWaterDuration");
+  if (lowWaterDurationValue.isNumber()) {
+    options.lowWaterDuration = static_cast<float>(lowWaterDurationValue.getNumber());
+  }
   return options;
 }
 
@@ -86,6 +86,12 @@ void AudioNode::disconnect(const std::shared_ptr<AudioParam> &param) {
   }
 }
 
+void AudioNode::release() {
+  if (std::shared_ptr<BaseAudioContext> context = context_.lock()) {
+    context->getGraphManager()->addReleasedNode(shared_from_this());
+  }
+}
+
 bool AudioNode::isEnabled() const {
   return isEnabled_;
 }
@@ -301,6 +307,13 @@ void AudioNode::onInputDisconnected(AudioNode *node) {
   }
 }
 
+void AudioNode::reinitialize() {
+  isInitialized_ = true;
+  isEnabled_ = true;
+  numberOfEnabledInputNodes_ = 0;
+  lastRenderedFrame_ = SIZE_MAX;
+}
+
 void AudioNode::cleanup() {
   isInitialized_ = false;
 
@@ -309,6 +322,13 @@ void AudioNode::cleanup() {
   }
 
   outputNodes_.clear();
+
+  // params keep a raw pointer to the node, which is recycled or destroyed next
+  for (const auto &param : outputParams_) {
+    param->removeInputNode(this);
+  }
+
+  outputParams_.clear();
 }
 
 } // namespace audioapi
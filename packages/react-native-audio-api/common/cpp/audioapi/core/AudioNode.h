@@ -45,6 +45,10 @@ class AudioNode : public std::enable_shared_from_this<AudioNode> {
   void enable();
   virtual void disable();
 
+  /// @brief Tells the graph manager nothing outside the graph holds the node any more,
+  /// so it is checked for destruction right away instead of by the periodic sweep.
+  void release();
+
  protected:
   friend class AudioGraphManager;
   friend class AudioDestinationNode;
@@ -71,6 +75,14 @@ class AudioNode : public std::enable_shared_from_this<AudioNode> {
 
   std::size_t lastRenderedFrame_{SIZE_MAX};
 
+  /// @brief Position of the node in the graph manager's node list, kept by the graph manager
+  /// so a released node is found without scanning the list.
+  std::size_t graphIndex_{SIZE_MAX};
+
+  /// @brief Brings a node that has been cleaned up back to the state of a new one.
+  /// @note Only to be called while the node is not in the graph.
+  void reinitialize();
+
  private:
   std::vector<std::shared_ptr<AudioBuffer>> inputBuffers_ = {};
 
@@ -3,8 +3,11 @@
 #include <audioapi/dsp/AudioUtils.hpp>
 #include <audioapi/dsp/VectorMath.h>
 #include <audioapi/utils/AudioArray.h>
+#include <algorithm>
 #include <memory>
+#include <span>
 #include <utility>
+#include <vector>
 
 namespace audioapi {
 
@@ -18,160 +21,42 @@ AudioParam::AudioParam(
       defaultValue_(defaultValue),
       minValue_(minValue),
       maxValue_(maxValue),
-      eventsQueue_(),
-      eventScheduler_(32),
-      startTime_(0),
-      endTime_(0),
-      startValue_(defaultValue),
-      endValue_(defaultValue),
+      timeline_(defaultValue),
       audioBuffer_(
           std::make_shared<AudioBuffer>(RENDER_QUANTUM_SIZE, 1, context->getSampleRate())) {
   inputBuffers_.reserve(4);
   inputNodes_.reserve(4);
-  // Default calculation function just returns the static value
-  calculateValue_ = [this](double, double, float, float, double) {
-    return value_.load(std::memory_order_relaxed);
-  };
 }
 
 float AudioParam::getValueAtTime(double time) {
-  // Check if current automation segment has ended and we need to advance to
-  // next event
-  if (endTime_ < time && !eventsQueue_.isEmpty()) {
-    ParamChangeEvent event;
-    eventsQueue_.popFront(event);
-    startTime_ = event.getStartTime();
-    endTime_ = event.getEndTime();
-    startValue_ = event.getStartValue();
-    endValue_ = event.getEndValue();
-    calculateValue_ = event.getCalculateValue();
+  // Without automation the param keeps the static value
+  float value = 0.0f;
+
+  if (timeline_.getValueAtTime(time, value)) {
+    setValue(value);
   }
 
-  // Calculate value using the current automation function and clamp to valid
-  setValue(calculateValue_(startTime_, endTime_, startValue_, endValue_, time));
   return value_;
 }
 
 void AudioParam::setValueAtTime(float value, double startTime) {
-  auto event = [value, startTime](AudioParam &param) {
-    // Ignore events scheduled before the end of existing automation
-    if (startTime < param.getQueueEndTime()) {
-      return;
-    }
-
-    // Step function: instant change at startTime
-    auto calculateValue =
-        [](double startTime, double /* endTime */, float startValue, float endValue, double time) {
-          if (time < startTime) {
-            return startValue;
-          }
-
-          return endValue;
-        };
-
-    param.updateQueue(ParamChangeEvent(
-        startTime,
-        startTime,
-        param.getQueueEndValue(),
-        value,
-        std::move(calculateValue),
-        ParamChangeEventType::SET_VALUE));
-  };
-  eventScheduler_.scheduleEvent(std::move(event));
+  applyEvent(ParamAutomationType::SET_VALUE, startTime, value, 0.0);
+  timeline_.publish();
 }
 
 void AudioParam::linearRampToValueAtTime(float value, double endTime) {
-  auto event = [value, endTime](AudioParam &param) {
-    // Ignore events scheduled before the end of existing automation
-    if (endTime < param.getQueueEndTime()) {
-      return;
-    }
-
-    // Linear interpolation function
-    auto calculateValue =
-        [](double startTime, double endTime, float startValue, float endValue, double time) {
-          if (time < startTime) {
-            return startValue;
-          }
-
-          if (time < endTime) {
-            return static_cast<float>(
-                startValue + (endValue - startValue) * (time - startTime) / (endTime - startTime));
-          }
-
-          return endValue;
-        };
-
-    param.updateQueue(ParamChangeEvent(
-        param.getQueueEndTime(),
-        endTime,
-        param.getQueueEndValue(),
-        value,
-        std::move(calculateValue),
-        ParamChangeEventType::LINEAR_RAMP));
-  };
-  eventScheduler_.scheduleEvent(std::move(event));
+  applyEvent(ParamAutomationType::LINEAR_RAMP, endTime, value, 0.0);
+  timeline_.publish();
 }
 
 void AudioParam::exponentialRampToValueAtTime(float value, double endTime) {
-  auto event = [value, endTime](AudioParam &param) {
-    if (endTime <= param.getQueueEndTime()) {
-      return;
-    }
-
-    // Exponential curve function using power law
-    auto calculateValue =
-        [](double startTime, double endTime, float startValue, float endValue, double time) {
-          if (time < startTime) {
-            return startValue;
-          }
-
-          if (time < endTime) {
-            return static_cast<float>(
-                startValue *
-                pow(endValue / startValue, (time - startTime) / (endTime - startTime)));
-          }
-
-          return endValue;
-        };
-
-    param.updateQueue(ParamChangeEvent(
-        param.getQueueEndTime(),
-        endTime,
-        param.getQueueEndValue(),
-        value,
-        std::move(calculateValue),
-        ParamChangeEventType::EXPONENTIAL_RAMP));
-  };
-  eventScheduler_.scheduleEvent(std::move(event));
+  applyEvent(ParamAutomationType::EXPONENTIAL_RAMP, endTime, value, 0.0);
+  timeline_.publish();
 }
 
 void AudioParam::setTargetAtTime(float target, double startTime, double timeConstant) {
-  auto event = [target, startTime, timeConstant](AudioParam &param) {
-    if (startTime <= param.getQueueEndTime()) {
-      return;
-    }
-    // Exponential decay function towards target value
-    auto calculateValue = [timeConstant, target](
-                              double startTime, double, float startValue, float, double time) {
-      if (time < startTime) {
-        return startValue;
-      }
-
-      return static_cast<float>(
-          target + (startValue - target) * exp(-(time - startTime) / timeConstant));
-    };
-    param.updateQueue(ParamChangeEvent(
-        startTime,
-        startTime, // SetTarget events have infinite duration conceptually
-        param.getQueueEndValue(),
-        param.getQueueEndValue(), // End value is not meaningful for
-                                  // infinite events
-        std::move(calculateValue),
-        ParamChangeEventType::SET_TARGET));
-  };
-
-  eventScheduler_.scheduleEvent(std::move(event));
+  applyEvent(ParamAutomationType::SET_TARGET, startTime, target, timeConstant);
+  timeline_.publish();
 }
 
 void AudioParam::setValueCurveAtTime(
@@ -179,54 +64,179 @@ void AudioParam::setValueCurveAtTime(
     size_t length,
     double startTime,
     double duration) {
-  auto event = [values, length, startTime, duration](AudioParam &param) {
-    if (startTime <= param.getQueueEndTime()) {
-      return;
-    }
+  if (startTime <= timeline_.getEndTime()) {
+    return;
+  }
 
-    auto calculateValue =
-        [values, length](
-            double startTime, double endTime, float startValue, float endValue, double time) {
-          if (time < startTime) {
-            return startValue;
-          }
-
-          if (time < endTime) {
-            // Calculate position in the array based on time progress
-            auto k = static_cast<int>(std::floor(
-                static_cast<double>(length - 1) / (endTime - startTime) * (time - startTime)));
-            // Calculate interpolation factor between adjacent array elements
-            auto factor = static_cast<float>(
-                (time - startTime) * static_cast<double>(length - 1) / (endTime - startTime) - k);
-            return dsp::linearInterpolate(values->span(), k, k + 1, factor);
-          }
-
-          return endValue;
-        };
-
-    param.updateQueue(ParamChangeEvent(
-        startTime,
-        startTime + duration,
-        param.getQueueEndValue(),
-        values->span()[length - 1],
-        std::move(calculateValue),
-        ParamChangeEventType::SET_VALUE_CURVE));
-  };
-
-  /// Schedules an event that modifies this param
-  /// It will be executed on next audio render cycle
-  eventScheduler_.scheduleEvent(std::move(event));
+  auto curve = values->span().subspan(0, length);
+
+  // The values are copied into the timeline, so the array can be reused right away
+  timeline_.append(
+      {
+          .type = ParamChangeEventType::SET_VALUE_CURVE,
+          .startTime = startTime,
+          .endTime = startTime + duration,
+          .endValue = curve[length - 1],
+      },
+      curve);
+  timeline_.publish();
 }
 
 void AudioParam::cancelScheduledValues(double cancelTime) {
-  eventScheduler_.scheduleEvent(
-      [cancelTime](AudioParam &param) { param.eventsQueue_.cancelScheduledValues(cancelTime); });
+  applyEvent(ParamAutomationType::CANCEL_SCHEDULED_VALUES, cancelTime, 0.0f, 0.0);
+  timeline_.publish();
 }
 
 void AudioParam::cancelAndHoldAtTime(double cancelTime) {
-  eventScheduler_.scheduleEvent([cancelTime](AudioParam &param) {
-    param.eventsQueue_.cancelAndHoldAtTime(cancelTime, param.endTime_);
-  });
+  applyEvent(ParamAutomationType::CANCEL_AND_HOLD, cancelTime, 0.0f, 0.0);
+  timeline_.publish();
+}
+
+void AudioParam::scheduleEvents(std::span<const double> events) {
+  auto context = context_.lock();
+  timeline_.reserve(events.size() / 4);
+  applyEvents(events, context != nullptr ? context->getCurrentTime() : 0.0);
+  timeline_.publish();
+}
+
+void AudioParam::scheduleEvents(
+    std::span<AudioParam *const> params,
+    std::span<const double> events) {
+  if (params.empty()) {
+    return;
+  }
+
+  auto context = params.front()->context_.lock();
+  auto currentTime = context != nullptr ? context->getCurrentTime() : 0.0;
+
+  // every timeline grows once up front instead of doubling while the events are appended
+  std::vector<size_t> counts(params.size(), 0);
+
+  for (size_t i = 0; i + 5 <= events.size(); i += 5) {
+    if (auto index = events[i]; index >= 0.0 && index < static_cast<double>(params.size())) {
+      ++counts[static_cast<size_t>(index)];
+    }
+  }
+
+  for (size_t i = 0; i < params.size(); ++i) {
+    params[i]->timeline_.reserve(counts[i]);
+  }
+
+  for (size_t i = 0; i + 5 <= events.size(); i += 5) {
+    auto index = events[i];
+
+    if (!(index >= 0.0 && index < static_cast<double>(params.size()))) {
+      continue;
+    }
+
+    params[static_cast<size_t>(index)]->applyEvents(events.subspan(i + 1, 4), currentTime);
+  }
+
+  // every param is published once, however many of its events there are
+  for (auto *param : params) {
+    param->timeline_.publish();
+  }
+}
+
+void AudioParam::reset(float defaultValue) {
+  defaultValue_ = defaultValue;
+  value_.store(std::clamp(defaultValue, minValue_, maxValue_), std::memory_order_release);
+  timeline_.reset(defaultValue);
+  inputBuffers_.clear();
+}
+
+void AudioParam::applyEvents(std::span<const double> events, double currentTime) {
+  for (size_t i = 0; i + 4 <= events.size(); i += 4) {
+    auto type = events[i];
+    auto time = events[i + 1];
+
+    // negated, so NaNs are skipped as well
+    if (!(type >= 0.0 && type <= static_cast<double>(ParamAutomationType::CANCEL_AND_HOLD)) ||
+        !(time >= 0.0)) {
+      continue;
+    }
+
+    auto automationType = static_cast<ParamAutomationType>(static_cast<int>(type));
+
+    // cancels keep their time, like cancelScheduledValues and cancelAndHoldAtTime do,
+    // so a cancel at 0 still removes the ramp in progress
+    if (automationType != ParamAutomationType::CANCEL_SCHEDULED_VALUES &&
+        automationType != ParamAutomationType::CANCEL_AND_HOLD) {
+      time = std::max(time, currentTime);
+    }
+
+    applyEvent(automationType, time, static_cast<float>(events[i + 2]), events[i + 3]);
+  }
+}
+
+void AudioParam::applyEvent(ParamAutomationType type, double time, float value, double extra) {
+  switch (type) {
+    case ParamAutomationType::SET_VALUE:
+      // Ignore events scheduled before the end of existing automation
+      if (time < timeline_.getEndTime()) {
+        return;
+      }
+
+      // Step function: instant change at startTime
+      timeline_.append({
+          .type = ParamChangeEventType::SET_VALUE,
+          .startTime = time,
+          .endTime = time,
+          .endValue = value,
+      });
+      break;
+
+    case ParamAutomationType::LINEAR_RAMP:
+      // Ignore events scheduled before the end of existing automation
+      if (time < timeline_.getEndTime()) {
+        return;
+      }
+
+      timeline_.append({
+          .type = ParamChangeEventType::LINEAR_RAMP,
+          .startTime = timeline_.getEndTime(),
+          .endTime = time,
+          .endValue = value,
+      });
+      break;
+
+    case ParamAutomationType::EXPONENTIAL_RAMP:
+      if (time <= timeline_.getEndTime()) {
+        return;
+      }
+
+      timeline_.append({
+          .type = ParamChangeEventType::EXPONENTIAL_RAMP,
+          .startTime = timeline_.getEndTime(),
+          .endTime = time,
+          .endValue = value,
+      });
+      break;
+
+    case ParamAutomationType::SET_TARGET:
+      if (time <= timeline_.getEndTime()) {
+        return;
+      }
+
+      // Exponential decay towards target value, SetTarget events have infinite duration
+      // conceptually
+      timeline_.append({
+          .type = ParamChangeEventType::SET_TARGET,
+          .startTime = time,
+          .endTime = time,
+          .target = value,
+          .timeConstant = extra,
+      });
+      break;
+
+    case ParamAutomationType::CANCEL_SCHEDULED_VALUES:
+      timeline_.cancelScheduledValues(time);
+      break;
+
+    case ParamAutomationType::CANCEL_AND_HOLD:
+      timeline_.cancelAndHoldAtTime(time);
+      break;
+  }
 }
 
 void AudioParam::addInputNode(AudioNode *node) {
@@ -256,7 +266,7 @@ std::shared_ptr<AudioBuffer> AudioParam::calculateInputs(
 }
 
 std::shared_ptr<AudioBuffer> AudioParam::processARateParam(int framesToProcess, double time) {
-  processScheduledEvents();
+  timeline_.update(time);
   auto processingBuffer = calculateInputs(audioBuffer_, framesToProcess);
 
   std::shared_ptr<BaseAudioContext> context = context_.lock();
@@ -278,7 +288,7 @@ std::shared_ptr<AudioBuffer> AudioParam::processARateParam(int framesToProcess,
 }
 
 float AudioParam::processKRateParam(int framesToProcess, double time) {
-  processScheduledEvents();
+  timeline_.update(time);
   auto processingBuffer = calculateInputs(audioBuffer_, framesToProcess);
 
   // Return block-rate parameter value plus first sample of input modulation
@@ -1,14 +1,15 @@
 #pragma once
 
 #include <audioapi/core/AudioNode.h>
+#include <audioapi/core/types/ParamAutomationType.h>
 #include <audioapi/core/types/ParamChangeEventType.h>
-#include <audioapi/core/utils/AudioParamEventQueue.h>
+#include <audioapi/core/utils/AudioParamTimeline.h>
 #include <audioapi/core/utils/ParamChangeEvent.hpp>
 #include <audioapi/utils/AudioBuffer.h>
 
-#include <audioapi/utils/CrossThreadEventScheduler.hpp>
 #include <cstddef>
 #include <memory>
+#include <span>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -76,6 +77,25 @@ class AudioParam {
   // JS-Thread only
   void cancelAndHoldAtTime(double cancelTime);
 
+  // JS-Thread only
+  /// @brief Schedules events given as (type, time, value, extra) tuples, see ParamAutomationType.
+  /// The extra field is the time constant of SET_TARGET and is ignored by the other types.
+  /// Times of the non-cancel events before the current time are moved to it and malformed tuples
+  /// are skipped.
+  /// @note All the events are handed to the audio thread at once.
+  void scheduleEvents(std::span<const double> events);
+
+  // JS-Thread only
+  /// @brief Schedules events of many params given as (param index, type, time, value, extra)
+  /// tuples, see scheduleEvents.
+  static void scheduleEvents(std::span<AudioParam *const> params, std::span<const double> events);
+
+  // JS-Thread only
+  /// @brief Brings the param back to the state of a new one with the given default value.
+  /// @note Only to be called while the audio thread does not process the param, when the node
+  /// owning it is recycled.
+  void reset(float defaultValue);
+
   /// Audio-Thread only methods
   /// These methods are called only from the Audio rendering thread.
 
@@ -99,51 +119,17 @@ class AudioParam {
   float minValue_;
   float maxValue_;
 
-  AudioParamEventQueue eventsQueue_;
-  CrossThreadEventScheduler<AudioParam> eventScheduler_;
-
-  // Current automation state (cached for performance)
-  double startTime_;
-  double endTime_;
-  float startValue_;
-  float endValue_;
-  std::function<float(double, double, float, float, double)> calculateValue_;
+  // Automation events, edited on the JS thread and published to the audio thread
+  AudioParamTimeline timeline_;
 
   // Input modulation system
   std::vector<AudioNode *> inputNodes_;
   std::shared_ptr<AudioBuffer> audioBuffer_;
   std::vector<std::shared_ptr<AudioBuffer>> inputBuffers_;
 
-  /// @brief Get the end time of the parameter queue.
-  /// @return The end time of the parameter queue or last endTime_ if queue is empty.
-  inline double getQueueEndTime() const noexcept {
-    if (eventsQueue_.isEmpty()) {
-      return endTime_;
-    }
-    return eventsQueue_.back().getEndTime();
-  }
-
-  /// @brief Get the end value of the parameter queue.
-  /// @return The end value of the parameter queue or last endValue_ if queue is empty.
-  inline float getQueueEndValue() const noexcept {
-    if (eventsQueue_.isEmpty()) {
-      return endValue_;
-    }
-    return eventsQueue_.back().getEndValue();
-  }
-
-  /// @brief Process all scheduled events.
-  inline void processScheduledEvents() noexcept(noexcept(eventScheduler_.processAllEvents(*this))) {
-    eventScheduler_.processAllEvents(*this);
-  }
-
-  /// @brief Update the parameter queue with a new event.
-  /// @param event The new event to add to the queue.
-  /// @note Handles connecting start value of the new event to the end value of the previous event.
-  inline void updateQueue(ParamChangeEvent &&event) {
-    eventsQueue_.pushBack(std::move(event));
-  }
   float getValueAtTime(double time);
+  void applyEvent(ParamAutomationType type, double time, float value, double extra);
+  void applyEvents(std::span<const double> events, double currentTime);
   void processInputs(
       const std::shared_ptr<AudioBuffer> &outputBuffer,
       int framesToProcess,
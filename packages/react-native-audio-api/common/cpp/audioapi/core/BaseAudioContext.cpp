@@ -28,6 +28,7 @@
 #include <audioapi/utils/AudioBuffer.h>
 #include <audioapi/utils/CircularAudioArray.h>
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <utility>
 #include <vector>
@@ -42,6 +43,7 @@ BaseAudioContext::BaseAudioContext(
       sampleRate_(sampleRate),
       graphManager_(std::make_shared<AudioGraphManager>()),
       audioEventHandlerRegistry_(audioEventHandlerRegistry),
+      eventQueue_(audioEventHandlerRegistry->createEventQueue(AudioEventQueue::kDefaultCapacity)),
       runtimeRegistry_(runtimeRegistry) {}
 
 void BaseAudioContext::initialize() {
@@ -83,10 +85,13 @@ void BaseAudioContext::setState(audioapi::ContextState state) {
 std::shared_ptr<WorkletSourceNode> BaseAudioContext::createWorkletSourceNode(
     std::shared_ptr<worklets::SerializableWorklet> &shareableWorklet,
     std::weak_ptr<worklets::WorkletRuntime> runtime,
-    bool shouldLockRuntime) {
-  WorkletsRunner workletRunner(runtime, shareableWorklet, shouldLockRuntime);
-  auto workletSourceNode =
-      std::make_shared<WorkletSourceNode>(shared_from_this(), std::move(workletRunner));
+    bool shouldLockRuntime,
+    size_t lookahead,
+    size_t blockSize) {
+  WorkletsRunner workletRunner(
+      runtime, shareableWorklet, resolveRuntimeLocking(runtime, shouldLockRuntime, lookahead));
+  auto workletSourceNode = std::make_shared<WorkletSourceNode>(
+      shared_from_this(), std::move(workletRunner), lookahead, blockSize);
   graphManager_->addSourceNode(workletSourceNode);
   return workletSourceNode;
 }
@@ -96,10 +101,12 @@ std::shared_ptr<WorkletNode> BaseAudioContext::createWorkletNode(
     std::weak_ptr<worklets::WorkletRuntime> runtime,
     size_t bufferLength,
     size_t inputChannelCount,
-    bool shouldLockRuntime) {
-  WorkletsRunner workletRunner(runtime, shareableWorklet, shouldLockRuntime);
+    bool shouldLockRuntime,
+    size_t lookahead) {
+  WorkletsRunner workletRunner(
+      runtime, shareableWorklet, resolveRuntimeLocking(runtime, shouldLockRuntime, lookahead));
   auto workletNode = std::make_shared<WorkletNode>(
-      shared_from_this(), bufferLength, inputChannelCount, std::move(workletRunner));
+      shared_from_this(), bufferLength, inputChannelCount, std::move(workletRunner), lookahead);
   graphManager_->addProcessingNode(workletNode);
   return workletNode;
 }
@@ -107,14 +114,35 @@ std::shared_ptr<WorkletNode> BaseAudioContext::createWorkletNode(
 std::shared_ptr<WorkletProcessingNode> BaseAudioContext::createWorkletProcessingNode(
     std::shared_ptr<worklets::SerializableWorklet> &shareableWorklet,
     std::weak_ptr<worklets::WorkletRuntime> runtime,
-    bool shouldLockRuntime) {
-  WorkletsRunner workletRunner(runtime, shareableWorklet, shouldLockRuntime);
-  auto workletProcessingNode =
-      std::make_shared<WorkletProcessingNode>(shared_from_this(), std::move(workletRunner));
+    bool shouldLockRuntime,
+    size_t lookahead,
+    size_t blockSize,
+    int channelCount) {
+  WorkletsRunner workletRunner(
+      runtime, shareableWorklet, resolveRuntimeLocking(runtime, shouldLockRuntime, lookahead));
+  auto workletProcessingNode = std::make_shared<WorkletProcessingNode>(
+      shared_from_this(), std::move(workletRunner), lookahead, blockSize, channelCount);
   graphManager_->addProcessingNode(workletProcessingNode);
   return workletProcessingNode;
 }
 
+bool BaseAudioContext::resolveRuntimeLocking(
+    const std::weak_ptr<worklets::WorkletRuntime> &runtime,
+    bool shouldLockRuntime,
+    size_t lookahead) {
+  // a worklet run ahead is called from its own thread, so it always locks the runtime
+  bool shouldLock = shouldLockRuntime || lookahead > 0;
+
+  // a worklet called on the audio thread without the lock would race with one holding it
+  auto [entry, inserted] = workletRuntimeLocking_.try_emplace(runtime, shouldLock);
+  if (!inserted && entry->second != shouldLock) {
+    throw std::invalid_argument(
+        "Worklets with and without lookahead can't run on the same runtime, as only the ones run ahead lock it.");
+  }
+
+  return shouldLock;
+}
+
 std::shared_ptr<RecorderAdapterNode> BaseAudioContext::createRecorderAdapter() {
   auto recorderAdapter = std::make_shared<RecorderAdapterNode>(shared_from_this());
   graphManager_->addProcessingNode(recorderAdapter);
@@ -123,7 +151,15 @@ std::shared_ptr<RecorderAdapterNode> BaseAudioContext::createRecorderAdapter() {
 
 std::shared_ptr<OscillatorNode> BaseAudioContext::createOscillator(
     const OscillatorOptions &options) {
-  auto oscillator = std::make_shared<OscillatorNode>(shared_from_this(), options);
+  auto oscillator = std::static_pointer_cast<OscillatorNode>(
+      graphManager_->getVoicePool().acquire(VoiceType::OSCILLATOR));
+
+  if (oscillator != nullptr) {
+    oscillator->reset(options);
+  } else {
+    oscillator = std::make_shared<OscillatorNode>(shared_from_this(), options);
+  }
+
   graphManager_->addSourceNode(oscillator);
   return oscillator;
 }
@@ -173,7 +209,15 @@ std::shared_ptr<BiquadFilterNode> BaseAudioContext::createBiquadFilter(
 
 std::shared_ptr<AudioBufferSourceNode> BaseAudioContext::createBufferSource(
     const AudioBufferSourceOptions &options) {
-  auto bufferSource = std::make_shared<AudioBufferSourceNode>(shared_from_this(), options);
+  auto bufferSource = std::static_pointer_cast<AudioBufferSourceNode>(
+      graphManager_->getVoicePool().acquire(VoiceType::BUFFER_SOURCE));
+
+  if (bufferSource != nullptr) {
+    bufferSource->reset(options);
+  } else {
+    bufferSource = std::make_shared<AudioBufferSourceNode>(shared_from_this(), options);
+  }
+
   graphManager_->addSourceNode(bufferSource);
   return bufferSource;
 }
@@ -257,6 +301,10 @@ std::shared_ptr<IAudioEventHandlerRegistry> BaseAudioContext::getAudioEventHandl
   return audioEventHandlerRegistry_;
 }
 
+std::shared_ptr<AudioEventQueue> BaseAudioContext::getEventQueue() const {
+  return eventQueue_;
+}
+
 const RuntimeRegistry &BaseAudioContext::getRuntimeRegistry() const {
   return runtimeRegistry_;
 }
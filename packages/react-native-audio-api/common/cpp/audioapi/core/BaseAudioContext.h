@@ -2,6 +2,7 @@
 
 #include <audioapi/core/types/ContextState.h>
 #include <audioapi/core/types/OscillatorType.h>
+#include <audioapi/core/utils/Constants.h>
 #include <audioapi/core/utils/worklets/SafeIncludes.h>
 
 #include <atomic>
@@ -9,6 +10,7 @@
 #include <complex>
 #include <cstddef>
 #include <functional>
+#include <map>
 #include <memory>
 #include <string>
 #include <utility>
@@ -34,6 +36,7 @@ class AnalyserNode;
 class AudioEventHandlerRegistry;
 class ConvolverNode;
 class IAudioEventHandlerRegistry;
+class AudioEventQueue;
 class RecorderAdapterNode;
 class WaveShaperNode;
 class WorkletSourceNode;
@@ -74,17 +77,23 @@ class BaseAudioContext : public std::enable_shared_from_this<BaseAudioContext> {
   std::shared_ptr<WorkletSourceNode> createWorkletSourceNode(
       std::shared_ptr<worklets::SerializableWorklet> &shareableWorklet,
       std::weak_ptr<worklets::WorkletRuntime> runtime,
-      bool shouldLockRuntime = true);
+      bool shouldLockRuntime = true,
+      size_t lookahead = 0,
+      size_t blockSize = RENDER_QUANTUM_SIZE);
   std::shared_ptr<WorkletNode> createWorkletNode(
       std::shared_ptr<worklets::SerializableWorklet> &shareableWorklet,
       std::weak_ptr<worklets::WorkletRuntime> runtime,
       size_t bufferLength,
       size_t inputChannelCount,
-      bool shouldLockRuntime = true);
+      bool shouldLockRuntime = true,
+      size_t lookahead = 0);
   std::shared_ptr<WorkletProcessingNode> createWorkletProcessingNode(
       std::shared_ptr<worklets::SerializableWorklet> &shareableWorklet,
       std::weak_ptr<worklets::WorkletRuntime> runtime,
-      bool shouldLockRuntime = true);
+      bool shouldLockRuntime = true,
+      size_t lookahead = 0,
+      size_t blockSize = RENDER_QUANTUM_SIZE,
+      int channelCount = 2);
   std::shared_ptr<DelayNode> createDelay(const DelayOptions &options);
   std::shared_ptr<IIRFilterNode> createIIRFilter(const IIRFilterOptions &options);
   std::shared_ptr<OscillatorNode> createOscillator(const OscillatorOptions &options);
@@ -109,6 +118,8 @@ class BaseAudioContext : public std::enable_shared_from_this<BaseAudioContext> {
   [[nodiscard]] float getNyquistFrequency() const;
   std::shared_ptr<AudioGraphManager> getGraphManager() const;
   std::shared_ptr<IAudioEventHandlerRegistry> getAudioEventHandlerRegistry() const;
+  /// @brief Events emitted from the audio thread of this context.
+  std::shared_ptr<AudioEventQueue> getEventQueue() const;
   const RuntimeRegistry &getRuntimeRegistry() const;
 
   virtual void initialize();
@@ -121,13 +132,24 @@ class BaseAudioContext : public std::enable_shared_from_this<BaseAudioContext> {
   std::atomic<float> sampleRate_;
   std::shared_ptr<AudioGraphManager> graphManager_;
   std::shared_ptr<IAudioEventHandlerRegistry> audioEventHandlerRegistry_;
+  std::shared_ptr<AudioEventQueue> eventQueue_;
   RuntimeRegistry runtimeRegistry_;
+  /// Whether the worklets of each runtime lock it, all of them have to agree.
+  std::map<std::weak_ptr<worklets::WorkletRuntime>, bool, std::owner_less<>>
+      workletRuntimeLocking_;
 
   std::shared_ptr<PeriodicWave> cachedSineWave_ = nullptr;
   std::shared_ptr<PeriodicWave> cachedSquareWave_ = nullptr;
   std::shared_ptr<PeriodicWave> cachedSawtoothWave_ = nullptr;
   std::shared_ptr<PeriodicWave> cachedTriangleWave_ = nullptr;
 
+  /// @brief Whether the worklets created for the runtime have to lock it.
+  /// @throws std::invalid_argument if the other worklets of the runtime do it the other way.
+  bool resolveRuntimeLocking(
+      const std::weak_ptr<worklets::WorkletRuntime> &runtime,
+      bool shouldLockRuntime,
+      size_t lookahead);
+
   [[nodiscard]] virtual bool isDriverRunning() const = 0;
 };
 
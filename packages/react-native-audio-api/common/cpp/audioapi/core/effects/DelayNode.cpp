@@ -4,19 +4,40 @@
 #include <audioapi/dsp/VectorMath.h>
 #include <audioapi/utils/AudioArray.h>
 #include <audioapi/utils/AudioBuffer.h>
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <limits>
 #include <memory>
 
 namespace audioapi {
 
+namespace {
+
+// relative tolerance under which a constant delay is treated as a whole number of frames,
+// covers the rounding of delay times given in seconds as floats
+constexpr double kIntegerDelayTolerance = std::numeric_limits<float>::epsilon();
+
+} // namespace
+
 DelayNode::DelayNode(const std::shared_ptr<BaseAudioContext> &context, const DelayOptions &options)
     : AudioNode(context, options),
       delayTimeParam_(
           std::make_shared<AudioParam>(options.delayTime, 0, options.maxDelayTime, context)),
+      sampleRate_(context->getSampleRate()),
+      maxDelayFrames_(static_cast<double>(options.maxDelayTime) * context->getSampleRate()),
+      // the ring holds the longest delay, the quantum being written and the interpolation taps
       delayBuffer_(
           std::make_shared<AudioBuffer>(
-              static_cast<size_t>(
-                  options.maxDelayTime * context->getSampleRate() +
-                  1), // +1 to enable delayTime equal to maxDelayTime
+              std::bit_ceil(
+                  static_cast<size_t>(std::ceil(maxDelayFrames_)) + RENDER_QUANTUM_SIZE +
+                  kInterpolationPadding),
+              channelCount_,
+              context->getSampleRate())),
+      ringMask_(delayBuffer_->getSize() - 1),
+      delayedBuffer_(
+          std::make_shared<AudioBuffer>(
+              RENDER_QUANTUM_SIZE,
               channelCount_,
               context->getSampleRate())) {
   isInitialized_ = true;
@@ -30,55 +51,88 @@ void DelayNode::onInputDisabled() {
   numberOfEnabledInputNodes_ -= 1;
   if (isEnabled() && numberOfEnabledInputNodes_ == 0) {
     signalledToStop_ = true;
-    if (std::shared_ptr<BaseAudioContext> context = context_.lock()) {
-      remainingFrames_ = delayTimeParam_->getValue() * context->getSampleRate();
-    } else {
-      remainingFrames_ = 0;
-    }
+    remainingFrames_ = static_cast<int>(std::ceil(lastMaxDelayFrames_));
   }
 }
 
-void DelayNode::delayBufferOperation(
-    const std::shared_ptr<AudioBuffer> &processingBuffer,
-    int framesToProcess,
-    size_t &operationStartingIndex,
-    DelayNode::BufferAction action) {
-  size_t processingBufferStartIndex = 0;
-
-  // handle buffer wrap around
-  if (operationStartingIndex + framesToProcess > delayBuffer_->getSize()) {
-    int framesToEnd = operationStartingIndex + framesToProcess - delayBuffer_->getSize();
-
-    if (action == BufferAction::WRITE) {
-      delayBuffer_->sum(
-          *processingBuffer, processingBufferStartIndex, operationStartingIndex, framesToEnd);
-    } else { // READ
-      processingBuffer->sum(
-          *delayBuffer_, operationStartingIndex, processingBufferStartIndex, framesToEnd);
-    }
+void DelayNode::writeToRing(const AudioBuffer &input, int framesToProcess) {
+  size_t start = static_cast<size_t>(writePosition_) & ringMask_;
+  size_t framesToEnd = std::min(static_cast<size_t>(framesToProcess), ringMask_ + 1 - start);
+
+  delayBuffer_->copy(input, 0, start, framesToEnd);
+  if (framesToEnd < static_cast<size_t>(framesToProcess)) {
+    delayBuffer_->copy(input, framesToEnd, 0, framesToProcess - framesToEnd);
+  }
+}
+
+void DelayNode::readFromRing(AudioBuffer &output, size_t delayFrames, int framesToProcess) {
+  size_t start =
+      static_cast<size_t>(writePosition_ - static_cast<int64_t>(delayFrames)) & ringMask_;
+  size_t framesToEnd = std::min(static_cast<size_t>(framesToProcess), ringMask_ + 1 - start);
+
+  output.copy(*delayBuffer_, start, 0, framesToEnd);
+  if (framesToEnd < static_cast<size_t>(framesToProcess)) {
+    output.copy(*delayBuffer_, 0, framesToEnd, framesToProcess - framesToEnd);
+  }
+}
+
+void DelayNode::readInterpolatedFromRing(
+    AudioBuffer &output,
+    std::span<const float> delayTimes,
+    int framesToProcess) {
+  // frames after the current quantum are not written yet
+  int64_t newestPosition = writePosition_ + framesToProcess - 1;
+  double maxDelayFrames = 0.0;
+
+  // read positions are shared by all channels
+  for (int i = 0; i < framesToProcess; ++i) {
+    double delayFrames =
+        std::clamp(static_cast<double>(delayTimes[i]) * sampleRate_, 0.0, maxDelayFrames_);
+    double position = static_cast<double>(writePosition_ + i) - delayFrames;
+    double integral = std::floor(position);
 
-    operationStartingIndex = 0;
-    processingBufferStartIndex += framesToEnd;
-    framesToProcess -= framesToEnd;
+    readPositions_[i] = static_cast<int64_t>(integral);
+    fractions_[i] = static_cast<float>(position - integral);
+    maxDelayFrames = std::max(maxDelayFrames, delayFrames);
   }
 
-  if (action == BufferAction::WRITE) {
-    delayBuffer_->sum(
-        *processingBuffer, processingBufferStartIndex, operationStartingIndex, framesToProcess);
-    processingBuffer->zero();
-  } else { // READ
-    processingBuffer->sum(
-        *delayBuffer_, operationStartingIndex, processingBufferStartIndex, framesToProcess);
-    delayBuffer_->zero(operationStartingIndex, framesToProcess);
+  lastMaxDelayFrames_ = maxDelayFrames;
+
+  for (size_t channel = 0; channel < delayBuffer_->getNumberOfChannels(); ++channel) {
+    const float *ring = delayBuffer_->getChannel(channel)->begin();
+    float *destination = delayedBuffer_->getChannel(channel)->begin();
+
+    // gathers taps at position - 1 ... position + 2, delays shorter than two frames
+    // repeat the newest written frame
+    for (int i = 0; i < framesToProcess; ++i) {
+      for (int tap = 0; tap < static_cast<int>(taps_.size()); ++tap) {
+        int64_t position = std::min(readPositions_[i] + tap - 1, newestPosition);
+        taps_[tap][i] = ring[static_cast<size_t>(position) & ringMask_];
+      }
+    }
+
+    // Catmull-Rom interpolation over contiguous taps, written so that it is vectorized
+    const float *previous = taps_[0].data();
+    const float *current = taps_[1].data();
+    const float *next = taps_[2].data();
+    const float *afterNext = taps_[3].data();
+    for (int i = 0; i < framesToProcess; ++i) {
+      float fraction = fractions_[i];
+      float c1 = 0.5f * (next[i] - previous[i]);
+      float c2 = previous[i] - 2.5f * current[i] + 2.0f * next[i] - 0.5f * afterNext[i];
+      float c3 = 0.5f * (afterNext[i] - previous[i]) + 1.5f * (current[i] - next[i]);
+      destination[i] = ((c3 * fraction + c2) * fraction + c1) * fraction + current[i];
+    }
   }
 
-  operationStartingIndex += framesToProcess;
+  output.copy(*delayedBuffer_, 0, 0, framesToProcess);
 }
 
 // delay buffer always has channelCount_ channels
 // processing is split into two parts
 // 1. writing to delay buffer (mixing if needed) from processing buffer
-// 2. reading from delay buffer to processing buffer (mixing if needed) with delay
+// 2. reading from delay buffer to processing buffer (mixing if needed) with delay,
+// constant whole-frame delays are block copies, anything else is interpolated per frame
 std::shared_ptr<AudioBuffer> DelayNode::processNode(
     const std::shared_ptr<AudioBuffer> &processingBuffer,
     int framesToProcess) {
@@ -90,24 +144,38 @@ std::shared_ptr<AudioBuffer> DelayNode::processNode(
       return processingBuffer;
     }
 
-    delayBufferOperation(
-        processingBuffer, framesToProcess, readIndex_, DelayNode::BufferAction::READ);
     remainingFrames_ -= framesToProcess;
-    return processingBuffer;
   }
 
-  // normal processing
   std::shared_ptr<BaseAudioContext> context = context_.lock();
   if (context == nullptr)
     return processingBuffer;
-  auto delayTime = delayTimeParam_->processKRateParam(framesToProcess, context->getCurrentTime());
-  size_t writeIndex = static_cast<size_t>(readIndex_ + delayTime * context->getSampleRate()) %
-      delayBuffer_->getSize();
-  delayBufferOperation(
-      processingBuffer, framesToProcess, writeIndex, DelayNode::BufferAction::WRITE);
-  delayBufferOperation(
-      processingBuffer, framesToProcess, readIndex_, DelayNode::BufferAction::READ);
+  auto delayTimes =
+      delayTimeParam_->processARateParam(framesToProcess, context->getCurrentTime())
+          ->getChannel(0)
+          ->subSpan(framesToProcess);
+
+  writeToRing(*processingBuffer, framesToProcess);
+
+  float firstDelayTime = delayTimes[0];
+  bool isConstant = std::all_of(
+      delayTimes.begin(), delayTimes.end(), [firstDelayTime](float value) {
+        return value == firstDelayTime;
+      });
+  double delayFrames =
+      std::clamp(static_cast<double>(firstDelayTime) * sampleRate_, 0.0, maxDelayFrames_);
+  double roundedDelayFrames = std::round(delayFrames);
+
+  if (isConstant &&
+      std::abs(delayFrames - roundedDelayFrames) <=
+          kIntegerDelayTolerance * std::max(1.0, delayFrames)) {
+    readFromRing(*processingBuffer, static_cast<size_t>(roundedDelayFrames), framesToProcess);
+    lastMaxDelayFrames_ = roundedDelayFrames;
+  } else {
+    readInterpolatedFromRing(*processingBuffer, delayTimes, framesToProcess);
+  }
 
+  writePosition_ += framesToProcess;
   return processingBuffer;
 }
 
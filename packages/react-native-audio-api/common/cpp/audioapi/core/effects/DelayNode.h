@@ -2,9 +2,13 @@
 
 #include <audioapi/core/AudioNode.h>
 #include <audioapi/core/AudioParam.h>
+#include <audioapi/core/utils/Constants.h>
 
+#include <array>
+#include <cstdint>
 #include <functional>
 #include <memory>
+#include <span>
 
 namespace audioapi {
 
@@ -23,16 +27,41 @@ class DelayNode : public AudioNode {
       int framesToProcess) override;
 
  private:
+  // cubic interpolation reads one frame before and two frames after the read position
+  static constexpr int kInterpolationPadding = 3;
+
   void onInputDisabled() override;
-  enum class BufferAction { READ, WRITE };
-  void delayBufferOperation(
-      const std::shared_ptr<AudioBuffer> &processingBuffer,
-      int framesToProcess,
-      size_t &operationStartingIndex,
-      BufferAction action);
+
+  /// @brief Writes framesToProcess frames of the input into the ring at writePosition_.
+  void writeToRing(const AudioBuffer &input, int framesToProcess);
+
+  /// @brief Copies framesToProcess frames delayed by a constant integer number of frames.
+  void readFromRing(AudioBuffer &output, size_t delayFrames, int framesToProcess);
+
+  /// @brief Reads frames delayed by per-frame fractional delays using cubic interpolation.
+  void readInterpolatedFromRing(
+      AudioBuffer &output,
+      std::span<const float> delayTimes,
+      int framesToProcess);
+
   std::shared_ptr<AudioParam> delayTimeParam_;
+  float sampleRate_;
+  double maxDelayFrames_;
+
+  // ring buffer with a power-of-two size, always has channelCount_ channels
   std::shared_ptr<AudioBuffer> delayBuffer_;
-  size_t readIndex_ = 0;
+  size_t ringMask_;
+  // total number of frames written, wrapped with ringMask_ on access
+  int64_t writePosition_ = 0;
+
+  // scratch used by the interpolated path
+  std::shared_ptr<AudioBuffer> delayedBuffer_;
+  std::array<int64_t, RENDER_QUANTUM_SIZE> readPositions_{};
+  std::array<float, RENDER_QUANTUM_SIZE> fractions_{};
+  std::array<std::array<float, RENDER_QUANTUM_SIZE>, 4> taps_{};
+
+  // longest delay used during the last quantum, determines the tail length
+  double lastMaxDelayFrames_ = 0.0;
   bool signalledToStop_ = false;
   int remainingFrames_ = 0;
 };
@@ -64,6 +64,12 @@ IIRFilterNode::IIRFilterNode(
 
     feedback_[0] = 1.0f;
   }
+
+  if (auto sections = dsp::factorIntoSecondOrderSections(feedforward_, feedback_)) {
+    cascade_ = std::make_unique<dsp::BiquadCascade>(std::move(*sections), maxChannels);
+  }
+
+  tailFrames_ = computeTailFrames(context->getSampleRate());
   isInitialized_ = true;
 }
 
@@ -116,24 +122,57 @@ void IIRFilterNode::getFrequencyResponse(
   }
 }
 
-// y[n] = sum(b[k] * x[n - k], k = 0, M) - sum(a[k] * y[n - k], k = 1, N)
-// where b[k] are the feedforward coefficients and a[k] are the feedback coefficients of the filter
-
-// TODO: tail
+void IIRFilterNode::onInputDisabled() {
+  numberOfEnabledInputNodes_ -= 1;
+  if (isEnabled() && numberOfEnabledInputNodes_ == 0) {
+    signalledToStop_ = true;
+    remainingFrames_ = tailFrames_;
+  }
+}
 
 std::shared_ptr<AudioBuffer> IIRFilterNode::processNode(
     const std::shared_ptr<AudioBuffer> &processingBuffer,
     int framesToProcess) {
-  int numChannels = processingBuffer->getNumberOfChannels();
+  // handling tail processing, the filter keeps ringing on silent input
+  if (signalledToStop_) {
+    if (numberOfEnabledInputNodes_ > 0) {
+      signalledToStop_ = false;
+    } else if (remainingFrames_ <= 0) {
+      disable();
+      signalledToStop_ = false;
+      resetState();
+      return processingBuffer;
+    } else {
+      remainingFrames_ -= framesToProcess;
+    }
+  }
 
+  filter(*processingBuffer, processingBuffer->getNumberOfChannels(), framesToProcess);
+  return processingBuffer;
+}
+
+void IIRFilterNode::filter(AudioBuffer &buffer, size_t numberOfChannels, int framesToProcess) {
+  if (cascade_ != nullptr) {
+    cascade_->process(buffer, numberOfChannels, framesToProcess);
+  } else {
+    filterDirectForm(buffer, numberOfChannels, framesToProcess);
+  }
+}
+
+// y[n] = sum(b[k] * x[n - k], k = 0, M) - sum(a[k] * y[n - k], k = 1, N)
+// where b[k] are the feedforward coefficients and a[k] are the feedback coefficients of the filter
+void IIRFilterNode::filterDirectForm(
+    AudioBuffer &buffer,
+    size_t numberOfChannels,
+    int framesToProcess) {
   size_t feedforwardLength = feedforward_.size();
   size_t feedbackLength = feedback_.size();
   int minLength = std::min(feedbackLength, feedforwardLength);
 
   int mask = bufferLength - 1;
 
-  for (int c = 0; c < numChannels; ++c) {
-    auto channel = processingBuffer->getChannel(c)->subSpan(framesToProcess);
+  for (size_t c = 0; c < numberOfChannels; ++c) {
+    auto channel = buffer.getChannel(c)->subSpan(framesToProcess);
 
     auto &x = xBuffers_[c];
     auto &y = yBuffers_[c];
@@ -170,7 +209,50 @@ std::shared_ptr<AudioBuffer> IIRFilterNode::processNode(
     }
     bufferIndices[c] = bufferIndex;
   }
-  return processingBuffer;
+}
+
+void IIRFilterNode::resetState() {
+  if (cascade_ != nullptr) {
+    cascade_->reset();
+  }
+
+  for (size_t c = 0; c < xBuffers_.size(); ++c) {
+    std::fill(xBuffers_[c].begin(), xBuffers_[c].end(), 0.0f);
+    std::fill(yBuffers_[c].begin(), yBuffers_[c].end(), 0.0f);
+    bufferIndices[c] = 0;
+  }
+}
+
+// Runs an impulse through the filter and returns the number of frames, rounded up to
+// the render quantum, after which the response stays below kMaxTailAmplitude.
+// Unstable or very long responses are capped at kMaxTailTime.
+int IIRFilterNode::computeTailFrames(float sampleRate) {
+  int maxTailFrames = static_cast<int>(kMaxTailTime * sampleRate);
+  AudioBuffer impulse(RENDER_QUANTUM_SIZE, 1, sampleRate);
+
+  int lastAudibleFrame = -1;
+  for (int offset = 0; offset < maxTailFrames; offset += RENDER_QUANTUM_SIZE) {
+    impulse.zero();
+    if (offset == 0) {
+      (*impulse.getChannel(0))[0] = 1.0f;
+    }
+
+    filter(impulse, 1, RENDER_QUANTUM_SIZE);
+
+    auto response = impulse.getChannel(0)->span();
+    for (int i = 0; i < RENDER_QUANTUM_SIZE; ++i) {
+      if (!(std::abs(response[i]) < kMaxTailAmplitude)) {
+        lastAudibleFrame = offset + i;
+      }
+    }
+  }
+
+  resetState();
+
+  int tailFrames = lastAudibleFrame + 1;
+  return std::min(
+      maxTailFrames,
+      (tailFrames + RENDER_QUANTUM_SIZE - 1) / RENDER_QUANTUM_SIZE * RENDER_QUANTUM_SIZE);
 }
 
 } // namespace audioapi
@@ -26,6 +26,11 @@
 #pragma once
 
 #include <audioapi/core/AudioNode.h>
+#include <audioapi/dsp/BiquadCascade.h>
+#if RN_AUDIO_API_TEST
+#include <gtest/gtest_prod.h>
+#endif // RN_AUDIO_API_TEST
+
 #include <complex>
 #include <vector>
 
@@ -36,6 +41,9 @@ namespace audioapi {
 struct IIRFilterOptions;
 
 class IIRFilterNode : public AudioNode {
+#if RN_AUDIO_API_TEST
+  friend class IIRFilterTest;
+#endif // RN_AUDIO_API_TEST
 
  public:
   explicit IIRFilterNode(
@@ -56,13 +64,32 @@ class IIRFilterNode : public AudioNode {
  private:
   static constexpr size_t bufferLength = 32;
 
+  // impulse response is considered finished when it stays below this amplitude
+  static constexpr float kMaxTailAmplitude = 1.0f / 32768.0f;
+  static constexpr float kMaxTailTime = 1.0f;
+
   std::vector<float> feedforward_;
   std::vector<float> feedback_;
 
+  // cascaded second-order sections, nullptr if the polynomials could not be factored
+  std::unique_ptr<dsp::BiquadCascade> cascade_;
+
+  // direct form state, used when the polynomials could not be factored
   std::vector<std::vector<float>> xBuffers_; // xBuffers_[channel][index]
   std::vector<std::vector<float>> yBuffers_;
   std::vector<size_t> bufferIndices;
 
+  // ring-out after the inputs are disabled, see computeTailFrames
+  int tailFrames_ = 0;
+  int remainingFrames_ = 0;
+  bool signalledToStop_ = false;
+
+  void onInputDisabled() override;
+  void filter(AudioBuffer &buffer, size_t numberOfChannels, int framesToProcess);
+  void filterDirectForm(AudioBuffer &buffer, size_t numberOfChannels, int framesToProcess);
+  void resetState();
+  int computeTailFrames(float sampleRate);
+
   static std::complex<float>
   evaluatePolynomial(const std::vector<float> coefficients, std::complex<float> z, int order) {
     // Use Horner's method to evaluate the polynomial P(z) = sum(coef[k]*z^k, k, 0, order);
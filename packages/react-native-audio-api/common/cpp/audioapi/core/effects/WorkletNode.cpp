@@ -2,7 +2,6 @@
 #include <algorithm>
 #include <memory>
 #include <utility>
-#include <vector>
 
 namespace audioapi {
 
@@ -10,29 +9,57 @@ WorkletNode::WorkletNode(
     const std::shared_ptr<BaseAudioContext> &context,
     size_t bufferLength,
     size_t inputChannelCount,
-    WorkletsRunner &&runtime)
+    WorkletsRunner &&runtime,
+    size_t lookahead)
     : AudioNode(context),
       workletRunner_(std::move(runtime)),
-      buffer_(
-          std::make_shared<AudioBuffer>(bufferLength, inputChannelCount, context->getSampleRate())),
+      workletBuffers_(std::make_unique<WorkletBuffers>(
+          bufferLength,
+          static_cast<int>(inputChannelCount),
+          context->getSampleRate(),
+          workletRunner_.getWeakRuntime())),
       bufferLength_(bufferLength),
       inputChannelCount_(inputChannelCount),
       curBuffIndex_(0) {
+  if (lookahead == 0) {
+    buffer_ = workletBuffers_->getBuffer();
+  } else {
+    buffer_ = std::make_shared<AudioBuffer>(
+        bufferLength, static_cast<int>(inputChannelCount), context->getSampleRate());
+    lookaheadRenderer_ = std::make_unique<LookaheadRenderer>(
+        lookahead,
+        bufferLength,
+        static_cast<int>(inputChannelCount),
+        0,
+        context->getSampleRate(),
+        [this](LookaheadRenderer::Block &block) {
+          workletBuffers_->getBuffer()->copy(*block.input);
+          runWorklet();
+          return true;
+        });
+  }
   isInitialized_ = true;
 }
 
+LookaheadRenderer::Stats WorkletNode::getLookaheadStats() const {
+  if (lookaheadRenderer_ == nullptr) {
+    return {};
+  }
+  auto stats = lookaheadRenderer_->getStats();
+  stats.latencyFrames = 0;
+  return stats;
+}
+
 std::shared_ptr<AudioBuffer> WorkletNode::processNode(
     const std::shared_ptr<AudioBuffer> &processingBuffer,
     int framesToProcess) {
   size_t processed = 0;
-  size_t channelCount_ =
-      std::min(inputChannelCount_, static_cast<size_t>(processingBuffer->getNumberOfChannels()));
   while (processed < framesToProcess) {
     size_t framesToWorkletInvoke = bufferLength_ - curBuffIndex_;
     size_t needsToProcess = framesToProcess - processed;
     size_t shouldProcess = std::min(framesToWorkletInvoke, needsToProcess);
 
-    /// here we copy
+    /// here we copy, mixing to the input channel count,
     /// to [curBuffIndex_, curBuffIndex_ + shouldProcess]
     /// from [processed, processed + shouldProcess]
     buffer_->copy(*processingBuffer, processed, curBuffIndex_, shouldProcess);
@@ -44,31 +71,38 @@ std::shared_ptr<AudioBuffer> WorkletNode::processNode(
     if (curBuffIndex_ != bufferLength_) {
       continue;
     }
-    // Reset buffer index, channel buffers and execute worklet
+    // Reset buffer index and execute worklet, the next quanta overwrite the whole buffer
     curBuffIndex_ = 0;
-    workletRunner_.executeOnRuntimeSync([this, channelCount_](jsi::Runtime &uiRuntimeRaw) {
-      /// Arguments preparation
-      auto jsArray = jsi::Array(uiRuntimeRaw, channelCount_);
-      for (size_t ch = 0; ch < channelCount_; ch++) {
-        auto sharedAudioArray = std::make_shared<AudioArrayBuffer>(bufferLength_);
-        sharedAudioArray->copy(*buffer_->getChannel(ch));
-        auto sharedAudioArraySize = sharedAudioArray->size();
-        auto arrayBuffer = jsi::ArrayBuffer(uiRuntimeRaw, std::move(sharedAudioArray));
-        arrayBuffer.setExternalMemoryPressure(uiRuntimeRaw, sharedAudioArraySize);
-        jsArray.setValueAtIndex(uiRuntimeRaw, ch, std::move(arrayBuffer));
-      }
+    if (lookaheadRenderer_ != nullptr) {
+      submitAhead();
+    } else {
+      runWorklet();
+    }
+  }
 
-      buffer_->zero();
+  return processingBuffer;
+}
 
-      /// Call the worklet
-      workletRunner_.callUnsafe(
-          std::move(jsArray), jsi::Value(uiRuntimeRaw, static_cast<int>(channelCount_)));
+void WorkletNode::runWorklet() {
+  workletRunner_.executeOnRuntimeSync([this](jsi::Runtime &uiRuntimeRaw) {
+    /// Call the worklet
+    workletRunner_.callUnsafe(
+        workletBuffers_->getJsArray(uiRuntimeRaw),
+        jsi::Value(uiRuntimeRaw, static_cast<int>(inputChannelCount_)));
 
-      return jsi::Value::undefined();
-    });
+    return jsi::Value::undefined();
+  });
+}
+
+void WorkletNode::submitAhead() {
+  // a free block is one the worklet is done with, without one the buffer is dropped
+  auto *block = lookaheadRenderer_->acquire();
+  if (block == nullptr) {
+    return;
   }
 
-  return processingBuffer;
+  block->input->copy(*buffer_);
+  lookaheadRenderer_->submit(block);
 }
 
 } // namespace audioapi
@@ -2,14 +2,13 @@
 
 #include <audioapi/core/AudioNode.h>
 #include <audioapi/core/BaseAudioContext.h>
+#include <audioapi/core/utils/LookaheadRenderer.h>
+#include <audioapi/core/utils/worklets/WorkletBuffers.h>
 #include <audioapi/core/utils/worklets/WorkletsRunner.h>
-#include <audioapi/utils/AudioArray.h>
-#include <audioapi/utils/AudioArrayBuffer.hpp>
 #include <audioapi/utils/AudioBuffer.h>
 #include <jsi/jsi.h>
 
 #include <memory>
-#include <vector>
 
 namespace audioapi {
 
@@ -20,9 +19,14 @@ class WorkletNode : public AudioNode {
       std::shared_ptr<BaseAudioContext> context,
       size_t bufferLength,
       size_t inputChannelCount,
-      WorkletsRunner &&workletRunner)
+      WorkletsRunner &&workletRunner,
+      size_t lookahead = 0)
       : AudioNode(context) {}
 
+  [[nodiscard]] LookaheadRenderer::Stats getLookaheadStats() const {
+    return {};
+  }
+
  protected:
   std::shared_ptr<AudioBuffer> processNode(
       const std::shared_ptr<AudioBuffer> &processingBuffer,
@@ -40,10 +44,16 @@ class WorkletNode : public AudioNode {
       const std::shared_ptr<BaseAudioContext> &context,
       size_t bufferLength,
       size_t inputChannelCount,
-      WorkletsRunner &&workletRunner);
+      WorkletsRunner &&workletRunner,
+      size_t lookahead = 0);
 
   ~WorkletNode() override = default;
 
+  /// @brief Buffers dropped because the worklet was still busy with the previous ones, all zero
+  /// when the worklet runs on the audio thread.
+  /// @note The input is passed through as it is, so no latency is added.
+  [[nodiscard]] LookaheadRenderer::Stats getLookaheadStats() const;
+
  protected:
   std::shared_ptr<AudioBuffer> processNode(
       const std::shared_ptr<AudioBuffer> &processingBuffer,
@@ -51,12 +61,23 @@ class WorkletNode : public AudioNode {
 
  private:
   WorkletsRunner workletRunner_;
+  /// @brief What the worklet reads from, used on the thread it runs on.
+  std::unique_ptr<WorkletBuffers> workletBuffers_;
+  /// @brief Buffer the quanta are gathered into, the worklet buffer itself when the worklet runs
+  /// on the audio thread.
   std::shared_ptr<AudioBuffer> buffer_;
 
   /// @brief Length of the byte buffer that will be passed to the AudioArrayBuffer
   size_t bufferLength_;
   size_t inputChannelCount_;
   size_t curBuffIndex_;
+
+  /// @brief Hands the filled buffers over to the worklet on its own thread when created with a
+  /// lookahead, destroyed first so the thread is stopped before the state it uses
+  std::unique_ptr<LookaheadRenderer> lookaheadRenderer_;
+
+  void runWorklet();
+  void submitAhead();
 };
 
 #endif // RN_AUDIO_API_TEST
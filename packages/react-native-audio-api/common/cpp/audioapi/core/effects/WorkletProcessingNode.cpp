@@ -1,82 +1,147 @@
 #include <audioapi/core/effects/WorkletProcessingNode.h>
 #include <audioapi/core/utils/Constants.h>
+#include <audioapi/types/NodeOptions.h>
+#include <algorithm>
 #include <memory>
+#include <optional>
 #include <utility>
 
 namespace audioapi {
 
 WorkletProcessingNode::WorkletProcessingNode(
     const std::shared_ptr<BaseAudioContext> &context,
-    WorkletsRunner &&workletRunner)
-    : AudioNode(context), workletRunner_(std::move(workletRunner)) {
-  // Pre-allocate buffers for max 128 frames and 2 channels (stereo)
-  size_t maxChannelCount = 2;
-  inputBuffsHandles_.resize(maxChannelCount);
-  outputBuffsHandles_.resize(maxChannelCount);
-
-  for (size_t i = 0; i < maxChannelCount; ++i) {
-    inputBuffsHandles_[i] = std::make_shared<AudioArrayBuffer>(RENDER_QUANTUM_SIZE);
-    outputBuffsHandles_[i] = std::make_shared<AudioArrayBuffer>(RENDER_QUANTUM_SIZE);
+    WorkletsRunner &&workletRunner,
+    size_t lookahead,
+    size_t blockSize,
+    int channelCount)
+    : AudioNode(context, WorkletProcessingOptions(channelCount)),
+      workletRunner_(std::move(workletRunner)),
+      blockSize_(blockSize),
+      inputBlockIndex_(0),
+      // the output of the first block is read right after its last quantum is written
+      outputBlockIndex_(RENDER_QUANTUM_SIZE) {
+  auto sampleRate = context->getSampleRate();
+  inputBuffers_ = std::make_unique<WorkletBuffers>(
+      blockSize_, channelCount, sampleRate, workletRunner_.getWeakRuntime());
+  outputBuffers_ = std::make_unique<WorkletBuffers>(
+      blockSize_, channelCount, sampleRate, workletRunner_.getWeakRuntime());
+
+  if (lookahead == 0) {
+    inputBlock_ = inputBuffers_->getBuffer();
+    outputBlock_ = outputBuffers_->getBuffer();
+  } else {
+    inputBlock_ = std::make_shared<AudioBuffer>(blockSize_, channelCount, sampleRate);
+    outputBlock_ = std::make_shared<AudioBuffer>(blockSize_, channelCount, sampleRate);
+    lookaheadRenderer_ = std::make_unique<LookaheadRenderer>(
+        lookahead,
+        blockSize_,
+        channelCount,
+        channelCount,
+        sampleRate,
+        [this](LookaheadRenderer::Block &block) { return renderBlock(block); });
   }
   isInitialized_ = true;
 }
 
+LookaheadRenderer::Stats WorkletProcessingNode::getLookaheadStats() const {
+  LookaheadRenderer::Stats stats{};
+  if (lookaheadRenderer_ != nullptr) {
+    stats = lookaheadRenderer_->getStats();
+  }
+  stats.latencyFrames += blockSize_ - RENDER_QUANTUM_SIZE;
+  return stats;
+}
+
 std::shared_ptr<AudioBuffer> WorkletProcessingNode::processNode(
     const std::shared_ptr<AudioBuffer> &processingBuffer,
     int framesToProcess) {
-  size_t channelCount = std::min(
-      static_cast<size_t>(2), // Fixed to stereo for now
-      static_cast<size_t>(processingBuffer->getNumberOfChannels()));
+  auto frames = static_cast<size_t>(framesToProcess);
 
-  // Copy input data to pre-allocated input buffers
-  for (size_t ch = 0; ch < channelCount; ch++) {
-    inputBuffsHandles_[ch]->copy(*processingBuffer->getChannel(ch), 0, 0, framesToProcess);
+  double time = 0.0;
+  if (std::shared_ptr<BaseAudioContext> context = context_.lock()) {
+    time = context->getCurrentTime();
   }
 
-  // Execute the worklet
-  auto result = workletRunner_.executeOnRuntimeSync(
-      [this, channelCount, framesToProcess](jsi::Runtime &rt) -> jsi::Value {
-        auto inputJsArray = jsi::Array(rt, channelCount);
-        auto outputJsArray = jsi::Array(rt, channelCount);
-
-        for (size_t ch = 0; ch < channelCount; ch++) {
-          // Create input array buffer
-          auto inputArrayBuffer = jsi::ArrayBuffer(rt, inputBuffsHandles_[ch]);
-          inputJsArray.setValueAtIndex(rt, ch, inputArrayBuffer);
-
-          // Create output array buffer
-          auto outputArrayBuffer = jsi::ArrayBuffer(rt, outputBuffsHandles_[ch]);
-          outputJsArray.setValueAtIndex(rt, ch, outputArrayBuffer);
-        }
-
-        // We call unsafely here because we are already on the runtime thread
-        // and the runtime is locked by executeOnRuntimeSync (if
-        // shouldLockRuntime is true)
-        float time = 0.0f;
-        if (std::shared_ptr<BaseAudioContext> context = context_.lock()) {
-          time = context->getCurrentTime();
-        }
-        return workletRunner_.callUnsafe(
-            inputJsArray,
-            outputJsArray,
-            jsi::Value(rt, static_cast<int>(framesToProcess)),
-            jsi::Value(rt, time));
-      });
-
-  // Copy processed output data back to the processing buffer or zero on failure
-  for (size_t ch = 0; ch < channelCount; ch++) {
-    auto channelData = processingBuffer->getChannel(ch);
-
-    if (result.has_value()) {
-      // Copy processed output data
-      channelData->copy(*inputBuffsHandles_[ch], 0, 0, framesToProcess);
-    } else {
-      // Zero the output on worklet execution failure
-      channelData->zero(0, framesToProcess);
+  // the whole input is gathered first, as the output overwrites it
+  size_t processed = 0;
+  while (processed < frames) {
+    size_t framesToCopy = std::min(frames - processed, blockSize_ - inputBlockIndex_);
+    inputBlock_->copy(*processingBuffer, processed, inputBlockIndex_, framesToCopy);
+
+    inputBlockIndex_ += framesToCopy;
+    processed += framesToCopy;
+
+    if (inputBlockIndex_ == blockSize_) {
+      // the block ends where the part just copied does
+      auto framesBefore = static_cast<double>(blockSize_ - processed);
+      processBlock(time - framesBefore / processingBuffer->getSampleRate());
+      inputBlockIndex_ = 0;
+      outputBlockIndex_ = 0;
     }
   }
 
+  processed = 0;
+  while (processed < frames) {
+    // only when the quanta are shorter than usual, which leaves the blocks unaligned
+    if (outputBlockIndex_ == blockSize_) {
+      processingBuffer->zero(processed, frames - processed);
+      break;
+    }
+
+    size_t framesToCopy = std::min(frames - processed, blockSize_ - outputBlockIndex_);
+    processingBuffer->copy(*outputBlock_, outputBlockIndex_, processed, framesToCopy);
+
+    outputBlockIndex_ += framesToCopy;
+    processed += framesToCopy;
+  }
+
   return processingBuffer;
 }
 
+std::optional<jsi::Value> WorkletProcessingNode::runWorklet(double time) {
+  return workletRunner_.executeOnRuntimeSync([this, time](jsi::Runtime &rt) -> jsi::Value {
+    // We call unsafely here because we are already on the runtime thread
+    // and the runtime is locked by executeOnRuntimeSync (if
+    // shouldLockRuntime is true)
+    return workletRunner_.callUnsafe(
+        inputBuffers_->getJsArray(rt),
+        outputBuffers_->getJsArray(rt),
+        jsi::Value(rt, static_cast<int>(blockSize_)),
+        jsi::Value(rt, time));
+  });
+}
+
+bool WorkletProcessingNode::renderBlock(LookaheadRenderer::Block &block) {
+  inputBuffers_->getBuffer()->copy(*block.input);
+
+  if (!runWorklet(block.time).has_value()) {
+    return false;
+  }
+
+  block.output->copy(*outputBuffers_->getBuffer());
+  return true;
+}
+
+void WorkletProcessingNode::processBlock(double time) {
+  if (lookaheadRenderer_ == nullptr) {
+    // Zero the output on worklet execution failure
+    if (!runWorklet(time).has_value()) {
+      outputBlock_->zero();
+    }
+    return;
+  }
+
+  auto *block = lookaheadRenderer_->acquire();
+  if (block == nullptr) {
+    // the input is dropped, as there is no free block to hand it over in
+    outputBlock_->zero();
+    return;
+  }
+
+  block->input->copy(*inputBlock_);
+  block->time = time;
+  outputBlock_->copy(*block->output);
+  lookaheadRenderer_->submit(block);
+}
+
 } // namespace audioapi
@@ -2,14 +2,15 @@
 
 #include <audioapi/core/AudioNode.h>
 #include <audioapi/core/BaseAudioContext.h>
+#include <audioapi/core/utils/Constants.h>
+#include <audioapi/core/utils/LookaheadRenderer.h>
+#include <audioapi/core/utils/worklets/WorkletBuffers.h>
 #include <audioapi/core/utils/worklets/WorkletsRunner.h>
-#include <audioapi/utils/AudioArray.h>
-#include <audioapi/utils/AudioArrayBuffer.hpp>
 #include <audioapi/utils/AudioBuffer.h>
 #include <jsi/jsi.h>
 
 #include <memory>
-#include <vector>
+#include <optional>
 
 namespace audioapi {
 
@@ -18,9 +19,16 @@ class WorkletProcessingNode : public AudioNode {
  public:
   explicit WorkletProcessingNode(
       std::shared_ptr<BaseAudioContext> context,
-      WorkletsRunner &&workletRunner)
+      WorkletsRunner &&workletRunner,
+      size_t lookahead = 0,
+      size_t blockSize = RENDER_QUANTUM_SIZE,
+      int channelCount = 2)
       : AudioNode(context) {}
 
+  [[nodiscard]] LookaheadRenderer::Stats getLookaheadStats() const {
+    return {};
+  }
+
  protected:
   std::shared_ptr<AudioBuffer> processNode(
       const std::shared_ptr<AudioBuffer> &processingBuffer,
@@ -36,7 +44,14 @@ class WorkletProcessingNode : public AudioNode {
  public:
   explicit WorkletProcessingNode(
       const std::shared_ptr<BaseAudioContext> &context,
-      WorkletsRunner &&workletRunner);
+      WorkletsRunner &&workletRunner,
+      size_t lookahead = 0,
+      size_t blockSize = RENDER_QUANTUM_SIZE,
+      int channelCount = 2);
+
+  /// @brief Latency added by the blocks and the lookahead, and the blocks the worklet did not
+  /// render in time.
+  [[nodiscard]] LookaheadRenderer::Stats getLookaheadStats() const;
 
  protected:
   std::shared_ptr<AudioBuffer> processNode(
@@ -45,8 +60,26 @@ class WorkletProcessingNode : public AudioNode {
 
  private:
   WorkletsRunner workletRunner_;
-  std::vector<std::shared_ptr<AudioArrayBuffer>> inputBuffsHandles_;
-  std::vector<std::shared_ptr<AudioArrayBuffer>> outputBuffsHandles_;
+
+  /// @brief Frames the worklet processes per call, the output lags the input by a block.
+  size_t blockSize_;
+  /// @brief What the worklet reads from and writes into, used on the thread it runs on.
+  std::unique_ptr<WorkletBuffers> inputBuffers_;
+  std::unique_ptr<WorkletBuffers> outputBuffers_;
+  /// @brief Blocks the quanta are gathered into and read from, the worklet buffers themselves
+  /// when the worklet runs on the audio thread.
+  std::shared_ptr<AudioBuffer> inputBlock_;
+  std::shared_ptr<AudioBuffer> outputBlock_;
+  size_t inputBlockIndex_;
+  size_t outputBlockIndex_;
+
+  /// @brief Runs the worklet on its own thread when created with a lookahead, destroyed first so
+  /// the thread is stopped before the state it uses
+  std::unique_ptr<LookaheadRenderer> lookaheadRenderer_;
+
+  std::optional<jsi::Value> runWorklet(double time);
+  bool renderBlock(LookaheadRenderer::Block &block);
+  void processBlock(double time);
 };
 
 #endif // RN_AUDIO_API_TEST
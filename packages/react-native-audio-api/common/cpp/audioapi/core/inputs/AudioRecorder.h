@@ -42,7 +42,8 @@ class AudioRecorder {
       float sampleRate,
       size_t bufferLength,
       int channelCount,
-      uint64_t callbackId) = 0;
+      uint64_t callbackId,
+      size_t bufferPoolSize) = 0;
   virtual void clearOnAudioReadyCallback() = 0;
 
   void setOnErrorCallback(uint64_t callbackId);
@@ -87,10 +87,8 @@ void AudioBufferBaseSourceNode::sendOnPositionChangedEvent() {
   auto onPositionChangedCallbackId = onPositionChangedCallbackId_.load(std::memory_order_acquire);
 
   if (onPositionChangedCallbackId != 0 && onPositionChangedTime_ > onPositionChangedInterval_) {
-    std::unordered_map<std::string, EventValue> body = {{"value", getCurrentPosition()}};
-
-    audioEventHandlerRegistry_->invokeHandlerWithEventBody(
-        AudioEvent::POSITION_CHANGED, onPositionChangedCallbackId, body);
+    sendEvent(AudioEventRecord(AudioEvent::POSITION_CHANGED, onPositionChangedCallbackId)
+                  .add("value", getCurrentPosition()));
 
     onPositionChangedTime_ = 0;
   }
@@ -179,6 +177,34 @@ void AudioBufferBaseSourceNode::processWithoutPitchCorrection(
   sendOnPositionChangedEvent();
 }
 
+void AudioBufferBaseSourceNode::SourceBuffer::copyTo(
+    AudioBuffer &destination,
+    size_t sourceStart,
+    size_t destinationStart,
+    size_t length) const {
+  if (buffer_) {
+    destination.copy(*buffer_, sourceStart, destinationStart, length);
+  } else {
+    compactBuffer_->copyTo(destination, sourceStart, destinationStart, length);
+  }
+}
+
+void AudioBufferBaseSourceNode::SourceBuffer::copyReverseTo(
+    AudioBuffer &destination,
+    size_t sourceStart,
+    size_t destinationStart,
+    size_t length) const {
+  if (!buffer_) {
+    compactBuffer_->copyReverseTo(destination, sourceStart, destinationStart, length);
+    return;
+  }
+
+  for (size_t ch = 0; ch < destination.getNumberOfChannels(); ch += 1) {
+    destination.getChannel(ch)->copyReverse(
+        *buffer_->getChannel(ch), sourceStart, destinationStart, length);
+  }
+}
+
 float AudioBufferBaseSourceNode::getComputedPlaybackRateValue(int framesToProcess, double time) {
   auto playbackRate = playbackRateParam_->processKRateParam(framesToProcess, time);
   auto detune = std::pow(2.0f, detuneParam_->processKRateParam(framesToProcess, time) / 1200.0f);
@@ -1,15 +1,19 @@
 #pragma once
 
 #include <audioapi/core/sources/AudioScheduledSourceNode.h>
+#include <audioapi/dsp/AudioUtils.hpp>
 #include <audioapi/libs/signalsmith-stretch/signalsmith-stretch.h>
+#include <audioapi/utils/AudioBuffer.h>
+#include <audioapi/utils/CompactAudioBuffer.h>
 
 #include <atomic>
+#include <cstddef>
 #include <memory>
 #include <mutex>
+#include <utility>
 
 namespace audioapi {
 
-class AudioBuffer;
 class AudioParam;
 struct BaseAudioBufferSourceOptions;
 
@@ -29,6 +33,72 @@ class AudioBufferBaseSourceNode : public AudioScheduledSourceNode {
   [[nodiscard]] double getOutputLatency() const;
 
  protected:
+  /// @brief Audio read by the node, either a float buffer
+  /// or a compact one converted to float as it is read.
+  class SourceBuffer {
+   public:
+    SourceBuffer() = default;
+    explicit SourceBuffer(std::shared_ptr<AudioBuffer> buffer)
+        : buffer_(std::move(buffer)), size_(buffer_->getSize()) {}
+    /// @param size Number of frames to be read, frames past the end of the buffer are silent.
+    SourceBuffer(std::shared_ptr<CompactAudioBuffer> buffer, size_t size)
+        : compactBuffer_(std::move(buffer)), size_(size) {}
+
+    explicit operator bool() const noexcept {
+      return buffer_ != nullptr || compactBuffer_ != nullptr;
+    }
+
+    /// @brief The float buffer, nullptr for compact audio.
+    [[nodiscard]] const std::shared_ptr<AudioBuffer> &getBuffer() const noexcept {
+      return buffer_;
+    }
+    [[nodiscard]] size_t getSize() const noexcept {
+      return size_;
+    }
+    [[nodiscard]] float getSampleRate() const noexcept {
+      return buffer_ ? buffer_->getSampleRate() : compactBuffer_->getSampleRate();
+    }
+    [[nodiscard]] double getDuration() const noexcept {
+      return static_cast<double>(size_) / static_cast<double>(getSampleRate());
+    }
+
+    [[nodiscard]] float getSample(size_t channel, size_t index) const noexcept {
+      return buffer_ ? (*buffer_->getChannel(channel))[index]
+                     : compactBuffer_->getSample(channel, index);
+    }
+
+    /// @brief Interpolates between two frames of a channel, as dsp::linearInterpolate does.
+    [[nodiscard]] float
+    interpolate(size_t channel, size_t firstIndex, size_t secondIndex, float factor) const {
+      if (buffer_) {
+        return dsp::linearInterpolate(
+            buffer_->getChannel(channel)->span(), firstIndex, secondIndex, factor);
+      }
+
+      float first = compactBuffer_->getSample(channel, firstIndex);
+      if (firstIndex == secondIndex && firstIndex >= 1) {
+        return first + factor * (first - compactBuffer_->getSample(channel, firstIndex - 1));
+      }
+      return std::lerp(first, compactBuffer_->getSample(channel, secondIndex), factor);
+    }
+
+    void copyTo(
+        AudioBuffer &destination,
+        size_t sourceStart,
+        size_t destinationStart,
+        size_t length) const;
+    void copyReverseTo(
+        AudioBuffer &destination,
+        size_t sourceStart,
+        size_t destinationStart,
+        size_t length) const;
+
+   private:
+    std::shared_ptr<AudioBuffer> buffer_;
+    std::shared_ptr<CompactAudioBuffer> compactBuffer_;
+    size_t size_ = 0;
+  };
+
   // pitch correction
   bool pitchCorrection_;
 
@@ -62,8 +62,8 @@ void AudioBufferQueueSourceNode::start(double when, double offset) {
     return;
   }
 
-  offset = std::min(offset, buffers_.front().second->getDuration());
-  vReadIndex_ = static_cast<double>(buffers_.front().second->getSampleRate() * offset);
+  offset = std::min(offset, buffers_.front().second.getDuration());
+  vReadIndex_ = static_cast<double>(buffers_.front().second.getSampleRate() * offset);
 }
 
 void AudioBufferQueueSourceNode::pause() {
@@ -72,8 +72,17 @@ void AudioBufferQueueSourceNode::pause() {
 }
 
 std::string AudioBufferQueueSourceNode::enqueueBuffer(const std::shared_ptr<AudioBuffer> &buffer) {
+  return enqueueSourceBuffer(SourceBuffer(buffer));
+}
+
+std::string AudioBufferQueueSourceNode::enqueueBuffer(
+    const std::shared_ptr<CompactAudioBuffer> &buffer) {
+  return enqueueSourceBuffer(SourceBuffer(buffer, buffer->getSize()));
+}
+
+std::string AudioBufferQueueSourceNode::enqueueSourceBuffer(SourceBuffer buffer) {
   auto locker = Locker(getBufferLock());
-  buffers_.emplace(bufferId_, buffer);
+  buffers_.emplace(bufferId_, std::move(buffer));
 
   if (tailBuffer_ != nullptr) {
     addExtraTailFrames_ = true;
@@ -96,7 +105,7 @@ void AudioBufferQueueSourceNode::dequeueBuffer(const size_t bufferId) {
 
   // If the buffer is not at the front, we need to remove it from the queue.
   // And keep vReadIndex_ at the same position.
-  std::queue<std::pair<size_t, std::shared_ptr<AudioBuffer>>> newQueue;
+  std::queue<std::pair<size_t, SourceBuffer>> newQueue;
   while (!buffers_.empty()) {
     if (buffers_.front().first != bufferId) {
       newQueue.push(buffers_.front());
@@ -171,11 +180,9 @@ void AudioBufferQueueSourceNode::sendOnBufferEndedEvent(size_t bufferId, bool is
   auto onBufferEndedCallbackId = onBufferEndedCallbackId_.load(std::memory_order_acquire);
 
   if (onBufferEndedCallbackId != 0) {
-    std::unordered_map<std::string, EventValue> body = {
-        {"bufferId", std::to_string(bufferId)}, {"isLastBufferInQueue", isLastBufferInQueue}};
-
-    audioEventHandlerRegistry_->invokeHandlerWithEventBody(
-        AudioEvent::BUFFER_ENDED, onBufferEndedCallbackId, body);
+    sendEvent(AudioEventRecord(AudioEvent::BUFFER_ENDED, onBufferEndedCallbackId)
+                  .add("bufferId", AudioEventId{bufferId})
+                  .add("isLastBufferInQueue", isLastBufferInQueue));
   }
 }
 
@@ -198,23 +205,23 @@ void AudioBufferQueueSourceNode::processWithoutInterpolation(
   size_t framesLeft = offsetLength;
 
   while (framesLeft > 0) {
-    size_t framesToEnd = buffer->getSize() - readIndex;
+    size_t framesToEnd = buffer.getSize() - readIndex;
     size_t framesToCopy = std::min(framesToEnd, framesLeft);
     framesToCopy = framesToCopy > 0 ? framesToCopy : 0;
 
     assert(readIndex >= 0);
     assert(writeIndex >= 0);
-    assert(readIndex + framesToCopy <= buffer->getSize());
+    assert(readIndex + framesToCopy <= buffer.getSize());
     assert(writeIndex + framesToCopy <= processingBuffer->getSize());
 
-    processingBuffer->copy(*buffer, readIndex, writeIndex, framesToCopy);
+    buffer.copyTo(*processingBuffer, readIndex, writeIndex, framesToCopy);
 
     writeIndex += framesToCopy;
     readIndex += framesToCopy;
     framesLeft -= framesToCopy;
 
-    if (readIndex >= buffer->getSize()) {
-      playedBuffersDuration_ += buffer->getDuration();
+    if (readIndex >= buffer.getSize()) {
+      playedBuffersDuration_ += buffer.getDuration();
       buffers_.pop();
 
       if (!(buffers_.empty() && addExtraTailFrames_)) {
@@ -223,7 +230,7 @@ void AudioBufferQueueSourceNode::processWithoutInterpolation(
 
       if (buffers_.empty()) {
         if (addExtraTailFrames_) {
-          buffers_.emplace(bufferId, tailBuffer_);
+          buffers_.emplace(bufferId, SourceBuffer(tailBuffer_));
           addExtraTailFrames_ = false;
         } else {
           processingBuffer->zero(writeIndex, framesLeft);
@@ -262,9 +269,9 @@ void AudioBufferQueueSourceNode::processWithInterpolation(
     auto factor = static_cast<float>(vReadIndex_ - static_cast<double>(readIndex));
 
     bool crossBufferInterpolation = false;
-    std::shared_ptr<AudioBuffer> nextBuffer = nullptr;
+    SourceBuffer nextBuffer;
 
-    if (nextReadIndex >= buffer->getSize()) {
+    if (nextReadIndex >= buffer.getSize()) {
       if (buffers_.size() > 1) {
         auto tempQueue = buffers_;
         tempQueue.pop();
@@ -278,16 +285,13 @@ void AudioBufferQueueSourceNode::processWithInterpolation(
 
     for (size_t i = 0; i < processingBuffer->getNumberOfChannels(); i += 1) {
       const auto destination = processingBuffer->getChannel(i)->span();
-      const auto currentSource = buffer->getChannel(i)->span();
 
       if (crossBufferInterpolation) {
-        const auto nextSource = nextBuffer->getChannel(i)->span();
-        float currentSample = currentSource[readIndex];
-        float nextSample = nextSource[nextReadIndex];
+        float currentSample = buffer.getSample(i, readIndex);
+        float nextSample = nextBuffer.getSample(i, nextReadIndex);
         destination[writeIndex] = currentSample + factor * (nextSample - currentSample);
       } else {
-        destination[writeIndex] =
-            dsp::linearInterpolate(currentSource, readIndex, nextReadIndex, factor);
+        destination[writeIndex] = buffer.interpolate(i, readIndex, nextReadIndex, factor);
       }
     }
 
@@ -296,8 +300,8 @@ void AudioBufferQueueSourceNode::processWithInterpolation(
     vReadIndex_ += std::abs(playbackRate);
     framesLeft -= 1;
 
-    if (vReadIndex_ >= static_cast<double>(buffer->getSize())) {
-      playedBuffersDuration_ += buffer->getDuration();
+    if (vReadIndex_ >= static_cast<double>(buffer.getSize())) {
+      playedBuffersDuration_ += buffer.getDuration();
       buffers_.pop();
 
       sendOnBufferEndedEvent(bufferId, buffers_.empty());
@@ -308,7 +312,7 @@ void AudioBufferQueueSourceNode::processWithInterpolation(
         break;
       }
 
-      vReadIndex_ = vReadIndex_ - buffer->getSize();
+      vReadIndex_ = vReadIndex_ - buffer.getSize();
       data = buffers_.front();
       bufferId = data.first;
       buffer = data.second;
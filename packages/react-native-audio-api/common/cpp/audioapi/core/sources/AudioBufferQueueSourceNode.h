@@ -3,6 +3,7 @@
 #include <audioapi/core/sources/AudioBufferBaseSourceNode.h>
 #include <audioapi/libs/signalsmith-stretch/signalsmith-stretch.h>
 #include <audioapi/utils/AudioBuffer.h>
+#include <audioapi/utils/CompactAudioBuffer.h>
 
 #include <algorithm>
 #include <cstddef>
@@ -30,6 +31,8 @@ class AudioBufferQueueSourceNode : public AudioBufferBaseSourceNode {
   void pause();
 
   std::string enqueueBuffer(const std::shared_ptr<AudioBuffer> &buffer);
+  /// @brief Enqueues compact audio, converted to float while processing.
+  std::string enqueueBuffer(const std::shared_ptr<CompactAudioBuffer> &buffer);
   void dequeueBuffer(size_t bufferId);
   void clearBuffers();
   void disable() override;
@@ -47,7 +50,7 @@ class AudioBufferQueueSourceNode : public AudioBufferBaseSourceNode {
 
  private:
   // User provided buffers
-  std::queue<std::pair<size_t, std::shared_ptr<AudioBuffer>>> buffers_;
+  std::queue<std::pair<size_t, SourceBuffer>> buffers_;
   size_t bufferId_ = 0;
 
   bool isPaused_ = false;
@@ -58,6 +61,8 @@ class AudioBufferQueueSourceNode : public AudioBufferBaseSourceNode {
 
   std::atomic<uint64_t> onBufferEndedCallbackId_ = 0; // 0 means no callback
 
+  std::string enqueueSourceBuffer(SourceBuffer buffer);
+
   void processWithoutInterpolation(
       const std::shared_ptr<AudioBuffer> &processingBuffer,
       size_t startOffset,
@@ -8,8 +8,10 @@
 #include <audioapi/events/AudioEventHandlerRegistry.h>
 #include <audioapi/utils/AudioArray.h>
 #include <audioapi/utils/AudioBuffer.h>
+#include <audioapi/utils/PagedAudioFile.h>
 #include <algorithm>
 #include <memory>
+#include <utility>
 
 namespace audioapi {
 
@@ -21,7 +23,11 @@ AudioBufferSourceNode::AudioBufferSourceNode(
       loopSkip_(false),
       loopStart_(options.loopStart),
       loopEnd_(options.loopEnd) {
-        setBuffer(options.buffer);
+  if (options.compactBuffer) {
+    setBuffer(options.compactBuffer);
+  } else {
+    setBuffer(options.buffer);
+  }
   isInitialized_ = true;
 }
 
@@ -29,7 +35,41 @@ AudioBufferSourceNode::~AudioBufferSourceNode() {
   Locker locker(getBufferLock());
 
   buffer_.reset();
-  alignedBuffer_.reset();
+  compactBuffer_.reset();
+  alignedBuffer_ = SourceBuffer();
+}
+
+bool AudioBufferSourceNode::canBeRecycled() const {
+  // a param still held elsewhere could be automated or modulated after the node is reused
+  return detuneParam_.use_count() == 1 && playbackRateParam_.use_count() == 1;
+}
+
+void AudioBufferSourceNode::reset(const AudioBufferSourceOptions &options) {
+  resetPlayback();
+
+  detuneParam_->reset(options.detune);
+  playbackRateParam_->reset(options.playbackRate);
+  pitchCorrection_ = options.pitchCorrection;
+  vReadIndex_ = 0.0;
+  setOnPositionChangedCallbackId(0);
+  onPositionChangedTime_ = 0;
+  setOnLoopEndedCallbackId(0);
+
+  if (std::shared_ptr<BaseAudioContext> context = context_.lock()) {
+    onPositionChangedInterval_ = static_cast<int>(context->getSampleRate() * 0.1);
+  }
+
+  loop_ = options.loop;
+  loopSkip_ = false;
+  loopStart_ = options.loopStart;
+  loopEnd_ = options.loopEnd;
+
+  stretch_->reset();
+  if (options.compactBuffer) {
+    setBuffer(options.compactBuffer);
+  } else {
+    setBuffer(options.buffer);
+  }
 }
 
 bool AudioBufferSourceNode::getLoop() const {
@@ -52,21 +92,30 @@ std::shared_ptr<AudioBuffer> AudioBufferSourceNode::getBuffer() const {
   return buffer_;
 }
 
+std::shared_ptr<CompactAudioBuffer> AudioBufferSourceNode::getCompactBuffer() const {
+  return compactBuffer_;
+}
+
 void AudioBufferSourceNode::setLoop(bool loop) {
   loop_ = loop;
+  keepLoopResident();
 }
 
 void AudioBufferSourceNode::setLoopSkip(bool loopSkip) {
   loopSkip_ = loopSkip;
+  keepLoopResident();
 }
 
 void AudioBufferSourceNode::setLoopStart(double loopStart) {
+  // resident before the audio thread can wrap or skip to it
+  loopStart_ = loopStart;
+  keepLoopResident();
+
   if (loopSkip_) {
     if (std::shared_ptr<BaseAudioContext> context = context_.lock()) {
       vReadIndex_ = loopStart * context->getSampleRate();
     }
   }
-  loopStart_ = loopStart;
 }
 
 void AudioBufferSourceNode::setLoopEnd(double loopEnd) {
@@ -78,38 +127,82 @@ void AudioBufferSourceNode::setBuffer(const std::shared_ptr<AudioBuffer> &buffer
   std::shared_ptr<BaseAudioContext> context = context_.lock();
 
   if (buffer == nullptr || context == nullptr) {
-    buffer_ = std::shared_ptr<AudioBuffer>(nullptr);
-    alignedBuffer_ = std::shared_ptr<AudioBuffer>(nullptr);
-    loopEnd_ = 0;
+    resetBuffer();
     return;
   }
 
   buffer_ = buffer;
+  compactBuffer_.reset();
   channelCount_ = buffer_->getNumberOfChannels();
 
   stretch_->presetDefault(static_cast<int>(channelCount_), buffer_->getSampleRate());
 
+  const auto &pagedFile = buffer_->getPagedFile();
+
   if (pitchCorrection_) {
     int extraTailFrames =
         static_cast<int>((getInputLatency() + getOutputLatency()) * context->getSampleRate());
     size_t totalSize = buffer_->getSize() + extraTailFrames;
 
-    alignedBuffer_ = std::make_shared<AudioBuffer>(totalSize, channelCount_, buffer_->getSampleRate());
-    alignedBuffer_->copy(*buffer_, 0, 0, buffer_->getSize());
+    if (pagedFile && totalSize <= pagedFile->getCapacity()) {
+      // the silent padding of the file serves as the tail, nothing is copied
+      alignedBuffer_ = SourceBuffer(pagedFile->createBuffer(totalSize));
+    } else {
+      auto alignedBuffer =
+          std::make_shared<AudioBuffer>(totalSize, channelCount_, buffer_->getSampleRate());
+      alignedBuffer->copy(*buffer_, 0, 0, buffer_->getSize());
 
-    alignedBuffer_->zero(buffer_->getSize(), extraTailFrames);
+      alignedBuffer->zero(buffer_->getSize(), extraTailFrames);
+      alignedBuffer_ = SourceBuffer(std::move(alignedBuffer));
+    }
+  } else if (pagedFile) {
+    // paged buffers are immutable, so they are read in place
+    alignedBuffer_ = SourceBuffer(buffer_);
   } else {
-    alignedBuffer_ = std::make_shared<AudioBuffer>(*buffer_);
+    alignedBuffer_ = SourceBuffer(std::make_shared<AudioBuffer>(*buffer_));
   }
-  audioBuffer_ =
-      std::make_shared<AudioBuffer>(RENDER_QUANTUM_SIZE, channelCount_, context->getSampleRate());
-  playbackRateBuffer_ = std::make_shared<AudioBuffer>(
-      RENDER_QUANTUM_SIZE * 3, channelCount_, context->getSampleRate());
 
+  allocateProcessingBuffers(context->getSampleRate());
   loopEnd_ = buffer_->getDuration();
+
+  startRegion_.reset();
+  keepLoopResident();
+}
+
+void AudioBufferSourceNode::setBuffer(const std::shared_ptr<CompactAudioBuffer> &buffer) {
+  Locker locker(getBufferLock());
+  std::shared_ptr<BaseAudioContext> context = context_.lock();
+
+  if (buffer == nullptr || context == nullptr) {
+    resetBuffer();
+    return;
+  }
+
+  buffer_.reset();
+  startRegion_.reset();
+  loopRegion_.reset();
+  compactBuffer_ = buffer;
+  channelCount_ = compactBuffer_->getNumberOfChannels();
+
+  stretch_->presetDefault(static_cast<int>(channelCount_), compactBuffer_->getSampleRate());
+
+  // compact buffers are immutable and read as silence past their end,
+  // so they are read in place and the pitch correction tail comes for free
+  size_t totalSize = compactBuffer_->getSize();
+  if (pitchCorrection_) {
+    totalSize +=
+        static_cast<size_t>((getInputLatency() + getOutputLatency()) * context->getSampleRate());
+  }
+  alignedBuffer_ = SourceBuffer(compactBuffer_, totalSize);
+
+  allocateProcessingBuffers(context->getSampleRate());
+  loopEnd_ = compactBuffer_->getDuration();
 }
 
 void AudioBufferSourceNode::start(double when, double offset, double duration) {
+  // a paged buffer may have dropped the frames at the offset
+  startRegion_ = keepResident(offset);
+
   AudioScheduledSourceNode::start(when);
 
   if (duration > 0) {
@@ -121,18 +214,18 @@ void AudioBufferSourceNode::start(double when, double offset, double duration) {
   }
 
   offset =
-      std::min(offset, static_cast<double>(alignedBuffer_->getSize()) / alignedBuffer_->getSampleRate());
+      std::min(offset, static_cast<double>(alignedBuffer_.getSize()) / alignedBuffer_.getSampleRate());
 
   if (loop_) {
     offset = std::min(offset, loopEnd_);
   }
 
-  vReadIndex_ = static_cast<double>(alignedBuffer_->getSampleRate() * offset);
+  vReadIndex_ = static_cast<double>(alignedBuffer_.getSampleRate() * offset);
 }
 
 void AudioBufferSourceNode::disable() {
   AudioScheduledSourceNode::disable();
-  alignedBuffer_.reset();
+  alignedBuffer_ = SourceBuffer();
 }
 
 void AudioBufferSourceNode::setOnLoopEndedCallbackId(uint64_t callbackId) {
@@ -159,6 +252,12 @@ std::shared_ptr<AudioBuffer> AudioBufferSourceNode::processNode(
       processWithPitchCorrection(processingBuffer, framesToProcess);
     }
 
+    if (const auto &alignedBuffer = alignedBuffer_.getBuffer()) {
+      if (const auto &pagedFile = alignedBuffer->getPagedFile()) {
+        pagedFile->setReadPosition(static_cast<size_t>(vReadIndex_));
+      }
+    }
+
     handleStopScheduled();
   } else {
     processingBuffer->zero();
@@ -168,14 +267,14 @@ std::shared_ptr<AudioBuffer> AudioBufferSourceNode::processNode(
 }
 
 double AudioBufferSourceNode::getCurrentPosition() const {
-  return dsp::sampleFrameToTime(static_cast<int>(vReadIndex_), buffer_->getSampleRate());
+  auto sampleRate = compactBuffer_ ? compactBuffer_->getSampleRate() : buffer_->getSampleRate();
+  return dsp::sampleFrameToTime(static_cast<int>(vReadIndex_), sampleRate);
 }
 
 void AudioBufferSourceNode::sendOnLoopEndedEvent() {
   auto onLoopEndedCallbackId = onLoopEndedCallbackId_.load(std::memory_order_acquire);
   if (onLoopEndedCallbackId != 0) {
-    audioEventHandlerRegistry_->invokeHandlerWithEventBody(
-        AudioEvent::LOOP_ENDED, onLoopEndedCallbackId, {});
+    sendEvent(AudioEventRecord(AudioEvent::LOOP_ENDED, onLoopEndedCallbackId));
   }
 }
 
@@ -221,17 +320,14 @@ void AudioBufferSourceNode::processWithoutInterpolation(
 
     assert(readIndex >= 0);
     assert(writeIndex >= 0);
-    assert(readIndex + framesToCopy <= alignedBuffer_->getSize());
+    assert(readIndex + framesToCopy <= alignedBuffer_.getSize());
     assert(writeIndex + framesToCopy <= processingBuffer->getSize());
 
     // Direction is forward, we can normally copy the data
     if (direction == 1) {
-      processingBuffer->copy(*alignedBuffer_, readIndex, writeIndex, framesToCopy);
+      alignedBuffer_.copyTo(*processingBuffer, readIndex, writeIndex, framesToCopy);
     } else {
-      for (size_t ch = 0; ch < processingBuffer->getNumberOfChannels(); ch += 1) {
-        processingBuffer->getChannel(ch)->copyReverse(
-            *alignedBuffer_->getChannel(ch), readIndex, writeIndex, framesToCopy);
-      }
+      alignedBuffer_.copyReverseTo(*processingBuffer, readIndex, writeIndex, framesToCopy);
     }
 
     writeIndex += framesToCopy;
@@ -298,9 +394,8 @@ void AudioBufferSourceNode::processWithInterpolation(
 
     for (size_t i = 0; i < processingBuffer->getNumberOfChannels(); i++) {
       auto destination = processingBuffer->getChannel(i)->span();
-      const auto source = alignedBuffer_->getChannel(i)->span();
 
-      destination[writeIndex] = dsp::linearInterpolate(source, readIndex, nextReadIndex, factor);
+      destination[writeIndex] = alignedBuffer_.interpolate(i, readIndex, nextReadIndex, factor);
     }
 
     writeIndex += 1;
@@ -321,13 +416,58 @@ void AudioBufferSourceNode::processWithInterpolation(
   }
 }
 
+void AudioBufferSourceNode::resetBuffer() {
+  buffer_.reset();
+  compactBuffer_.reset();
+  alignedBuffer_ = SourceBuffer();
+  loopEnd_ = 0;
+  startRegion_.reset();
+  loopRegion_.reset();
+}
+
+void AudioBufferSourceNode::keepLoopResident() {
+  // wrapping around, or skipping with loopSkip, jumps back to the loop start
+  if (loop_ || loopSkip_) {
+    loopRegion_ = keepResident(loopStart_);
+  } else {
+    loopRegion_.reset();
+  }
+}
+
+std::unique_ptr<PagedAudioFile::ResidentRegion> AudioBufferSourceNode::keepResident(
+    double time) const {
+  if (!buffer_ || !buffer_->getPagedFile()) {
+    return nullptr;
+  }
+
+  // the window follows the read position once the audio thread has published it
+  auto sampleRate = buffer_->getSampleRate();
+  time = time > 0.0 ? std::min(time, buffer_->getDuration()) : 0.0;
+  auto begin = static_cast<size_t>(time * sampleRate);
+  auto frames = static_cast<size_t>(PagedAudioFile::kPrefetchAheadSeconds * sampleRate);
+  return buffer_->getPagedFile()->keepResident(begin, begin + frames);
+}
+
+void AudioBufferSourceNode::allocateProcessingBuffers(float sampleRate) {
+  // a recycled node playing a buffer with the same layout keeps its buffers
+  if (audioBuffer_->getNumberOfChannels() == channelCount_ &&
+      audioBuffer_->getSampleRate() == sampleRate &&
+      playbackRateBuffer_->getNumberOfChannels() == channelCount_) {
+    return;
+  }
+
+  audioBuffer_ = std::make_shared<AudioBuffer>(RENDER_QUANTUM_SIZE, channelCount_, sampleRate);
+  playbackRateBuffer_ =
+      std::make_shared<AudioBuffer>(RENDER_QUANTUM_SIZE * 3, channelCount_, sampleRate);
+}
+
 double AudioBufferSourceNode::getVirtualStartFrame(float sampleRate) const {
   auto loopStartFrame = loopStart_ * sampleRate;
   return loop_ && loopStartFrame >= 0 && loopStart_ < loopEnd_ ? loopStartFrame : 0.0;
 }
 
 double AudioBufferSourceNode::getVirtualEndFrame(float sampleRate) {
-  auto inputBufferLength = static_cast<double>(alignedBuffer_->getSize());
+  auto inputBufferLength = static_cast<double>(alignedBuffer_.getSize());
   auto loopEndFrame = loopEnd_ * sampleRate;
 
   return loop_ && loopEndFrame > 0 && loopStart_ < loopEnd_
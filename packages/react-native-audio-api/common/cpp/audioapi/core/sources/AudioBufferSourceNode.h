@@ -3,6 +3,8 @@
 #include <audioapi/core/sources/AudioBufferBaseSourceNode.h>
 #include <audioapi/libs/signalsmith-stretch/signalsmith-stretch.h>
 #include <audioapi/utils/AudioBuffer.h>
+#include <audioapi/utils/CompactAudioBuffer.h>
+#include <audioapi/utils/PagedAudioFile.h>
 
 #include <algorithm>
 #include <cstddef>
@@ -27,12 +29,15 @@ class AudioBufferSourceNode : public AudioBufferBaseSourceNode {
   [[nodiscard]] double getLoopStart() const;
   [[nodiscard]] double getLoopEnd() const;
   [[nodiscard]] std::shared_ptr<AudioBuffer> getBuffer() const;
+  [[nodiscard]] std::shared_ptr<CompactAudioBuffer> getCompactBuffer() const;
 
   void setLoop(bool loop);
   void setLoopSkip(bool loopSkip);
   void setLoopStart(double loopStart);
   void setLoopEnd(double loopEnd);
   void setBuffer(const std::shared_ptr<AudioBuffer> &buffer);
+  /// @brief Plays compact audio, converting it to float while processing.
+  void setBuffer(const std::shared_ptr<CompactAudioBuffer> &buffer);
 
   using AudioScheduledSourceNode::start;
   void start(double when, double offset, double duration = -1);
@@ -40,6 +45,12 @@ class AudioBufferSourceNode : public AudioBufferBaseSourceNode {
 
   void setOnLoopEndedCallbackId(uint64_t callbackId);
 
+  [[nodiscard]] bool canBeRecycled() const override;
+
+  /// @brief Brings a recycled node back to the state of a new one created with the options.
+  /// The processing buffers and the stretcher are kept.
+  void reset(const AudioBufferSourceOptions &options);
+
  protected:
   std::shared_ptr<AudioBuffer> processNode(
       const std::shared_ptr<AudioBuffer> &processingBuffer,
@@ -53,9 +64,14 @@ class AudioBufferSourceNode : public AudioBufferBaseSourceNode {
   double loopStart_;
   double loopEnd_;
 
-  // User provided buffer
+  // User provided buffer, at most one of them is set
   std::shared_ptr<AudioBuffer> buffer_;
-  std::shared_ptr<AudioBuffer> alignedBuffer_;
+  std::shared_ptr<CompactAudioBuffer> compactBuffer_;
+  SourceBuffer alignedBuffer_;
+
+  // frames of a paged buffer the node jumps to, faulted in on the JS thread
+  std::unique_ptr<PagedAudioFile::ResidentRegion> startRegion_;
+  std::unique_ptr<PagedAudioFile::ResidentRegion> loopRegion_;
 
   std::atomic<uint64_t> onLoopEndedCallbackId_ = 0; // 0 means no callback
   void sendOnLoopEndedEvent();
@@ -72,6 +88,11 @@ class AudioBufferSourceNode : public AudioBufferBaseSourceNode {
       size_t offsetLength,
       float playbackRate) override;
 
+  void resetBuffer();
+  void keepLoopResident();
+  [[nodiscard]] std::unique_ptr<PagedAudioFile::ResidentRegion> keepResident(double time) const;
+  void allocateProcessingBuffers(float sampleRate);
+
   double getVirtualStartFrame(float sampleRate) const;
   double getVirtualEndFrame(float sampleRate);
 };
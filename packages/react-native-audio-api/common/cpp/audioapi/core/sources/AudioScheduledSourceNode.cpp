@@ -13,6 +13,7 @@
 #include <algorithm>
 #include <limits>
 #include <memory>
+#include <utility>
 
 namespace audioapi {
 
@@ -23,7 +24,8 @@ AudioScheduledSourceNode::AudioScheduledSourceNode(
       startTime_(-1.0),
       stopTime_(-1.0),
       playbackState_(PlaybackState::UNSCHEDULED),
-      audioEventHandlerRegistry_(context->getAudioEventHandlerRegistry()) {}
+      audioEventHandlerRegistry_(context->getAudioEventHandlerRegistry()),
+      eventQueue_(context->getEventQueue()) {}
 
 void AudioScheduledSourceNode::start(double when) {
 #if !RN_AUDIO_API_TEST
@@ -167,15 +169,36 @@ void AudioScheduledSourceNode::disable() {
 
   auto onEndedCallbackId = onEndedCallbackId_.load(std::memory_order_acquire);
   if (onEndedCallbackId != 0) {
-    audioEventHandlerRegistry_->invokeHandlerWithEventBody(
-        AudioEvent::ENDED, onEndedCallbackId, {});
+    sendEvent(AudioEventRecord(AudioEvent::ENDED, onEndedCallbackId));
   }
 }
 
+void AudioScheduledSourceNode::sendEvent(const AudioEventRecord &record) {
+  if (eventQueue_ != nullptr) {
+    eventQueue_->push(record);
+  }
+}
+
+void AudioScheduledSourceNode::resetPlayback() {
+  reinitialize();
+
+  startTime_ = -1.0;
+  stopTime_ = -1.0;
+  playbackState_ = PlaybackState::UNSCHEDULED;
+  setOnEndedCallbackId(0);
+}
+
 void AudioScheduledSourceNode::handleStopScheduled() {
   if (isStopScheduled()) {
     playbackState_ = PlaybackState::FINISHED;
     disable();
+
+    // a finished node is reclaimed in the next quantum if nothing else holds it
+    std::shared_ptr<BaseAudioContext> context = context_.lock();
+    std::shared_ptr<AudioNode> node = weak_from_this().lock();
+    if (context != nullptr && node != nullptr) {
+      context->getGraphManager()->addReclaimCandidate(std::move(node));
+    }
   }
 }
 
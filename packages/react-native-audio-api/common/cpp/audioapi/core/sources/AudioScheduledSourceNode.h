@@ -18,6 +18,8 @@
 namespace audioapi {
 
 class IAudioEventHandlerRegistry;
+class AudioEventQueue;
+struct AudioEventRecord;
 
 class AudioScheduledSourceNode : public AudioNode {
  public:
@@ -44,6 +46,13 @@ class AudioScheduledSourceNode : public AudioNode {
 
   void disable() override;
 
+  /// @brief Whether the node can be reset and played again instead of being destroyed, once
+  /// nothing but the graph holds it.
+  /// @note Called on the audio thread.
+  [[nodiscard]] virtual bool canBeRecycled() const {
+    return false;
+  }
+
  protected:
   double startTime_;
   double stopTime_;
@@ -52,6 +61,11 @@ class AudioScheduledSourceNode : public AudioNode {
 
   std::atomic<uint64_t> onEndedCallbackId_ = 0;
   std::shared_ptr<IAudioEventHandlerRegistry> audioEventHandlerRegistry_;
+  std::shared_ptr<AudioEventQueue> eventQueue_;
+
+  /// @brief Queues the event to be delivered on the JS thread.
+  /// @note Real-time safe, never allocates nor locks.
+  void sendEvent(const AudioEventRecord &record);
 
   void updatePlaybackInfo(
       const std::shared_ptr<AudioBuffer> &processingBuffer,
@@ -62,6 +76,9 @@ class AudioScheduledSourceNode : public AudioNode {
       size_t currentSampleFrame);
 
   void handleStopScheduled();
+
+  /// @brief Brings the playback state back to the one of a new node, see canBeRecycled.
+  void resetPlayback();
 };
 
 } // namespace audioapi
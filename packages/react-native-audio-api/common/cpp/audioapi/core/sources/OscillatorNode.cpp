@@ -32,6 +32,27 @@ OscillatorNode::OscillatorNode(
   isInitialized_ = true;
 }
 
+bool OscillatorNode::canBeRecycled() const {
+  // a param still held elsewhere could be automated or modulated after the node is reused
+  return frequencyParam_.use_count() == 1 && detuneParam_.use_count() == 1;
+}
+
+void OscillatorNode::reset(const OscillatorOptions &options) {
+  resetPlayback();
+
+  frequencyParam_->reset(options.frequency);
+  detuneParam_->reset(options.detune);
+  phase_ = 0.0;
+  channelCount_ = options.channelCount;
+
+  type_ = options.type;
+  if (options.periodicWave) {
+    periodicWave_ = options.periodicWave;
+  } else if (std::shared_ptr<BaseAudioContext> context = context_.lock()) {
+    periodicWave_ = context->getBasicWaveForm(type_);
+  }
+}
+
 std::shared_ptr<AudioParam> OscillatorNode::getFrequencyParam() const {
   return frequencyParam_;
 }
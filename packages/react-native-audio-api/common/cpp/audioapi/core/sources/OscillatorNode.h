@@ -27,6 +27,11 @@ class OscillatorNode : public AudioScheduledSourceNode {
   void setType(OscillatorType);
   void setPeriodicWave(const std::shared_ptr<PeriodicWave> &periodicWave);
 
+  [[nodiscard]] bool canBeRecycled() const override;
+
+  /// @brief Brings a recycled node back to the state of a new one created with the options.
+  void reset(const OscillatorOptions &options);
+
  protected:
   std::shared_ptr<AudioBuffer> processNode(
       const std::shared_ptr<AudioBuffer> &processingBuffer,
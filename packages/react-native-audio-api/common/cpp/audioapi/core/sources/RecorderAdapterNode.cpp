@@ -23,12 +23,11 @@ void RecorderAdapterNode::init(size_t bufferSize, int channelCount) {
   }
 
   channelCount_ = channelCount;
-
-  buff_.resize(channelCount_);
-
-  for (size_t i = 0; i < channelCount_; ++i) {
-    buff_[i] = std::make_shared<CircularOverflowableAudioArray>(bufferSize);
-  }
+  buff_ = std::make_shared<CircularAudioBuffer>(
+      bufferSize,
+      channelCount_,
+      context->getSampleRate(),
+      CircularAudioBuffer::OverflowPolicy::OVERWRITE_OLDEST);
 
   // This assumes that the sample rate is the same in audio context and recorder.
   // (recorder is not enforcing any sample rate on the system*). This means that only
@@ -48,10 +47,17 @@ void RecorderAdapterNode::init(size_t bufferSize, int channelCount) {
 
 void RecorderAdapterNode::cleanup() {
   isInitialized_ = false;
-  buff_.clear();
+  buff_.reset();
   adapterOutputBuffer_.reset();
 }
 
+CircularAudioBuffer::Stats RecorderAdapterNode::getBufferStats() const {
+  if (buff_ == nullptr) {
+    return {};
+  }
+  return buff_->getStats();
+}
+
 std::shared_ptr<AudioBuffer> RecorderAdapterNode::processNode(
     const std::shared_ptr<AudioBuffer> &processingBuffer,
     int framesToProcess) {
@@ -68,10 +74,7 @@ std::shared_ptr<AudioBuffer> RecorderAdapterNode::processNode(
 
 void RecorderAdapterNode::readFrames(const size_t framesToRead) {
   adapterOutputBuffer_->zero();
-
-  for (size_t channel = 0; channel < channelCount_; ++channel) {
-    buff_[channel]->read(*adapterOutputBuffer_->getChannel(channel), framesToRead);
-  }
+  buff_->read(*adapterOutputBuffer_, framesToRead);
 }
 
 } // namespace audioapi
@@ -4,7 +4,7 @@
 #include <audioapi/core/AudioParam.h>
 #include <audioapi/core/BaseAudioContext.h>
 #include <audioapi/core/inputs/AudioRecorder.h>
-#include <audioapi/utils/CircularOverflowableAudioArray.h>
+#include <audioapi/utils/CircularAudioBuffer.h>
 #include <memory>
 #include <vector>
 
@@ -13,7 +13,8 @@ namespace audioapi {
 class AudioBuffer;
 
 /// @brief RecorderAdapterNode is an AudioNode which adapts push Recorder into pull graph.
-/// It uses RingBuffer to store audio data and AudioParam to provide audio data in pull mode.
+/// It uses a wait-free ring to store audio data and provides it to the graph in pull mode.
+/// When the recorder gets ahead of the graph, the oldest audio is overwritten.
 /// It is used to connect native audio recording APIs with Audio API.
 ///
 /// @note it will push silence if it is not connected to any Recorder
@@ -29,8 +30,11 @@ class RecorderAdapterNode : public AudioNode {
   void cleanup();
 
   int channelCount_{};
-  // TODO: CircularOverflowableAudioBuffer
-  std::vector<std::shared_ptr<CircularOverflowableAudioArray>> buff_;
+  std::shared_ptr<CircularAudioBuffer> buff_;
+
+  /// @brief Frames passed from the recorder to the graph, lost and missing,
+  /// which show the drift between the recorder and the audio output.
+  [[nodiscard]] CircularAudioBuffer::Stats getBufferStats() const;
 
  protected:
   std::shared_ptr<AudioBuffer> processNode(
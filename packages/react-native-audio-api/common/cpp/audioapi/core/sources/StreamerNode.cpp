@@ -14,6 +14,7 @@
 #include <audioapi/core/utils/Locker.h>
 #include <audioapi/utils/AudioArray.h>
 #include <audioapi/utils/AudioBuffer.h>
+#include <algorithm>
 #include <chrono>
 #include <cstdio>
 #include <memory>
@@ -26,6 +27,9 @@ StreamerNode::StreamerNode(
     const std::shared_ptr<BaseAudioContext> &context,
     const StreamerOptions &options)
     : AudioScheduledSourceNode(context, options),
+      prebufferDuration_(options.prebufferDuration),
+      lowWaterDuration_(options.lowWaterDuration),
+      pendingSeekTime_(-1.0),
       fmtCtx_(nullptr),
       codecCtx_(nullptr),
       decoder_(nullptr),
@@ -34,16 +38,19 @@ StreamerNode::StreamerNode(
       frame_(nullptr),
       swrCtx_(nullptr),
       resampledData_(nullptr),
-      bufferedAudioBuffer_(nullptr),
-      bufferedAudioBufferSize_(0),
       audio_stream_index_(-1),
       maxResampledSamples_(0),
-      processedSamples_(0) {}
+      seekTargetTimestamp_(AV_NOPTS_VALUE),
+      seekEntryTimestamp_(AV_NOPTS_VALUE),
+      framesToDiscard_(0) {}
 #else
 StreamerNode::StreamerNode(
     const std::shared_ptr<BaseAudioContext> &context,
     const StreamerOptions &options)
-    : AudioScheduledSourceNode(context) {}
+    : AudioScheduledSourceNode(context),
+      prebufferDuration_(options.prebufferDuration),
+      lowWaterDuration_(options.lowWaterDuration),
+      pendingSeekTime_(-1.0) {}
 #endif // RN_AUDIO_API_FFMPEG_DISABLED
 
 StreamerNode::~StreamerNode() {
@@ -91,12 +98,25 @@ bool StreamerNode::initialize(const std::string &input_url) {
   audioBuffer_ =
       std::make_shared<AudioBuffer>(RENDER_QUANTUM_SIZE, channelCount_, context->getSampleRate());
 
-  auto [sender, receiver] = channels::spsc::channel<
-      StreamingData,
-      STREAMER_NODE_SPSC_OVERFLOW_STRATEGY,
-      STREAMER_NODE_SPSC_WAIT_STRATEGY>(CHANNEL_CAPACITY);
-  sender_ = std::move(sender);
-  receiver_ = std::move(receiver);
+  // the pool holds twice the larger threshold, so that after refilling
+  // from the low-water mark the decoding thread can stay ahead of playback
+  float sampleRate = context->getSampleRate();
+  auto thresholdFrames =
+      static_cast<size_t>(std::max(prebufferDuration_, lowWaterDuration_) * sampleRate);
+  size_t numberOfChunks = std::max<size_t>(
+      CHANNEL_CAPACITY, (2 * thresholdFrames + CHUNK_FRAMES - 1) / CHUNK_FRAMES + 1);
+  chunkPool_ = std::make_unique<AudioChunkPool>(
+      channelCount_,
+      sampleRate,
+      numberOfChunks,
+      CHUNK_FRAMES,
+      static_cast<size_t>(prebufferDuration_ * sampleRate),
+      static_cast<size_t>(lowWaterDuration_ * sampleRate));
+
+  AVStream *stream = fmtCtx_->streams[audio_stream_index_];
+  auto seekIndexDistance = static_cast<int64_t>(SEEK_INDEX_DISTANCE * AV_TIME_BASE);
+  seekIndex_ = SeekIndex(
+      av_rescale_q(seekIndexDistance, AV_TIME_BASE_Q, stream->time_base), SEEK_INDEX_MAX_ENTRIES);
 
   streamingThread_ = std::thread(&StreamerNode::streamAudio, this);
   isInitialized_ = true;
@@ -126,38 +146,38 @@ std::shared_ptr<AudioBuffer> StreamerNode::processNode(
       context->getCurrentSampleFrame());
   isNodeFinished_.store(isFinished(), std::memory_order_release);
 
-  if (!isPlaying() && !isStopScheduled()) {
+  if ((!isPlaying() && !isStopScheduled()) || chunkPool_ == nullptr) {
     processingBuffer->zero();
     return processingBuffer;
   }
 
-  int bufferRemaining = bufferedAudioBufferSize_ - processedSamples_;
-  int alreadyProcessed = 0;
-  if (bufferRemaining < framesToProcess) {
-    if (bufferedAudioBuffer_ != nullptr) {
-      processingBuffer->copy(*bufferedAudioBuffer_, processedSamples_, 0, bufferRemaining);
-      framesToProcess -= bufferRemaining;
-      alreadyProcessed += bufferRemaining;
-    }
-    StreamingData data;
-    auto res = receiver_.try_receive(data);
-    if (res == channels::spsc::ResponseStatus::SUCCESS) {
-      bufferedAudioBuffer_ = std::make_shared<AudioBuffer>(std::move(data.buffer));
-      bufferedAudioBufferSize_ = data.size;
-      processedSamples_ = 0;
-    } else {
-      bufferedAudioBuffer_ = nullptr;
-    }
-  }
-  if (bufferedAudioBuffer_ != nullptr) {
-    processingBuffer->copy(*bufferedAudioBuffer_, processedSamples_, alreadyProcessed, framesToProcess);
-    processedSamples_ += framesToProcess;
-  }
+  // frames before the start offset were zeroed by updatePlaybackInfo
+  chunkPool_->read(*processingBuffer, startOffset, offsetLength);
 #endif // RN_AUDIO_API_FFMPEG_DISABLED
 
   return processingBuffer;
 }
 
+AudioChunkPool::Stats StreamerNode::getStats() const {
+#if !RN_AUDIO_API_FFMPEG_DISABLED
+  if (chunkPool_ != nullptr) {
+    return chunkPool_->getStats();
+  }
+#endif // RN_AUDIO_API_FFMPEG_DISABLED
+  return {};
+}
+
+void StreamerNode::seek(double time) {
+  // published before the flush, so the streaming thread sees it once it sees the flush
+  pendingSeekTime_.store(std::max(time, 0.0), std::memory_order_release);
+#if !RN_AUDIO_API_FFMPEG_DISABLED
+  if (chunkPool_ != nullptr) {
+    // stops the buffered audio at once and interrupts the streaming thread
+    chunkPool_->flush();
+  }
+#endif // RN_AUDIO_API_FFMPEG_DISABLED
+}
+
 #if !RN_AUDIO_API_FFMPEG_DISABLED
 bool StreamerNode::setupResampler(float outSampleRate) {
   // Allocate resampler context
@@ -195,32 +215,148 @@ bool StreamerNode::setupResampler(float outSampleRate) {
 }
 
 void StreamerNode::streamAudio() {
+  // a seek requested before the pool was created came without a flush
+  seekToPendingTimes(pendingSeekTime_.exchange(-1.0, std::memory_order_acq_rel));
+
   while (!isNodeFinished_.load(std::memory_order_acquire)) {
-    if (av_read_frame(fmtCtx_, pkt_) < 0) {
-      return;
-    }
-    if (pkt_->stream_index == audio_stream_index_) {
-      if (avcodec_send_packet(codecCtx_, pkt_) != 0) {
-        return;
+    // a seek is taken only together with its flush, a later flush would drop the sought audio
+    if (chunkPool_->isFlushPending()) {
+      double seekTime = pendingSeekTime_.exchange(-1.0, std::memory_order_acq_rel);
+      if (seekTime < 0.0) {
+        // the time of this flush was taken early, with an earlier flush, and the audio decoded
+        // for it since then is dropped by this one, so that seek is done again
+        seekTime = lastSeekTime_;
       }
-      if (avcodec_receive_frame(codecCtx_, frame_) != 0) {
-        return;
+      if (seekTime >= 0.0) {
+        seekToPendingTimes(seekTime);
+      } else {
+        chunkPool_->acknowledgeFlush();
       }
-      std::shared_ptr<BaseAudioContext> context = context_.lock();
-      if (context == nullptr) {
+    }
+
+    int ret = av_read_frame(fmtCtx_, pkt_);
+    if (ret == AVERROR_EOF) {
+      // flush the frames still buffered in the decoder
+      if (decodePacket(nullptr)) {
+        chunkPool_->finish();
+        // keep the thread alive for seeking back into the stream
+        if (!chunkPool_->waitForFlush()) {
+          return;
+        }
+      } else if (!chunkPool_->isFlushPending()) {
         return;
       }
-      if (!processFrameWithResampler(frame_, context)) {
-        return;
+      continue;
+    }
+    if (ret < 0) {
+      return;
+    }
+
+    bool isDecoded = true;
+    if (pkt_->stream_index == audio_stream_index_) {
+      if ((pkt_->flags & AV_PKT_FLAG_KEY) && pkt_->pts != AV_NOPTS_VALUE && pkt_->pos >= 0) {
+        seekIndex_.add(pkt_->pts, pkt_->pos);
       }
+      isDecoded = decodePacket(pkt_);
     }
     av_packet_unref(pkt_);
+
+    // writing to the pool is interrupted by a flush, which is handled on the next pass
+    if (!isDecoded && !chunkPool_->isFlushPending()) {
+      return;
+    }
+  }
+}
+
+void StreamerNode::seekToPendingTimes(double time) {
+  // the acknowledgement of a seek also takes the flush of a seek requested meanwhile,
+  // so its time is taken right away instead of waiting for a flush that already happened
+  while (time >= 0.0) {
+    seekStream(time);
+    time = pendingSeekTime_.exchange(-1.0, std::memory_order_acq_rel);
   }
 }
 
-bool StreamerNode::processFrameWithResampler(
-    AVFrame *frame,
-    const std::shared_ptr<BaseAudioContext> &context) {
+void StreamerNode::seekStream(double time) {
+  lastSeekTime_ = time;
+  AVStream *stream = fmtCtx_->streams[audio_stream_index_];
+  int64_t timestamp = av_rescale_q(
+      static_cast<int64_t>(time * AV_TIME_BASE), AV_TIME_BASE_Q, stream->time_base);
+  if (stream->start_time != AV_NOPTS_VALUE) {
+    timestamp += stream->start_time;
+  }
+
+  int ret = -1;
+  seekEntryTimestamp_ = AV_NOPTS_VALUE;
+
+  // jumping to a known keyframe avoids searching the file for the timestamp
+  auto entry = seekIndex_.find(timestamp);
+  if (entry.has_value() && !(fmtCtx_->iformat->flags & AVFMT_NO_BYTE_SEEK)) {
+    ret = av_seek_frame(fmtCtx_, -1, entry->position, AVSEEK_FLAG_BYTE);
+    if (ret >= 0) {
+      seekEntryTimestamp_ = entry->timestamp;
+    }
+  }
+  if (ret < 0) {
+    ret = av_seek_frame(fmtCtx_, audio_stream_index_, timestamp, AVSEEK_FLAG_BACKWARD);
+  }
+
+  if (ret < 0) {
+    if (VERBOSE)
+      printf("Failed to seek to %f\n", time);
+    // the stream continues from where it was
+    chunkPool_->acknowledgeFlush();
+    return;
+  }
+
+  avcodec_flush_buffers(codecCtx_);
+  // drops the samples buffered in the resampler
+  swr_init(swrCtx_);
+
+  seekTargetTimestamp_ = timestamp;
+  framesToDiscard_ = 0;
+
+  // audio decoded since the seek request failed to be written or is tagged with an older flush
+  chunkPool_->acknowledgeFlush();
+}
+
+size_t StreamerNode::getPreRollFrames(const AVFrame *frame) const {
+  int64_t frameTimestamp = frame->best_effort_timestamp;
+  if (frameTimestamp == AV_NOPTS_VALUE) {
+    // after a byte seek the first frame can lack a timestamp
+    frameTimestamp = seekEntryTimestamp_;
+  }
+  if (frameTimestamp == AV_NOPTS_VALUE || frameTimestamp >= seekTargetTimestamp_) {
+    return 0;
+  }
+
+  AVStream *stream = fmtCtx_->streams[audio_stream_index_];
+  auto outSampleRate = static_cast<int>(audioBuffer_->getSampleRate());
+  return static_cast<size_t>(av_rescale_q(
+      seekTargetTimestamp_ - frameTimestamp, stream->time_base, AVRational{1, outSampleRate}));
+}
+
+bool StreamerNode::decodePacket(const AVPacket *packet) {
+  int ret = avcodec_send_packet(codecCtx_, packet);
+  // a corrupted packet is skipped instead of ending the stream
+  if (ret == AVERROR_INVALIDDATA) {
+    return true;
+  }
+  if (ret < 0) {
+    return false;
+  }
+
+  // a packet can contain any number of frames
+  while ((ret = avcodec_receive_frame(codecCtx_, frame_)) == 0) {
+    if (!processFrameWithResampler(frame_)) {
+      return false;
+    }
+  }
+
+  return ret == AVERROR(EAGAIN) || ret == AVERROR_EOF;
+}
+
+bool StreamerNode::processFrameWithResampler(AVFrame *frame) {
   // Check if we need to reallocate the resampled buffer
   int out_samples = swr_get_out_samples(swrCtx_, frame->nb_samples);
   if (out_samples > maxResampledSamples_) {
@@ -258,17 +394,21 @@ bool StreamerNode::processFrameWithResampler(
     return true;
   }
 
-  AudioBuffer buffer =
-      AudioBuffer(converted_samples, codecCtx_->ch_layout.nb_channels, context->getSampleRate());
-
-  for (size_t ch = 0; ch < codecCtx_->ch_layout.nb_channels; ch++) {
-    auto *src = reinterpret_cast<float *>(resampledData_[ch]);
-    buffer.getChannel(ch)->copy(src, 0, 0, converted_samples);
+  auto framesToWrite = static_cast<size_t>(converted_samples);
+  if (seekTargetTimestamp_ != AV_NOPTS_VALUE) {
+    framesToDiscard_ = getPreRollFrames(frame);
+    seekTargetTimestamp_ = AV_NOPTS_VALUE;
   }
 
-  StreamingData data{std::move(buffer), static_cast<size_t>(converted_samples)};
-  sender_.send(std::move(data));
-  return true;
+  // the pre-roll can span several frames
+  size_t discarded = std::min(framesToDiscard_, framesToWrite);
+  framesToDiscard_ -= discarded;
+
+  // fails when the pool was closed by cleanup or flushed by seek
+  return chunkPool_->write(
+      reinterpret_cast<const float *const *>(resampledData_),
+      discarded,
+      framesToWrite - discarded);
 }
 
 bool StreamerNode::openInput(const std::string &input_url) {
@@ -314,10 +454,10 @@ bool StreamerNode::setupDecoder() {
 void StreamerNode::cleanup() {
   this->playbackState_ = PlaybackState::FINISHED;
   isNodeFinished_.store(true, std::memory_order_release);
+  if (chunkPool_ != nullptr) {
+    chunkPool_->close(); // wake the streaming thread if it waits for free chunks
+  }
   if (streamingThread_.joinable()) {
-    StreamingData dummy;
-    while (receiver_.try_receive(dummy) == channels::spsc::ResponseStatus::SUCCESS)
-      ; // clear the receiver
     streamingThread_.join();
   }
   if (swrCtx_ != nullptr) {
@@ -350,6 +490,9 @@ void StreamerNode::cleanup() {
   decoder_ = nullptr;
   codecpar_ = nullptr;
   maxResampledSamples_ = 0;
+  seekIndex_.clear();
+  seekTargetTimestamp_ = AV_NOPTS_VALUE;
+  framesToDiscard_ = 0;
 }
 #endif // RN_AUDIO_API_FFMPEG_DISABLED
 } // namespace audioapi
@@ -24,37 +24,17 @@ extern "C" {
 }
 #endif // RN_AUDIO_API_FFMPEG_DISABLED
 
-#include <audioapi/utils/SpscChannel.hpp>
+#include <audioapi/core/utils/AudioChunkPool.h>
+#include <audioapi/core/utils/SeekIndex.h>
 #include <atomic>
 #include <cmath>
 #include <memory>
 #include <string>
-#include <utility>
-
-inline constexpr auto STREAMER_NODE_SPSC_OVERFLOW_STRATEGY =
-    audioapi::channels::spsc::OverflowStrategy::WAIT_ON_FULL;
-inline constexpr auto STREAMER_NODE_SPSC_WAIT_STRATEGY =
-    audioapi::channels::spsc::WaitStrategy::ATOMIC_WAIT;
+#include <thread>
 
 inline constexpr auto VERBOSE = false;
 inline constexpr auto CHANNEL_CAPACITY = 32;
-
-struct StreamingData {
-  audioapi::AudioBuffer buffer;
-  size_t size;
-  StreamingData() = default;
-  StreamingData(audioapi::AudioBuffer b, size_t s) : buffer(b), size(s) {}
-  StreamingData(const StreamingData &data) : buffer(data.buffer), size(data.size) {}
-  StreamingData(StreamingData &&data) noexcept : buffer(std::move(data.buffer)), size(data.size) {}
-  StreamingData &operator=(const StreamingData &data) {
-    if (this == &data) {
-      return *this;
-    }
-    buffer = data.buffer;
-    size = data.size;
-    return *this;
-  }
-};
+inline constexpr auto CHUNK_FRAMES = 2048;
 
 namespace audioapi {
 
@@ -77,6 +57,16 @@ class StreamerNode : public AudioScheduledSourceNode {
     return streamPath_;
   }
 
+  /// @brief Buffering state and underruns of the current stream.
+  [[nodiscard]] AudioChunkPool::Stats getStats() const;
+
+  /**
+   * @brief Continue the stream from the given time
+   * @param time Position in seconds from the start of the stream
+   * @note The buffered audio is dropped at once, the seek itself is done on the streaming thread
+  */
+  void seek(double time);
+
  protected:
   std::shared_ptr<AudioBuffer> processNode(
       const std::shared_ptr<AudioBuffer> &processingBuffer,
@@ -84,6 +74,9 @@ class StreamerNode : public AudioScheduledSourceNode {
 
  private:
   std::string streamPath_;
+  float prebufferDuration_;
+  float lowWaterDuration_;
+  std::atomic<double> pendingSeekTime_; // negative when there is no seek to do
 
 #if !RN_AUDIO_API_FFMPEG_DISABLED
   AVFormatContext *fmtCtx_;
@@ -95,23 +88,21 @@ class StreamerNode : public AudioScheduledSourceNode {
   SwrContext *swrCtx_;
   uint8_t **resampledData_; // weird ffmpeg way of using raw byte pointers for resampled data
 
-  std::shared_ptr<AudioBuffer> bufferedAudioBuffer_; // audio buffer for buffering hls frames
-  size_t bufferedAudioBufferSize_;                   // size of currently buffered buffer
+  std::unique_ptr<AudioChunkPool> chunkPool_; // decoded audio passed to the audio thread
   int audio_stream_index_; // index of the audio stream channel in the input
   int maxResampledSamples_;
-  size_t processedSamples_;
+
+  SeekIndex seekIndex_;         // keyframes of the parts of the stream that were read
+  int64_t seekTargetTimestamp_; // AV_NOPTS_VALUE when not seeking
+  int64_t seekEntryTimestamp_;  // keyframe the stream was seeked to, AV_NOPTS_VALUE if unknown
+  size_t framesToDiscard_;      // pre-roll before the seek target
+  double lastSeekTime_ = -1.0;  // time of the last seek done by the streaming thread
+  static constexpr double SEEK_INDEX_DISTANCE = 0.5; // seconds between seek index entries
+  static constexpr size_t SEEK_INDEX_MAX_ENTRIES = 4096;
 
   std::thread streamingThread_;
   std::atomic<bool> isNodeFinished_;                         // Flag to control the streaming thread
   static constexpr int INITIAL_MAX_RESAMPLED_SAMPLES = 8192; // Initial size for resampled data
-  channels::spsc::
-      Sender<StreamingData, STREAMER_NODE_SPSC_OVERFLOW_STRATEGY, STREAMER_NODE_SPSC_WAIT_STRATEGY>
-          sender_;
-  channels::spsc::Receiver<
-      StreamingData,
-      STREAMER_NODE_SPSC_OVERFLOW_STRATEGY,
-      STREAMER_NODE_SPSC_WAIT_STRATEGY>
-      receiver_;
 
   /**
    * @brief Setting up the resampler
@@ -122,10 +113,37 @@ class StreamerNode : public AudioScheduledSourceNode {
 
   /**
    * @brief Resample the audio frame, change its sample format and channel layout
+   * and write it to the chunk pool
    * @param frame The AVFrame to resample
    * @return true if successful, false otherwise
    */
-  bool processFrameWithResampler(AVFrame *frame, const std::shared_ptr<BaseAudioContext> &context);
+  bool processFrameWithResampler(AVFrame *frame);
+
+  /**
+   * @brief Seek the input, flush the decoder and resampler and drop the buffered audio
+   * @param time Position in seconds from the start of the stream
+   * @note Uses the seek index when the time falls into a part of the stream that was already read
+   */
+  void seekStream(double time);
+
+  /**
+   * @brief Seek to the time, then to the times of the seeks requested while seeking
+   * @param time Position in seconds from the start of the stream, negative for none
+   */
+  void seekToPendingTimes(double time);
+
+  /**
+   * @brief Number of resampled frames of the frame that precede the seek target
+   * @param frame The first decoded AVFrame after seeking
+   */
+  size_t getPreRollFrames(const AVFrame *frame) const;
+
+  /**
+   * @brief Send the packet to the decoder and process every frame it returns
+   * @param packet The packet to decode, nullptr drains the decoder
+   * @return false if streaming should stop, true otherwise
+   */
+  bool decodePacket(const AVPacket *packet);
 
   /**
    * @brief Thread function to continuously read and process audio frames
@@ -1,22 +1,48 @@
 #include <audioapi/core/sources/WorkletSourceNode.h>
 #include <audioapi/core/utils/Constants.h>
+#include <algorithm>
 #include <memory>
+#include <optional>
 #include <utility>
 
 namespace audioapi {
 
 WorkletSourceNode::WorkletSourceNode(
     const std::shared_ptr<BaseAudioContext> &context,
-    WorkletsRunner &&workletRunner)
-    : AudioScheduledSourceNode(context), workletRunner_(std::move(workletRunner)) {
+    WorkletsRunner &&workletRunner,
+    size_t lookahead,
+    size_t blockSize)
+    : AudioScheduledSourceNode(context),
+      workletRunner_(std::move(workletRunner)),
+      blockSize_(blockSize),
+      blockIndex_(blockSize) {
   isInitialized_ = true;
 
-  // Prepare buffers for audio processing
-  size_t outputChannelCount = this->getChannelCount();
-  outputBuffsHandles_.resize(outputChannelCount);
-  for (size_t i = 0; i < outputChannelCount; ++i) {
-    outputBuffsHandles_[i] = std::make_shared<AudioArrayBuffer>(RENDER_QUANTUM_SIZE);
+  auto outputChannelCount = static_cast<int>(this->getChannelCount());
+  outputBuffers_ = std::make_unique<WorkletBuffers>(
+      blockSize_, outputChannelCount, context->getSampleRate(), workletRunner_.getWeakRuntime());
+
+  if (lookahead == 0) {
+    block_ = outputBuffers_->getBuffer();
+    return;
+  }
+
+  block_ =
+      std::make_shared<AudioBuffer>(blockSize_, outputChannelCount, context->getSampleRate());
+  lookaheadRenderer_ = std::make_unique<LookaheadRenderer>(
+      lookahead,
+      blockSize_,
+      0,
+      outputChannelCount,
+      context->getSampleRate(),
+      [this](LookaheadRenderer::Block &block) { return renderBlock(block); });
+}
+
+LookaheadRenderer::Stats WorkletSourceNode::getLookaheadStats() const {
+  if (lookaheadRenderer_ == nullptr) {
+    return {};
   }
+  return lookaheadRenderer_->getStats();
 }
 
 std::shared_ptr<AudioBuffer> WorkletSourceNode::processNode(
@@ -48,38 +74,20 @@ std::shared_ptr<AudioBuffer> WorkletSourceNode::processNode(
     return processingBuffer;
   }
 
-  size_t outputChannelCount = processingBuffer->getNumberOfChannels();
-
-  auto result = workletRunner_.executeOnRuntimeSync(
-      [this, nonSilentFramesToProcess, startOffset, time = context->getCurrentTime()](
-          jsi::Runtime &rt) {
-        auto jsiArray = jsi::Array(rt, this->outputBuffsHandles_.size());
-        for (size_t i = 0; i < this->outputBuffsHandles_.size(); ++i) {
-          auto arrayBuffer = jsi::ArrayBuffer(rt, this->outputBuffsHandles_[i]);
-          jsiArray.setValueAtIndex(rt, i, arrayBuffer);
-        }
-
-        // We call unsafely here because we are already on the runtime thread
-        // and the runtime is locked by executeOnRuntimeSync (if
-        // shouldLockRuntime is true)
-        return workletRunner_.callUnsafe(
-            jsiArray,
-            jsi::Value(rt, static_cast<int>(nonSilentFramesToProcess)),
-            jsi::Value(rt, time),
-            jsi::Value(rt, static_cast<int>(startOffset)));
-      });
-
-  // If the worklet execution failed, zero the output
-  // It might happen if the runtime is not available
-  if (!result.has_value()) {
-    processingBuffer->zero();
-    return processingBuffer;
-  }
+  // the worklet renders whole blocks, the quanta are cut out of them from the start frame on
+  size_t processed = 0;
+  while (processed < nonSilentFramesToProcess) {
+    if (blockIndex_ == blockSize_) {
+      auto frame = context->getCurrentSampleFrame() + startOffset + processed;
+      renderNextBlock(static_cast<double>(frame) / context->getSampleRate());
+      blockIndex_ = 0;
+    }
 
-  // Copy the processed data back to the AudioBuffer
-  for (size_t i = 0; i < outputChannelCount; ++i) {
-    processingBuffer->getChannel(i)->copy(
-        *outputBuffsHandles_[i], 0, startOffset, nonSilentFramesToProcess);
+    size_t framesToCopy = std::min(nonSilentFramesToProcess - processed, blockSize_ - blockIndex_);
+    processingBuffer->copy(*block_, blockIndex_, startOffset + processed, framesToCopy);
+
+    blockIndex_ += framesToCopy;
+    processed += framesToCopy;
   }
 
   handleStopScheduled();
@@ -87,4 +95,50 @@ std::shared_ptr<AudioBuffer> WorkletSourceNode::processNode(
   return processingBuffer;
 }
 
+std::optional<jsi::Value> WorkletSourceNode::runWorklet(double time) {
+  return workletRunner_.executeOnRuntimeSync([this, time](jsi::Runtime &rt) {
+    // We call unsafely here because we are already on the runtime thread
+    // and the runtime is locked by executeOnRuntimeSync (if
+    // shouldLockRuntime is true)
+    return workletRunner_.callUnsafe(
+        outputBuffers_->getJsArray(rt),
+        jsi::Value(rt, static_cast<int>(blockSize_)),
+        jsi::Value(rt, time),
+        jsi::Value(rt, 0));
+  });
+}
+
+bool WorkletSourceNode::renderBlock(LookaheadRenderer::Block &block) {
+  if (!runWorklet(block.time).has_value()) {
+    return false;
+  }
+
+  block.output->copy(*outputBuffers_->getBuffer());
+  return true;
+}
+
+void WorkletSourceNode::renderNextBlock(double time) {
+  if (lookaheadRenderer_ == nullptr) {
+    // If the worklet execution failed, zero the output
+    // It might happen if the runtime is not available
+    if (!runWorklet(time).has_value()) {
+      block_->zero();
+    }
+    return;
+  }
+
+  auto *block = lookaheadRenderer_->acquire();
+  if (block == nullptr) {
+    block_->zero();
+    return;
+  }
+
+  block_->copy(*block->output);
+
+  // the block is played lookahead blocks from now
+  auto latencyFrames = lookaheadRenderer_->getLookahead() * blockSize_;
+  block->time = time + static_cast<double>(latencyFrames) / block_->getSampleRate();
+  lookaheadRenderer_->submit(block);
+}
+
 } // namespace audioapi
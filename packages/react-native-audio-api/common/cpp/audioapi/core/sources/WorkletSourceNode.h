@@ -1,15 +1,16 @@
 #pragma once
 #include <audioapi/core/BaseAudioContext.h>
 #include <audioapi/core/sources/AudioScheduledSourceNode.h>
+#include <audioapi/core/utils/LookaheadRenderer.h>
+#include <audioapi/core/utils/Constants.h>
 #include <audioapi/core/utils/worklets/SafeIncludes.h>
+#include <audioapi/core/utils/worklets/WorkletBuffers.h>
 #include <audioapi/core/utils/worklets/WorkletsRunner.h>
-#include <audioapi/utils/AudioArray.h>
-#include <audioapi/utils/AudioArrayBuffer.hpp>
 #include <audioapi/utils/AudioBuffer.h>
 #include <jsi/jsi.h>
 
 #include <memory>
-#include <vector>
+#include <optional>
 
 namespace audioapi {
 
@@ -18,9 +19,15 @@ class WorkletSourceNode : public AudioScheduledSourceNode {
  public:
   explicit WorkletSourceNode(
       std::shared_ptr<BaseAudioContext> context,
-      WorkletsRunner &&workletRunner)
+      WorkletsRunner &&workletRunner,
+      size_t lookahead = 0,
+      size_t blockSize = RENDER_QUANTUM_SIZE)
       : AudioScheduledSourceNode(context) {}
 
+  [[nodiscard]] LookaheadRenderer::Stats getLookaheadStats() const {
+    return {};
+  }
+
  protected:
   std::shared_ptr<AudioBuffer> processNode(
       const std::shared_ptr<AudioBuffer> &processingBuffer,
@@ -34,7 +41,13 @@ class WorkletSourceNode : public AudioScheduledSourceNode {
  public:
   explicit WorkletSourceNode(
       const std::shared_ptr<BaseAudioContext> &context,
-      WorkletsRunner &&workletRunner);
+      WorkletsRunner &&workletRunner,
+      size_t lookahead = 0,
+      size_t blockSize = RENDER_QUANTUM_SIZE);
+
+  /// @brief Latency added by the lookahead and the blocks the worklet did not render in time,
+  /// all zero when the worklet runs on the audio thread.
+  [[nodiscard]] LookaheadRenderer::Stats getLookaheadStats() const;
 
  protected:
   std::shared_ptr<AudioBuffer> processNode(
@@ -43,7 +56,23 @@ class WorkletSourceNode : public AudioScheduledSourceNode {
 
  private:
   WorkletsRunner workletRunner_;
-  std::vector<std::shared_ptr<AudioArrayBuffer>> outputBuffsHandles_;
+
+  /// @brief Frames the worklet renders per call, the quanta are cut out of them.
+  size_t blockSize_;
+  /// @brief What the worklet renders into, used on the thread it runs on.
+  std::unique_ptr<WorkletBuffers> outputBuffers_;
+  /// @brief Block the quanta are read from, the output buffer itself when the worklet runs on the
+  /// audio thread.
+  std::shared_ptr<AudioBuffer> block_;
+  size_t blockIndex_;
+
+  /// @brief Runs the worklet on its own thread when created with a lookahead, destroyed first so
+  /// the thread is stopped before the state it uses
+  std::unique_ptr<LookaheadRenderer> lookaheadRenderer_;
+
+  std::optional<jsi::Value> runWorklet(double time);
+  bool renderBlock(LookaheadRenderer::Block &block);
+  void renderNextBlock(double time);
 };
 #endif // RN_AUDIO_API_TEST
 
@@ -0,0 +1,15 @@
+#pragma once
+
+namespace audioapi {
+
+/// @brief Kinds of the events scheduled in bulk, the values are shared with JS.
+enum class ParamAutomationType {
+  SET_VALUE = 0,
+  LINEAR_RAMP = 1,
+  EXPONENTIAL_RAMP = 2,
+  SET_TARGET = 3,
+  CANCEL_SCHEDULED_VALUES = 4,
+  CANCEL_AND_HOLD = 5,
+};
+
+} // namespace audioapi
@@ -0,0 +1,7 @@
+#pragma once
+
+namespace audioapi {
+
+enum class SampleFormat { FLOAT32, INT16, FLOAT16 };
+
+} // namespace audioapi
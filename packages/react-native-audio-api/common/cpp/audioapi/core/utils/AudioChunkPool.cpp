@@ -0,0 +1,242 @@
+#include <audioapi/core/utils/AudioChunkPool.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBuffer.h>
+
+#include <algorithm>
+#include <mutex>
+#include <utility>
+
+namespace audioapi {
+
+AudioChunkPool::AudioChunkPool(
+    int numberOfChannels,
+    float sampleRate,
+    size_t numberOfChunks,
+    size_t chunkFrames,
+    size_t prebufferFrames,
+    size_t lowWaterFrames)
+    : chunkSizes_(std::max(numberOfChunks, kMinNumberOfChunks), 0),
+      chunkGenerations_(chunkSizes_.size(), 0),
+      chunkFrames_(std::max<size_t>(chunkFrames, 1)),
+      // the decoding thread holds one chunk while filling it
+      capacity_((chunkSizes_.size() - 1) * chunkFrames_),
+      prebufferFrames_(std::min(prebufferFrames, capacity_)),
+      lowWaterFrames_(std::clamp(lowWaterFrames, chunkFrames_, capacity_)) {
+  numberOfChunks = chunkSizes_.size();
+  chunks_.reserve(numberOfChunks);
+  for (size_t i = 0; i < numberOfChunks; ++i) {
+    chunks_.emplace_back(chunkFrames_, numberOfChannels, sampleRate);
+  }
+
+  // both channels can hold every chunk, so sending never fails
+  auto [filledSender, filledReceiver] = channels::spsc::channel<size_t>(numberOfChunks + 1);
+  filledSender_ = std::move(filledSender);
+  filledReceiver_ = std::move(filledReceiver);
+
+  auto [freeSender, freeReceiver] = channels::spsc::channel<size_t>(numberOfChunks + 1);
+  freeSender_ = std::move(freeSender);
+  freeReceiver_ = std::move(freeReceiver);
+
+  for (size_t i = 0; i < numberOfChunks; ++i) {
+    freeSender_.try_send(i);
+  }
+}
+
+bool AudioChunkPool::write(const float *const *channels, size_t sourceStart, size_t frames) {
+  size_t offset = sourceStart;
+  size_t end = sourceStart + frames;
+
+  while (offset < end) {
+    if (!canWrite() || (writingChunk_ == kNoChunk && !acquireChunk())) {
+      return false;
+    }
+
+    auto &chunk = chunks_[writingChunk_];
+    size_t framesToCopy = std::min(end - offset, chunkFrames_ - writtenFrames_);
+    for (size_t ch = 0; ch < chunk.getNumberOfChannels(); ++ch) {
+      chunk.getChannel(ch)->copy(channels[ch], offset, writtenFrames_, framesToCopy);
+    }
+
+    offset += framesToCopy;
+    writtenFrames_ += framesToCopy;
+
+    if (writtenFrames_ == chunkFrames_) {
+      publishChunk();
+    }
+  }
+
+  return true;
+}
+
+void AudioChunkPool::finish() {
+  if (writingChunk_ != kNoChunk && writtenFrames_ > 0) {
+    publishChunk();
+  }
+  isFinished_.store(true, std::memory_order_release);
+}
+
+void AudioChunkPool::close() {
+  {
+    std::lock_guard lock(mutex_);
+    isClosed_.store(true, std::memory_order_release);
+  }
+  condition_.notify_all();
+}
+
+void AudioChunkPool::flush() {
+  {
+    std::lock_guard lock(mutex_);
+    generation_.fetch_add(1, std::memory_order_acq_rel);
+  }
+  condition_.notify_all();
+}
+
+void AudioChunkPool::acknowledgeFlush() {
+  writeGeneration_ = generation_.load(std::memory_order_acquire);
+  writtenFrames_ = 0;
+  isWaitingForLowWater_ = false;
+  isFinished_.store(false, std::memory_order_release);
+}
+
+bool AudioChunkPool::isFlushPending() const {
+  return generation_.load(std::memory_order_acquire) != writeGeneration_;
+}
+
+bool AudioChunkPool::waitForFlush() {
+  std::unique_lock lock(mutex_);
+  condition_.wait(lock, [this] {
+    return isClosed_.load(std::memory_order_acquire) ||
+        generation_.load(std::memory_order_acquire) != writeGeneration_;
+  });
+  return !isClosed_.load(std::memory_order_acquire);
+}
+
+size_t AudioChunkPool::read(AudioBuffer &destination, size_t destinationStart, size_t frames) {
+  auto generation = generation_.load(std::memory_order_acquire);
+  if (generation != readGeneration_) {
+    readGeneration_ = generation;
+    isBuffering_.store(true, std::memory_order_relaxed);
+    if (readingChunk_ != kNoChunk && chunkGenerations_[readingChunk_] < generation) {
+      releaseReadingChunk();
+    }
+  }
+
+  if (isBuffering_.load(std::memory_order_relaxed)) {
+    // stale chunks are in front of the channel, dropping them keeps the count accurate
+    if (readingChunk_ == kNoChunk) {
+      receiveChunk(generation);
+    }
+    if (bufferedFrames_.load(std::memory_order_acquire) < prebufferFrames_ &&
+        !isFinished_.load(std::memory_order_acquire)) {
+      destination.zero(destinationStart, frames);
+      underrunFrames_.fetch_add(frames, std::memory_order_relaxed);
+      return 0;
+    }
+    isBuffering_.store(false, std::memory_order_relaxed);
+  }
+
+  size_t framesRead = 0;
+
+  while (framesRead < frames) {
+    if (readingChunk_ == kNoChunk && !receiveChunk(generation)) {
+      break;
+    }
+
+    size_t framesToCopy = std::min(frames - framesRead, chunkSizes_[readingChunk_] - readFrames_);
+    destination.copy(
+        chunks_[readingChunk_], readFrames_, destinationStart + framesRead, framesToCopy);
+
+    framesRead += framesToCopy;
+    readFrames_ += framesToCopy;
+
+    bufferedFrames_.fetch_sub(framesToCopy, std::memory_order_release);
+
+    if (readFrames_ == chunkSizes_[readingChunk_]) {
+      freeSender_.try_send(readingChunk_);
+      readingChunk_ = kNoChunk;
+    }
+  }
+
+  if (framesRead < frames) {
+    destination.zero(destinationStart + framesRead, frames - framesRead);
+
+    // running out at the end of the stream is not an underrun
+    if (!isFinished_.load(std::memory_order_acquire)) {
+      underruns_.fetch_add(1, std::memory_order_relaxed);
+      underrunFrames_.fetch_add(frames - framesRead, std::memory_order_relaxed);
+      isBuffering_.store(true, std::memory_order_relaxed);
+    }
+  }
+
+  return framesRead;
+}
+
+AudioChunkPool::Stats AudioChunkPool::getStats() const noexcept {
+  return {
+      bufferedFrames_.load(std::memory_order_relaxed),
+      underruns_.load(std::memory_order_relaxed),
+      underrunFrames_.load(std::memory_order_relaxed),
+      isBuffering_.load(std::memory_order_relaxed)};
+}
+
+bool AudioChunkPool::canWrite() const {
+  return !isClosed_.load(std::memory_order_acquire) &&
+      generation_.load(std::memory_order_acquire) == writeGeneration_;
+}
+
+bool AudioChunkPool::acquireChunk() {
+  std::unique_lock lock(mutex_);
+
+  while (canWrite()) {
+    // once the pool has been filled up, it is refilled in one go
+    // after the buffered audio drops below the low-water mark
+    if (!isWaitingForLowWater_ ||
+        bufferedFrames_.load(std::memory_order_acquire) < lowWaterFrames_) {
+      if (freeReceiver_.try_receive(writingChunk_) == channels::spsc::ResponseStatus::SUCCESS) {
+        writtenFrames_ = 0;
+        isWaitingForLowWater_ = false;
+        return true;
+      }
+      isWaitingForLowWater_ = true;
+    }
+
+    // the audio thread does not notify, so the state is polled
+    condition_.wait_for(lock, kWriterPollInterval);
+  }
+
+  writingChunk_ = kNoChunk;
+  return false;
+}
+
+void AudioChunkPool::publishChunk() {
+  chunkSizes_[writingChunk_] = writtenFrames_;
+  chunkGenerations_[writingChunk_] = writeGeneration_;
+  // counted before sending, so the audio thread never reads more than was counted
+  bufferedFrames_.fetch_add(writtenFrames_, std::memory_order_release);
+  filledSender_.try_send(writingChunk_);
+
+  writingChunk_ = kNoChunk;
+  writtenFrames_ = 0;
+}
+
+bool AudioChunkPool::receiveChunk(uint64_t generation) {
+  while (filledReceiver_.try_receive(readingChunk_) == channels::spsc::ResponseStatus::SUCCESS) {
+    readFrames_ = 0;
+    // chunks written before the last flush are dropped
+    if (chunkGenerations_[readingChunk_] >= generation) {
+      return true;
+    }
+    releaseReadingChunk();
+  }
+
+  readingChunk_ = kNoChunk;
+  return false;
+}
+
+void AudioChunkPool::releaseReadingChunk() {
+  bufferedFrames_.fetch_sub(chunkSizes_[readingChunk_] - readFrames_, std::memory_order_release);
+  freeSender_.try_send(readingChunk_);
+  readingChunk_ = kNoChunk;
+}
+
+} // namespace audioapi
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <audioapi/utils/AudioBuffer.h>
+#include <audioapi/utils/SpscChannel.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <vector>
+
+namespace audioapi {
+
+/// @brief Fixed pool of audio chunks passed from a decoding thread to the audio thread.
+/// Chunks are allocated once and cycle between the two threads as indices,
+/// so neither side allocates while streaming.
+/// Playback starts, and resumes after an underrun, once prebufferFrames are buffered.
+/// When every chunk is full, the decoding thread waits for the buffered audio
+/// to fall below lowWaterFrames before it refills the pool.
+/// flush drops the buffered audio, e.g. on seek. Chunks are tagged with the number
+/// of flushes before they were written, so the audio thread can tell stale ones apart.
+/// @note write, finish, acknowledgeFlush, isFlushPending and waitForFlush are to be called from
+/// the decoding thread, read from the audio thread, flush, close and getStats from any thread.
+class AudioChunkPool {
+ public:
+  static constexpr std::chrono::milliseconds kWriterPollInterval{5};
+  /// One chunk is filled by the decoding thread while the others are played.
+  static constexpr size_t kMinNumberOfChunks = 2;
+
+  struct Stats {
+    size_t bufferedFrames;
+    /// Times the buffered audio ran out before the end of the stream.
+    uint64_t underruns;
+    /// Frames of silence played because of underruns, prebuffering included.
+    uint64_t underrunFrames;
+    bool isBuffering;
+  };
+
+  /// @param numberOfChunks Raised to kMinNumberOfChunks.
+  /// @param chunkFrames Raised to 1.
+  /// @param prebufferFrames Clamped to the frames the pool can buffer.
+  /// @param lowWaterFrames Clamped between one chunk and the frames the pool can buffer.
+  AudioChunkPool(
+      int numberOfChannels,
+      float sampleRate,
+      size_t numberOfChunks,
+      size_t chunkFrames,
+      size_t prebufferFrames,
+      size_t lowWaterFrames);
+
+  [[nodiscard]] size_t getCapacity() const noexcept {
+    return capacity_;
+  }
+
+  /// @brief Appends planar frames, waiting for free chunks when the pool is full.
+  /// @return false if the pool was closed, or flushed and not yet acknowledged.
+  bool write(const float *const *channels, size_t sourceStart, size_t frames);
+
+  /// @brief Publishes the partially filled chunk and marks the end of the stream.
+  /// The remaining audio is played without prebuffering.
+  void finish();
+
+  /// @brief Stops a waiting write, further writes fail.
+  void close();
+
+  /// @brief Drops the buffered audio and restarts prebuffering.
+  /// Writes fail until the decoding thread acknowledges the flush.
+  void flush();
+
+  /// @brief Starts writing after a flush, dropping the partially filled chunk.
+  void acknowledgeFlush();
+
+  /// @brief Whether a flush is waiting to be acknowledged, writes fail until it is.
+  [[nodiscard]] bool isFlushPending() const;
+
+  /// @brief Waits for a flush, e.g. after the end of the stream.
+  /// @return false if the pool was closed while waiting.
+  bool waitForFlush();
+
+  /// @brief Reads the next frames into the destination, silence while buffering.
+  /// @return Number of frames read from the pool.
+  /// @note Real-time safe.
+  size_t read(AudioBuffer &destination, size_t destinationStart, size_t frames);
+
+  [[nodiscard]] Stats getStats() const noexcept;
+
+ private:
+  static constexpr size_t kNoChunk = std::numeric_limits<size_t>::max();
+
+  using ChunkSender = channels::spsc::Sender<size_t>;
+  using ChunkReceiver = channels::spsc::Receiver<size_t>;
+
+  std::vector<AudioBuffer> chunks_;
+  std::vector<size_t> chunkSizes_;
+  std::vector<uint64_t> chunkGenerations_;
+  size_t chunkFrames_;
+  size_t capacity_;
+  size_t prebufferFrames_;
+  size_t lowWaterFrames_;
+
+  // filled chunks, from the decoding thread to the audio thread
+  ChunkSender filledSender_;
+  ChunkReceiver filledReceiver_;
+  // played chunks, from the audio thread back to the decoding thread
+  ChunkSender freeSender_;
+  ChunkReceiver freeReceiver_;
+
+  // decoding thread state
+  size_t writingChunk_ = kNoChunk;
+  size_t writtenFrames_ = 0;
+  bool isWaitingForLowWater_ = false;
+  uint64_t writeGeneration_ = 0;
+
+  // audio thread state
+  size_t readingChunk_ = kNoChunk;
+  size_t readFrames_ = 0;
+  uint64_t readGeneration_ = 0;
+
+  std::atomic<size_t> bufferedFrames_{0};
+  std::atomic<bool> isBuffering_{true};
+  std::atomic<bool> isFinished_{false};
+  std::atomic<bool> isClosed_{false};
+  std::atomic<uint64_t> underruns_{0};
+  std::atomic<uint64_t> underrunFrames_{0};
+  std::atomic<uint64_t> generation_{0};
+
+  std::mutex mutex_;
+  std::condition_variable condition_;
+
+  bool canWrite() const;
+  bool acquireChunk();
+  void publishChunk();
+  bool receiveChunk(uint64_t generation);
+  void releaseReadingChunk();
+};
+
+} // namespace audioapi
@@ -18,9 +18,12 @@ class AudioDecoder {
  public:
   AudioDecoder() = delete;
 
+  /// @param pagedFileDirectory Directory of a memory-mapped cache file for the decoded audio,
+  /// see PagedAudioFile. Empty to decode into memory.
   [[nodiscard]] static std::shared_ptr<AudioBuffer> decodeWithFilePath(
       const std::string &path,
-      float sampleRate);
+      float sampleRate,
+      const std::string &pagedFileDirectory = "");
   [[nodiscard]] static std::shared_ptr<AudioBuffer>
   decodeWithMemoryBlock(const void *data, size_t size, float sampleRate);
   [[nodiscard]] static std::shared_ptr<AudioBuffer> decodeWithPCMInBase64(
@@ -29,12 +32,26 @@ class AudioDecoder {
       int inputChannelCount,
       bool interleaved);
 
+  /// @brief Private cache directory of the app, for the files of paged buffers.
+  /// @note To be called on the JS thread.
+  [[nodiscard]] static std::string getPagedFileDirectory();
+
+  static inline bool pathHasExtension(
+      const std::string &path,
+      const std::vector<std::string> &extensions) {
+    std::string pathLower = path;
+    std::transform(pathLower.begin(), pathLower.end(), pathLower.begin(), ::tolower);
+    for (const auto &ext : extensions) {
+      if (pathLower.ends_with(ext))
+        return true;
+    }
+    return false;
+  }
+
  private:
-  static std::vector<float> readAllPcmFrames(ma_decoder &decoder, int outputChannels);
-  static std::shared_ptr<AudioBuffer> makeAudioBufferFromFloatBuffer(
-      const std::vector<float> &buffer,
-      float outputSampleRate,
-      int outputChannels);
+  static std::shared_ptr<AudioBuffer> readAllPcmFrames(
+      ma_decoder &decoder,
+      const std::string &pagedFileDirectory = "");
 
   static AudioFormat detectAudioFormat(const void *data, size_t size) {
     if (size < 12)
@@ -73,18 +90,6 @@ class AudioDecoder {
     return AudioFormat::UNKNOWN;
   }
 
-  static inline bool pathHasExtension(
-      const std::string &path,
-      const std::vector<std::string> &extensions) {
-    std::string pathLower = path;
-    std::transform(pathLower.begin(), pathLower.end(), pathLower.begin(), ::tolower);
-    for (const auto &ext : extensions) {
-      if (pathLower.ends_with(ext))
-        return true;
-    }
-    return false;
-  }
-
   [[nodiscard]] static inline int16_t floatToInt16(float sample) {
     return static_cast<int16_t>(sample * INT16_MAX);
   }
@@ -1,74 +1,40 @@
 #pragma once
 
-#include <audioapi/utils/SpscChannel.hpp>
-#include <atomic>
+#include <audioapi/core/utils/DeferredReclaimer.h>
+#include <concepts>
 #include <memory>
-#include <thread>
 #include <utility>
-#include <vector>
 
 namespace audioapi {
 
 /// @brief A generic class to offload object destruction to a separate thread.
 /// @tparam T The type of object to be destroyed.
+/// @note Objects are destroyed by the DeferredReclaimer shared by all the contexts, each
+/// destructor is a lane of it rather than a thread of its own.
 template <typename T>
 class AudioDestructor {
  public:
-  AudioDestructor() : isExiting_(false) {
-    auto [sender, receiver] = channels::spsc::channel<
-        std::shared_ptr<T>,
-        channels::spsc::OverflowStrategy::WAIT_ON_FULL,
-        channels::spsc::WaitStrategy::ATOMIC_WAIT>(kChannelCapacity);
-    sender_ = std::move(sender);
-    workerHandle_ = std::thread(&AudioDestructor::process, this, std::move(receiver));
-  }
-
-  ~AudioDestructor() {
-    isExiting_.store(true, std::memory_order_release);
-
-    // We need to send a nullptr to unblock the receiver
-    sender_.send(nullptr);
-    if (workerHandle_.joinable()) {
-      workerHandle_.join();
-    }
-  }
+  AudioDestructor() : lane_(DeferredReclaimer::getShared()) {}
 
   /// @brief Adds an audio object to the deconstruction queue.
   /// @param object The audio object to be deconstructed.
   /// @return True if the node was successfully added, false otherwise.
   /// @note audio object does NOT get moved out if it is not successfully added.
-  bool tryAddForDeconstruction(std::shared_ptr<T> &&object) {
-    return sender_.try_send(std::move(object)) == channels::spsc::ResponseStatus::SUCCESS;
+  template <typename U>
+    requires std::convertible_to<U *, T *>
+  bool tryAddForDeconstruction(std::shared_ptr<U> &&object) {
+    // type erased without touching the reference count, and given back as is on failure
+    DeferredReclaimer::Garbage garbage = std::move(object);
+    if (lane_.tryRetire(std::move(garbage))) {
+      return true;
+    }
+
+    object = std::static_pointer_cast<U>(std::move(garbage));
+    return false;
   }
 
  private:
-  static constexpr size_t kChannelCapacity = 1024;
-
-  std::thread workerHandle_;
-  std::atomic<bool> isExiting_;
-
-  using SenderType = channels::spsc::Sender<
-      std::shared_ptr<T>,
-      channels::spsc::OverflowStrategy::WAIT_ON_FULL,
-      channels::spsc::WaitStrategy::ATOMIC_WAIT>;
-
-  using ReceiverType = channels::spsc::Receiver<
-      std::shared_ptr<T>,
-      channels::spsc::OverflowStrategy::WAIT_ON_FULL,
-      channels::spsc::WaitStrategy::ATOMIC_WAIT>;
-
-  SenderType sender_;
-
-  /// @brief Processes audio objects for deconstruction.
-  /// @param receiver The receiver channel for incoming audio objects.
-  void process(ReceiverType &&receiver) {
-    auto rcv = std::move(receiver);
-    while (!isExiting_.load(std::memory_order_acquire)) {
-      rcv.receive();
-    }
-  }
+  DeferredReclaimer::Lane lane_;
 };
 
-#undef AUDIO_NODE_DESTRUCTOR_SPSC_OPTIONS
-
 } // namespace audioapi
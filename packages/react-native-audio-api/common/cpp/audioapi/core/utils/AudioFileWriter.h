@@ -27,8 +27,8 @@ class AudioFileWriter {
   virtual std::string getFilePath() const = 0;
   virtual double getCurrentDuration() const = 0;
 
-  void setOnErrorCallback(uint64_t callbackId);
-  void clearOnErrorCallback();
+  virtual void setOnErrorCallback(uint64_t callbackId);
+  virtual void clearOnErrorCallback();
   void invokeOnErrorCallback(const std::string &message);
 
  protected:
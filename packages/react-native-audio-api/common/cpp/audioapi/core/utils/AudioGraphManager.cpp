@@ -6,13 +6,16 @@
 #include <audioapi/core/utils/AudioGraphManager.h>
 #include <audioapi/core/utils/Locker.h>
 #include <audioapi/utils/AudioBuffer.h>
+#include <cstddef>
+#include <exception>
 #include <memory>
+#include <new>
 #include <utility>
 #include <vector>
 
 namespace audioapi {
 
-AudioGraphManager::Event::Event(Event &&other) noexcept {
+AudioGraphManager::Event::Event(Event &&other) noexcept : Event() {
   *this = std::move(other);
 }
 
@@ -21,26 +24,31 @@ AudioGraphManager::Event &AudioGraphManager::Event::operator=(Event &&other) noe
     // Clean up current resources
     this->~Event();
 
-    // Move resources from the other event
+    // Move resources from the other event, constructing them in place as the destroyed members
+    // are not to be assigned to, e.g. when a ring slot is reused
     type = other.type;
     payloadType = other.payloadType;
     switch (payloadType) {
       case EventPayloadType::NODES:
-        payload.nodes.from = std::move(other.payload.nodes.from);
-        payload.nodes.to = std::move(other.payload.nodes.to);
+        new (&payload.nodes.from) std::shared_ptr<AudioNode>(std::move(other.payload.nodes.from));
+        new (&payload.nodes.to) std::shared_ptr<AudioNode>(std::move(other.payload.nodes.to));
         break;
       case EventPayloadType::PARAMS:
-        payload.params.from = std::move(other.payload.params.from);
-        payload.params.to = std::move(other.payload.params.to);
+        new (&payload.params.from) std::shared_ptr<AudioNode>(std::move(other.payload.params.from));
+        new (&payload.params.to) std::shared_ptr<AudioParam>(std::move(other.payload.params.to));
         break;
       case EventPayloadType::SOURCE_NODE:
-        payload.sourceNode = std::move(other.payload.sourceNode);
+        new (&payload.sourceNode)
+            std::shared_ptr<AudioScheduledSourceNode>(std::move(other.payload.sourceNode));
         break;
       case EventPayloadType::AUDIO_PARAM:
-        payload.audioParam = std::move(other.payload.audioParam);
+        new (&payload.audioParam) std::shared_ptr<AudioParam>(std::move(other.payload.audioParam));
         break;
       case EventPayloadType::NODE:
-        payload.node = std::move(other.payload.node);
+        new (&payload.node) std::shared_ptr<AudioNode>(std::move(other.payload.node));
+        break;
+      case EventPayloadType::EVENTS:
+        new (&payload.events) std::unique_ptr<std::vector<Event>>(std::move(other.payload.events));
         break;
 
       default:
@@ -69,6 +77,22 @@ AudioGraphManager::Event::~Event() {
     case EventPayloadType::NODE:
       payload.node.~shared_ptr();
       break;
+    case EventPayloadType::EVENTS:
+      payload.events.~unique_ptr();
+      break;
+  }
+}
+
+AudioGraphManager::Transaction::Transaction(AudioGraphManager &graphManager)
+    : graphManager_(graphManager), uncaughtExceptions_(std::uncaught_exceptions()) {
+  graphManager_.beginBatch();
+}
+
+AudioGraphManager::Transaction::~Transaction() {
+  if (std::uncaught_exceptions() > uncaughtExceptions_) {
+    graphManager_.discardBatch();
+  } else {
+    graphManager_.commitBatch();
   }
 }
 
@@ -77,14 +101,21 @@ AudioGraphManager::AudioGraphManager() {
   processingNodes_.reserve(kInitialCapacity);
   audioParams_.reserve(kInitialCapacity);
   audioBuffers_.reserve(kInitialCapacity);
+  batchStarts_.reserve(kInitialCapacity);
+  reclaimCandidates_.reserve(kReclaimCandidatesCapacity);
 
   auto channel_pair = channels::spsc::channel<
-      std::unique_ptr<Event>,
+      Event,
       channels::spsc::OverflowStrategy::WAIT_ON_FULL,
       channels::spsc::WaitStrategy::BUSY_LOOP>(kChannelCapacity);
 
   sender_ = std::move(channel_pair.first);
   receiver_ = std::move(channel_pair.second);
+
+  auto [recycledBatchSender, recycledBatchReceiver] =
+      channels::spsc::channel<std::unique_ptr<std::vector<Event>>>(kRecycledBatchesCapacity);
+  recycledBatchSender_ = std::move(recycledBatchSender);
+  recycledBatchReceiver_ = std::move(recycledBatchReceiver);
 }
 
 AudioGraphManager::~AudioGraphManager() {
@@ -95,60 +126,129 @@ void AudioGraphManager::addPendingNodeConnection(
     const std::shared_ptr<AudioNode> &from,
     const std::shared_ptr<AudioNode> &to,
     ConnectionType type) {
-  auto event = std::make_unique<Event>();
-  event->type = type;
-  event->payloadType = EventPayloadType::NODES;
-  event->payload.nodes.from = from;
-  event->payload.nodes.to = to;
+  Event event;
+  event.type = type;
+  event.payloadType = EventPayloadType::NODES;
+  event.payload.nodes.from = from;
+  event.payload.nodes.to = to;
 
-  sender_.send(std::move(event));
+  sendEvent(std::move(event));
 }
 
 void AudioGraphManager::addPendingParamConnection(
     const std::shared_ptr<AudioNode> &from,
     const std::shared_ptr<AudioParam> &to,
     ConnectionType type) {
-  auto event = std::make_unique<Event>();
-  event->type = type;
-  event->payloadType = EventPayloadType::PARAMS;
-  event->payload.params.from = from;
-  event->payload.params.to = to;
+  Event event;
+  event.type = type;
+  event.payloadType = EventPayloadType::PARAMS;
+  event.payload.params.from = from;
+  event.payload.params.to = to;
 
-  sender_.send(std::move(event));
+  sendEvent(std::move(event));
 }
 
 void AudioGraphManager::preProcessGraph() {
   settlePendingConnections();
-  AudioGraphManager::prepareForDestruction(sourceNodes_, nodeDestructor_);
-  AudioGraphManager::prepareForDestruction(processingNodes_, nodeDestructor_);
+  reclaimNodes();
   AudioGraphManager::prepareForDestruction(audioBuffers_, bufferDestructor_);
 }
 
 void AudioGraphManager::addProcessingNode(const std::shared_ptr<AudioNode> &node) {
-  auto event = std::make_unique<Event>();
-  event->type = ConnectionType::ADD;
-  event->payloadType = EventPayloadType::NODE;
-  event->payload.node = node;
+  Event event;
+  event.type = ConnectionType::ADD;
+  event.payloadType = EventPayloadType::NODE;
+  event.payload.node = node;
 
-  sender_.send(std::move(event));
+  sendEvent(std::move(event));
 }
 
 void AudioGraphManager::addSourceNode(const std::shared_ptr<AudioScheduledSourceNode> &node) {
-  auto event = std::make_unique<Event>();
-  event->type = ConnectionType::ADD;
-  event->payloadType = EventPayloadType::SOURCE_NODE;
-  event->payload.sourceNode = node;
+  Event event;
+  event.type = ConnectionType::ADD;
+  event.payloadType = EventPayloadType::SOURCE_NODE;
+  event.payload.sourceNode = node;
 
-  sender_.send(std::move(event));
+  sendEvent(std::move(event));
 }
 
 void AudioGraphManager::addAudioParam(const std::shared_ptr<AudioParam> &param) {
-  auto event = std::make_unique<Event>();
-  event->type = ConnectionType::ADD;
-  event->payloadType = EventPayloadType::AUDIO_PARAM;
-  event->payload.audioParam = param;
+  Event event;
+  event.type = ConnectionType::ADD;
+  event.payloadType = EventPayloadType::AUDIO_PARAM;
+  event.payload.audioParam = param;
 
-  sender_.send(std::move(event));
+  sendEvent(std::move(event));
+}
+
+void AudioGraphManager::addReleasedNode(const std::shared_ptr<AudioNode> &node) {
+  Event event;
+  event.type = ConnectionType::RELEASE;
+  event.payloadType = EventPayloadType::NODE;
+  event.payload.node = node;
+
+  sendEvent(std::move(event));
+}
+
+void AudioGraphManager::addReclaimCandidate(std::shared_ptr<AudioNode> node) {
+  // direct access because this is called from the Audio thread
+  if (reclaimCandidates_.size() < kReclaimCandidatesCapacity) {
+    reclaimCandidates_.push_back(std::move(node));
+  }
+}
+
+void AudioGraphManager::beginBatch() {
+  // a batch handled by the audio thread is reused, so batches do not allocate in steady state
+  if (batch_ == nullptr &&
+      recycledBatchReceiver_.try_receive(batch_) != channels::spsc::ResponseStatus::SUCCESS) {
+    batch_ = std::make_unique<std::vector<Event>>();
+    batch_->reserve(kInitialCapacity);
+  }
+
+  batchStarts_.push_back(batch_->size());
+}
+
+void AudioGraphManager::commitBatch() {
+  assert(!batchStarts_.empty());
+  batchStarts_.pop_back();
+
+  // an inner batch is sent with the outermost one, an empty batch is kept for the next one
+  if (!batchStarts_.empty() || batch_->empty()) {
+    return;
+  }
+
+  Event event;
+  event.type = ConnectionType::BATCH;
+  event.payloadType = EventPayloadType::EVENTS;
+  new (&event.payload.events) std::unique_ptr<std::vector<Event>>(std::move(batch_));
+
+  sendEvent(std::move(event));
+}
+
+void AudioGraphManager::discardBatch() {
+  assert(!batchStarts_.empty());
+  batch_->erase(
+      batch_->begin() + static_cast<std::ptrdiff_t>(batchStarts_.back()), batch_->end());
+  batchStarts_.pop_back();
+}
+
+void AudioGraphManager::sendEvent(Event &&event) {
+  if (!batchStarts_.empty()) {
+    batch_->push_back(std::move(event));
+    return;
+  }
+
+  // once an event is staged, the following ones are staged as well, so they keep their order
+  if (!hasStagedEvents_.load(std::memory_order_acquire) &&
+      sender_.try_send(std::move(event)) == channels::spsc::ResponseStatus::SUCCESS) {
+    return;
+  }
+
+  // the audio thread never waits for the lock, so this waits at most for it to handle the
+  // staged events, instead of spinning until it drains a full channel
+  std::lock_guard<std::mutex> lock(stagingMutex_);
+  stagedEvents_.push_back(std::move(event));
+  hasStagedEvents_.store(true, std::memory_order_release);
 }
 
 void AudioGraphManager::addAudioBuffeForDestruction(std::shared_ptr<AudioBuffer> buffer) {
@@ -157,71 +257,156 @@ void AudioGraphManager::addAudioBuffeForDestruction(std::shared_ptr<AudioBuffer>
 }
 
 void AudioGraphManager::settlePendingConnections() {
-  std::unique_ptr<Event> value;
-  while (receiver_.try_receive(value) != channels::spsc::ResponseStatus::CHANNEL_EMPTY) {
-    switch (value->type) {
-      case ConnectionType::CONNECT:
-        handleConnectEvent(std::move(value));
-        break;
-      case ConnectionType::DISCONNECT:
-        handleDisconnectEvent(std::move(value));
-        break;
-      case ConnectionType::DISCONNECT_ALL:
-        handleDisconnectAllEvent(std::move(value));
-        break;
-      case ConnectionType::ADD:
-        handleAddToDeconstructionEvent(std::move(value));
-        break;
-    }
+  receiveEvents();
+
+  if (!hasStagedEvents_.load(std::memory_order_acquire)) {
+    return;
+  }
+
+  // the staged events wait for the next quantum if the JavaScript thread is staging one
+  auto locker = Locker::tryLock(stagingMutex_);
+  if (!locker) {
+    return;
+  }
+
+  // events sent before the first staged one may have arrived since the channel was drained
+  receiveEvents();
+
+  for (auto &event : stagedEvents_) {
+    handleEvent(event);
+  }
+
+  // the capacity is kept, so staging allocates only when a stall outgrows it
+  stagedEvents_.clear();
+  hasStagedEvents_.store(false, std::memory_order_release);
+}
+
+void AudioGraphManager::receiveEvents() {
+  Event event;
+  while (receiver_.try_receive(event) == channels::spsc::ResponseStatus::SUCCESS) {
+    handleEvent(event);
+  }
+}
+
+void AudioGraphManager::handleEvent(Event &event) {
+  switch (event.type) {
+    case ConnectionType::CONNECT:
+      handleConnectEvent(event);
+      break;
+    case ConnectionType::DISCONNECT:
+      handleDisconnectEvent(event);
+      break;
+    case ConnectionType::DISCONNECT_ALL:
+      handleDisconnectAllEvent(event);
+      break;
+    case ConnectionType::ADD:
+      handleAddToDeconstructionEvent(event);
+      break;
+    case ConnectionType::BATCH:
+      handleBatchEvent(event);
+      break;
+    case ConnectionType::RELEASE:
+      handleReleaseEvent(event);
+      break;
   }
 }
 
-void AudioGraphManager::handleConnectEvent(std::unique_ptr<Event> event) {
-  if (event->payloadType == EventPayloadType::NODES) {
-    event->payload.nodes.from->connectNode(event->payload.nodes.to);
-  } else if (event->payloadType == EventPayloadType::PARAMS) {
-    event->payload.params.from->connectParam(event->payload.params.to);
+void AudioGraphManager::handleBatchEvent(Event &event) {
+  assert(event.payloadType == EventPayloadType::EVENTS);
+  auto &events = event.payload.events;
+
+  // events of a batch are applied in the order they were added, like separate ones
+  for (auto &batchedEvent : *events) {
+    handleEvent(batchedEvent);
+  }
+
+  // the emptied batch keeps its capacity and goes back to be reused,
+  // it is only freed here if the JavaScript thread has not taken the previous ones
+  events->clear();
+  recycledBatchSender_.try_send(std::move(events));
+}
+
+void AudioGraphManager::handleConnectEvent(Event &event) {
+  if (event.payloadType == EventPayloadType::NODES) {
+    event.payload.nodes.from->connectNode(event.payload.nodes.to);
+  } else if (event.payloadType == EventPayloadType::PARAMS) {
+    event.payload.params.from->connectParam(event.payload.params.to);
   } else {
     assert(false && "Invalid payload type for connect event");
   }
 }
 
-void AudioGraphManager::handleDisconnectEvent(std::unique_ptr<Event> event) {
-  if (event->payloadType == EventPayloadType::NODES) {
-    event->payload.nodes.from->disconnectNode(event->payload.nodes.to);
-  } else if (event->payloadType == EventPayloadType::PARAMS) {
-    event->payload.params.from->disconnectParam(event->payload.params.to);
+void AudioGraphManager::handleDisconnectEvent(Event &event) {
+  if (event.payloadType == EventPayloadType::NODES) {
+    event.payload.nodes.from->disconnectNode(event.payload.nodes.to);
+  } else if (event.payloadType == EventPayloadType::PARAMS) {
+    event.payload.params.from->disconnectParam(event.payload.params.to);
   } else {
     assert(false && "Invalid payload type for disconnect event");
   }
 }
 
-void AudioGraphManager::handleDisconnectAllEvent(std::unique_ptr<Event> event) {
-  assert(event->payloadType == EventPayloadType::NODES);
-  for (auto it = event->payload.nodes.from->outputNodes_.begin();
-       it != event->payload.nodes.from->outputNodes_.end();) {
+void AudioGraphManager::handleDisconnectAllEvent(Event &event) {
+  assert(event.payloadType == EventPayloadType::NODES);
+  for (auto it = event.payload.nodes.from->outputNodes_.begin();
+       it != event.payload.nodes.from->outputNodes_.end();) {
     auto next = std::next(it);
-    event->payload.nodes.from->disconnectNode(*it);
+    event.payload.nodes.from->disconnectNode(*it);
     it = next;
   }
 }
 
-void AudioGraphManager::handleAddToDeconstructionEvent(std::unique_ptr<Event> event) {
-  switch (event->payloadType) {
+void AudioGraphManager::handleAddToDeconstructionEvent(Event &event) {
+  switch (event.payloadType) {
     case EventPayloadType::NODE:
-      processingNodes_.push_back(event->payload.node);
+      event.payload.node->graphIndex_ = processingNodes_.size();
+      processingNodes_.push_back(event.payload.node);
       break;
     case EventPayloadType::SOURCE_NODE:
-      sourceNodes_.push_back(event->payload.sourceNode);
+      event.payload.sourceNode->graphIndex_ = sourceNodes_.size();
+      sourceNodes_.push_back(event.payload.sourceNode);
       break;
     case EventPayloadType::AUDIO_PARAM:
-      audioParams_.push_back(event->payload.audioParam);
+      audioParams_.push_back(event.payload.audioParam);
       break;
     default:
       assert(false && "Unknown event payload type");
   }
 }
 
+void AudioGraphManager::handleReleaseEvent(Event &event) {
+  assert(event.payloadType == EventPayloadType::NODE);
+  addReclaimCandidate(std::move(event.payload.node));
+}
+
+void AudioGraphManager::reclaimNodes() {
+  for (size_t checked = 0; checked < kReclaimBudget && !reclaimCandidates_.empty(); checked++) {
+    auto candidate = std::move(reclaimCandidates_.back());
+    reclaimCandidates_.pop_back();
+
+    auto *node = candidate.get();
+    auto index = node->graphIndex_;
+
+    // the candidate is dropped first, so the list holds the only reference to a released node
+    if (index < sourceNodes_.size() && sourceNodes_[index].get() == node) {
+      candidate.reset();
+      tryReclaim(sourceNodes_, index);
+    } else if (index < processingNodes_.size() && processingNodes_[index].get() == node) {
+      candidate.reset();
+      tryReclaim(processingNodes_, index);
+    } else if (
+        candidate.use_count() == 1 &&
+        !nodeDestructor_.tryAddForDeconstruction(std::move(candidate))) {
+      // a node outside of the lists is not destroyed on the Audio thread, it is retried later
+      reclaimCandidates_.push_back(std::move(candidate));
+      break;
+    }
+  }
+
+  sweep(sourceNodes_, sourceNodesSweepCursor_);
+  sweep(processingNodes_, processingNodesSweepCursor_);
+}
+
 void AudioGraphManager::cleanup() {
   for (auto it = sourceNodes_.begin(), end = sourceNodes_.end(); it != end; ++it) {
     it->get()->cleanup();
@@ -235,6 +420,9 @@ void AudioGraphManager::cleanup() {
   processingNodes_.clear();
   audioParams_.clear();
   audioBuffers_.clear();
+  reclaimCandidates_.clear();
+  sourceNodesSweepCursor_ = 0;
+  processingNodesSweepCursor_ = 0;
 }
 
 } // namespace audioapi
@@ -1,9 +1,12 @@
 #pragma once
 
 #include <audioapi/core/utils/AudioDestructor.hpp>
+#include <audioapi/core/utils/VoicePool.h>
 #include <audioapi/utils/SpscChannel.hpp>
 
+#include <atomic>
 #include <concepts>
+#include <exception>
 #include <memory>
 #include <mutex>
 #include <tuple>
@@ -18,8 +21,7 @@ class AudioParam;
 class AudioBuffer;
 
 #define AUDIO_GRAPH_MANAGER_SPSC_OPTIONS \
-  std::unique_ptr<Event>, channels::spsc::OverflowStrategy::WAIT_ON_FULL, \
-      channels::spsc::WaitStrategy::BUSY_LOOP
+  Event, channels::spsc::OverflowStrategy::WAIT_ON_FULL, channels::spsc::WaitStrategy::BUSY_LOOP
 
 template <typename T>
 concept HasCleanupMethod = requires(T t) {
@@ -28,9 +30,10 @@ concept HasCleanupMethod = requires(T t) {
 
 class AudioGraphManager {
  public:
-  enum class ConnectionType { CONNECT, DISCONNECT, DISCONNECT_ALL, ADD };
+  enum class ConnectionType { CONNECT, DISCONNECT, DISCONNECT_ALL, ADD, BATCH, RELEASE };
   typedef ConnectionType EventType; // for backwards compatibility
-  enum class EventPayloadType { NODES, PARAMS, SOURCE_NODE, AUDIO_PARAM, NODE };
+  enum class EventPayloadType { NODES, PARAMS, SOURCE_NODE, AUDIO_PARAM, NODE, EVENTS };
+  struct Event;
   union EventPayload {
     struct {
       std::shared_ptr<AudioNode> from;
@@ -43,6 +46,7 @@ class AudioGraphManager {
     std::shared_ptr<AudioScheduledSourceNode> sourceNode;
     std::shared_ptr<AudioParam> audioParam;
     std::shared_ptr<AudioNode> node;
+    std::unique_ptr<std::vector<Event>> events;
 
     // Default constructor that initializes the first member
     EventPayload() : nodes{} {}
@@ -61,6 +65,22 @@ class AudioGraphManager {
     ~Event();
   };
 
+  /// @brief Batch open for the lifetime of the object, see beginBatch.
+  /// The batch is committed when the object goes out of scope, and discarded when that happens
+  /// because of an exception, so either all or none of its events reach the audio thread.
+  class Transaction {
+   public:
+    explicit Transaction(AudioGraphManager &graphManager);
+    ~Transaction();
+
+    Transaction(const Transaction &) = delete;
+    Transaction &operator=(const Transaction &) = delete;
+
+   private:
+    AudioGraphManager &graphManager_;
+    int uncaughtExceptions_;
+  };
+
   AudioGraphManager();
   ~AudioGraphManager();
 
@@ -101,38 +121,115 @@ class AudioGraphManager {
   /// @note Should be only used from JavaScript/HostObjects thread
   void addAudioParam(const std::shared_ptr<AudioParam> &param);
 
+  /// @brief Marks a node as no longer held from JavaScript, it is checked for destruction in the
+  /// next quantum.
+  /// @param node The released node.
+  /// @note Should be only used from JavaScript/HostObjects thread
+  void addReleasedNode(const std::shared_ptr<AudioNode> &node);
+
+  /// @brief Marks a node that may have become destructible, e.g. a source node that finished.
+  /// @param node The candidate node.
+  /// @note Called directly from the Audio thread (bypasses SPSC). Real-time safe, the candidate is
+  /// dropped if too many are pending and the periodic sweep reclaims the node instead.
+  void addReclaimCandidate(std::shared_ptr<AudioNode> node);
+
+  /// @brief Starts collecting the events added from now on into a single batch.
+  /// Nodes added and connected while the batch is open reach the audio thread together, in one
+  /// event, and are settled within the same render quantum.
+  /// Batches can be nested, the events of an inner batch are sent with the outermost one.
+  /// @note Should be only used from JavaScript/HostObjects thread
+  void beginBatch();
+
+  /// @brief Closes the batch opened by the matching beginBatch, the outermost one is sent as a
+  /// single event.
+  /// @note Should be only used from JavaScript/HostObjects thread
+  void commitBatch();
+
+  /// @brief Drops the events collected since the matching beginBatch, none of them reach the
+  /// audio thread. The events of the enclosing batches are kept.
+  /// @note Should be only used from JavaScript/HostObjects thread
+  void discardBatch();
+
   /// @brief Adds an audio buffer to the manager for destruction.
   /// @note Called directly from the Audio thread (bypasses SPSC).
   void addAudioBuffeForDestruction(std::shared_ptr<AudioBuffer> buffer);
 
+  /// @brief Finished source nodes kept to be played again instead of being destroyed.
+  VoicePool &getVoicePool() {
+    return voicePool_;
+  }
+
   void cleanup();
 
  private:
   AudioDestructor<AudioNode> nodeDestructor_;
   AudioDestructor<AudioBuffer> bufferDestructor_;
+  VoicePool voicePool_;
 
   /// @brief Initial capacity for various node types for deletion
   /// @note Higher capacity decreases number of reallocations at runtime (can be easily adjusted to 128 if needed)
   static constexpr size_t kInitialCapacity = 32;
 
-  /// @brief Initial capacity for event passing channel
-  /// @note High value reduces wait time for sender (JavaScript/HostObjects thread here)
+  /// @brief Capacity of the event passing channel
+  /// @note Events that do not fit are staged, the sender (JavaScript/HostObjects thread here)
+  /// never waits for the audio thread
   static constexpr size_t kChannelCapacity = 1024;
 
+  /// @brief Number of handled batches kept to be reused by the next ones
+  static constexpr size_t kRecycledBatchesCapacity = 16;
+
+  /// @brief Number of reclaim candidates kept between quanta
+  static constexpr size_t kReclaimCandidatesCapacity = 256;
+
+  /// @brief Number of reclaim candidates checked per quantum
+  static constexpr size_t kReclaimBudget = 32;
+
+  /// @brief Number of nodes of each list checked per quantum by the sweep, which reclaims the
+  /// nodes that were not marked as candidates, e.g. ones released from C++ or with a tail
+  static constexpr size_t kSweepBudget = 16;
+
   std::vector<std::shared_ptr<AudioScheduledSourceNode>> sourceNodes_;
   std::vector<std::shared_ptr<AudioNode>> processingNodes_;
   std::vector<std::shared_ptr<AudioParam>> audioParams_;
   std::vector<std::shared_ptr<AudioBuffer>> audioBuffers_;
 
+  /// @brief Nodes to be checked for destruction, so a quantum checks only the nodes that may have
+  /// become destructible instead of the whole graph
+  std::vector<std::shared_ptr<AudioNode>> reclaimCandidates_;
+  size_t sourceNodesSweepCursor_ = 0;
+  size_t processingNodesSweepCursor_ = 0;
+
   channels::spsc::Receiver<AUDIO_GRAPH_MANAGER_SPSC_OPTIONS> receiver_;
 
   channels::spsc::Sender<AUDIO_GRAPH_MANAGER_SPSC_OPTIONS> sender_;
 
+  /// @brief Events sent while the channel was full, in order, and every event sent after them
+  /// until the audio thread has handled them. Guarded by stagingMutex_, which the audio thread
+  /// only ever tries to lock.
+  std::vector<Event> stagedEvents_;
+  std::mutex stagingMutex_;
+  std::atomic<bool> hasStagedEvents_{false};
+
+  /// @brief Events collected by open batches, only touched by the JavaScript/HostObjects thread.
+  /// batchStarts_ holds the size of batch_ when each open batch began.
+  std::unique_ptr<std::vector<Event>> batch_;
+  std::vector<size_t> batchStarts_;
+
+  /// @brief Handled batches, emptied by the audio thread and reused by the JavaScript thread
+  channels::spsc::Sender<std::unique_ptr<std::vector<Event>>> recycledBatchSender_;
+  channels::spsc::Receiver<std::unique_ptr<std::vector<Event>>> recycledBatchReceiver_;
+
+  void sendEvent(Event &&event);
   void settlePendingConnections();
-  void handleConnectEvent(std::unique_ptr<Event> event);
-  void handleDisconnectEvent(std::unique_ptr<Event> event);
-  void handleDisconnectAllEvent(std::unique_ptr<Event> event);
-  void handleAddToDeconstructionEvent(std::unique_ptr<Event> event);
+  void receiveEvents();
+  void handleEvent(Event &event);
+  void handleBatchEvent(Event &event);
+  void handleConnectEvent(Event &event);
+  void handleDisconnectEvent(Event &event);
+  void handleDisconnectAllEvent(Event &event);
+  void handleAddToDeconstructionEvent(Event &event);
+  void handleReleaseEvent(Event &event);
+  void reclaimNodes();
 
   template <typename U>
   inline static bool canBeDestructed(const std::shared_ptr<U> &object) {
@@ -156,6 +253,52 @@ class AudioGraphManager {
     return node.use_count() == 1;
   }
 
+  /// @brief Destroys the node at the index, or recycles it, if it can be destructed, moving the
+  /// last node of the list into its place.
+  /// @return true if the node left the list.
+  template <typename T>
+    requires std::derived_from<T, AudioNode>
+  bool tryReclaim(std::vector<std::shared_ptr<T>> &vec, size_t index) {
+    auto &node = vec[index];
+    if (!AudioGraphManager::canBeDestructed(node)) {
+      return false;
+    }
+
+    node->cleanup();
+
+    /// @note node does NOT get moved out if it is not recycled or added.
+    bool isRecycled = false;
+    if constexpr (std::is_same_v<T, AudioScheduledSourceNode>) {
+      isRecycled = voicePool_.tryRecycle(node);
+    }
+    if (!isRecycled && !nodeDestructor_.tryAddForDeconstruction(std::move(node))) {
+      return false;
+    }
+
+    if (index != vec.size() - 1) {
+      vec[index] = std::move(vec.back());
+      vec[index]->graphIndex_ = index;
+    }
+    vec.pop_back();
+    return true;
+  }
+
+  /// @brief Checks up to kSweepBudget nodes of the list, continuing from where the previous
+  /// sweep stopped, so every node is eventually checked at a bounded cost per quantum.
+  template <typename T>
+    requires std::derived_from<T, AudioNode>
+  void sweep(std::vector<std::shared_ptr<T>> &vec, size_t &cursor) {
+    for (size_t checked = 0; checked < kSweepBudget && !vec.empty(); checked++) {
+      if (cursor >= vec.size()) {
+        cursor = 0;
+      }
+      // the node moved into the place of a reclaimed one is checked next
+      if (!tryReclaim(vec, cursor)) {
+        cursor++;
+      }
+    }
+  }
+
   template <typename T, typename D>
     requires std::convertible_to<T *, D *>
   static void prepareForDestruction(
@@ -187,10 +330,12 @@ class AudioGraphManager {
         end--;
       }
       if (AudioGraphManager::canBeDestructed(vec[begin])) {
+        // the swapped in object is checked again, it is the last one when begin == end
         std::swap(vec[begin], vec[end]);
         end--;
+      } else {
+        begin++;
       }
-      begin++;
     }
 
     for (int i = begin; i < vec.size(); i++) {
@@ -0,0 +1,344 @@
+#include <audioapi/core/utils/AudioParamTimeline.h>
+#include <audioapi/dsp/AudioUtils.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <span>
+#include <utility>
+
+namespace audioapi {
+
+namespace {
+
+/// @brief Finds the event the param follows at the given time, the last one that has started or
+/// the first one if none has.
+size_t findEvent(const ParamChangeEvent *events, size_t size, double time) {
+  auto found = std::upper_bound(
+      events, events + size, time, [](double time, const ParamChangeEvent &event) {
+        return time < event.startTime;
+      });
+  return found == events ? 0 : static_cast<size_t>(found - events) - 1;
+}
+
+} // namespace
+
+AudioParamTimeline::AudioParamTimeline(float defaultValue) : defaultValue_(defaultValue) {
+  auto [retiredSender, retiredReceiver] = channels::spsc::channel<Storage *>(kRetiredCapacity);
+  retiredSender_ = std::move(retiredSender);
+  retiredReceiver_ = std::move(retiredReceiver);
+}
+
+double AudioParamTimeline::getEndTime() const noexcept {
+  if (isEmpty()) {
+    return 0.0;
+  }
+
+  return storage_->events.back().endTime;
+}
+
+float AudioParamTimeline::getEndValue(double time) const noexcept {
+  if (isEmpty()) {
+    return defaultValue_;
+  }
+
+  const auto &last = storage_->events.back();
+
+  // SET_TARGET never settles, it has the value it has reached by the time
+  if (last.type == ParamChangeEventType::SET_TARGET) {
+    return getEventValue(last, storage_->curveValues.data(), time);
+  }
+
+  return last.endValue;
+}
+
+void AudioParamTimeline::append(ParamChangeEvent event, std::span<const float> curve) {
+  if (storage_ == nullptr || storage_->events.size() == storage_->events.capacity() ||
+      storage_->curveValues.size() + curve.size() > storage_->curveValues.capacity()) {
+    rebuild(1, curve.size());
+  }
+
+  event.startValue = getEndValue(event.startTime);
+
+  if (!curve.empty()) {
+    event.curveOffset = storage_->curveValues.size();
+    event.curveLength = curve.size();
+    storage_->curveValues.insert(storage_->curveValues.end(), curve.begin(), curve.end());
+  }
+
+  // the capacity is reserved, so the events the audio thread reads stay in place
+  storage_->events.push_back(event);
+}
+
+void AudioParamTimeline::reserve(size_t extraEvents) {
+  if (storage_ != nullptr &&
+      storage_->events.capacity() - storage_->events.size() >= extraEvents) {
+    return;
+  }
+
+  rebuild(extraEvents, 0);
+}
+
+void AudioParamTimeline::cancelScheduledValues(double cancelTime) {
+  if (isEmpty() || storage_->events.back().endTime < cancelTime) {
+    return;
+  }
+
+  makeEditable();
+  auto &events = storage_->events;
+
+  // ramps and curves still running at the cancel time are removed as well
+  while (!events.empty() && events.back().endTime >= cancelTime) {
+    events.pop_back();
+  }
+}
+
+void AudioParamTimeline::cancelAndHoldAtTime(double cancelTime) {
+  if (isEmpty()) {
+    return;
+  }
+
+  makeEditable();
+  auto &events = storage_->events;
+
+  while (!events.empty() && events.back().startTime > cancelTime) {
+    events.pop_back();
+  }
+
+  if (events.empty()) {
+    return;
+  }
+
+  auto &last = events.back();
+  auto heldValue = getEventValue(last, storage_->curveValues.data(), cancelTime);
+
+  switch (last.type) {
+    case ParamChangeEventType::LINEAR_RAMP:
+    case ParamChangeEventType::EXPONENTIAL_RAMP:
+      // a ramp cut short at its value at the cancel time follows the same curve
+      if (cancelTime < last.endTime) {
+        last.endTime = cancelTime;
+        last.endValue = heldValue;
+      }
+      break;
+
+    case ParamChangeEventType::SET_TARGET:
+    case ParamChangeEventType::SET_VALUE_CURVE:
+      // these can not be cut short, so the held value follows them
+      if (last.type == ParamChangeEventType::SET_TARGET || cancelTime < last.endTime) {
+        append({
+            .type = ParamChangeEventType::SET_VALUE,
+            .startTime = cancelTime,
+            .endTime = cancelTime,
+            .endValue = heldValue,
+        });
+        storage_->events.back().startValue = heldValue;
+      }
+      break;
+
+    case ParamChangeEventType::SET_VALUE:
+      break;
+  }
+}
+
+void AudioParamTimeline::publish() {
+  if (storage_ == nullptr) {
+    return;
+  }
+
+  storage_->size.store(storage_->events.size(), std::memory_order_release);
+
+  if (isStoragePublished_) {
+    return;
+  }
+
+  // a storage still waiting in the handoff has never been seen by the audio thread
+  if (auto *previous = pendingStorage_.exchange(storage_, std::memory_order_acq_rel);
+      previous != nullptr) {
+    releaseStorage(previous);
+  }
+
+  isStoragePublished_ = true;
+}
+
+void AudioParamTimeline::reset(float defaultValue) {
+  defaultValue_ = defaultValue;
+  collectRetiredStorages();
+
+  // the audio thread state is reset here as well, so only the storage being edited is kept
+  std::erase_if(storages_, [this](const auto &owned) { return owned.get() != storage_; });
+  pendingStorage_.store(nullptr, std::memory_order_relaxed);
+  renderTime_.store(0.0, std::memory_order_relaxed);
+
+  if (storage_ != nullptr) {
+    storage_->events.clear();
+    storage_->curveValues.clear();
+    storage_->size.store(0, std::memory_order_relaxed);
+  }
+  isStoragePublished_ = false;
+
+  currentStorage_ = nullptr;
+  events_ = nullptr;
+  curveValues_ = nullptr;
+  size_ = 0;
+  cursor_ = 0;
+}
+
+void AudioParamTimeline::update(double time) noexcept {
+  renderTime_.store(time, std::memory_order_release);
+
+  if (auto *storage = pendingStorage_.exchange(nullptr, std::memory_order_acq_rel);
+      storage != nullptr) {
+    if (currentStorage_ != nullptr) {
+      // the JS thread collects retired storages before building a new one, so it is never full
+      retiredSender_.try_send(currentStorage_);
+    }
+
+    currentStorage_ = storage;
+    events_ = storage->eventsData;
+    curveValues_ = storage->curveValuesData;
+    size_ = storage->size.load(std::memory_order_acquire);
+    cursor_ = findEvent(events_, size_, time);
+    return;
+  }
+
+  if (currentStorage_ != nullptr) {
+    size_ = currentStorage_->size.load(std::memory_order_acquire);
+  }
+}
+
+bool AudioParamTimeline::getValueAtTime(double time, float &value) noexcept {
+  if (size_ == 0) {
+    return false;
+  }
+
+  while (cursor_ + 1 < size_ && events_[cursor_ + 1].startTime <= time) {
+    ++cursor_;
+  }
+
+  value = getEventValue(events_[cursor_], curveValues_, time);
+  return true;
+}
+
+float AudioParamTimeline::getEventValue(
+    const ParamChangeEvent &event,
+    const float *curveValues,
+    double time) noexcept {
+  if (time < event.startTime) {
+    return event.startValue;
+  }
+
+  switch (event.type) {
+    case ParamChangeEventType::SET_VALUE:
+      return event.endValue;
+
+    case ParamChangeEventType::LINEAR_RAMP:
+      if (time < event.endTime) {
+        auto progress = (time - event.startTime) / (event.endTime - event.startTime);
+        return static_cast<float>(
+            event.startValue + (event.endValue - event.startValue) * progress);
+      }
+      return event.endValue;
+
+    case ParamChangeEventType::EXPONENTIAL_RAMP:
+      if (time < event.endTime) {
+        auto progress = (time - event.startTime) / (event.endTime - event.startTime);
+        return static_cast<float>(
+            event.startValue * std::pow(event.endValue / event.startValue, progress));
+      }
+      return event.endValue;
+
+    case ParamChangeEventType::SET_TARGET:
+      return static_cast<float>(
+          event.target +
+          (event.startValue - event.target) *
+              std::exp(-(time - event.startTime) / event.timeConstant));
+
+    case ParamChangeEventType::SET_VALUE_CURVE:
+      if (time < event.endTime) {
+        auto values = std::span<const float>(curveValues + event.curveOffset, event.curveLength);
+        auto position = (time - event.startTime) / (event.endTime - event.startTime) *
+            static_cast<double>(event.curveLength - 1);
+        auto k = static_cast<size_t>(std::floor(position));
+        auto factor = static_cast<float>(position - static_cast<double>(k));
+        return dsp::linearInterpolate(values, k, std::min(k + 1, event.curveLength - 1), factor);
+      }
+      return event.endValue;
+  }
+
+  return event.endValue;
+}
+
+void AudioParamTimeline::rebuild(size_t extraEvents, size_t extraCurveValues) {
+  collectRetiredStorages();
+
+  auto storage = std::make_unique<Storage>();
+  size_t first = 0;
+  size_t keptEvents = 0;
+  size_t keptCurveValues = 0;
+
+  if (storage_ != nullptr) {
+    const auto &events = storage_->events;
+
+    // the audio thread never goes back to the events before the one it follows
+    if (!events.empty()) {
+      first = findEvent(events.data(), events.size(), renderTime_.load(std::memory_order_acquire));
+    }
+
+    keptEvents = events.size() - first;
+
+    for (size_t i = first; i < events.size(); ++i) {
+      keptCurveValues += events[i].curveLength;
+    }
+  }
+
+  storage->events.reserve(std::max(kMinCapacity, 2 * (keptEvents + extraEvents)));
+  storage->curveValues.reserve(2 * (keptCurveValues + extraCurveValues));
+
+  if (storage_ != nullptr) {
+    for (size_t i = first; i < storage_->events.size(); ++i) {
+      auto event = storage_->events[i];
+
+      if (event.curveLength > 0) {
+        auto begin = storage_->curveValues.begin() + static_cast<ptrdiff_t>(event.curveOffset);
+        event.curveOffset = storage->curveValues.size();
+        storage->curveValues.insert(
+            storage->curveValues.end(), begin, begin + static_cast<ptrdiff_t>(event.curveLength));
+      }
+
+      storage->events.push_back(event);
+    }
+
+    // a storage the audio thread has never seen can go right away
+    if (!isStoragePublished_) {
+      releaseStorage(storage_);
+    }
+  }
+
+  storage->eventsData = storage->events.data();
+  storage->curveValuesData = storage->curveValues.data();
+
+  storage_ = storage.get();
+  isStoragePublished_ = false;
+  storages_.push_back(std::move(storage));
+}
+
+void AudioParamTimeline::makeEditable() {
+  if (isStoragePublished_) {
+    rebuild(0, 0);
+  }
+}
+
+void AudioParamTimeline::collectRetiredStorages() {
+  Storage *storage = nullptr;
+
+  while (retiredReceiver_.try_receive(storage) == channels::spsc::ResponseStatus::SUCCESS) {
+    releaseStorage(storage);
+  }
+}
+
+void AudioParamTimeline::releaseStorage(Storage *storage) {
+  std::erase_if(storages_, [storage](const auto &owned) { return owned.get() == storage; });
+}
+
+} // namespace audioapi
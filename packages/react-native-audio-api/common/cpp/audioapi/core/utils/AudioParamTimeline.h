@@ -0,0 +1,129 @@
+#pragma once
+
+#include <audioapi/core/types/ParamChangeEventType.h>
+#include <audioapi/core/utils/ParamChangeEvent.hpp>
+#include <audioapi/utils/SpscChannel.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace audioapi {
+
+/// @brief The automation events of an AudioParam, edited on the JS thread and read on the audio
+/// thread without locks.
+///
+/// The JS thread owns the events and keeps them sorted by start time. Appending writes past the
+/// end of the published events, so it is done in place. Every other change, and an append that
+/// does not fit, builds a new storage without the events the audio thread has already passed,
+/// which is handed over with an atomic exchange. Storages the audio thread stops using are sent
+/// back and freed on the JS thread, so the audio thread never allocates nor frees.
+///
+/// The audio thread keeps a cursor on the current event, which only moves forward, and looks it
+/// up with a binary search only when it picks up a new storage.
+/// @note The number of events is only limited by memory, no event is ever dropped.
+class AudioParamTimeline {
+ public:
+  explicit AudioParamTimeline(float defaultValue);
+
+  AudioParamTimeline(const AudioParamTimeline &) = delete;
+  AudioParamTimeline &operator=(const AudioParamTimeline &) = delete;
+
+  /// JS-Thread only methods
+
+  [[nodiscard]] inline bool isEmpty() const noexcept {
+    return storage_ == nullptr || storage_->events.empty();
+  }
+
+  /// @brief Get the end time of the last event.
+  /// @return The end time of the last event or 0 if there are no events.
+  [[nodiscard]] double getEndTime() const noexcept;
+
+  /// @brief Get the value the last event settles on at the given time.
+  /// @return The value of the last event at the time or the default value if there are no events.
+  [[nodiscard]] float getEndValue(double time) const noexcept;
+
+  /// @brief Appends an event, which can not start before the end time of the timeline.
+  /// @param curve The values of a SET_VALUE_CURVE event, copied into the timeline.
+  /// @note The start value of the event is connected to the value of the last event.
+  void append(ParamChangeEvent event, std::span<const float> curve = {});
+
+  /// @brief Makes room for appending the given number of events without moving the storage.
+  void reserve(size_t extraEvents);
+
+  /// @brief Removes the events at or after the given time.
+  void cancelScheduledValues(double cancelTime);
+
+  /// @brief Removes the events starting after the given time and holds the value the timeline
+  /// has at that time.
+  void cancelAndHoldAtTime(double cancelTime);
+
+  /// @brief Makes every change made since the last call visible to the audio thread.
+  void publish();
+
+  /// @brief Removes every event and changes the default value, keeping the reserved capacity.
+  /// @note Only to be called while the audio thread does not use the timeline.
+  void reset(float defaultValue);
+
+  /// Audio-Thread only methods
+
+  /// @brief Picks up the changes published since the last render quantum.
+  /// @param time The time of the first frame of the render quantum.
+  void update(double time) noexcept;
+
+  /// @brief Evaluates the timeline at the given time.
+  /// @param time A time not earlier than the one of the previous call.
+  /// @param value Set to the value of the timeline when it has any events.
+  /// @return False if there are no events.
+  bool getValueAtTime(double time, float &value) noexcept;
+
+  /// @brief Evaluates an event at the given time.
+  [[nodiscard]] static float
+  getEventValue(const ParamChangeEvent &event, const float *curveValues, double time) noexcept;
+
+ private:
+  static constexpr size_t kMinCapacity = 16;
+  // storages the audio thread has let go of between two rebuilds, at most two ever are
+  static constexpr size_t kRetiredCapacity = 8;
+
+  /// @brief Events with enough capacity reserved that appending never moves them.
+  struct Storage {
+    std::vector<ParamChangeEvent> events;
+    std::vector<float> curveValues;
+    // the audio thread reads through these, so it never touches the vectors being appended to
+    const ParamChangeEvent *eventsData = nullptr;
+    const float *curveValuesData = nullptr;
+    // the number of events visible to the audio thread
+    std::atomic<size_t> size{0};
+  };
+
+  float defaultValue_;
+
+  // JS thread state, the storage being edited and every storage that can still be in use
+  Storage *storage_ = nullptr;
+  bool isStoragePublished_ = false;
+  std::vector<std::unique_ptr<Storage>> storages_;
+  channels::spsc::Receiver<Storage *> retiredReceiver_;
+
+  // handoff of the latest published storage
+  std::atomic<Storage *> pendingStorage_{nullptr};
+  // start time of the render quantum being processed, events ending before it can be dropped
+  std::atomic<double> renderTime_{0.0};
+
+  // audio thread state
+  Storage *currentStorage_ = nullptr;
+  const ParamChangeEvent *events_ = nullptr;
+  const float *curveValues_ = nullptr;
+  size_t size_ = 0;
+  size_t cursor_ = 0;
+  channels::spsc::Sender<Storage *> retiredSender_;
+
+  void rebuild(size_t extraEvents, size_t extraCurveValues);
+  void makeEditable();
+  void collectRetiredStorages();
+  void releaseStorage(Storage *storage);
+};
+
+} // namespace audioapi
@@ -5,15 +5,32 @@
 #include <audioapi/events/AudioEventHandlerRegistry.h>
 #include <audioapi/utils/AudioArray.h>
 #include <audioapi/utils/AudioBuffer.h>
-#include <audioapi/utils/CircularAudioArray.h>
+#include <audioapi/utils/CircularAudioBuffer.h>
 
 #include <algorithm>
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace audioapi {
 
+namespace {
+
+/// @brief A pooled buffer is in use while JS or a node holds its audio,
+/// in the compact storage format if JS switched it to one.
+bool isBufferInUse(const AudioBufferHostObject &bufferHostObject) {
+  if (const auto &compactBuffer = bufferHostObject.compactBuffer_) {
+    return compactBuffer.use_count() > 1;
+  }
+
+  const auto &buffer = bufferHostObject.audioBuffer_;
+  return buffer.use_count() > 1 || buffer->isChannelDataShared();
+}
+
+} // namespace
+
 /// @brief Constructor
 /// Allocates circular buffer (as every property to do so is already known at this point).
 /// @param audioEventHandlerRegistry The audio event handler registry
@@ -21,22 +38,34 @@ namespace audioapi {
 /// @param bufferLength The user desired buffer length
 /// @param channelCount The user desired channel count
 /// @param callbackId The callback identifier
+/// @param bufferPoolSize Number of buffers reused for the emitted chunks, 0 to allocate each one
 AudioRecorderCallback::AudioRecorderCallback(
     const std::shared_ptr<AudioEventHandlerRegistry> &audioEventHandlerRegistry,
     float sampleRate,
     size_t bufferLength,
     int channelCount,
-    uint64_t callbackId)
+    uint64_t callbackId,
+    size_t bufferPoolSize)
     : sampleRate_(sampleRate),
       bufferLength_(bufferLength),
       channelCount_(channelCount),
       callbackId_(callbackId),
       audioEventHandlerRegistry_(audioEventHandlerRegistry) {
   ringBufferSize_ = std::max(bufferLength * 2, static_cast<size_t>(8192));
-  circularBuffer_.resize(channelCount_);
-
-  for (size_t i = 0; i < channelCount_; ++i) {
-    circularBuffer_[i] = std::make_shared<CircularAudioArray>(ringBufferSize_);
+  circularBuffer_ = std::make_shared<CircularAudioBuffer>(
+      ringBufferSize_,
+      channelCount_,
+      sampleRate_,
+      CircularAudioBuffer::OverflowPolicy::DROP_NEWEST);
+
+  if (bufferPoolSize > 0) {
+    std::vector<std::shared_ptr<AudioBufferHostObject>> bufferHostObjects(bufferPoolSize);
+    for (auto &bufferHostObject : bufferHostObjects) {
+      bufferHostObject = std::make_shared<AudioBufferHostObject>(
+          std::make_shared<AudioBuffer>(bufferLength_, channelCount_, sampleRate_));
+    }
+    bufferPool_ = std::make_unique<RecyclingPool<AudioBufferHostObject>>(
+        std::move(bufferHostObjects), isBufferInUse);
   }
 
   isInitialized_.store(true, std::memory_order_release);
@@ -49,30 +78,25 @@ AudioRecorderCallback::~AudioRecorderCallback() {
 /// @brief Emits audio data from the circular buffer when enough frames are available.
 /// @param flush If true, emits all available data regardless of buffer length.
 void AudioRecorderCallback::emitAudioData(bool flush) {
-  size_t sizeLimit = flush ? circularBuffer_[0]->getNumberOfAvailableFrames() : bufferLength_;
+  size_t sizeLimit = flush ? circularBuffer_->getNumberOfAvailableFrames() : bufferLength_;
 
   if (sizeLimit == 0) {
     return;
   }
 
-  while (circularBuffer_[0]->getNumberOfAvailableFrames() >= sizeLimit) {
-    auto buffer = std::make_shared<AudioBuffer>(sizeLimit, channelCount_, sampleRate_);
+  while (circularBuffer_->getNumberOfAvailableFrames() >= sizeLimit) {
+    auto bufferHostObject = createBufferHostObject(sizeLimit);
+    circularBuffer_->read(*bufferHostObject->audioBuffer_, sizeLimit);
 
-    for (int i = 0; i < channelCount_; ++i) {
-      circularBuffer_[i]->pop_front(*buffer->getChannel(i), sizeLimit);
-    }
-
-    invokeCallback(buffer, static_cast<int>(sizeLimit));
+    invokeCallback(bufferHostObject, static_cast<int>(sizeLimit));
   }
 }
 
 void AudioRecorderCallback::invokeCallback(
-    const std::shared_ptr<AudioBuffer> &buffer,
+    const std::shared_ptr<AudioBufferHostObject> &bufferHostObject,
     int numFrames) {
-  auto audioBufferHostObject = std::make_shared<AudioBufferHostObject>(buffer);
-
   std::unordered_map<std::string, EventValue> eventPayload = {};
-  eventPayload.insert({"buffer", audioBufferHostObject});
+  eventPayload.insert({"buffer", bufferHostObject});
   eventPayload.insert({"numFrames", numFrames});
 
   if (audioEventHandlerRegistry_) {
@@ -81,6 +105,26 @@ void AudioRecorderCallback::invokeCallback(
   }
 }
 
+/// @brief Takes a free buffer from the pool, or allocates one when none is free.
+/// @param numFrames Length of the buffer, only buffers of the configured length are pooled.
+std::shared_ptr<AudioBufferHostObject> AudioRecorderCallback::createBufferHostObject(
+    size_t numFrames) {
+  if (bufferPool_ != nullptr && numFrames == bufferLength_) {
+    if (auto bufferHostObject = bufferPool_->acquire()) {
+      // a buffer JS switched to a compact format gets a float one again
+      if (bufferHostObject->compactBuffer_ != nullptr) {
+        bufferHostObject->compactBuffer_.reset();
+        bufferHostObject->audioBuffer_ =
+            std::make_shared<AudioBuffer>(bufferLength_, channelCount_, sampleRate_);
+      }
+      return bufferHostObject;
+    }
+  }
+
+  return std::make_shared<AudioBufferHostObject>(
+      std::make_shared<AudioBuffer>(numFrames, channelCount_, sampleRate_));
+}
+
 void AudioRecorderCallback::setOnErrorCallback(uint64_t callbackId) {
   errorCallbackId_.store(callbackId, std::memory_order_release);
 }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <audioapi/core/utils/RecyclingPool.h>
 #include <audioapi/utils/Result.hpp>
 #include <audioapi/utils/SpscChannel.hpp>
 #include <audioapi/utils/TaskOffloader.hpp>
@@ -12,8 +13,9 @@ namespace audioapi {
 
 class AudioBuffer;
 class AudioArray;
-class CircularAudioArray;
+class CircularAudioBuffer;
 class AudioEventHandlerRegistry;
+class AudioBufferHostObject;
 
 class AudioRecorderCallback {
  public:
@@ -22,13 +24,16 @@ class AudioRecorderCallback {
       float sampleRate,
       size_t bufferLength,
       int channelCount,
-      uint64_t callbackId);
+      uint64_t callbackId,
+      size_t bufferPoolSize);
   virtual ~AudioRecorderCallback();
 
   virtual void cleanup() = 0;
 
   void emitAudioData(bool flush = false);
-  void invokeCallback(const std::shared_ptr<AudioBuffer> &buffer, int numFrames);
+  void invokeCallback(
+      const std::shared_ptr<AudioBufferHostObject> &bufferHostObject,
+      int numFrames);
 
   void setOnErrorCallback(uint64_t callbackId);
   void clearOnErrorCallback();
@@ -47,8 +52,13 @@ class AudioRecorderCallback {
 
   std::shared_ptr<AudioEventHandlerRegistry> audioEventHandlerRegistry_;
 
-  // TODO: CircularAudioBuffer
-  std::vector<std::shared_ptr<CircularAudioArray>> circularBuffer_;
+  // buffers reused once JS released them, nullptr if every chunk gets a new buffer
+  std::unique_ptr<RecyclingPool<AudioBufferHostObject>> bufferPool_;
+
+  std::shared_ptr<AudioBufferHostObject> createBufferHostObject(size_t numFrames);
+
+  // frames that do not fit are dropped until JS catches up with the emitted chunks
+  std::shared_ptr<CircularAudioBuffer> circularBuffer_;
   static constexpr auto RECORDER_CALLBACK_SPSC_OVERFLOW_STRATEGY =
       channels::spsc::OverflowStrategy::OVERWRITE_ON_FULL;
   static constexpr auto RECORDER_CALLBACK_SPSC_WAIT_STRATEGY =
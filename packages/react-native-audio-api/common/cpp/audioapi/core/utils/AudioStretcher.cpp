@@ -1,73 +1,85 @@
 #include <audioapi/core/utils/AudioStretcher.h>
 #include <audioapi/core/utils/Constants.h>
-#include <audioapi/libs/audio-stretch/stretch.h>
+#include <audioapi/dsp/TimeStretcher.h>
 #include <audioapi/utils/AudioArray.h>
 #include <audioapi/utils/AudioBuffer.h>
-#include <cstdint>
+#include <algorithm>
+#include <cmath>
 #include <memory>
 #include <vector>
 
 namespace audioapi {
 
-std::vector<int16_t> AudioStretcher::castToInt16Buffer(AudioBuffer &buffer) {
-  const size_t numChannels = buffer.getNumberOfChannels();
-  const size_t numFrames = buffer.getSize();
-
-  std::vector<int16_t> int16Buffer(numFrames * numChannels);
-
-  for (size_t ch = 0; ch < numChannels; ++ch) {
-    auto channelData = buffer.getChannel(ch)->span();
-    for (size_t i = 0; i < numFrames; ++i) {
-      int16Buffer[i * numChannels + ch] = floatToInt16(channelData[i]);
-    }
-  }
-
-  return int16Buffer;
-}
-
 std::shared_ptr<AudioBuffer> AudioStretcher::changePlaybackSpeed(
-    AudioBuffer buffer,
-    float playbackSpeed) {
+    const AudioBuffer &buffer,
+    float playbackSpeed,
+    const ProgressCallback &onProgress,
+    const CancellationCheck &isCancelled) {
   const float sampleRate = buffer.getSampleRate();
-  const size_t outputChannels = buffer.getNumberOfChannels();
+  const size_t numberOfChannels = buffer.getNumberOfChannels();
   const size_t numFrames = buffer.getSize();
 
   if (playbackSpeed == 1.0f) {
     return std::make_shared<AudioBuffer>(buffer);
   }
 
-  std::vector<int16_t> int16Buffer = castToInt16Buffer(buffer);
-
-  auto stretcher = stretch_init(
+  const float ratio = std::clamp(
+      1.0f / playbackSpeed, dsp::TimeStretcher::kMinRatio, dsp::TimeStretcher::kMaxRatio);
+  dsp::TimeStretcher stretcher(
       static_cast<int>(sampleRate / UPPER_FREQUENCY_LIMIT_DETECTION),
       static_cast<int>(sampleRate / LOWER_FREQUENCY_LIMIT_DETECTION),
-      outputChannels,
-      0x1);
+      numberOfChannels);
+
+  // The length of the stretched signal only follows the ratio up to a few pitch periods,
+  // the output is trimmed or padded with silence to the exact expected length.
+  const auto outputFrames =
+      static_cast<size_t>(std::lround(static_cast<double>(numFrames) * ratio));
+  auto audioBuffer = std::make_shared<AudioBuffer>(outputFrames, numberOfChannels, sampleRate);
+
+  // Frames are written straight into the output while a whole chunk fits,
+  // only the last chunks go through the bounded scratch buffer.
+  const size_t chunkCapacity = stretcher.getOutputCapacity(kChunkFrames, ratio);
+  AudioBuffer scratch(chunkCapacity, static_cast<int>(numberOfChannels), sampleRate);
+
+  std::vector<const float *> input(numberOfChannels);
+  std::vector<float *> output(numberOfChannels);
+  for (size_t ch = 0; ch < numberOfChannels; ++ch) {
+    input[ch] = buffer.getChannel(ch)->begin();
+  }
 
-  int maxOutputFrames =
-      stretch_output_capacity(stretcher, static_cast<int>(numFrames), 1 / playbackSpeed);
-  std::vector<int16_t> stretchedBuffer(maxOutputFrames * outputChannels);
+  size_t writtenFrames = 0;
+  auto stretchInto = [&](auto &&stretch) {
+    const bool writeDirectly = writtenFrames + chunkCapacity <= outputFrames;
+    for (size_t ch = 0; ch < numberOfChannels; ++ch) {
+      output[ch] = writeDirectly ? audioBuffer->getChannel(ch)->begin() + writtenFrames
+                                 : scratch.getChannel(ch)->begin();
+    }
 
-  int outputFrames = stretch_samples(
-      stretcher,
-      int16Buffer.data(),
-      static_cast<int>(numFrames),
-      stretchedBuffer.data(),
-      1 / playbackSpeed);
+    size_t producedFrames = stretch(output.data());
+    if (!writeDirectly) {
+      producedFrames = std::min(producedFrames, outputFrames - writtenFrames);
+      audioBuffer->copy(scratch, 0, writtenFrames, producedFrames);
+    }
+    writtenFrames += producedFrames;
+  };
 
-  outputFrames += stretch_flush(stretcher, stretchedBuffer.data() + (outputFrames));
-  stretchedBuffer.resize(outputFrames * outputChannels);
-  stretch_deinit(stretcher);
+  for (size_t offset = 0; offset < numFrames; offset += kChunkFrames) {
+    if (isCancelled && isCancelled()) {
+      return nullptr;
+    }
 
-  auto audioBuffer = std::make_shared<AudioBuffer>(outputFrames, outputChannels, sampleRate);
+    const size_t framesToProcess = std::min(kChunkFrames, numFrames - offset);
+    stretchInto([&](float *const *destination) {
+      return stretcher.process(input.data(), offset, framesToProcess, destination, ratio);
+    });
 
-  for (size_t ch = 0; ch < outputChannels; ++ch) {
-    auto channelData = audioBuffer->getChannel(ch)->span();
-    for (int i = 0; i < outputFrames; ++i) {
-      channelData[i] = int16ToFloat(stretchedBuffer[i * outputChannels + ch]);
+    if (onProgress) {
+      onProgress(static_cast<float>(offset + framesToProcess) / static_cast<float>(numFrames));
     }
   }
 
+  stretchInto([&](float *const *destination) { return stretcher.flush(destination); });
+
   return audioBuffer;
 }
 
@@ -1,7 +1,8 @@
 #pragma once
 
+#include <cstddef>
+#include <functional>
 #include <memory>
-#include <vector>
 
 namespace audioapi {
 
@@ -9,21 +10,30 @@ class AudioBuffer;
 
 class AudioStretcher {
  public:
+  /// @brief Receives the fraction of the input processed so far, in (0, 1].
+  using ProgressCallback = std::function<void(float)>;
+  /// @brief Polled between chunks, returning true stops processing.
+  using CancellationCheck = std::function<bool()>;
+
   AudioStretcher() = delete;
 
+  /// @brief Changes the duration of the buffer without altering its pitch.
+  /// @param buffer The buffer to stretch, it is not modified.
+  /// @param playbackSpeed Speed factor, the output lasts duration / playbackSpeed
+  /// with the speed clamped to [0.5, 2].
+  /// @param onProgress Optional callback invoked after each processed chunk.
+  /// @param isCancelled Optional check polled before each chunk.
+  /// @return The stretched buffer or nullptr if processing was cancelled.
+  /// @note Works in chunks of kChunkFrames, apart from the output only a few periods
+  /// of audio are buffered regardless of the buffer length.
   [[nodiscard]] static std::shared_ptr<AudioBuffer> changePlaybackSpeed(
-      AudioBuffer buffer,
-      float playbackSpeed);
+      const AudioBuffer &buffer,
+      float playbackSpeed,
+      const ProgressCallback &onProgress = nullptr,
+      const CancellationCheck &isCancelled = nullptr);
 
  private:
-  static std::vector<int16_t> castToInt16Buffer(AudioBuffer &buffer);
-
-  [[nodiscard]] static inline int16_t floatToInt16(float sample) {
-    return static_cast<int16_t>(sample * INT16_MAX);
-  }
-  [[nodiscard]] static inline float int16ToFloat(int16_t sample) {
-    return static_cast<float>(sample) / INT16_MAX;
-  }
+  static constexpr size_t kChunkFrames = 16384;
 };
 
 } // namespace audioapi
@@ -27,6 +27,5 @@ static constexpr float PI = std::numbers::pi_v<float>;
 
 // buffer sizes
 static constexpr size_t PROMISE_VENDOR_THREAD_POOL_WORKER_COUNT = 4;
-static constexpr size_t PROMISE_VENDOR_THREAD_POOL_LOAD_BALANCER_QUEUE_SIZE = 32;
-static constexpr size_t PROMISE_VENDOR_THREAD_POOL_WORKER_QUEUE_SIZE = 32;
+static constexpr size_t DECODED_AUDIO_CACHE_DEFAULT_BUDGET_IN_BYTES = 32 * 1024 * 1024;
 } // namespace audioapi
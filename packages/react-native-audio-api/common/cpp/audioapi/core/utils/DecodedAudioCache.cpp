@@ -0,0 +1,175 @@
+#include <audioapi/core/utils/DecodedAudioCache.h>
+#include <audioapi/utils/AudioBuffer.h>
+
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace audioapi {
+
+namespace {
+
+// 64-bit FNV-1a over whole words, a lot cheaper than decoding the same bytes
+uint64_t hashBytes(const void *data, size_t size) {
+  constexpr uint64_t kOffsetBasis = 14695981039346656037ull;
+  constexpr uint64_t kPrime = 1099511628211ull;
+
+  const auto *bytes = static_cast<const unsigned char *>(data);
+  uint64_t hash = kOffsetBasis;
+  size_t i = 0;
+
+  for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+    uint64_t word;
+    std::memcpy(&word, bytes + i, sizeof(uint64_t));
+    hash = (hash ^ word) * kPrime;
+  }
+  for (; i < size; ++i) {
+    hash = (hash ^ bytes[i]) * kPrime;
+  }
+
+  return hash;
+}
+
+size_t getSizeInBytes(const AudioBuffer &buffer) {
+  return buffer.getSize() * buffer.getNumberOfChannels() * sizeof(float);
+}
+
+} // namespace
+
+void DecodedAudioCache::PendingDecode::then(Callback &&callback) {
+  std::unique_lock lock(mutex_);
+  if (!isDone_) {
+    callbacks_.emplace_back(std::move(callback));
+    return;
+  }
+
+  lock.unlock();
+  callback(buffer_);
+}
+
+void DecodedAudioCache::PendingDecode::resolve(const std::shared_ptr<AudioBuffer> &buffer) {
+  std::vector<Callback> callbacks;
+  {
+    std::lock_guard lock(mutex_);
+    isDone_ = true;
+    buffer_ = buffer;
+    callbacks.swap(callbacks_);
+  }
+
+  for (auto &callback : callbacks) {
+    callback(buffer);
+  }
+}
+
+DecodedAudioCache::DecodedAudioCache(size_t budgetInBytes) : budgetInBytes_(budgetInBytes) {}
+
+std::string DecodedAudioCache::makeFileKey(const std::string &path, float sampleRate) {
+  // size and modification time make a rewritten file miss the cache
+  std::error_code ec;
+  auto size = std::filesystem::file_size(path, ec);
+  if (ec) {
+    size = 0;
+  }
+  auto modified = std::filesystem::last_write_time(path, ec);
+  auto modifiedTicks = ec ? 0 : static_cast<long long>(modified.time_since_epoch().count());
+
+  return "file:" + path + ":" + std::to_string(size) + ":" + std::to_string(modifiedTicks) +
+      "@" + std::to_string(sampleRate);
+}
+
+std::string DecodedAudioCache::makeMemoryKey(const void *data, size_t size, float sampleRate) {
+  return "memory:" + std::to_string(hashBytes(data, size)) + ":" + std::to_string(size) + "@" +
+      std::to_string(sampleRate);
+}
+
+DecodedAudioCache::Lookup DecodedAudioCache::lookup(const std::string &key) {
+  std::lock_guard lock(mutex_);
+
+  if (auto it = index_.find(key); it != index_.end()) {
+    entries_.splice(entries_.begin(), entries_, it->second);
+    hits_++;
+    return {it->second->buffer, nullptr, false};
+  }
+
+  if (auto it = inFlight_.find(key); it != inFlight_.end()) {
+    inFlightJoins_++;
+    it->second->hasJoiners_ = true;
+    return {nullptr, it->second, false};
+  }
+
+  misses_++;
+  inFlight_.emplace(key, std::make_shared<PendingDecode>());
+  return {nullptr, nullptr, true};
+}
+
+bool DecodedAudioCache::complete(
+    const std::string &key,
+    const std::shared_ptr<AudioBuffer> &buffer) {
+  std::shared_ptr<PendingDecode> pending;
+  bool isShared = false;
+  {
+    std::lock_guard lock(mutex_);
+
+    if (auto it = inFlight_.find(key); it != inFlight_.end()) {
+      pending = std::move(it->second);
+      inFlight_.erase(it);
+      isShared = pending->hasJoiners_;
+    }
+
+    size_t sizeInBytes = buffer ? getSizeInBytes(*buffer) : 0;
+    if (buffer && sizeInBytes <= budgetInBytes_ && !index_.contains(key)) {
+      evictToFit(budgetInBytes_ - sizeInBytes);
+      entries_.push_front({key, buffer, sizeInBytes});
+      index_.emplace(key, entries_.begin());
+      sizeInBytes_ += sizeInBytes;
+      isShared = true;
+    }
+  }
+
+  // callbacks may resolve promises, so they run outside of the cache lock
+  if (pending) {
+    pending->resolve(buffer);
+  }
+
+  return buffer != nullptr && isShared;
+}
+
+std::shared_ptr<AudioBuffer> DecodedAudioCache::detach(
+    const std::shared_ptr<AudioBuffer> &buffer) {
+  return std::make_shared<AudioBuffer>(*buffer);
+}
+
+void DecodedAudioCache::setBudget(size_t budgetInBytes) {
+  std::lock_guard lock(mutex_);
+  budgetInBytes_ = budgetInBytes;
+  evictToFit(budgetInBytes_);
+}
+
+void DecodedAudioCache::clear() {
+  std::lock_guard lock(mutex_);
+  entries_.clear();
+  index_.clear();
+  sizeInBytes_ = 0;
+}
+
+DecodedAudioCache::Stats DecodedAudioCache::getStats() const {
+  std::lock_guard lock(mutex_);
+  return {
+      hits_, misses_, inFlightJoins_, evictions_, entries_.size(), sizeInBytes_, budgetInBytes_};
+}
+
+void DecodedAudioCache::evictToFit(size_t budgetInBytes) {
+  // buffers still referenced elsewhere stay alive, the cache only drops its reference
+  while (sizeInBytes_ > budgetInBytes && !entries_.empty()) {
+    auto &entry = entries_.back();
+    sizeInBytes_ -= entry.sizeInBytes;
+    index_.erase(entry.key);
+    entries_.pop_back();
+    evictions_++;
+  }
+}
+
+} // namespace audioapi
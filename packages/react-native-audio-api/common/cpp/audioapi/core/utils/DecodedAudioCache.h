@@ -0,0 +1,118 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace audioapi {
+
+class AudioBuffer;
+
+/// @brief Least recently used cache of decoded audio, bounded by a budget in bytes.
+/// Entries are keyed by the source (a file path with its size and modification time, or a
+/// hash of the encoded bytes) and the requested sample rate.
+/// @note Cached buffers are shared by every caller and must be treated as immutable.
+/// @note Concurrent decodes of the same key are deduplicated, the first caller decodes and
+/// the others are notified once it completes.
+/// @note Thread-safe.
+class DecodedAudioCache {
+ public:
+  using Callback = std::function<void(const std::shared_ptr<AudioBuffer> &)>;
+
+  /// @brief Decode of a key started by another caller.
+  class PendingDecode {
+   public:
+    /// @brief Runs the callback with the decoded buffer, nullptr if decoding failed.
+    /// Runs right away when the decode has already finished, otherwise on the thread
+    /// completing it.
+    void then(Callback &&callback);
+
+   private:
+    friend class DecodedAudioCache;
+
+    std::mutex mutex_;
+    bool isDone_ = false;
+    std::shared_ptr<AudioBuffer> buffer_;
+    std::vector<Callback> callbacks_;
+    // set under the lock of the cache by every lookup joining the decode
+    bool hasJoiners_ = false;
+
+    void resolve(const std::shared_ptr<AudioBuffer> &buffer);
+  };
+
+  /// @brief Outcome of lookup, exactly one of the three cases holds.
+  struct Lookup {
+    /// Cached buffer on a hit.
+    std::shared_ptr<AudioBuffer> buffer;
+    /// Decode of the same key already in flight.
+    std::shared_ptr<PendingDecode> pending;
+    /// The key has been reserved for the caller, which has to decode it and call complete.
+    bool isOwner = false;
+  };
+
+  struct Stats {
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t inFlightJoins;
+    uint64_t evictions;
+    size_t entries;
+    size_t sizeInBytes;
+    size_t budgetInBytes;
+  };
+
+  explicit DecodedAudioCache(size_t budgetInBytes);
+
+  [[nodiscard]] static std::string makeFileKey(const std::string &path, float sampleRate);
+  [[nodiscard]] static std::string makeMemoryKey(const void *data, size_t size, float sampleRate);
+
+  [[nodiscard]] Lookup lookup(const std::string &key);
+
+  /// @brief Stores the result of a decode reserved by lookup and notifies waiting callers.
+  /// @param buffer Decoded buffer, nullptr when decoding failed. Buffers larger than
+  /// the budget are handed to waiting callers but not cached.
+  /// @return Whether the buffer is shared, it was cached or handed to waiting callers.
+  bool complete(const std::string &key, const std::shared_ptr<AudioBuffer> &buffer);
+
+  /// @brief Copies a shared buffer, so that the copy can be written to without changing the
+  /// audio of the other owners.
+  [[nodiscard]] static std::shared_ptr<AudioBuffer> detach(
+      const std::shared_ptr<AudioBuffer> &buffer);
+
+  /// @brief Changes the budget, evicting least recently used entries to fit it.
+  /// A budget of 0 disables caching, concurrent decodes are still deduplicated.
+  void setBudget(size_t budgetInBytes);
+  void clear();
+
+  [[nodiscard]] Stats getStats() const;
+
+ private:
+  struct Entry {
+    std::string key;
+    std::shared_ptr<AudioBuffer> buffer;
+    size_t sizeInBytes;
+  };
+
+  mutable std::mutex mutex_;
+  size_t budgetInBytes_;
+  size_t sizeInBytes_ = 0;
+  // most recently used entry first
+  std::list<Entry> entries_;
+  std::unordered_map<std::string, std::list<Entry>::iterator> index_;
+  std::unordered_map<std::string, std::shared_ptr<PendingDecode>> inFlight_;
+
+  uint64_t hits_ = 0;
+  uint64_t misses_ = 0;
+  uint64_t inFlightJoins_ = 0;
+  uint64_t evictions_ = 0;
+
+  void evictToFit(size_t budgetInBytes);
+};
+
+} // namespace audioapi
@@ -0,0 +1,114 @@
+#include <audioapi/core/utils/DeferredReclaimer.h>
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace audioapi {
+
+DeferredReclaimer::Lane::Lane(std::shared_ptr<DeferredReclaimer> reclaimer)
+    : reclaimer_(std::move(reclaimer)) {
+  auto [sender, receiver] = channels::spsc::channel<Garbage>(kLaneCapacity);
+  sender_ = std::move(sender);
+  receiver_ = reclaimer_->addLane(std::move(receiver));
+}
+
+DeferredReclaimer::Lane::~Lane() {
+  reclaimer_->removeLane(receiver_);
+}
+
+bool DeferredReclaimer::Lane::tryRetire(Garbage &&garbage) {
+  if (sender_.try_send(std::move(garbage)) != channels::spsc::ResponseStatus::SUCCESS) {
+    return false;
+  }
+
+  reclaimer_->notifyRetired();
+  return true;
+}
+
+DeferredReclaimer::DeferredReclaimer() {
+  workerHandle_ = std::thread(&DeferredReclaimer::process, this);
+}
+
+DeferredReclaimer::~DeferredReclaimer() {
+  isExiting_.store(true, std::memory_order_release);
+  notifyRetired();
+
+  if (workerHandle_.joinable()) {
+    workerHandle_.join();
+  }
+}
+
+std::shared_ptr<DeferredReclaimer> DeferredReclaimer::getShared() {
+  static std::mutex sharedMutex;
+  static std::weak_ptr<DeferredReclaimer> shared;
+
+  std::lock_guard<std::mutex> lock(sharedMutex);
+  auto reclaimer = shared.lock();
+  if (reclaimer == nullptr) {
+    reclaimer = std::make_shared<DeferredReclaimer>();
+    shared = reclaimer;
+  }
+  return reclaimer;
+}
+
+channels::spsc::Receiver<DeferredReclaimer::Garbage> *DeferredReclaimer::addLane(
+    channels::spsc::Receiver<Garbage> &&receiver) {
+  auto laneReceiver = std::make_unique<channels::spsc::Receiver<Garbage>>(std::move(receiver));
+  auto *result = laneReceiver.get();
+
+  std::lock_guard<std::mutex> lock(lanesMutex_);
+  receivers_.push_back(std::move(laneReceiver));
+  return result;
+}
+
+void DeferredReclaimer::removeLane(channels::spsc::Receiver<Garbage> *receiver) {
+  std::unique_ptr<channels::spsc::Receiver<Garbage>> laneReceiver;
+
+  {
+    std::lock_guard<std::mutex> lock(lanesMutex_);
+    auto it = std::find_if(receivers_.begin(), receivers_.end(), [receiver](const auto &r) {
+      return r.get() == receiver;
+    });
+    if (it == receivers_.end()) {
+      return;
+    }
+    laneReceiver = std::move(*it);
+    receivers_.erase(it);
+  }
+
+  // the producer is gone, so whatever it left is destroyed here rather than waiting for the worker
+  drain(*laneReceiver);
+}
+
+void DeferredReclaimer::notifyRetired() {
+  retiredCount_.fetch_add(1, std::memory_order_release);
+  retiredCount_.notify_one();
+}
+
+void DeferredReclaimer::process() {
+  while (true) {
+    retiredCount_.wait(0, std::memory_order_acquire);
+    if (isExiting_.load(std::memory_order_acquire)) {
+      return;
+    }
+
+    // objects retired from now on trigger another pass, even if this one already destroys them
+    retiredCount_.store(0, std::memory_order_release);
+
+    std::lock_guard<std::mutex> lock(lanesMutex_);
+    for (auto &receiver : receivers_) {
+      drain(*receiver);
+    }
+  }
+}
+
+void DeferredReclaimer::drain(channels::spsc::Receiver<Garbage> &receiver) {
+  Garbage garbage;
+  while (receiver.try_receive(garbage) == channels::spsc::ResponseStatus::SUCCESS) {
+    garbage.reset();
+  }
+}
+
+} // namespace audioapi
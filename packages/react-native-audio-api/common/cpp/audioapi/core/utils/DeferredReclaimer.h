@@ -0,0 +1,79 @@
+#pragma once
+
+#include <audioapi/utils/SpscChannel.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace audioapi {
+
+/// @brief Destroys the objects retired by the audio threads of all the contexts on a single
+/// thread shared by the process, so the number of threads does not grow with the number of
+/// contexts.
+/// Every producer retires objects through its own Lane, so retiring stays wait-free.
+/// An object is retired by handing over its last reference, so no reader can be left when it
+/// is destroyed and no grace period has to be awaited.
+/// @note The shared instance lives as long as some lane uses it, the thread is joined when the
+/// last lane is destroyed.
+class DeferredReclaimer {
+ public:
+  using Garbage = std::shared_ptr<void>;
+
+  /// @brief Producer side of the reclaimer, to be used from a single thread.
+  class Lane {
+   public:
+    explicit Lane(std::shared_ptr<DeferredReclaimer> reclaimer);
+
+    /// @brief Destroys the objects not yet reclaimed on the calling thread.
+    ~Lane();
+
+    Lane(const Lane &) = delete;
+    Lane &operator=(const Lane &) = delete;
+
+    /// @brief Hands an object over to be destroyed on the reclaimer thread.
+    /// @return True if the object was retired, false if the lane is full.
+    /// @note garbage does NOT get moved out if it is not retired. Real-time safe.
+    bool tryRetire(Garbage &&garbage);
+
+   private:
+    std::shared_ptr<DeferredReclaimer> reclaimer_;
+    channels::spsc::Sender<Garbage> sender_;
+    channels::spsc::Receiver<Garbage> *receiver_;
+  };
+
+  DeferredReclaimer();
+  ~DeferredReclaimer();
+
+  DeferredReclaimer(const DeferredReclaimer &) = delete;
+  DeferredReclaimer &operator=(const DeferredReclaimer &) = delete;
+
+  /// @return The instance shared by every context, created when it is not used by any.
+  static std::shared_ptr<DeferredReclaimer> getShared();
+
+ private:
+  static constexpr size_t kLaneCapacity = 1024;
+
+  std::thread workerHandle_;
+  std::atomic<bool> isExiting_{false};
+
+  /// @brief Number of objects retired since the worker last drained the lanes
+  std::atomic<size_t> retiredCount_{0};
+
+  /// @brief Consumer sides of the lanes, guarded by lanesMutex_, which the producers only lock to
+  /// create and destroy their lanes.
+  std::vector<std::unique_ptr<channels::spsc::Receiver<Garbage>>> receivers_;
+  std::mutex lanesMutex_;
+
+  channels::spsc::Receiver<Garbage> *addLane(channels::spsc::Receiver<Garbage> &&receiver);
+  void removeLane(channels::spsc::Receiver<Garbage> *receiver);
+  void notifyRetired();
+  void process();
+
+  static void drain(channels::spsc::Receiver<Garbage> &receiver);
+};
+
+} // namespace audioapi
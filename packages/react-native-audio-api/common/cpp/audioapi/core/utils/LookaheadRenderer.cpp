@@ -0,0 +1,120 @@
+#include <audioapi/core/utils/LookaheadRenderer.h>
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+
+namespace audioapi {
+
+LookaheadRenderer::Block::Block(
+    size_t size,
+    int inputChannelCount,
+    int outputChannelCount,
+    float sampleRate)
+    : input(std::make_shared<AudioBuffer>(size, inputChannelCount, sampleRate)),
+      output(std::make_shared<AudioBuffer>(size, outputChannelCount, sampleRate)) {}
+
+LookaheadRenderer::LookaheadRenderer(
+    size_t lookahead,
+    size_t blockSize,
+    int inputChannelCount,
+    int outputChannelCount,
+    float sampleRate,
+    RenderCallback &&callback)
+    : blockSize_(blockSize), callback_(std::move(callback)) {
+  lookahead = std::clamp(lookahead, MIN_LOOKAHEAD, MAX_LOOKAHEAD);
+
+  // one slot of a channel is always left empty, and one more is needed to stop the thread
+  auto [toRenderSender, toRenderReceiver] = channels::spsc::channel<
+      Block *,
+      channels::spsc::OverflowStrategy::WAIT_ON_FULL,
+      channels::spsc::WaitStrategy::ATOMIC_WAIT>(lookahead + 2);
+  toRenderSender_ = std::move(toRenderSender);
+  toRenderReceiver_ = std::move(toRenderReceiver);
+
+  auto [renderedSender, renderedReceiver] = channels::spsc::channel<Block *>(lookahead + 1);
+  renderedSender_ = std::move(renderedSender);
+  renderedReceiver_ = std::move(renderedReceiver);
+
+  // the blocks start as rendered silence, which delays the output by the whole lookahead
+  blocks_.reserve(lookahead);
+  for (size_t i = 0; i < lookahead; ++i) {
+    blocks_.push_back(
+        std::make_unique<Block>(blockSize, inputChannelCount, outputChannelCount, sampleRate));
+    renderedSender_.try_send(blocks_.back().get());
+  }
+
+  workerHandle_ = std::thread(&LookaheadRenderer::process, this);
+}
+
+LookaheadRenderer::~LookaheadRenderer() {
+  // there is always a free slot for it, as the channel fits every block and one more
+  toRenderSender_.try_send(nullptr);
+
+  if (workerHandle_.joinable()) {
+    workerHandle_.join();
+  }
+}
+
+LookaheadRenderer::Block *LookaheadRenderer::acquire() {
+  Block *block = nullptr;
+  if (renderedReceiver_.try_receive(block) != channels::spsc::ResponseStatus::SUCCESS) {
+    underruns_.fetch_add(1, std::memory_order_relaxed);
+    // skipping needs a second rendered block, so with a single one the output stays late
+    lateBlocks_ = std::min(lateBlocks_ + 1, blocks_.size() - 1);
+    return nullptr;
+  }
+
+  // the late block goes back ahead of the caller's one, taking the slot of the dropped input
+  while (lateBlocks_ > 0) {
+    Block *next = nullptr;
+    if (renderedReceiver_.try_receive(next) != channels::spsc::ResponseStatus::SUCCESS) {
+      break;
+    }
+
+    block->isSkipped = true;
+    toRenderSender_.try_send(block);
+    block = next;
+    --lateBlocks_;
+  }
+
+  return block;
+}
+
+void LookaheadRenderer::submit(Block *block) {
+  toRenderSender_.try_send(block);
+}
+
+LookaheadRenderer::Stats LookaheadRenderer::getStats() const {
+  return {
+      .latencyFrames = blocks_.size() * blockSize_,
+      .underruns = underruns_.load(std::memory_order_relaxed),
+      .renderedBlocks = renderedBlocks_.load(std::memory_order_relaxed),
+      .skippedBlocks = skippedBlocks_.load(std::memory_order_relaxed),
+  };
+}
+
+void LookaheadRenderer::process() {
+  while (true) {
+    Block *block = toRenderReceiver_.receive();
+    if (block == nullptr) {
+      return;
+    }
+
+    if (block->isSkipped) {
+      block->isSkipped = false;
+      block->output->zero();
+      skippedBlocks_.fetch_add(1, std::memory_order_relaxed);
+    } else {
+      if (!callback_(*block)) {
+        block->output->zero();
+      }
+      renderedBlocks_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // there is a slot for every block, so it never fails
+    renderedSender_.try_send(block);
+  }
+}
+
+} // namespace audioapi
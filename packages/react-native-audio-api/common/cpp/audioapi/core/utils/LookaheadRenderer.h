@@ -0,0 +1,118 @@
+#pragma once
+
+#include <audioapi/utils/AudioBuffer.h>
+#include <audioapi/utils/SpscChannel.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace audioapi {
+
+/// @brief Renders blocks of audio on its own thread a fixed number of blocks ahead of the audio
+/// thread, so a slow render callback costs latency instead of glitches.
+/// The blocks are preallocated and circulate between the two threads through lock-free channels,
+/// the audio thread never waits for the callback nor allocates.
+///
+/// Every quantum the audio thread takes the oldest rendered block with acquire, reads its output,
+/// writes the next input into it and hands it back with submit. All the blocks start on the audio
+/// thread side as silence, so the output is delayed by lookahead blocks.
+/// @note acquire and submit must be called from a single thread.
+class LookaheadRenderer {
+ public:
+  struct Block {
+    Block(size_t size, int inputChannelCount, int outputChannelCount, float sampleRate);
+
+    std::shared_ptr<AudioBuffer> input;
+    std::shared_ptr<AudioBuffer> output;
+    /// @brief Context time the block is rendered for, set by the audio thread.
+    double time = 0.0;
+    /// @brief Set for a late block skipped by acquire, it is passed on as silence unrendered.
+    bool isSkipped = false;
+  };
+
+  struct Stats {
+    /// Frames the output is delayed by.
+    size_t latencyFrames;
+    /// Blocks the audio thread asked for that were not rendered yet.
+    uint64_t underruns;
+    uint64_t renderedBlocks;
+    /// Late blocks dropped to catch up with the lookahead after underruns.
+    uint64_t skippedBlocks;
+  };
+
+  /// @brief Renders the output of a block from its input and time.
+  /// @return False if the block could not be rendered, its output is zeroed then.
+  /// @note Called on the lookahead thread.
+  using RenderCallback = std::function<bool(Block &block)>;
+
+  static constexpr size_t MIN_LOOKAHEAD = 1;
+  static constexpr size_t MAX_LOOKAHEAD = 64;
+
+  /// @param lookahead Number of blocks rendered ahead, clamped to [MIN_LOOKAHEAD, MAX_LOOKAHEAD].
+  LookaheadRenderer(
+      size_t lookahead,
+      size_t blockSize,
+      int inputChannelCount,
+      int outputChannelCount,
+      float sampleRate,
+      RenderCallback &&callback);
+
+  /// @brief Stops the lookahead thread once it is done with the block being rendered.
+  ~LookaheadRenderer();
+
+  LookaheadRenderer(const LookaheadRenderer &) = delete;
+  LookaheadRenderer &operator=(const LookaheadRenderer &) = delete;
+
+  /// @return The oldest rendered block, or nullptr if it is not rendered yet, which is counted as
+  /// an underrun. Real-time safe.
+  /// @note The block missed by an underrun is skipped once the one after it is rendered too, so
+  /// the output goes back to the lookahead instead of trailing it by a block.
+  Block *acquire();
+
+  /// @brief Hands an acquired block over to be rendered. Real-time safe.
+  void submit(Block *block);
+
+  [[nodiscard]] Stats getStats() const;
+
+  [[nodiscard]] size_t getLookahead() const {
+    return blocks_.size();
+  }
+
+ private:
+  std::vector<std::unique_ptr<Block>> blocks_;
+  size_t blockSize_;
+  RenderCallback callback_;
+
+  /// @brief Blocks to be rendered, the lookahead thread sleeps on it, nullptr stops the thread.
+  channels::spsc::Sender<
+      Block *,
+      channels::spsc::OverflowStrategy::WAIT_ON_FULL,
+      channels::spsc::WaitStrategy::ATOMIC_WAIT>
+      toRenderSender_;
+  channels::spsc::Receiver<
+      Block *,
+      channels::spsc::OverflowStrategy::WAIT_ON_FULL,
+      channels::spsc::WaitStrategy::ATOMIC_WAIT>
+      toRenderReceiver_;
+
+  /// @brief Rendered blocks, in the order they were submitted.
+  channels::spsc::Sender<Block *> renderedSender_;
+  channels::spsc::Receiver<Block *> renderedReceiver_;
+
+  /// Blocks delivered later than the lookahead since the underruns, touched by acquire only.
+  size_t lateBlocks_ = 0;
+  std::atomic<uint64_t> underruns_{0};
+  std::atomic<uint64_t> renderedBlocks_{0};
+  std::atomic<uint64_t> skippedBlocks_{0};
+
+  std::thread workerHandle_;
+
+  void process();
+};
+
+} // namespace audioapi
@@ -0,0 +1,370 @@
+#include <audioapi/core/utils/LosslessFileWriter.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBuffer.h>
+#include <audioapi/utils/AudioFileProperties.h>
+#include <audioapi/utils/UnitConversion.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace audioapi {
+
+LosslessFileWriter::LosslessFileWriter(
+    const std::shared_ptr<AudioEventHandlerRegistry> &audioEventHandlerRegistry,
+    const std::shared_ptr<AudioFileProperties> &fileProperties)
+    : AudioFileWriter(audioEventHandlerRegistry, fileProperties) {}
+
+LosslessFileWriter::~LosslessFileWriter() {
+  if (isFileOpen()) {
+    closeFile();
+  }
+}
+
+/// @brief Opens the file for writing.
+/// Allocates every buffer used while writing, so it should be called only on the JS thread.
+/// @param filePath Path of the file, an existing file is overwritten.
+/// @param streamSampleRate The sample rate of the written audio.
+/// @param streamChannelCount The channel count of the written audio.
+/// @return The status of the file opening operation.
+OpenFileResult LosslessFileWriter::openFile(
+    const std::string &filePath,
+    float streamSampleRate,
+    int streamChannelCount) {
+  if (isFileOpen()) {
+    return OpenFileResult::Err("File is already open");
+  }
+
+  encoder_ = LosslessEncoder::create(*fileProperties_);
+
+  if (encoder_ == nullptr) {
+    return OpenFileResult::Err("Only WAV and FLAC files can be written natively");
+  }
+
+  streamSampleRate_ = streamSampleRate;
+  streamChannelCount_ = streamChannelCount;
+
+  if (streamSampleRate_ != encoder_->getSampleRate() ||
+      streamChannelCount_ != encoder_->getNumberOfChannels()) {
+    ma_data_converter_config converterConfig = ma_data_converter_config_init(
+        ma_format_f32,
+        ma_format_f32,
+        streamChannelCount_,
+        encoder_->getNumberOfChannels(),
+        static_cast<ma_uint32>(streamSampleRate_),
+        static_cast<ma_uint32>(encoder_->getSampleRate()));
+
+    converter_ = std::make_unique<ma_data_converter>();
+    ma_result result = ma_data_converter_init(&converterConfig, nullptr, converter_.get());
+
+    if (result != MA_SUCCESS) {
+      converter_.reset();
+      release();
+      return OpenFileResult::Err(
+          "Failed to initialize converter: " + std::string(ma_result_description(result)));
+    }
+
+    ma_uint64 convertedFrameCount = 0;
+    ma_data_converter_get_expected_output_frame_count(
+        converter_.get(), kBlockFrames, &convertedFrameCount);
+    convertedFrames_.resize((convertedFrameCount + 1) * encoder_->getNumberOfChannels());
+  }
+
+  file_ = std::fopen(filePath.c_str(), "wb");
+
+  if (file_ == nullptr) {
+    release();
+    return OpenFileResult::Err("Failed to create file: " + filePath);
+  }
+
+  // writes are batched already, so they go straight to the file
+  std::setvbuf(file_, nullptr, _IONBF, 0);
+
+  filePath_ = filePath;
+  fileSize_ = 0;
+  hasFailed_ = false;
+  framesWritten_.store(0, std::memory_order_release);
+  droppedFrames_.store(0, std::memory_order_relaxed);
+  isDrained_.store(false, std::memory_order_relaxed);
+
+  encodedBytes_.reserve(2 * kFlushSize);
+  encoder_->writeHeader(encodedBytes_);
+
+  blocks_.assign(kNumberOfBlocks, std::vector<float>(kBlockFrames * streamChannelCount_));
+  auto [freeBlockSender, freeBlockReceiver] = channels::spsc::
+      channel<int, FREE_BLOCK_OVERFLOW_STRATEGY, FREE_BLOCK_WAIT_STRATEGY>(kNumberOfBlocks + 1);
+  freeBlockSender_ = std::move(freeBlockSender);
+  freeBlockReceiver_ = std::move(freeBlockReceiver);
+
+  for (int i = 0; i < static_cast<int>(kNumberOfBlocks); ++i) {
+    freeBlockSender_.send(i);
+  }
+
+  currentBlock_ = -1;
+  currentBlockFrames_ = 0;
+
+  auto offloaderLambda = [this](BlockWriteRequest request) {
+    taskOffloaderFunction(request);
+  };
+
+  // every block and the last request fit, so sending never waits
+  offloader_ = std::make_unique<task_offloader::TaskOffloader<
+      BlockWriteRequest,
+      WRITE_REQUEST_OVERFLOW_STRATEGY,
+      WRITE_REQUEST_WAIT_STRATEGY>>(kNumberOfBlocks + 1, offloaderLambda);
+
+  isFileOpen_.store(true, std::memory_order_release);
+  return OpenFileResult::Ok(filePath_);
+}
+
+/// @brief Closes the file.
+/// Waits for the background thread to write every submitted block, then writes the remaining
+/// audio and the final header. It should be called only on the JS thread.
+/// @return The status of the file closing operation.
+CloseFileResult LosslessFileWriter::closeFile() {
+  if (!isFileOpen()) {
+    return CloseFileResult::Err("File is not open");
+  }
+
+  isFileOpen_.store(false, std::memory_order_release);
+
+  if (currentBlock_ >= 0) {
+    submitBlock(true);
+  } else {
+    offloader_->getSender()->send(BlockWriteRequest{-1, 0, true});
+  }
+
+  isDrained_.wait(false, std::memory_order_acquire);
+  offloader_.reset();
+
+  if (converter_ != nullptr && !hasFailed_) {
+    drainConverter();
+  }
+
+  encoder_->finish(encodedBytes_);
+  flush(true);
+
+  // the header is rewritten now that the length of the audio is known
+  if (!hasFailed_) {
+    encoder_->writeHeader(encodedBytes_);
+
+    if (std::fseek(file_, 0, SEEK_SET) != 0 ||
+        std::fwrite(encodedBytes_.data(), 1, encodedBytes_.size(), file_) !=
+            encodedBytes_.size()) {
+      hasFailed_ = true;
+    }
+  }
+
+  auto filePath = filePath_;
+  auto hasFailed = hasFailed_;
+  auto durationInSeconds =
+      static_cast<double>(encoder_->getEncodedFrames()) / encoder_->getSampleRate();
+  auto fileSizeInMB = static_cast<double>(fileSize_) / MB_IN_BYTES;
+
+  release();
+
+  if (hasFailed) {
+    return CloseFileResult::Err("Failed to write audio data to file: " + filePath);
+  }
+
+  return CloseFileResult::Ok({fileSizeInMB, durationInSeconds});
+}
+
+/// @brief Copies interleaved audio into the current block.
+/// It is real-time safe, the audio that does not fit into the free blocks is dropped.
+void LosslessFileWriter::writeAudioData(const float *data, size_t numFrames) {
+  if (!isFileOpen()) {
+    return;
+  }
+
+  appendFrames(numFrames, [this, data](float *destination, size_t offset, size_t count) {
+    std::memcpy(
+        destination,
+        data + offset * streamChannelCount_,
+        count * streamChannelCount_ * sizeof(float));
+  });
+}
+
+/// @brief Interleaves the audio of the buffer into the current block.
+/// It is real-time safe, the audio that does not fit into the free blocks is dropped.
+void LosslessFileWriter::writeAudioData(const AudioBuffer &buffer, size_t numFrames) {
+  if (!isFileOpen()) {
+    return;
+  }
+
+  appendFrames(numFrames, [this, &buffer](float *destination, size_t offset, size_t count) {
+    for (int channel = 0; channel < streamChannelCount_; ++channel) {
+      const auto *source = buffer.getChannel(channel)->begin() + offset;
+
+      for (size_t i = 0; i < count; ++i) {
+        destination[i * streamChannelCount_ + channel] = source[i];
+      }
+    }
+  });
+}
+
+double LosslessFileWriter::getCurrentDuration() const {
+  if (streamSampleRate_ == 0) {
+    return 0.0;
+  }
+
+  return static_cast<double>(framesWritten_.load(std::memory_order_acquire)) / streamSampleRate_;
+}
+
+template <typename F>
+void LosslessFileWriter::appendFrames(size_t numFrames, F &&copyFrames) {
+  size_t offset = 0;
+
+  while (offset < numFrames) {
+    if (currentBlock_ < 0 &&
+        freeBlockReceiver_.try_receive(currentBlock_) != channels::spsc::ResponseStatus::SUCCESS) {
+      droppedFrames_.fetch_add(numFrames - offset, std::memory_order_relaxed);
+      break;
+    }
+
+    auto count = std::min(numFrames - offset, kBlockFrames - currentBlockFrames_);
+    copyFrames(
+        blocks_[currentBlock_].data() + currentBlockFrames_ * streamChannelCount_, offset, count);
+
+    offset += count;
+    currentBlockFrames_ += count;
+
+    if (currentBlockFrames_ == kBlockFrames) {
+      submitBlock(false);
+    }
+  }
+
+  framesWritten_.fetch_add(offset, std::memory_order_acq_rel);
+}
+
+void LosslessFileWriter::submitBlock(bool isLast) {
+  offloader_->getSender()->send(BlockWriteRequest{currentBlock_, currentBlockFrames_, isLast});
+  currentBlock_ = -1;
+  currentBlockFrames_ = 0;
+}
+
+/// @brief Encodes and writes a block, then hands it back to the writing thread.
+void LosslessFileWriter::taskOffloaderFunction(BlockWriteRequest request) {
+  if (request.blockIndex >= 0) {
+    if (!hasFailed_) {
+      encodeBlock(request.blockIndex, request.numFrames);
+    }
+
+    freeBlockSender_.send(request.blockIndex);
+  }
+
+  if (request.isLast) {
+    isDrained_.store(true, std::memory_order_release);
+    isDrained_.notify_one();
+  }
+}
+
+void LosslessFileWriter::encodeBlock(int blockIndex, size_t numFrames) {
+  const float *input = blocks_[blockIndex].data();
+
+  if (converter_ == nullptr) {
+    encoder_->encode(input, numFrames, encodedBytes_);
+  } else {
+    auto capacity = convertedFrames_.size() / encoder_->getNumberOfChannels();
+
+    // the resampler may keep a few frames, so the block can take more than one pass
+    while (numFrames > 0) {
+      ma_uint64 inputFrameCount = numFrames;
+      ma_uint64 outputFrameCount = capacity;
+
+      ma_data_converter_process_pcm_frames(
+          converter_.get(), input, &inputFrameCount, convertedFrames_.data(), &outputFrameCount);
+      encoder_->encode(convertedFrames_.data(), outputFrameCount, encodedBytes_);
+
+      if (inputFrameCount == 0 && outputFrameCount == 0) {
+        break;
+      }
+
+      input += inputFrameCount * streamChannelCount_;
+      numFrames -= inputFrameCount;
+    }
+  }
+
+  if (encodedBytes_.size() >= kFlushSize) {
+    flush(false);
+  }
+}
+
+/// @brief Encodes the frames the resampler still holds back.
+/// Silence is fed until the file has as many frames as the written audio converts to.
+void LosslessFileWriter::drainConverter() {
+  auto expectedFrames = static_cast<uint64_t>(std::llround(
+      static_cast<double>(framesWritten_.load(std::memory_order_acquire)) *
+      encoder_->getSampleRate() / streamSampleRate_));
+  auto capacity = convertedFrames_.size() / encoder_->getNumberOfChannels();
+
+  while (encoder_->getEncodedFrames() < expectedFrames) {
+    // a null input is read as silence
+    ma_uint64 inputFrameCount = kBlockFrames;
+    ma_uint64 outputFrameCount =
+        std::min<uint64_t>(capacity, expectedFrames - encoder_->getEncodedFrames());
+
+    ma_data_converter_process_pcm_frames(
+        converter_.get(), nullptr, &inputFrameCount, convertedFrames_.data(), &outputFrameCount);
+
+    if (outputFrameCount == 0) {
+      break;
+    }
+
+    encoder_->encode(convertedFrames_.data(), outputFrameCount, encodedBytes_);
+  }
+}
+
+/// @brief Writes the encoded bytes in whole multiples of kFlushSize and keeps the remainder,
+/// so every write starts at a page-aligned offset of the file.
+/// @param isLast Whether the remainder is written too.
+void LosslessFileWriter::flush(bool isLast) {
+  if (encodedBytes_.empty() || hasFailed_) {
+    encodedBytes_.clear();
+    return;
+  }
+
+  auto size = isLast ? encodedBytes_.size() : encodedBytes_.size() / kFlushSize * kFlushSize;
+
+  if (size == 0) {
+    return;
+  }
+
+  if (std::fwrite(encodedBytes_.data(), 1, size, file_) != size) {
+    fail("Failed to write audio data to file: " + filePath_);
+  }
+
+  fileSize_ += size;
+  encodedBytes_.erase(
+      encodedBytes_.begin(), encodedBytes_.begin() + static_cast<std::ptrdiff_t>(size));
+}
+
+void LosslessFileWriter::fail(const std::string &message) {
+  hasFailed_ = true;
+  invokeOnErrorCallback(message);
+}
+
+void LosslessFileWriter::release() {
+  if (file_ != nullptr) {
+    std::fclose(file_);
+    file_ = nullptr;
+  }
+
+  if (converter_ != nullptr) {
+    ma_data_converter_uninit(converter_.get(), nullptr);
+    converter_.reset();
+  }
+
+  encoder_.reset();
+  blocks_.clear();
+  convertedFrames_.clear();
+  encodedBytes_ = EncodedBytes();
+  filePath_ = "";
+}
+
+} // namespace audioapi
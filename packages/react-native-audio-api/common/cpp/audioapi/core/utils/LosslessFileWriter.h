@@ -0,0 +1,124 @@
+#pragma once
+
+#include <audioapi/core/utils/AudioFileWriter.h>
+#include <audioapi/core/utils/encoders/LosslessEncoder.h>
+#include <audioapi/libs/miniaudio/miniaudio.h>
+#include <audioapi/utils/SpscChannel.hpp>
+#include <audioapi/utils/TaskOffloader.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace audioapi {
+
+class AudioBuffer;
+
+struct BlockWriteRequest {
+  int blockIndex = -1;
+  size_t numFrames = 0;
+  // the last request of the file, the thread closing it waits for it
+  bool isLast = false;
+};
+
+/// @brief Platform independent WAV and FLAC file writer.
+/// Incoming audio is copied into one of a fixed number of preallocated blocks. Full blocks are
+/// handed to a background thread, which converts them to the format of the file when needed,
+/// encodes them and writes the encoded bytes in batches of whole multiples of kFlushSize.
+/// When the background thread falls behind and every block is in use, incoming audio is dropped
+/// and counted instead of growing the buffering.
+/// @note writeAudioData is real-time safe and is to be called from one thread.
+/// openFile and closeFile are to be called from another one, never concurrently with it.
+class LosslessFileWriter : public AudioFileWriter {
+ public:
+  static constexpr size_t kBlockFrames = 4096;
+  static constexpr size_t kNumberOfBlocks = 16;
+  static constexpr size_t kFlushSize = 256 * 1024;
+
+  LosslessFileWriter(
+      const std::shared_ptr<AudioEventHandlerRegistry> &audioEventHandlerRegistry,
+      const std::shared_ptr<AudioFileProperties> &fileProperties);
+  ~LosslessFileWriter() override;
+
+  /// @brief Creates the file and starts the background thread.
+  /// @param streamSampleRate Sample rate of the written audio, resampled to the one of the file.
+  /// @param streamChannelCount Channel count of the written audio, mixed to the one of the file.
+  /// @return The path of the file.
+  OpenFileResult
+  openFile(const std::string &filePath, float streamSampleRate, int streamChannelCount);
+
+  /// @brief Writes the buffered audio, completes the header and closes the file.
+  /// @return The size of the file in MB and its duration in seconds.
+  CloseFileResult closeFile() override;
+
+  /// @brief Appends interleaved frames of the stream channel count.
+  void writeAudioData(const float *data, size_t numFrames);
+
+  /// @brief Appends the frames of a buffer with at least the stream channel count.
+  void writeAudioData(const AudioBuffer &buffer, size_t numFrames);
+
+  std::string getFilePath() const override {
+    return filePath_;
+  }
+
+  double getCurrentDuration() const override;
+
+  /// @brief Frames dropped because every block was waiting to be written.
+  [[nodiscard]] uint64_t getDroppedFrames() const noexcept {
+    return droppedFrames_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  static constexpr auto WRITE_REQUEST_OVERFLOW_STRATEGY =
+      channels::spsc::OverflowStrategy::WAIT_ON_FULL;
+  static constexpr auto WRITE_REQUEST_WAIT_STRATEGY = channels::spsc::WaitStrategy::ATOMIC_WAIT;
+  static constexpr auto FREE_BLOCK_OVERFLOW_STRATEGY =
+      channels::spsc::OverflowStrategy::WAIT_ON_FULL;
+  static constexpr auto FREE_BLOCK_WAIT_STRATEGY = channels::spsc::WaitStrategy::BUSY_LOOP;
+
+  std::string filePath_;
+  FILE *file_ = nullptr;
+  float streamSampleRate_ = 0;
+  int streamChannelCount_ = 0;
+
+  std::unique_ptr<LosslessEncoder> encoder_;
+  std::unique_ptr<ma_data_converter> converter_;
+  std::vector<float> convertedFrames_;
+  EncodedBytes encodedBytes_;
+  uint64_t fileSize_ = 0;
+  bool hasFailed_ = false;
+
+  // blocks of interleaved frames, the free ones come back through the channel
+  std::vector<std::vector<float>> blocks_;
+  channels::spsc::Receiver<int, FREE_BLOCK_OVERFLOW_STRATEGY, FREE_BLOCK_WAIT_STRATEGY>
+      freeBlockReceiver_;
+  channels::spsc::Sender<int, FREE_BLOCK_OVERFLOW_STRATEGY, FREE_BLOCK_WAIT_STRATEGY>
+      freeBlockSender_;
+  int currentBlock_ = -1;
+  size_t currentBlockFrames_ = 0;
+  std::atomic<uint64_t> droppedFrames_{0};
+  std::atomic<bool> isDrained_{false};
+
+  std::unique_ptr<task_offloader::TaskOffloader<
+      BlockWriteRequest,
+      WRITE_REQUEST_OVERFLOW_STRATEGY,
+      WRITE_REQUEST_WAIT_STRATEGY>>
+      offloader_;
+
+  template <typename F>
+  void appendFrames(size_t numFrames, F &&copyFrames);
+  void submitBlock(bool isLast);
+
+  void taskOffloaderFunction(BlockWriteRequest request);
+  void encodeBlock(int blockIndex, size_t numFrames);
+  void drainConverter();
+  void flush(bool isLast);
+  void fail(const std::string &message);
+  void release();
+};
+
+} // namespace audioapi
@@ -0,0 +1,300 @@
+#include <audioapi/core/utils/AudioDecoder.h>
+#include <audioapi/core/utils/ParallelAudioDecoder.h>
+#include <audioapi/dsp/VectorMath.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBuffer.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace audioapi {
+
+namespace {
+
+// formats whose seeking is sample-exact, probed in this order
+constexpr ma_encoding_format kSeekableFormats[] =
+    {ma_encoding_format_wav, ma_encoding_format_flac, ma_encoding_format_mp3};
+
+// MP3 has no frame index, a seek table avoids decoding everything in front of a range
+constexpr ma_uint32 kMp3SeekPoints = 1024;
+
+// a known extension names the only format worth probing
+std::vector<ma_encoding_format> getCandidateFormats(const std::string &path) {
+  if (AudioDecoder::pathHasExtension(path, {".wav"})) {
+    return {ma_encoding_format_wav};
+  }
+  if (AudioDecoder::pathHasExtension(path, {".flac"})) {
+    return {ma_encoding_format_flac};
+  }
+  if (AudioDecoder::pathHasExtension(path, {".mp3"})) {
+    return {ma_encoding_format_mp3};
+  }
+  return {std::begin(kSeekableFormats), std::end(kSeekableFormats)};
+}
+
+} // namespace
+
+ParallelAudioDecoder::ParallelAudioDecoder(
+    std::string path,
+    float sampleRate,
+    size_t maxNumberOfParts)
+    : path_(std::move(path)), sampleRate_(sampleRate), maxNumberOfParts_(maxNumberOfParts) {}
+
+bool ParallelAudioDecoder::initDecoder(
+    ma_decoder &decoder,
+    ma_encoding_format encodingFormat) const {
+  // native sample rate and channel count, the parts resample what they decode themselves
+  ma_decoder_config config = ma_decoder_config_init(ma_format_f32, 0, 0);
+  config.encodingFormat = encodingFormat;
+  if (encodingFormat == ma_encoding_format_mp3) {
+    config.seekPointCount = kMp3SeekPoints;
+  }
+
+  return ma_decoder_init_file(path_.c_str(), &config, &decoder) == MA_SUCCESS;
+}
+
+size_t ParallelAudioDecoder::split() {
+  std::call_once(prepared_, &ParallelAudioDecoder::prepare, this);
+  return numberOfParts_;
+}
+
+void ParallelAudioDecoder::prepare() {
+  // containers decoded through FFmpeg or not seekable sample-exactly
+  if (maxNumberOfParts_ < 2 ||
+      AudioDecoder::pathHasExtension(path_, {".mp4", ".m4a", ".aac", ".ogg", ".opus"})) {
+    return;
+  }
+
+  ma_decoder decoder;
+  for (auto encodingFormat : getCandidateFormats(path_)) {
+    if (initDecoder(decoder, encodingFormat)) {
+      encodingFormat_ = encodingFormat;
+      break;
+    }
+  }
+
+  if (encodingFormat_ == ma_encoding_format_unknown) {
+    return;
+  }
+
+  ma_uint64 length = 0;
+  if (ma_decoder_get_length_in_pcm_frames(&decoder, &length) != MA_SUCCESS) {
+    length = 0;
+  }
+
+  // only files long enough for two ranges are split, the rest is decoded sequentially
+  auto numberOfParts = std::min<size_t>(maxNumberOfParts_, length / kMinFramesPerPart);
+  if (numberOfParts >= 2 && decoder.outputChannels > 0 && decoder.outputSampleRate > 0) {
+    numberOfFrames_ = length;
+    numberOfChannels_ = decoder.outputChannels;
+    nativeSampleRate_ = decoder.outputSampleRate;
+    outputSampleRate_ =
+        sampleRate_ > 0.0f ? static_cast<ma_uint32>(sampleRate_) : nativeSampleRate_;
+
+    outputEnd_ = getOutputFrame(numberOfFrames_);
+    output_ = std::make_shared<AudioBuffer>(
+        outputEnd_, static_cast<int>(numberOfChannels_), static_cast<float>(outputSampleRate_));
+    numberOfParts_ = numberOfParts;
+  }
+
+  ma_decoder_uninit(&decoder);
+}
+
+size_t ParallelAudioDecoder::getOutputFrame(size_t inputFrame) const {
+  // first output frame at or after the input frame, ranges split on it tile the output
+  auto numerator = static_cast<uint64_t>(inputFrame) * outputSampleRate_ + nativeSampleRate_ - 1;
+  return static_cast<size_t>(numerator / nativeSampleRate_);
+}
+
+void ParallelAudioDecoder::decodePart(size_t index) {
+  if (index >= split() || failed_.load(std::memory_order_relaxed)) {
+    return;
+  }
+
+  if (outputSampleRate_ == nativeSampleRate_) {
+    decodeRange(index);
+  } else {
+    decodeResampledRange(index);
+  }
+}
+
+void ParallelAudioDecoder::decodeRange(size_t index) {
+  size_t start = numberOfFrames_ * index / numberOfParts_;
+  size_t end = numberOfFrames_ * (index + 1) / numberOfParts_;
+
+  ma_decoder decoder;
+  if (!initDecoder(decoder, encodingFormat_)) {
+    failed_.store(true, std::memory_order_relaxed);
+    return;
+  }
+
+  if (start > 0 && ma_decoder_seek_to_pcm_frame(&decoder, start) != MA_SUCCESS) {
+    ma_decoder_uninit(&decoder);
+    failed_.store(true, std::memory_order_relaxed);
+    return;
+  }
+
+  std::vector<float> temp(CHUNK_SIZE * numberOfChannels_);
+  size_t position = start;
+
+  while (position < end && !failed_.load(std::memory_order_relaxed)) {
+    ma_uint64 framesRead = 0;
+    ma_decoder_read_pcm_frames(
+        &decoder, temp.data(), std::min<size_t>(CHUNK_SIZE, end - position), &framesRead);
+    if (framesRead == 0) {
+      break;
+    }
+
+    writeFrames(temp.data(), position, framesRead);
+    position += framesRead;
+  }
+
+  ma_decoder_uninit(&decoder);
+
+  // a short range would leave a gap in the output, the caller falls back to a plain decode
+  if (position != end) {
+    failed_.store(true, std::memory_order_relaxed);
+  }
+}
+
+void ParallelAudioDecoder::decodeResampledRange(size_t index) {
+  size_t start = numberOfFrames_ * index / numberOfParts_;
+  size_t end = numberOfFrames_ * (index + 1) / numberOfParts_;
+  bool isLast = index + 1 == numberOfParts_;
+  size_t outputStart = getOutputFrame(start);
+  size_t outputEnd = isLast ? output_->getSize() : getOutputFrame(end);
+
+  // an output frame falls exactly on every inputStep-th input frame, a resampler started on one
+  // of them keeps the output grid of a resampler started at the beginning of the file, only its
+  // filter state differs and fades out over the priming frames
+  auto divisor = std::gcd(nativeSampleRate_, outputSampleRate_);
+  size_t inputStep = nativeSampleRate_ / divisor;
+  size_t primingStart =
+      start > kResamplerPrimingFrames ? (start - kResamplerPrimingFrames) / inputStep : 0;
+  size_t position = primingStart * (outputSampleRate_ / divisor);
+  primingStart *= inputStep;
+
+  ma_decoder decoder;
+  if (!initDecoder(decoder, encodingFormat_)) {
+    failed_.store(true, std::memory_order_relaxed);
+    return;
+  }
+
+  if (primingStart > 0 && ma_decoder_seek_to_pcm_frame(&decoder, primingStart) != MA_SUCCESS) {
+    ma_decoder_uninit(&decoder);
+    failed_.store(true, std::memory_order_relaxed);
+    return;
+  }
+
+  // same linear resampler the decoder would use
+  auto config = ma_resampler_config_init(
+      ma_format_f32,
+      static_cast<ma_uint32>(numberOfChannels_),
+      nativeSampleRate_,
+      outputSampleRate_,
+      ma_resample_algorithm_linear);
+  ma_resampler resampler;
+  if (ma_resampler_init(&config, nullptr, &resampler) != MA_SUCCESS) {
+    ma_decoder_uninit(&decoder);
+    failed_.store(true, std::memory_order_relaxed);
+    return;
+  }
+
+  std::vector<float> decoded(CHUNK_SIZE * numberOfChannels_);
+  std::vector<float> resampled(CHUNK_SIZE * numberOfChannels_);
+
+  while (position < outputEnd && !failed_.load(std::memory_order_relaxed)) {
+    ma_uint64 framesRead = 0;
+    ma_decoder_read_pcm_frames(&decoder, decoded.data(), CHUNK_SIZE, &framesRead);
+    if (framesRead == 0) {
+      break;
+    }
+
+    ma_uint64 framesConsumed = 0;
+    while (framesConsumed < framesRead && position < outputEnd) {
+      ma_uint64 framesIn = framesRead - framesConsumed;
+      ma_uint64 framesOut = CHUNK_SIZE;
+      ma_resampler_process_pcm_frames(
+          &resampler,
+          decoded.data() + framesConsumed * numberOfChannels_,
+          &framesIn,
+          resampled.data(),
+          &framesOut);
+      if (framesIn == 0 && framesOut == 0) {
+        failed_.store(true, std::memory_order_relaxed);
+        break;
+      }
+      framesConsumed += framesIn;
+
+      // the frames in front of the range only primed the resampler
+      size_t first = std::max(position, outputStart);
+      size_t last = std::min<size_t>(position + framesOut, outputEnd);
+      if (first < last) {
+        writeFrames(resampled.data() + (first - position) * numberOfChannels_, first, last - first);
+      }
+      position += framesOut;
+    }
+  }
+
+  ma_resampler_uninit(&resampler, nullptr);
+  ma_decoder_uninit(&decoder);
+
+  if (position >= outputEnd) {
+    return;
+  }
+
+  // the resampler may hold back the last frames of the file, anywhere else it is a gap
+  if (isLast && position + 2 >= outputEnd) {
+    outputEnd_ = std::max(position, outputStart);
+  } else {
+    failed_.store(true, std::memory_order_relaxed);
+  }
+}
+
+void ParallelAudioDecoder::writeFrames(
+    const float *interleaved,
+    size_t position,
+    size_t numberOfFrames) {
+  if (numberOfChannels_ == 2) {
+    dsp::deinterleaveStereo(
+        interleaved,
+        output_->getChannel(0)->begin() + position,
+        output_->getChannel(1)->begin() + position,
+        numberOfFrames);
+    return;
+  }
+
+  for (size_t ch = 0; ch < numberOfChannels_; ++ch) {
+    float *destination = output_->getChannel(ch)->begin() + position;
+    for (size_t i = 0; i < numberOfFrames; ++i) {
+      destination[i] = interleaved[i * numberOfChannels_ + ch];
+    }
+  }
+}
+
+std::shared_ptr<AudioBuffer> ParallelAudioDecoder::getResult() {
+  if (numberOfParts_ == 0 || failed_.load(std::memory_order_relaxed)) {
+    return nullptr;
+  }
+
+  if (outputEnd_ < output_->getSize()) {
+    output_->truncate(outputEnd_);
+  }
+  return output_;
+}
+
+std::shared_ptr<AudioBuffer> ParallelAudioDecoder::decode() {
+  for (size_t index = 0; index < split(); ++index) {
+    decodePart(index);
+  }
+
+  return getResult();
+}
+
+} // namespace audioapi
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <audioapi/libs/miniaudio/miniaudio.h>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace audioapi {
+
+class AudioBuffer;
+
+/// @brief Decodes a long seekable file (WAV, FLAC, MP3) in independent time ranges.
+/// Every part opens its own decoder, seeks to the first frame of its range and writes
+/// into a disjoint region of one output buffer, so parts can run on different threads.
+/// @note Seeking is sample-exact for the supported formats, so the stitched result equals a
+/// sequential decode. When a different sample rate is requested, every part resamples its
+/// chunks as they are decoded, straight into the output at the requested rate. Each part
+/// starts its own resampler, so around the range boundaries the result only approximates a
+/// single resampler, the difference decays over the priming frames.
+/// @note Files that are short, not seekable or not supported produce no result and should
+/// be decoded sequentially instead.
+class ParallelAudioDecoder {
+ public:
+  /// Shortest range worth decoding on its own thread, about 12 seconds at 44.1 kHz.
+  static constexpr size_t kMinFramesPerPart = 1 << 19;
+  /// Frames decoded in front of a range only to settle the low-pass state of the resampler,
+  /// so a resampled range continues the previous one close to the way a single resampler would.
+  static constexpr size_t kResamplerPrimingFrames = 4096;
+
+  /// @param path Path of the file to decode.
+  /// @param sampleRate Requested output sample rate, 0 for the native one.
+  /// @param maxNumberOfParts Maximum number of ranges, typically the number of workers.
+  ParallelAudioDecoder(std::string path, float sampleRate, size_t maxNumberOfParts);
+
+  [[nodiscard]] size_t getMaxNumberOfParts() const {
+    return maxNumberOfParts_;
+  }
+
+  /// @brief Opens the file once, finds its format and length and splits it into ranges.
+  /// Later calls return the same split.
+  /// @return Number of ranges, 0 when the file should be decoded sequentially.
+  size_t split();
+
+  /// @brief Decodes range index out of the ranges the file was split into.
+  /// Splits the file first if that was not done yet.
+  /// @note Thread-safe for distinct indexes, indexes past the actual number of parts
+  /// return immediately.
+  void decodePart(size_t index);
+
+  /// @brief Stitched output, available once every part has been decoded.
+  /// @return nullptr when the file could not be decoded in parts.
+  [[nodiscard]] std::shared_ptr<AudioBuffer> getResult();
+
+  /// @brief Decodes every part on the calling thread, used mostly for testing.
+  [[nodiscard]] std::shared_ptr<AudioBuffer> decode();
+
+ private:
+  std::string path_;
+  float sampleRate_;
+  size_t maxNumberOfParts_;
+
+  std::once_flag prepared_;
+  size_t numberOfParts_ = 0;
+  size_t numberOfFrames_ = 0;
+  size_t numberOfChannels_ = 0;
+  ma_uint32 nativeSampleRate_ = 0;
+  ma_uint32 outputSampleRate_ = 0;
+  ma_encoding_format encodingFormat_ = ma_encoding_format_unknown;
+  std::shared_ptr<AudioBuffer> output_;
+  // where the last part stopped, the resampler may end a frame short of the expected length
+  size_t outputEnd_ = 0;
+  std::atomic<bool> failed_{false};
+
+  void prepare();
+  [[nodiscard]] bool initDecoder(ma_decoder &decoder, ma_encoding_format encodingFormat) const;
+  [[nodiscard]] size_t getOutputFrame(size_t inputFrame) const;
+  void decodeRange(size_t index);
+  void decodeResampledRange(size_t index);
+  void writeFrames(const float *interleaved, size_t position, size_t numberOfFrames);
+};
+
+} // namespace audioapi
@@ -2,89 +2,27 @@
 
 #include <audioapi/core/types/ParamChangeEventType.h>
 
-#include <functional>
-#include <memory>
-#include <utility>
+#include <cstddef>
 
 namespace audioapi {
 
-class ParamChangeEvent {
- public:
-  ParamChangeEvent() = default;
-  explicit ParamChangeEvent(
-      double startTime,
-      double endTime,
-      float startValue,
-      float endValue,
-      std::function<float(double, double, float, float, double)> &&calculateValue,
-      ParamChangeEventType type)
-      : startTime_(startTime),
-        endTime_(endTime),
-        calculateValue_(std::move(calculateValue)),
-        startValue_(startValue),
-        endValue_(endValue),
-        type_(type) {}
-
-  ParamChangeEvent(const ParamChangeEvent &other) = delete;
-  ParamChangeEvent &operator=(const ParamChangeEvent &other) = delete;
-
-  ParamChangeEvent(ParamChangeEvent &&other) noexcept
-      : startTime_(other.startTime_),
-        endTime_(other.endTime_),
-        calculateValue_(std::move(other.calculateValue_)),
-        startValue_(other.startValue_),
-        endValue_(other.endValue_),
-        type_(other.type_) {}
-
-  ParamChangeEvent &operator=(ParamChangeEvent &&other) noexcept {
-    if (this != &other) {
-      startTime_ = other.startTime_;
-      endTime_ = other.endTime_;
-      calculateValue_ = std::move(other.calculateValue_);
-      startValue_ = other.startValue_;
-      endValue_ = other.endValue_;
-      type_ = other.type_;
-    }
-    return *this;
-  }
-
-  [[nodiscard]] inline double getEndTime() const noexcept {
-    return endTime_;
-  }
-  [[nodiscard]] inline double getStartTime() const noexcept {
-    return startTime_;
-  }
-  [[nodiscard]] inline float getEndValue() const noexcept {
-    return endValue_;
-  }
-  [[nodiscard]] inline float getStartValue() const noexcept {
-    return startValue_;
-  }
-  [[nodiscard]] inline const std::function<float(double, double, float, float, double)> &
-  getCalculateValue() const noexcept {
-    return calculateValue_;
-  }
-  [[nodiscard]] inline ParamChangeEventType getType() const noexcept {
-    return type_;
-  }
-
-  inline void setEndTime(double endTime) noexcept {
-    endTime_ = endTime;
-  }
-  inline void setStartValue(float startValue) noexcept {
-    startValue_ = startValue;
-  }
-  inline void setEndValue(float endValue) noexcept {
-    endValue_ = endValue;
-  }
-
- private:
-  double startTime_ = 0.0;
-  double endTime_ = 0.0;
-  std::function<float(double, double, float, float, double)> calculateValue_;
-  float startValue_ = 0.0f;
-  float endValue_ = 0.0f;
-  ParamChangeEventType type_;
+/// @brief A scheduled change of an AudioParam.
+/// It is a plain value, the way the param changes over time is picked by its type, so events can
+/// be copied in bulk and evaluated on the audio thread without any indirection.
+struct ParamChangeEvent {
+  ParamChangeEventType type = ParamChangeEventType::SET_VALUE;
+  double startTime = 0.0;
+  double endTime = 0.0;
+  float startValue = 0.0f;
+  float endValue = 0.0f;
+
+  // SET_TARGET only
+  float target = 0.0f;
+  double timeConstant = 0.0;
+
+  // SET_VALUE_CURVE only, the range of the curve values stored by the timeline
+  size_t curveOffset = 0;
+  size_t curveLength = 0;
 };
 
 } // namespace audioapi
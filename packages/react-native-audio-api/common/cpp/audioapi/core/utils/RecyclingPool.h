@@ -0,0 +1,70 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace audioapi {
+
+/// @brief Fixed set of objects handed out as shared pointers and reused
+/// once every other owner, e.g. the JS garbage collector, released them.
+/// The pool keeps one reference to each object, so an object is free when it holds the only one.
+/// @note acquire is to be called from one thread, the objects can be released from any thread.
+template <typename T>
+class RecyclingPool {
+ public:
+  /// @brief Tells whether a free object is still referenced indirectly, e.g. through its data.
+  using IsInUse = bool (*)(const T &);
+
+  explicit RecyclingPool(std::vector<std::shared_ptr<T>> objects, IsInUse isInUse = nullptr)
+      : objects_(std::move(objects)), isInUse_(isInUse) {}
+
+  /// @return A free object, or nullptr if every object is still in use.
+  /// @note Does not allocate.
+  std::shared_ptr<T> acquire() {
+    for (size_t i = 0; i < objects_.size(); ++i) {
+      size_t index = (nextIndex_ + i) % objects_.size();
+      const auto &object = objects_[index];
+
+      // only the pool hands the objects out, so once free, an object stays free
+      if (object.use_count() != 1 || (isInUse_ != nullptr && isInUse_(*object))) {
+        continue;
+      }
+
+      // pairs with the release of the last other reference
+      std::atomic_thread_fence(std::memory_order_acquire);
+      nextIndex_ = (index + 1) % objects_.size();
+      acquiredCount_.fetch_add(1, std::memory_order_relaxed);
+      return object;
+    }
+
+    missedCount_.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+  }
+
+  [[nodiscard]] size_t getCapacity() const noexcept {
+    return objects_.size();
+  }
+
+  [[nodiscard]] uint64_t getAcquiredCount() const noexcept {
+    return acquiredCount_.load(std::memory_order_relaxed);
+  }
+
+  /// @brief Number of acquire calls that found every object in use.
+  [[nodiscard]] uint64_t getMissedCount() const noexcept {
+    return missedCount_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  std::vector<std::shared_ptr<T>> objects_;
+  IsInUse isInUse_;
+  // objects are handed out in turn, so the least recently used one is checked first
+  size_t nextIndex_ = 0;
+  std::atomic<uint64_t> acquiredCount_{0};
+  std::atomic<uint64_t> missedCount_{0};
+};
+
+} // namespace audioapi
@@ -0,0 +1,69 @@
+#include <audioapi/core/utils/SeekIndex.h>
+
+#include <algorithm>
+
+namespace audioapi {
+
+SeekIndex::SeekIndex(int64_t minDistance, size_t maxEntries)
+    : minDistance_(std::max<int64_t>(minDistance, 1)),
+      maxEntries_(std::max<size_t>(maxEntries, 2)) {
+  entries_.reserve(maxEntries_);
+}
+
+void SeekIndex::add(int64_t timestamp, int64_t position) {
+  if (maxEntries_ == 0) {
+    return;
+  }
+
+  auto next = std::lower_bound(
+      entries_.begin(), entries_.end(), timestamp, [](const Entry &entry, int64_t value) {
+        return entry.timestamp < value;
+      });
+
+  if (next != entries_.end() && next->timestamp - timestamp < minDistance_) {
+    return;
+  }
+  if (next != entries_.begin() && timestamp - std::prev(next)->timestamp < minDistance_) {
+    return;
+  }
+
+  entries_.insert(next, {timestamp, position});
+
+  if (entries_.size() == maxEntries_) {
+    reduce();
+  }
+}
+
+std::optional<SeekIndex::Entry> SeekIndex::find(int64_t timestamp) const {
+  auto next = std::upper_bound(
+      entries_.begin(), entries_.end(), timestamp, [](int64_t value, const Entry &entry) {
+        return value < entry.timestamp;
+      });
+
+  if (next == entries_.begin()) {
+    return std::nullopt;
+  }
+
+  auto entry = *std::prev(next);
+  // entries are at most two distances apart in parts that were read linearly
+  if (timestamp - entry.timestamp > 2 * minDistance_) {
+    return std::nullopt;
+  }
+
+  return entry;
+}
+
+void SeekIndex::clear() {
+  entries_.clear();
+}
+
+void SeekIndex::reduce() {
+  size_t kept = 0;
+  for (size_t i = 0; i < entries_.size(); i += 2) {
+    entries_[kept++] = entries_[i];
+  }
+  entries_.resize(kept);
+  minDistance_ *= 2;
+}
+
+} // namespace audioapi
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace audioapi {
+
+/// @brief Keyframe positions recorded while a stream is read,
+/// so that seeking back into already read parts can jump straight to a byte position.
+/// Entries are kept at least a given distance apart. When the index is full,
+/// every other entry is dropped and the distance doubled.
+/// @note Not thread-safe.
+class SeekIndex {
+ public:
+  struct Entry {
+    int64_t timestamp;
+    int64_t position;
+  };
+
+  SeekIndex() = default;
+  /// @param minDistance Minimal distance between entries, in stream time base units.
+  SeekIndex(int64_t minDistance, size_t maxEntries);
+
+  void add(int64_t timestamp, int64_t position);
+
+  /// @brief Finds the last entry at or before the timestamp.
+  /// @return nullopt if there is none, or the index has a gap before the timestamp,
+  /// i.e. that part of the stream was not read.
+  [[nodiscard]] std::optional<Entry> find(int64_t timestamp) const;
+
+  [[nodiscard]] size_t size() const noexcept {
+    return entries_.size();
+  }
+
+  [[nodiscard]] int64_t getMinDistance() const noexcept {
+    return minDistance_;
+  }
+
+  void clear();
+
+ private:
+  std::vector<Entry> entries_;
+  int64_t minDistance_ = 1;
+  size_t maxEntries_ = 0;
+
+  void reduce();
+};
+
+} // namespace audioapi
@@ -0,0 +1,86 @@
+#include <audioapi/core/sources/AudioBufferSourceNode.h>
+#include <audioapi/core/sources/AudioScheduledSourceNode.h>
+#include <audioapi/core/sources/OscillatorNode.h>
+#include <audioapi/core/utils/VoicePool.h>
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+
+namespace audioapi {
+
+VoicePool::VoicePool() {
+  for (auto &slot : slots_) {
+    auto [sender, receiver] =
+        channels::spsc::channel<std::shared_ptr<AudioScheduledSourceNode>>(kMaxCapacity);
+    slot.sender = std::move(sender);
+    slot.receiver = std::move(receiver);
+  }
+}
+
+bool VoicePool::tryRecycle(std::shared_ptr<AudioScheduledSourceNode> &node) {
+  Slot *slot = nullptr;
+
+  if (dynamic_cast<OscillatorNode *>(node.get()) != nullptr) {
+    slot = &getSlot(VoiceType::OSCILLATOR);
+  } else if (dynamic_cast<AudioBufferSourceNode *>(node.get()) != nullptr) {
+    slot = &getSlot(VoiceType::BUFFER_SOURCE);
+  }
+
+  if (slot == nullptr || !node->canBeRecycled() ||
+      slot->size.load(std::memory_order_acquire) >=
+          slot->capacity.load(std::memory_order_relaxed)) {
+    return false;
+  }
+
+  if (slot->sender.try_send(std::move(node)) != channels::spsc::ResponseStatus::SUCCESS) {
+    return false;
+  }
+
+  slot->size.fetch_add(1, std::memory_order_release);
+  slot->recycled.fetch_add(1, std::memory_order_relaxed);
+  return true;
+}
+
+std::shared_ptr<AudioScheduledSourceNode> VoicePool::acquire(VoiceType type) {
+  auto &slot = getSlot(type);
+  std::shared_ptr<AudioScheduledSourceNode> node;
+
+  if (slot.receiver.try_receive(node) != channels::spsc::ResponseStatus::SUCCESS) {
+    slot.misses.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+  }
+
+  slot.size.fetch_sub(1, std::memory_order_release);
+  slot.hits.fetch_add(1, std::memory_order_relaxed);
+  return node;
+}
+
+void VoicePool::setCapacity(VoiceType type, size_t capacity) {
+  auto &slot = getSlot(type);
+  capacity = std::min(capacity, kMaxCapacity);
+  slot.capacity.store(capacity, std::memory_order_relaxed);
+
+  std::shared_ptr<AudioScheduledSourceNode> node;
+
+  // the dropped nodes are out of the graph, so they can be destroyed on this thread
+  while (slot.size.load(std::memory_order_acquire) > capacity &&
+         slot.receiver.try_receive(node) == channels::spsc::ResponseStatus::SUCCESS) {
+    slot.size.fetch_sub(1, std::memory_order_release);
+    node.reset();
+  }
+}
+
+VoicePool::Stats VoicePool::getStats(VoiceType type) const {
+  const auto &slot = getSlot(type);
+
+  return {
+      .hits = slot.hits.load(std::memory_order_relaxed),
+      .misses = slot.misses.load(std::memory_order_relaxed),
+      .recycled = slot.recycled.load(std::memory_order_relaxed),
+      .available = slot.size.load(std::memory_order_relaxed),
+      .capacity = slot.capacity.load(std::memory_order_relaxed),
+  };
+}
+
+} // namespace audioapi
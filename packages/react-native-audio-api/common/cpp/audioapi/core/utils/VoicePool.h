@@ -0,0 +1,83 @@
+#pragma once
+
+#include <audioapi/utils/SpscChannel.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace audioapi {
+
+class AudioScheduledSourceNode;
+
+/// @brief Source nodes that can be played again instead of being destroyed.
+enum class VoiceType { OSCILLATOR, BUFFER_SOURCE };
+
+/// @brief Per type pools of finished source nodes, handed back to the JS thread to be reset and
+/// played again, so triggering a voice does not allocate a node and its params in steady state.
+/// The audio thread recycles the nodes the graph manager would otherwise destroy, up to the
+/// capacity of their type, the JS thread acquires them in place of new ones.
+/// @note tryRecycle is to be called from the audio thread, acquire and setCapacity from the
+/// JS thread, getStats from any thread.
+class VoicePool {
+ public:
+  static constexpr size_t kDefaultCapacity = 32;
+  static constexpr size_t kMaxCapacity = 256;
+
+  struct Stats {
+    /// Nodes created from the pool.
+    uint64_t hits;
+    /// Nodes created while the pool was empty.
+    uint64_t misses;
+    /// Finished nodes taken into the pool.
+    uint64_t recycled;
+    size_t available;
+    size_t capacity;
+  };
+
+  VoicePool();
+
+  /// @brief Takes a finished node into the pool of its type, if it can be recycled and the pool
+  /// is not full. The node has to be cleaned up and held by nothing else.
+  /// @return true if the node was moved into the pool.
+  /// @note node does NOT get moved out if it is not taken. Real-time safe.
+  bool tryRecycle(std::shared_ptr<AudioScheduledSourceNode> &node);
+
+  /// @return A recycled node of the type, to be reset before it is used, or nullptr.
+  std::shared_ptr<AudioScheduledSourceNode> acquire(VoiceType type);
+
+  /// @brief Sets the number of nodes of the type kept, clamped to kMaxCapacity.
+  /// Nodes above the new capacity are dropped.
+  void setCapacity(VoiceType type, size_t capacity);
+
+  [[nodiscard]] Stats getStats(VoiceType type) const;
+
+ private:
+  using VoiceSender = channels::spsc::Sender<std::shared_ptr<AudioScheduledSourceNode>>;
+  using VoiceReceiver = channels::spsc::Receiver<std::shared_ptr<AudioScheduledSourceNode>>;
+
+  struct Slot {
+    // recycled nodes, from the audio thread to the JS thread
+    VoiceSender sender;
+    VoiceReceiver receiver;
+
+    std::atomic<size_t> capacity{kDefaultCapacity};
+    std::atomic<size_t> size{0};
+    std::atomic<uint64_t> hits{0};
+    std::atomic<uint64_t> misses{0};
+    std::atomic<uint64_t> recycled{0};
+  };
+
+  std::array<Slot, 2> slots_;
+
+  Slot &getSlot(VoiceType type) {
+    return slots_[static_cast<size_t>(type)];
+  }
+  [[nodiscard]] const Slot &getSlot(VoiceType type) const {
+    return slots_[static_cast<size_t>(type)];
+  }
+};
+
+} // namespace audioapi
@@ -0,0 +1,474 @@
+#include <audioapi/core/utils/encoders/FlacEncoder.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <limits>
+#include <vector>
+
+namespace audioapi {
+
+namespace {
+
+constexpr int kMaxFixedOrder = 4;
+constexpr int kMaxRiceParameter = 30;
+// parameters above it need the 5 bit parameters of the second Rice coding method
+constexpr int kMaxRiceParameter4Bit = 14;
+
+constexpr uint32_t CHANNELS_LEFT_SIDE = 8;
+constexpr uint32_t CHANNELS_SIDE_RIGHT = 9;
+constexpr uint32_t CHANNELS_MID_SIDE = 10;
+
+constexpr std::array<uint8_t, 256> makeCrc8Table() {
+  std::array<uint8_t, 256> table{};
+  for (int i = 0; i < 256; ++i) {
+    auto crc = static_cast<uint8_t>(i);
+    for (int bit = 0; bit < 8; ++bit) {
+      crc = static_cast<uint8_t>((crc & 0x80) ? (crc << 1) ^ 0x07 : crc << 1);
+    }
+    table[i] = crc;
+  }
+  return table;
+}
+
+constexpr std::array<uint16_t, 256> makeCrc16Table() {
+  std::array<uint16_t, 256> table{};
+  for (int i = 0; i < 256; ++i) {
+    auto crc = static_cast<uint16_t>(i << 8);
+    for (int bit = 0; bit < 8; ++bit) {
+      crc = static_cast<uint16_t>((crc & 0x8000) ? (crc << 1) ^ 0x8005 : crc << 1);
+    }
+    table[i] = crc;
+  }
+  return table;
+}
+
+constexpr auto CRC8_TABLE = makeCrc8Table();
+constexpr auto CRC16_TABLE = makeCrc16Table();
+
+uint8_t crc8(const uint8_t *data, size_t size) {
+  uint8_t crc = 0;
+  for (size_t i = 0; i < size; ++i) {
+    crc = CRC8_TABLE[crc ^ data[i]];
+  }
+  return crc;
+}
+
+uint16_t crc16(const uint8_t *data, size_t size) {
+  uint16_t crc = 0;
+  for (size_t i = 0; i < size; ++i) {
+    crc = static_cast<uint16_t>((crc << 8) ^ CRC16_TABLE[(crc >> 8) ^ data[i]]);
+  }
+  return crc;
+}
+
+/// @brief Appends bits to the output, most significant first.
+class BitWriter {
+ public:
+  explicit BitWriter(EncodedBytes &output) : output_(output) {}
+
+  /// @param bits Up to 32.
+  void write(uint32_t value, int bits) {
+    if (bits == 0) {
+      return;
+    }
+    buffer_ = (buffer_ << bits) | (value & (0xFFFFFFFFu >> (32 - bits)));
+    bitCount_ += bits;
+    while (bitCount_ >= 8) {
+      bitCount_ -= 8;
+      output_.push_back(static_cast<uint8_t>(buffer_ >> bitCount_));
+    }
+  }
+
+  void write64(uint64_t value, int bits) {
+    if (bits > 32) {
+      write(static_cast<uint32_t>(value >> 32), bits - 32);
+      bits = 32;
+    }
+    write(static_cast<uint32_t>(value), bits);
+  }
+
+  void writeSigned(int32_t value, int bits) {
+    write(static_cast<uint32_t>(value), bits);
+  }
+
+  void writeRice(int32_t value, int parameter) {
+    auto folded = (static_cast<uint32_t>(value) << 1) ^ static_cast<uint32_t>(value >> 31);
+    auto quotient = folded >> parameter;
+    while (quotient >= 32) {
+      write(0, 32);
+      quotient -= 32;
+    }
+    write(1, static_cast<int>(quotient) + 1);
+    write(folded, parameter);
+  }
+
+  /// @brief Pads the last byte with zeros.
+  void alignToByte() {
+    if (bitCount_ > 0) {
+      write(0, 8 - bitCount_);
+    }
+  }
+
+ private:
+  EncodedBytes &output_;
+  uint64_t buffer_ = 0;
+  int bitCount_ = 0;
+};
+
+/// @brief Writes the frame number the way FLAC extends UTF-8 to 36 bit values.
+void writeUtf8(BitWriter &writer, uint64_t value) {
+  if (value < 0x80) {
+    writer.write(static_cast<uint32_t>(value), 8);
+    return;
+  }
+
+  int bytes = 2;
+  while (bytes < 7 && value >= (uint64_t{1} << (5 * bytes + 1))) {
+    ++bytes;
+  }
+
+  auto shift = 6 * (bytes - 1);
+  writer.write((0xFF00u >> bytes) | static_cast<uint32_t>(value >> shift), 8);
+  for (shift -= 6; shift >= 0; shift -= 6) {
+    writer.write(0x80 | static_cast<uint32_t>((value >> shift) & 0x3F), 8);
+  }
+}
+
+uint32_t getSampleSizeCode(int bitsPerSample) {
+  return bitsPerSample == 16 ? 0b100 : 0b110;
+}
+
+/// @brief Prediction of the fixed polynomial predictor of the order, which is at most i.
+int64_t predictFixed(const int32_t *samples, size_t i, int order) {
+  switch (order) {
+    case 0:
+      return 0;
+    case 1:
+      return samples[i - 1];
+    case 2:
+      return 2 * int64_t{samples[i - 1]} - samples[i - 2];
+    case 3:
+      return 3 * (int64_t{samples[i - 1]} - samples[i - 2]) + samples[i - 3];
+    default:
+      return 4 * (int64_t{samples[i - 1]} + samples[i - 3]) - 6 * int64_t{samples[i - 2]} -
+          samples[i - 4];
+  }
+}
+
+/// @return Rice parameter with the fewest bits for a partition, estimated from its sum.
+int getRiceParameter(uint64_t sum, size_t count) {
+  int best = 0;
+  uint64_t bestSize = std::numeric_limits<uint64_t>::max();
+  for (int parameter = 0; parameter <= kMaxRiceParameter; ++parameter) {
+    auto size = count * (parameter + 1) + (sum >> parameter);
+    if (size > bestSize) {
+      // the size is convex in the parameter
+      break;
+    }
+    bestSize = size;
+    best = parameter;
+  }
+  return best;
+}
+
+} // namespace
+
+FlacEncoder::FlacEncoder(
+    int numberOfChannels,
+    float sampleRate,
+    int bitsPerSample,
+    int compressionLevel)
+    : LosslessEncoder(numberOfChannels, sampleRate, bitsPerSample) {
+  auto level = compressionLevel < 0 ? 5 : std::min(compressionLevel, 8);
+  usesStereoDecorrelation_ = numberOfChannels == 2 && level >= 1;
+  maxPartitionOrder_ = std::clamp(level, 3, kMaxPartitionOrder);
+
+  samples_.assign(numberOfChannels_, std::vector<int32_t>(kBlockSize));
+  if (usesStereoDecorrelation_) {
+    side_.resize(kBlockSize);
+    mid_.resize(kBlockSize);
+  }
+  auto numberOfCandidates = usesStereoDecorrelation_ ? 4 : numberOfChannels_;
+  residuals_.assign(numberOfCandidates, std::vector<int32_t>(kBlockSize));
+  subframes_.resize(numberOfCandidates);
+}
+
+void FlacEncoder::writeHeader(EncodedBytes &output) const {
+  BitWriter writer(output);
+  for (char c : {'f', 'L', 'a', 'C'}) {
+    writer.write(static_cast<uint8_t>(c), 8);
+  }
+
+  // the only metadata block is STREAMINFO
+  writer.write(1, 1);
+  writer.write(0, 7);
+  writer.write(34, 24);
+
+  writer.write(kBlockSize, 16);
+  writer.write(kBlockSize, 16);
+  writer.write(minFrameSize_, 24);
+  writer.write(maxFrameSize_, 24);
+  writer.write(static_cast<uint32_t>(sampleRate_), 20);
+  writer.write(numberOfChannels_ - 1, 3);
+  writer.write(bitsPerSample_ - 1, 5);
+  writer.write64(encodedFrames_, 36);
+  // the MD5 of the audio is left unknown
+  for (int i = 0; i < 4; ++i) {
+    writer.write(0, 32);
+  }
+}
+
+void FlacEncoder::encode(const float *interleaved, size_t frames, EncodedBytes &output) {
+  size_t offset = 0;
+
+  while (offset < frames) {
+    auto framesToCopy = std::min(frames - offset, kBlockSize - bufferedFrames_);
+    const auto *source = interleaved + offset * numberOfChannels_;
+
+    for (size_t i = 0; i < framesToCopy; ++i) {
+      for (int channel = 0; channel < numberOfChannels_; ++channel) {
+        samples_[channel][bufferedFrames_ + i] = quantize(*source++);
+      }
+    }
+
+    offset += framesToCopy;
+    bufferedFrames_ += framesToCopy;
+
+    if (bufferedFrames_ == kBlockSize) {
+      encodeFrame(kBlockSize, output);
+      bufferedFrames_ = 0;
+    }
+  }
+
+  encodedFrames_ += frames;
+}
+
+void FlacEncoder::finish(EncodedBytes &output) {
+  if (bufferedFrames_ > 0) {
+    encodeFrame(bufferedFrames_, output);
+    bufferedFrames_ = 0;
+  }
+}
+
+void FlacEncoder::encodeFrame(size_t frames, EncodedBytes &output) {
+  std::array<const Subframe *, 8> chosen{};
+  uint32_t channelAssignment = numberOfChannels_ - 1;
+
+  if (usesStereoDecorrelation_) {
+    const auto *left = samples_[0].data();
+    const auto *right = samples_[1].data();
+    for (size_t i = 0; i < frames; ++i) {
+      side_[i] = left[i] - right[i];
+      mid_[i] = (left[i] + right[i]) >> 1;
+    }
+
+    planSubframe(subframes_[0], left, frames, bitsPerSample_, residuals_[0]);
+    planSubframe(subframes_[1], right, frames, bitsPerSample_, residuals_[1]);
+    planSubframe(subframes_[2], side_.data(), frames, bitsPerSample_ + 1, residuals_[2]);
+    planSubframe(subframes_[3], mid_.data(), frames, bitsPerSample_, residuals_[3]);
+
+    const auto &l = subframes_[0];
+    const auto &r = subframes_[1];
+    const auto &s = subframes_[2];
+    const auto &m = subframes_[3];
+    chosen = {&l, &r};
+    auto size = l.size + r.size;
+
+    if (l.size + s.size < size) {
+      channelAssignment = CHANNELS_LEFT_SIDE;
+      chosen = {&l, &s};
+      size = l.size + s.size;
+    }
+    if (s.size + r.size < size) {
+      channelAssignment = CHANNELS_SIDE_RIGHT;
+      chosen = {&s, &r};
+      size = s.size + r.size;
+    }
+    if (m.size + s.size < size) {
+      channelAssignment = CHANNELS_MID_SIDE;
+      chosen = {&m, &s};
+    }
+  } else {
+    for (int channel = 0; channel < numberOfChannels_; ++channel) {
+      planSubframe(
+          subframes_[channel],
+          samples_[channel].data(),
+          frames,
+          bitsPerSample_,
+          residuals_[channel]);
+      chosen[channel] = &subframes_[channel];
+    }
+  }
+
+  auto frameStart = output.size();
+  BitWriter writer(output);
+
+  // fixed block size stream, the sample rate is the one of STREAMINFO
+  writer.write(0xFFF8, 16);
+  writer.write(frames == kBlockSize ? 0b1100 : 0b0111, 4);
+  writer.write(0, 4);
+  writer.write(channelAssignment, 4);
+  writer.write(getSampleSizeCode(bitsPerSample_), 3);
+  writer.write(0, 1);
+  writeUtf8(writer, frameNumber_++);
+  if (frames != kBlockSize) {
+    writer.write(static_cast<uint32_t>(frames - 1), 16);
+  }
+  writer.write(crc8(output.data() + frameStart, output.size() - frameStart), 8);
+
+  for (int channel = 0; channel < numberOfChannels_; ++channel) {
+    const auto &subframe = *chosen[channel];
+    const auto bitsPerSample = subframe.bitsPerSample;
+
+    writer.write(0, 1);
+    switch (subframe.type) {
+      case Subframe::Type::CONSTANT:
+        writer.write(0b000000, 6);
+        writer.write(0, 1);
+        writer.writeSigned(subframe.samples[0], bitsPerSample);
+        break;
+
+      case Subframe::Type::VERBATIM:
+        writer.write(0b000001, 6);
+        writer.write(0, 1);
+        for (size_t i = 0; i < frames; ++i) {
+          writer.writeSigned(subframe.samples[i], bitsPerSample);
+        }
+        break;
+
+      case Subframe::Type::FIXED: {
+        writer.write(0b001000 | subframe.order, 6);
+        writer.write(0, 1);
+        for (int i = 0; i < subframe.order; ++i) {
+          writer.writeSigned(subframe.samples[i], bitsPerSample);
+        }
+
+        writer.write(subframe.parameterBits == 5 ? 1 : 0, 2);
+        writer.write(subframe.partitionOrder, 4);
+        auto partitionSize = frames >> subframe.partitionOrder;
+        for (size_t partition = 0; partition < (size_t{1} << subframe.partitionOrder);
+             ++partition) {
+          auto parameter = subframe.parameters[partition];
+          writer.write(parameter, subframe.parameterBits);
+          auto start = partition == 0 ? subframe.order : partition * partitionSize;
+          for (size_t i = start; i < (partition + 1) * partitionSize; ++i) {
+            writer.writeRice(subframe.residual[i], parameter);
+          }
+        }
+        break;
+      }
+    }
+  }
+
+  writer.alignToByte();
+  writer.write(crc16(output.data() + frameStart, output.size() - frameStart), 16);
+
+  auto frameSize = static_cast<uint32_t>(output.size() - frameStart);
+  minFrameSize_ = minFrameSize_ == 0 ? frameSize : std::min(minFrameSize_, frameSize);
+  maxFrameSize_ = std::max(maxFrameSize_, frameSize);
+}
+
+void FlacEncoder::planSubframe(
+    Subframe &subframe,
+    const int32_t *samples,
+    size_t frames,
+    int bitsPerSample,
+    std::vector<int32_t> &residual) const {
+  subframe.samples = samples;
+  subframe.residual = residual.data();
+  subframe.bitsPerSample = bitsPerSample;
+
+  if (std::all_of(samples, samples + frames, [samples](int32_t s) { return s == samples[0]; })) {
+    subframe.type = Subframe::Type::CONSTANT;
+    subframe.size = 8 + bitsPerSample;
+    return;
+  }
+
+  subframe.type = Subframe::Type::VERBATIM;
+  subframe.size = 8 + frames * bitsPerSample;
+
+  if (frames <= kMaxFixedOrder) {
+    return;
+  }
+
+  // the order leaving the smallest residual, compared over the samples every order predicts
+  std::array<uint64_t, kMaxFixedOrder + 1> sums{};
+  for (size_t i = kMaxFixedOrder; i < frames; ++i) {
+    for (int order = 0; order <= kMaxFixedOrder; ++order) {
+      sums[order] += std::llabs(samples[i] - predictFixed(samples, i, order));
+    }
+  }
+  subframe.order = static_cast<int>(std::min_element(sums.begin(), sums.end()) - sums.begin());
+
+  for (size_t i = subframe.order; i < frames; ++i) {
+    residual[i] = static_cast<int32_t>(samples[i] - predictFixed(samples, i, subframe.order));
+  }
+
+  auto verbatimSize = subframe.size;
+  planResidual(subframe, frames);
+  subframe.size += 8 + subframe.order * bitsPerSample;
+
+  if (subframe.size < verbatimSize) {
+    subframe.type = Subframe::Type::FIXED;
+  } else {
+    subframe.size = verbatimSize;
+  }
+}
+
+void FlacEncoder::planResidual(Subframe &subframe, size_t frames) const {
+  const auto order = static_cast<size_t>(subframe.order);
+
+  // every partition holds the same number of samples, more than the order
+  auto maxPartitionOrder = maxPartitionOrder_;
+  while (maxPartitionOrder > 0 &&
+         ((frames & ((size_t{1} << maxPartitionOrder) - 1)) != 0 ||
+          (frames >> maxPartitionOrder) <= order)) {
+    --maxPartitionOrder;
+  }
+
+  std::array<uint64_t, 1 << kMaxPartitionOrder> sums{};
+  auto partitionSize = frames >> maxPartitionOrder;
+  for (size_t partition = 0; partition < (size_t{1} << maxPartitionOrder); ++partition) {
+    auto start = partition == 0 ? order : partition * partitionSize;
+    for (size_t i = start; i < (partition + 1) * partitionSize; ++i) {
+      auto value = subframe.residual[i];
+      sums[partition] += (static_cast<uint32_t>(value) << 1) ^ static_cast<uint32_t>(value >> 31);
+    }
+  }
+
+  subframe.size = std::numeric_limits<uint64_t>::max();
+  std::array<uint8_t, 1 << kMaxPartitionOrder> parameters{};
+
+  for (int partitionOrder = maxPartitionOrder; partitionOrder >= 0; --partitionOrder) {
+    auto numberOfPartitions = size_t{1} << partitionOrder;
+    partitionSize = frames >> partitionOrder;
+    uint64_t size = 0;
+    int maxParameter = 0;
+
+    for (size_t partition = 0; partition < numberOfPartitions; ++partition) {
+      auto count = partitionSize - (partition == 0 ? order : 0);
+      auto parameter = getRiceParameter(sums[partition], count);
+      size += count * (parameter + 1) + (sums[partition] >> parameter);
+      parameters[partition] = static_cast<uint8_t>(parameter);
+      maxParameter = std::max(maxParameter, parameter);
+    }
+
+    auto parameterBits = maxParameter > kMaxRiceParameter4Bit ? 5 : 4;
+    size += 6 + numberOfPartitions * parameterBits;
+
+    if (size < subframe.size) {
+      subframe.size = size;
+      subframe.partitionOrder = partitionOrder;
+      subframe.parameterBits = parameterBits;
+      subframe.parameters = parameters;
+    }
+
+    // the partitions of the next order are pairs of the current ones
+    for (size_t partition = 0; partition < numberOfPartitions / 2; ++partition) {
+      sums[partition] = sums[2 * partition] + sums[2 * partition + 1];
+    }
+  }
+}
+
+} // namespace audioapi
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <audioapi/core/utils/encoders/LosslessEncoder.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace audioapi {
+
+/// @brief Writes a native FLAC stream of fixed-size blocks.
+/// Every subframe is stored as constant, verbatim or with the fixed polynomial predictor that
+/// leaves the smallest residual, which is then Rice coded in partitions. Stereo blocks also try
+/// the left/side, side/right and mid/side decorrelations and keep the smallest one.
+/// Linear prediction is not used, so at high compression levels the files are somewhat larger
+/// than the ones of libFLAC.
+class FlacEncoder : public LosslessEncoder {
+ public:
+  static constexpr size_t kBlockSize = 4096;
+  static constexpr size_t kHeaderSize = 42;
+  static constexpr int kMaxPartitionOrder = 8;
+
+  /// @param bitsPerSample 16 or 24.
+  /// @param compressionLevel 0 to 8, a negative one picks the default. Level 0 stores the
+  /// channels independently, higher levels try more Rice partitionings.
+  FlacEncoder(int numberOfChannels, float sampleRate, int bitsPerSample, int compressionLevel);
+
+  void writeHeader(EncodedBytes &output) const override;
+  void encode(const float *interleaved, size_t frames, EncodedBytes &output) override;
+  void finish(EncodedBytes &output) override;
+
+ private:
+  struct Subframe {
+    enum class Type {
+      CONSTANT,
+      VERBATIM,
+      FIXED,
+    };
+
+    Type type;
+    const int32_t *samples;
+    const int32_t *residual;
+    int bitsPerSample;
+    int order;
+    int partitionOrder;
+    int parameterBits;
+    std::array<uint8_t, 1 << kMaxPartitionOrder> parameters;
+    uint64_t size;
+  };
+
+  bool usesStereoDecorrelation_;
+  int maxPartitionOrder_;
+
+  // samples of the block being gathered, one vector per channel
+  std::vector<std::vector<int32_t>> samples_;
+  size_t bufferedFrames_ = 0;
+  uint64_t frameNumber_ = 0;
+  uint32_t minFrameSize_ = 0;
+  uint32_t maxFrameSize_ = 0;
+
+  // side and mid of stereo blocks, then one residual per planned subframe
+  std::vector<int32_t> side_;
+  std::vector<int32_t> mid_;
+  std::vector<std::vector<int32_t>> residuals_;
+  std::vector<Subframe> subframes_;
+
+  void encodeFrame(size_t frames, EncodedBytes &output);
+  void planSubframe(
+      Subframe &subframe,
+      const int32_t *samples,
+      size_t frames,
+      int bitsPerSample,
+      std::vector<int32_t> &residual) const;
+  void planResidual(Subframe &subframe, size_t frames) const;
+};
+
+} // namespace audioapi
@@ -0,0 +1,53 @@
+#include <audioapi/core/utils/encoders/FlacEncoder.h>
+#include <audioapi/core/utils/encoders/LosslessEncoder.h>
+#include <audioapi/core/utils/encoders/WavEncoder.h>
+#include <audioapi/utils/AudioFileProperties.h>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+
+namespace audioapi {
+
+LosslessEncoder::LosslessEncoder(int numberOfChannels, float sampleRate, int bitsPerSample)
+    : numberOfChannels_(numberOfChannels),
+      sampleRate_(sampleRate),
+      bitsPerSample_(bitsPerSample) {}
+
+std::unique_ptr<LosslessEncoder> LosslessEncoder::create(const AudioFileProperties &properties) {
+  using BitDepth = AudioFileProperties::BitDepth;
+
+  switch (properties.format) {
+    case AudioFileProperties::Format::WAV:
+      switch (properties.bitDepth) {
+        case BitDepth::Bit16:
+          return std::make_unique<WavEncoder>(
+              properties.channelCount, properties.sampleRate, WavEncoder::SampleFormat::Int16);
+        case BitDepth::Bit24:
+          return std::make_unique<WavEncoder>(
+              properties.channelCount, properties.sampleRate, WavEncoder::SampleFormat::Int24);
+        default:
+          return std::make_unique<WavEncoder>(
+              properties.channelCount, properties.sampleRate, WavEncoder::SampleFormat::Float32);
+      }
+
+    case AudioFileProperties::Format::FLAC:
+      // FLAC has no float samples, 32 bit audio is stored with 24 bits
+      return std::make_unique<FlacEncoder>(
+          properties.channelCount,
+          properties.sampleRate,
+          properties.bitDepth == BitDepth::Bit16 ? 16 : 24,
+          properties.flacCompressionLevel);
+
+    default:
+      return nullptr;
+  }
+}
+
+int32_t LosslessEncoder::quantize(float sample) const noexcept {
+  auto scale = static_cast<float>(1 << (bitsPerSample_ - 1));
+  auto value = std::lrint(std::clamp(sample, -1.0f, 1.0f) * scale);
+  return static_cast<int32_t>(std::min(value, static_cast<long>(scale) - 1));
+}
+
+} // namespace audioapi
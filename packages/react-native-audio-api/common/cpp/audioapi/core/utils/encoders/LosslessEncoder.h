@@ -0,0 +1,67 @@
+#pragma once
+
+#include <audioapi/utils/AlignedAllocator.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace audioapi {
+
+class AudioFileProperties;
+
+/// @brief Encoded bytes waiting to be written, page aligned so they are flushed in whole pages.
+using EncodedBytes = std::vector<uint8_t, AlignedAllocator<uint8_t, 4096>>;
+
+/// @brief Encodes interleaved float frames into a lossless file format.
+/// The header is written before any audio and rewritten once the length of the audio is known,
+/// so its size does not depend on the audio.
+/// @note Not thread-safe, to be used by one thread at a time.
+class LosslessEncoder {
+ public:
+  virtual ~LosslessEncoder() = default;
+
+  /// @return Encoder for the format and bit depth of the file, nullptr if the format is not
+  /// lossless.
+  static std::unique_ptr<LosslessEncoder> create(const AudioFileProperties &properties);
+
+  /// @brief Appends the file header describing the audio encoded so far.
+  virtual void writeHeader(EncodedBytes &output) const = 0;
+
+  /// @brief Appends the encoded frames, some of them may be kept until the next call.
+  virtual void encode(const float *interleaved, size_t frames, EncodedBytes &output) = 0;
+
+  /// @brief Appends the frames kept by encode and whatever the format needs at the end.
+  virtual void finish(EncodedBytes &output) = 0;
+
+  [[nodiscard]] int getNumberOfChannels() const noexcept {
+    return numberOfChannels_;
+  }
+
+  [[nodiscard]] float getSampleRate() const noexcept {
+    return sampleRate_;
+  }
+
+  [[nodiscard]] int getBitsPerSample() const noexcept {
+    return bitsPerSample_;
+  }
+
+  /// @brief Frames passed to encode so far.
+  [[nodiscard]] uint64_t getEncodedFrames() const noexcept {
+    return encodedFrames_;
+  }
+
+ protected:
+  LosslessEncoder(int numberOfChannels, float sampleRate, int bitsPerSample);
+
+  int numberOfChannels_;
+  float sampleRate_;
+  int bitsPerSample_;
+  uint64_t encodedFrames_ = 0;
+
+  /// @brief Converts a sample to a signed integer of bitsPerSample_ bits, clipping it.
+  [[nodiscard]] int32_t quantize(float sample) const noexcept;
+};
+
+} // namespace audioapi
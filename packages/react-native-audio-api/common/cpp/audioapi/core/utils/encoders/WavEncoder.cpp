@@ -0,0 +1,114 @@
+#include <audioapi/core/utils/encoders/WavEncoder.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace audioapi {
+
+namespace {
+
+constexpr uint16_t WAVE_FORMAT_PCM = 1;
+constexpr uint16_t WAVE_FORMAT_IEEE_FLOAT = 3;
+
+void appendTag(EncodedBytes &output, const char (&tag)[5]) {
+  output.insert(output.end(), tag, tag + 4);
+}
+
+void appendUInt16(EncodedBytes &output, uint16_t value) {
+  output.push_back(static_cast<uint8_t>(value));
+  output.push_back(static_cast<uint8_t>(value >> 8));
+}
+
+void appendUInt32(EncodedBytes &output, uint32_t value) {
+  appendUInt16(output, static_cast<uint16_t>(value));
+  appendUInt16(output, static_cast<uint16_t>(value >> 16));
+}
+
+int getSampleSize(WavEncoder::SampleFormat sampleFormat) {
+  switch (sampleFormat) {
+    case WavEncoder::SampleFormat::Int16:
+      return 16;
+    case WavEncoder::SampleFormat::Int24:
+      return 24;
+    default:
+      return 32;
+  }
+}
+
+} // namespace
+
+WavEncoder::WavEncoder(int numberOfChannels, float sampleRate, SampleFormat sampleFormat)
+    : LosslessEncoder(numberOfChannels, sampleRate, getSampleSize(sampleFormat)),
+      sampleFormat_(sampleFormat) {}
+
+void WavEncoder::writeHeader(EncodedBytes &output) const {
+  auto blockAlign = static_cast<uint16_t>(numberOfChannels_ * bitsPerSample_ / 8);
+  auto sampleRate = static_cast<uint32_t>(sampleRate_);
+  // sizes are capped, readers of files over 4 GB rely on the end of the file anyway
+  auto dataSize = static_cast<uint32_t>(std::min<uint64_t>(dataSize_, UINT32_MAX - kHeaderSize));
+  auto paddedDataSize = dataSize + (dataSize & 1);
+
+  appendTag(output, "RIFF");
+  appendUInt32(output, static_cast<uint32_t>(kHeaderSize - 8 + paddedDataSize));
+  appendTag(output, "WAVE");
+
+  appendTag(output, "fmt ");
+  appendUInt32(output, 16);
+  appendUInt16(
+      output,
+      sampleFormat_ == SampleFormat::Float32 ? WAVE_FORMAT_IEEE_FLOAT : WAVE_FORMAT_PCM);
+  appendUInt16(output, static_cast<uint16_t>(numberOfChannels_));
+  appendUInt32(output, sampleRate);
+  appendUInt32(output, sampleRate * blockAlign);
+  appendUInt16(output, blockAlign);
+  appendUInt16(output, static_cast<uint16_t>(bitsPerSample_));
+
+  appendTag(output, "data");
+  appendUInt32(output, dataSize);
+}
+
+void WavEncoder::encode(const float *interleaved, size_t frames, EncodedBytes &output) {
+  auto samples = frames * numberOfChannels_;
+  auto bytesPerSample = static_cast<size_t>(bitsPerSample_ / 8);
+  auto offset = output.size();
+  output.resize(offset + samples * bytesPerSample);
+  auto *destination = output.data() + offset;
+
+  switch (sampleFormat_) {
+    case SampleFormat::Int16:
+      for (size_t i = 0; i < samples; ++i) {
+        auto value = quantize(interleaved[i]);
+        destination[0] = static_cast<uint8_t>(value);
+        destination[1] = static_cast<uint8_t>(value >> 8);
+        destination += 2;
+      }
+      break;
+
+    case SampleFormat::Int24:
+      for (size_t i = 0; i < samples; ++i) {
+        auto value = quantize(interleaved[i]);
+        destination[0] = static_cast<uint8_t>(value);
+        destination[1] = static_cast<uint8_t>(value >> 8);
+        destination[2] = static_cast<uint8_t>(value >> 16);
+        destination += 3;
+      }
+      break;
+
+    case SampleFormat::Float32:
+      // every supported platform is little-endian
+      std::memcpy(destination, interleaved, samples * sizeof(float));
+      break;
+  }
+
+  dataSize_ += samples * bytesPerSample;
+  encodedFrames_ += frames;
+}
+
+void WavEncoder::finish(EncodedBytes &output) {
+  // RIFF chunks are word aligned
+  if (dataSize_ & 1) {
+    output.push_back(0);
+  }
+}
+
+} // namespace audioapi
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <audioapi/core/utils/encoders/LosslessEncoder.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace audioapi {
+
+/// @brief Writes little-endian PCM into a RIFF/WAVE file.
+class WavEncoder : public LosslessEncoder {
+ public:
+  enum class SampleFormat {
+    Int16,
+    Int24,
+    Float32,
+  };
+
+  static constexpr size_t kHeaderSize = 44;
+
+  WavEncoder(int numberOfChannels, float sampleRate, SampleFormat sampleFormat);
+
+  void writeHeader(EncodedBytes &output) const override;
+  void encode(const float *interleaved, size_t frames, EncodedBytes &output) override;
+  void finish(EncodedBytes &output) override;
+
+ private:
+  SampleFormat sampleFormat_;
+  uint64_t dataSize_ = 0;
+};
+
+} // namespace audioapi
@@ -0,0 +1,44 @@
+#include <audioapi/core/utils/worklets/WorkletBuffers.h>
+#include <audioapi/utils/AudioArrayBuffer.hpp>
+
+#include <memory>
+#include <utility>
+
+namespace audioapi {
+
+#if !RN_AUDIO_API_TEST
+WorkletBuffers::WorkletBuffers(
+    size_t size,
+    int numberOfChannels,
+    float sampleRate,
+    std::weak_ptr<worklets::WorkletRuntime> weakRuntime)
+    : buffer_(std::make_shared<AudioBuffer>(size, numberOfChannels, sampleRate)),
+      weakRuntime_(std::move(weakRuntime)) {}
+
+WorkletBuffers::~WorkletBuffers() {
+  if (weakRuntime_.expired()) {
+    // same as the worklet itself, see WorkletsRunner
+    static_cast<void>(jsArray_.release());
+  }
+}
+
+jsi::Array &WorkletBuffers::getJsArray(jsi::Runtime &runtime) {
+  if (jsArray_ != nullptr) {
+    return *jsArray_;
+  }
+
+  auto numberOfChannels = buffer_->getNumberOfChannels();
+  auto float32ArrayCtor = runtime.global().getPropertyAsFunction(runtime, "Float32Array");
+  jsArray_ = std::make_unique<jsi::Array>(runtime, numberOfChannels);
+
+  for (size_t i = 0; i < numberOfChannels; ++i) {
+    auto arrayBuffer = jsi::ArrayBuffer(runtime, buffer_->getSharedChannel(i));
+    auto channelData = float32ArrayCtor.callAsConstructor(runtime, arrayBuffer);
+    jsArray_->setValueAtIndex(runtime, i, channelData);
+  }
+
+  return *jsArray_;
+}
+#endif // RN_AUDIO_API_TEST
+
+} // namespace audioapi
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <audioapi/core/utils/worklets/SafeIncludes.h>
+#include <audioapi/utils/AudioBuffer.h>
+#include <jsi/jsi.h>
+
+#include <memory>
+
+namespace audioapi {
+using namespace facebook;
+
+#if !RN_AUDIO_API_TEST
+/// @brief Audio buffer shared with a worklet without copying.
+/// Its channels are wrapped in Float32Arrays on the first call, and the same JS array of them is
+/// passed to every later call, so a call allocates nothing on either side.
+/// @note The worklet has to copy the samples it keeps, the next call overwrites them.
+class WorkletBuffers {
+ public:
+  WorkletBuffers(
+      size_t size,
+      int numberOfChannels,
+      float sampleRate,
+      std::weak_ptr<worklets::WorkletRuntime> weakRuntime);
+
+  /// @brief Leaks the JS array if its runtime is already gone, it cannot be released then.
+  ~WorkletBuffers();
+
+  WorkletBuffers(const WorkletBuffers &) = delete;
+  WorkletBuffers &operator=(const WorkletBuffers &) = delete;
+
+  [[nodiscard]] const std::shared_ptr<AudioBuffer> &getBuffer() const {
+    return buffer_;
+  }
+
+  /// @return The JS array of Float32Arrays over the channels.
+  /// @note To be called on the runtime of the worklet.
+  jsi::Array &getJsArray(jsi::Runtime &runtime);
+
+ private:
+  std::shared_ptr<AudioBuffer> buffer_;
+  std::weak_ptr<worklets::WorkletRuntime> weakRuntime_;
+  std::unique_ptr<jsi::Array> jsArray_;
+};
+#endif // RN_AUDIO_API_TEST
+
+} // namespace audioapi
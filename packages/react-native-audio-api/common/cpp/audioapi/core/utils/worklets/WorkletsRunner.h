@@ -67,6 +67,11 @@ class WorkletsRunner {
       return executeOnRuntimeUnsafe(std::move(job));
   }
 
+  /// @return The runtime the worklet is called on, to tie the values created on it to its lifetime.
+  [[nodiscard]] std::weak_ptr<worklets::WorkletRuntime> getWeakRuntime() const {
+    return weakRuntime_;
+  }
+
  private:
   std::weak_ptr<worklets::WorkletRuntime> weakRuntime_;
   jsi::Runtime *unsafeRuntimePtr = nullptr;
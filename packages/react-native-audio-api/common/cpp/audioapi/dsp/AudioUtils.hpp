@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+#include <bit>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
@@ -36,4 +38,54 @@ namespace audioapi::dsp {
   return static_cast<float>(pow(10, value / 20));
 }
 
+[[nodiscard]] inline float int16ToFloat(int16_t sample) {
+  return static_cast<float>(sample) * (1.0f / INT16_MAX);
+}
+
+/// @brief Converts a sample to int16, clamping it to [-1, 1] and rounding to the nearest value.
+[[nodiscard]] inline int16_t floatToInt16(float sample) {
+  if (std::isnan(sample)) {
+    return 0;
+  }
+  return static_cast<int16_t>(std::lround(std::clamp(sample, -1.0f, 1.0f) * INT16_MAX));
+}
+
+/// @brief Converts IEEE 754 half precision bits to a float.
+/// @note Halves written by floatToFloat16 are never infinite or NaN, so those are not handled.
+[[nodiscard]] inline float float16ToFloat(uint16_t half) {
+  // shifting the exponent and mantissa in place and multiplying by 2^(127 - 15)
+  // rebiases the exponent, subnormal halves included
+  auto magnitude = std::bit_cast<float>(static_cast<uint32_t>(half & 0x7fffu) << 13) * 0x1.0p112f;
+  return std::bit_cast<float>(
+      std::bit_cast<uint32_t>(magnitude) | (static_cast<uint32_t>(half & 0x8000u) << 16));
+}
+
+/// @brief Converts a float to IEEE 754 half precision bits, rounding to nearest even.
+/// @note Values out of the half range saturate to the largest finite half and NaN becomes 0.
+[[nodiscard]] inline uint16_t floatToFloat16(float sample) {
+  static constexpr uint16_t kMaxHalf = 0x7bff;
+
+  auto bits = std::bit_cast<uint32_t>(sample);
+  auto sign = static_cast<uint16_t>((bits & 0x80000000u) >> 16);
+  bits &= 0x7fffffffu;
+
+  uint16_t half;
+  if (bits > 0x7f800000u) {
+    return 0;
+  } else if (bits >= 0x47800000u) {
+    half = kMaxHalf;
+  } else if (bits < 0x38800000u) {
+    // subnormal halves, adding 0.5 lets the FPU do the rounding
+    auto rounded = std::bit_cast<float>(bits) + 0.5f;
+    half = static_cast<uint16_t>(std::bit_cast<uint32_t>(rounded) - std::bit_cast<uint32_t>(0.5f));
+  } else {
+    uint32_t isMantissaOdd = (bits >> 13) & 1u;
+    // rebias the exponent and round the dropped mantissa bits
+    bits += (static_cast<uint32_t>(15 - 127) << 23) + 0xfffu + isMantissaOdd;
+    half = static_cast<uint16_t>(std::min(bits >> 13, static_cast<uint32_t>(kMaxHalf)));
+  }
+
+  return half | sign;
+}
+
 } // namespace audioapi::dsp
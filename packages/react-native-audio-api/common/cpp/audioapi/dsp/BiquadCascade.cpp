@@ -0,0 +1,514 @@
+#include <audioapi/dsp/BiquadCascade.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBuffer.h>
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <numbers>
+#include <utility>
+
+#if defined(HAVE_X86_SSE2)
+#include <emmintrin.h>
+#endif
+
+#if defined(HAVE_ARM_NEON_INTRINSICS)
+#include <arm_neon.h>
+#endif
+
+namespace audioapi::dsp {
+
+namespace {
+
+using Complex = std::complex<double>;
+using Polynomial = std::vector<double>;
+
+constexpr int kMaxRootIterations = 500;
+constexpr double kRootTolerance = 1e-14;
+constexpr double kConjugateTolerance = 1e-9;
+constexpr double kUnitRootTolerance = 1e-6;
+constexpr double kReconstructionTolerance = 1e-6;
+constexpr float kDenormalThreshold = 1e-15f;
+
+// Evaluates p(z) and p'(z) of a polynomial given in descending powers.
+std::pair<Complex, Complex> evaluateWithDerivative(const Polynomial &coefficients, Complex z) {
+  Complex value = 0.0;
+  Complex derivative = 0.0;
+  for (double coefficient : coefficients) {
+    derivative = derivative * z + value;
+    value = value * z + coefficient;
+  }
+  return {value, derivative};
+}
+
+// Aberth-Ehrlich iteration, coefficients are given in descending powers
+// and the leading and trailing coefficients must be non-zero.
+std::vector<Complex> findRoots(const Polynomial &coefficients) {
+  size_t degree = coefficients.size() - 1;
+  std::vector<Complex> roots(degree);
+
+  if (degree == 0) {
+    return roots;
+  }
+
+  if (degree == 1) {
+    roots[0] = -coefficients[1] / coefficients[0];
+    return roots;
+  }
+
+  double radius = std::pow(std::abs(coefficients.back() / coefficients.front()), 1.0 / degree);
+  for (size_t k = 0; k < degree; ++k) {
+    double angle = 2.0 * std::numbers::pi * static_cast<double>(k) / degree + 0.4;
+    roots[k] = std::polar(radius, angle);
+  }
+
+  for (int iteration = 0; iteration < kMaxRootIterations; ++iteration) {
+    double maxCorrection = 0.0;
+
+    for (size_t k = 0; k < degree; ++k) {
+      auto [value, derivative] = evaluateWithDerivative(coefficients, roots[k]);
+      if (value == 0.0) {
+        continue;
+      }
+
+      Complex ratio = value / derivative;
+      Complex repulsion = 0.0;
+      for (size_t j = 0; j < degree; ++j) {
+        if (j != k) {
+          repulsion += 1.0 / (roots[k] - roots[j]);
+        }
+      }
+
+      Complex correction = ratio / (1.0 - ratio * repulsion);
+      if (!std::isfinite(correction.real()) || !std::isfinite(correction.imag())) {
+        continue;
+      }
+
+      roots[k] -= correction;
+      maxCorrection =
+          std::max(maxCorrection, std::abs(correction) / std::max(1.0, std::abs(roots[k])));
+    }
+
+    if (maxCorrection < kRootTolerance) {
+      break;
+    }
+  }
+
+  return roots;
+}
+
+// Multiplies two polynomials given in ascending powers of z^-1.
+Polynomial multiply(const Polynomial &lhs, const Polynomial &rhs) {
+  Polynomial result(lhs.size() + rhs.size() - 1, 0.0);
+  for (size_t i = 0; i < lhs.size(); ++i) {
+    for (size_t j = 0; j < rhs.size(); ++j) {
+      result[i + j] += lhs[i] * rhs[j];
+    }
+  }
+  return result;
+}
+
+/// @brief Factor of a polynomial in z^-1 of at most second order.
+/// `radius` is the largest magnitude of its roots and `anchor` is the root used for pairing.
+struct Quadratic {
+  std::array<double, 3> coefficients = {1.0, 0.0, 0.0};
+  double radius = 0.0;
+  Complex anchor = 0.0;
+};
+
+// Groups roots into real quadratic factors (1 - r1 * z^-1)(1 - r2 * z^-1).
+std::vector<Quadratic> groupIntoQuadratics(std::vector<Complex> roots) {
+  std::vector<Quadratic> quadratics;
+  std::vector<double> realRoots;
+
+  std::sort(roots.begin(), roots.end(), [](const Complex &lhs, const Complex &rhs) {
+    return lhs.imag() > rhs.imag();
+  });
+
+  std::vector<bool> used(roots.size(), false);
+  for (size_t i = 0; i < roots.size(); ++i) {
+    if (used[i]) {
+      continue;
+    }
+    used[i] = true;
+
+    auto root = roots[i];
+    if (std::abs(root.imag()) <= kConjugateTolerance * std::max(1.0, std::abs(root))) {
+      realRoots.push_back(root.real());
+      continue;
+    }
+
+    // find the closest unused conjugate
+    size_t conjugateIndex = roots.size();
+    double bestDistance = 0.0;
+    for (size_t j = i + 1; j < roots.size(); ++j) {
+      double distance = std::abs(roots[j] - std::conj(root));
+      if (!used[j] && (conjugateIndex == roots.size() || distance < bestDistance)) {
+        conjugateIndex = j;
+        bestDistance = distance;
+      }
+    }
+
+    if (conjugateIndex == roots.size()) {
+      // unpaired complex root, keep only its real part and let the reconstruction check decide
+      realRoots.push_back(root.real());
+      continue;
+    }
+    used[conjugateIndex] = true;
+
+    auto averaged = Complex(
+        0.5 * (root.real() + roots[conjugateIndex].real()),
+        0.5 * (std::abs(root.imag()) + std::abs(roots[conjugateIndex].imag())));
+    Quadratic quadratic;
+    quadratic.coefficients = {1.0, -2.0 * averaged.real(), std::norm(averaged)};
+    quadratic.radius = std::abs(averaged);
+    quadratic.anchor = averaged;
+    quadratics.push_back(quadratic);
+  }
+
+  std::sort(realRoots.begin(), realRoots.end());
+  for (size_t i = 0; i < realRoots.size(); i += 2) {
+    Quadratic quadratic;
+    if (i + 1 < realRoots.size()) {
+      double r1 = realRoots[i];
+      double r2 = realRoots[i + 1];
+      quadratic.coefficients = {1.0, -(r1 + r2), r1 * r2};
+      quadratic.radius = std::max(std::abs(r1), std::abs(r2));
+      quadratic.anchor = std::abs(r1) > std::abs(r2) ? r1 : r2;
+    } else {
+      quadratic.coefficients = {1.0, -realRoots[i], 0.0};
+      quadratic.radius = std::abs(realRoots[i]);
+      quadratic.anchor = realRoots[i];
+    }
+    quadratics.push_back(quadratic);
+  }
+
+  return quadratics;
+}
+
+/// @brief Strips leading and trailing zeros of a polynomial in z^-1.
+/// @return The remaining coefficients (ascending powers of z^-1) and the number of
+/// leading zeros, which is a pure delay of the signal.
+std::pair<Polynomial, size_t> trim(const std::vector<float> &coefficients) {
+  size_t first = 0;
+  while (first < coefficients.size() && coefficients[first] == 0.0f) {
+    ++first;
+  }
+
+  size_t last = coefficients.size();
+  while (last > first && coefficients[last - 1] == 0.0f) {
+    --last;
+  }
+
+  return {Polynomial(coefficients.begin() + first, coefficients.begin() + last), first};
+}
+
+// Roots in z of b0 + b1 * z^-1 + ... + bN * z^-N are the roots of b0 * z^N + ... + bN,
+// so coefficients given in ascending powers of z^-1 are the descending powers of z.
+// Lowpass, highpass and bandpass designs place multiple zeros exactly at z = 1 or z = -1,
+// which iterative root finding resolves poorly, so they can be divided out first.
+std::vector<Quadratic> factor(Polynomial coefficients, bool divideUnitRoots) {
+  std::vector<Complex> roots;
+
+  // tolerance is relative to the original polynomial, as that is what the dropped
+  // remainders are eventually compared against
+  double magnitude = 0.0;
+  for (double coefficient : coefficients) {
+    magnitude += std::abs(coefficient);
+  }
+
+  for (double unitRoot : {1.0, -1.0}) {
+    while (divideUnitRoots && coefficients.size() > 1) {
+      if (std::abs(evaluateWithDerivative(coefficients, unitRoot).first) >
+          kUnitRootTolerance * magnitude) {
+        break;
+      }
+
+      // synthetic division by (z - unitRoot), the remainder is dropped
+      Polynomial quotient(coefficients.size() - 1);
+      quotient[0] = coefficients[0];
+      for (size_t k = 1; k < quotient.size(); ++k) {
+        quotient[k] = coefficients[k] + unitRoot * quotient[k - 1];
+      }
+
+      coefficients = std::move(quotient);
+      roots.emplace_back(unitRoot);
+    }
+  }
+
+  auto remaining = findRoots(coefficients);
+  roots.insert(roots.end(), remaining.begin(), remaining.end());
+
+  return groupIntoQuadratics(std::move(roots));
+}
+
+// Checks that gain * product of sections reproduces the normalized transfer function.
+bool reconstructs(
+    const std::vector<std::pair<Quadratic, Quadratic>> &sections,
+    double gain,
+    const std::vector<float> &feedforward,
+    const std::vector<float> &feedback) {
+  Polynomial numerator = {gain};
+  Polynomial denominator = {1.0};
+  for (const auto &[zeros, poles] : sections) {
+    numerator = multiply(
+        numerator, {zeros.coefficients[0], zeros.coefficients[1], zeros.coefficients[2]});
+    denominator = multiply(
+        denominator, {poles.coefficients[0], poles.coefficients[1], poles.coefficients[2]});
+  }
+
+  auto matches = [](const Polynomial &reconstructed, const std::vector<float> &expected) {
+    double scale = 0.0;
+    for (float value : expected) {
+      scale = std::max(scale, std::abs(static_cast<double>(value)));
+    }
+
+    for (size_t k = 0; k < std::max(reconstructed.size(), expected.size()); ++k) {
+      double lhs = k < reconstructed.size() ? reconstructed[k] : 0.0;
+      double rhs = k < expected.size() ? expected[k] : 0.0;
+      if (!std::isfinite(lhs) || std::abs(lhs - rhs) > kReconstructionTolerance * scale) {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  return matches(numerator, feedforward) && matches(denominator, feedback);
+}
+
+std::optional<std::vector<BiquadSection>> buildSections(
+    const Polynomial &numerator,
+    size_t delay,
+    const Polynomial &denominator,
+    const std::vector<float> &feedforward,
+    const std::vector<float> &feedback,
+    bool divideUnitRoots) {
+  double gain = numerator[0];
+  // unit roots are divided out only from zeros, poles close to z = 1 are common in
+  // lowpass designs and must not be snapped onto the unit circle
+  auto zeros = factor(numerator, divideUnitRoots);
+  auto poles = factor(denominator, false);
+
+  // pure delays are the only zero factors that do not start with 1
+  for (size_t i = 0; i < delay; ++i) {
+    auto shiftable = std::find_if(zeros.begin(), zeros.end(), [](const Quadratic &quadratic) {
+      return quadratic.coefficients[2] == 0.0;
+    });
+
+    if (shiftable == zeros.end()) {
+      zeros.push_back(Quadratic{.coefficients = {0.0, 1.0, 0.0}});
+    } else {
+      shiftable->coefficients = {0.0, shiftable->coefficients[0], shiftable->coefficients[1]};
+    }
+  }
+
+  size_t numberOfSections = std::max({zeros.size(), poles.size(), static_cast<size_t>(1)});
+  zeros.resize(numberOfSections);
+  poles.resize(numberOfSections);
+
+  // Pairs poles closest to the unit circle first, each with the nearest remaining zeros,
+  // and places them at the end of the cascade to limit the gain of intermediate stages.
+  std::sort(poles.begin(), poles.end(), [](const Quadratic &lhs, const Quadratic &rhs) {
+    return lhs.radius < rhs.radius;
+  });
+
+  std::vector<std::pair<Quadratic, Quadratic>> pairs(numberOfSections);
+  std::vector<bool> usedZeros(numberOfSections, false);
+  for (size_t p = numberOfSections; p-- > 0;) {
+    size_t best = numberOfSections;
+    double bestDistance = 0.0;
+    for (size_t z = 0; z < numberOfSections; ++z) {
+      if (usedZeros[z]) {
+        continue;
+      }
+      double distance = std::abs(zeros[z].anchor - poles[p].anchor);
+      if (best == numberOfSections || distance < bestDistance) {
+        best = z;
+        bestDistance = distance;
+      }
+    }
+    usedZeros[best] = true;
+    pairs[p] = {zeros[best], poles[p]};
+  }
+
+  if (!reconstructs(pairs, gain, feedforward, feedback)) {
+    return std::nullopt;
+  }
+
+  // the overall gain is applied by the first section
+  std::vector<BiquadSection> sections(numberOfSections);
+  for (size_t i = 0; i < numberOfSections; ++i) {
+    const auto &[zeroFactor, poleFactor] = pairs[i];
+    double scale = i == 0 ? gain : 1.0;
+    sections[i].b0 = static_cast<float>(scale * zeroFactor.coefficients[0]);
+    sections[i].b1 = static_cast<float>(scale * zeroFactor.coefficients[1]);
+    sections[i].b2 = static_cast<float>(scale * zeroFactor.coefficients[2]);
+    sections[i].a1 = static_cast<float>(poleFactor.coefficients[1]);
+    sections[i].a2 = static_cast<float>(poleFactor.coefficients[2]);
+  }
+
+  return sections;
+}
+
+} // namespace
+
+std::optional<std::vector<BiquadSection>> factorIntoSecondOrderSections(
+    const std::vector<float> &feedforward,
+    const std::vector<float> &feedback) {
+  if (feedback.empty() || feedback[0] == 0.0f || feedforward.empty()) {
+    return std::nullopt;
+  }
+
+  std::vector<float> normalizedFeedforward(feedforward);
+  std::vector<float> normalizedFeedback(feedback);
+  for (auto &value : normalizedFeedforward) {
+    value /= feedback[0];
+  }
+  for (auto &value : normalizedFeedback) {
+    value /= feedback[0];
+  }
+
+  auto [numerator, delay] = trim(normalizedFeedforward);
+  auto denominator = trim(normalizedFeedback).first;
+
+  if (numerator.empty()) {
+    return std::nullopt;
+  }
+
+  auto sections = buildSections(
+      numerator, delay, denominator, normalizedFeedforward, normalizedFeedback, true);
+  if (!sections) {
+    sections = buildSections(
+        numerator, delay, denominator, normalizedFeedforward, normalizedFeedback, false);
+  }
+
+  return sections;
+}
+
+BiquadCascade::BiquadCascade(std::vector<BiquadSection> sections, size_t maxChannels)
+    : sections_(std::move(sections)),
+      state_(((maxChannels + kLanes - 1) / kLanes) * sections_.size()) {}
+
+void BiquadCascade::reset() {
+  std::fill(state_.begin(), state_.end(), SectionState{});
+}
+
+void BiquadCascade::process(AudioBuffer &buffer, size_t numberOfChannels, size_t framesToProcess) {
+  size_t numberOfGroups = std::min(
+      (numberOfChannels + kLanes - 1) / kLanes,
+      sections_.empty() ? 0 : state_.size() / sections_.size());
+
+  for (size_t offset = 0; offset < framesToProcess; offset += RENDER_QUANTUM_SIZE) {
+    size_t frames = std::min(framesToProcess - offset, static_cast<size_t>(RENDER_QUANTUM_SIZE));
+
+    for (size_t group = 0; group < numberOfGroups; ++group) {
+      size_t firstChannel = group * kLanes;
+      size_t lanes = std::min(kLanes, numberOfChannels - firstChannel);
+
+      // interleave channels of the group, unused lanes are filled with silence
+      for (size_t lane = 0; lane < kLanes; ++lane) {
+        if (lane < lanes) {
+          const float *source = buffer.getChannel(firstChannel + lane)->begin() + offset;
+          for (size_t i = 0; i < frames; ++i) {
+            scratch_[i * kLanes + lane] = source[i];
+          }
+        } else {
+          for (size_t i = 0; i < frames; ++i) {
+            scratch_[i * kLanes + lane] = 0.0f;
+          }
+        }
+      }
+
+      auto *state = state_.data() + group * sections_.size();
+      for (size_t s = 0; s < sections_.size(); ++s) {
+        processSection(sections_[s], state[s], frames);
+      }
+
+      for (size_t lane = 0; lane < lanes; ++lane) {
+        float *destination = buffer.getChannel(firstChannel + lane)->begin() + offset;
+        for (size_t i = 0; i < frames; ++i) {
+          destination[i] = scratch_[i * kLanes + lane];
+        }
+      }
+    }
+  }
+}
+
+// Transposed direct form II, one channel per lane:
+// y[n] = b0 * x[n] + z1
+// z1 = b1 * x[n] - a1 * y[n] + z2
+// z2 = b2 * x[n] - a2 * y[n]
+void BiquadCascade::processSection(
+    const BiquadSection &section,
+    SectionState &state,
+    size_t framesToProcess) {
+  float *samples = scratch_.data();
+
+#if defined(HAVE_X86_SSE2)
+  const __m128 b0 = _mm_set1_ps(section.b0);
+  const __m128 b1 = _mm_set1_ps(section.b1);
+  const __m128 b2 = _mm_set1_ps(section.b2);
+  const __m128 a1 = _mm_set1_ps(section.a1);
+  const __m128 a2 = _mm_set1_ps(section.a2);
+  __m128 z1 = _mm_loadu_ps(state.z1.data());
+  __m128 z2 = _mm_loadu_ps(state.z2.data());
+
+  for (size_t i = 0; i < framesToProcess; ++i, samples += kLanes) {
+    __m128 x = _mm_load_ps(samples);
+    __m128 y = _mm_add_ps(_mm_mul_ps(b0, x), z1);
+    z1 = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(b1, x), _mm_mul_ps(a1, y)), z2);
+    z2 = _mm_sub_ps(_mm_mul_ps(b2, x), _mm_mul_ps(a2, y));
+    _mm_store_ps(samples, y);
+  }
+
+  _mm_storeu_ps(state.z1.data(), z1);
+  _mm_storeu_ps(state.z2.data(), z2);
+#elif defined(HAVE_ARM_NEON_INTRINSICS)
+  const float32x4_t b0 = vdupq_n_f32(section.b0);
+  const float32x4_t b1 = vdupq_n_f32(section.b1);
+  const float32x4_t b2 = vdupq_n_f32(section.b2);
+  const float32x4_t a1 = vdupq_n_f32(section.a1);
+  const float32x4_t a2 = vdupq_n_f32(section.a2);
+  float32x4_t z1 = vld1q_f32(state.z1.data());
+  float32x4_t z2 = vld1q_f32(state.z2.data());
+
+  for (size_t i = 0; i < framesToProcess; ++i, samples += kLanes) {
+    float32x4_t x = vld1q_f32(samples);
+    float32x4_t y = vmlaq_f32(z1, b0, x);
+    z1 = vmlsq_f32(vmlaq_f32(z2, b1, x), a1, y);
+    z2 = vmlsq_f32(vmulq_f32(b2, x), a2, y);
+    vst1q_f32(samples, y);
+  }
+
+  vst1q_f32(state.z1.data(), z1);
+  vst1q_f32(state.z2.data(), z2);
+#else
+  auto z1 = state.z1;
+  auto z2 = state.z2;
+
+  for (size_t i = 0; i < framesToProcess; ++i, samples += kLanes) {
+    for (size_t lane = 0; lane < kLanes; ++lane) {
+      float x = samples[lane];
+      float y = section.b0 * x + z1[lane];
+      z1[lane] = section.b1 * x - section.a1 * y + z2[lane];
+      z2[lane] = section.b2 * x - section.a2 * y;
+      samples[lane] = y;
+    }
+  }
+
+  state.z1 = z1;
+  state.z2 = z2;
+#endif
+
+  // Avoid denormalized numbers
+  for (size_t lane = 0; lane < kLanes; ++lane) {
+    if (std::abs(state.z1[lane]) < kDenormalThreshold) {
+      state.z1[lane] = 0.0f;
+    }
+    if (std::abs(state.z2[lane]) < kDenormalThreshold) {
+      state.z2[lane] = 0.0f;
+    }
+  }
+}
+
+} // namespace audioapi::dsp
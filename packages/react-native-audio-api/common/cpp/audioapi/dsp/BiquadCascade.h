@@ -0,0 +1,70 @@
+#pragma once
+
+#include <audioapi/core/utils/Constants.h>
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+namespace audioapi {
+
+class AudioBuffer;
+
+namespace dsp {
+
+/// @brief Coefficients of a single second-order section with a0 normalized to 1.
+/// H(z) = (b0 + b1 * z^-1 + b2 * z^-2) / (1 + a1 * z^-1 + a2 * z^-2)
+struct BiquadSection {
+  float b0 = 1.0f;
+  float b1 = 0.0f;
+  float b2 = 0.0f;
+  float a1 = 0.0f;
+  float a2 = 0.0f;
+};
+
+/// @brief Factors a direct-form transfer function into cascaded second-order sections.
+/// @param feedforward Numerator coefficients b[k] of z^-k.
+/// @param feedback Denominator coefficients a[k] of z^-k, a[0] must be non-zero.
+/// @return Sections whose product reproduces the transfer function or nullopt
+/// if the polynomials could not be factored accurately enough.
+/// @note Conjugate roots are paired into real sections, each pole pair is matched with
+/// its nearest zeros and sections are ordered by increasing pole radius.
+std::optional<std::vector<BiquadSection>> factorIntoSecondOrderSections(
+    const std::vector<float> &feedforward,
+    const std::vector<float> &feedback);
+
+/// @brief Runs a cascade of second-order sections over all channels of a buffer.
+/// Channels are processed in groups of kLanes, each channel occupying one SIMD lane,
+/// so that the recursion over time is vectorized across channels.
+/// @note Not thread-safe, state is kept per channel between calls.
+class BiquadCascade {
+ public:
+  static constexpr size_t kLanes = 4;
+
+  BiquadCascade(std::vector<BiquadSection> sections, size_t maxChannels);
+
+  void process(AudioBuffer &buffer, size_t numberOfChannels, size_t framesToProcess);
+  void reset();
+
+  [[nodiscard]] size_t getNumberOfSections() const noexcept {
+    return sections_.size();
+  }
+
+ private:
+  struct alignas(16) SectionState {
+    std::array<float, kLanes> z1{};
+    std::array<float, kLanes> z2{};
+  };
+
+  std::vector<BiquadSection> sections_;
+  // state_[group * sections_.size() + section]
+  std::vector<SectionState> state_;
+  // interleaved scratch holding kLanes channels, frame by frame
+  alignas(16) std::array<float, RENDER_QUANTUM_SIZE * kLanes> scratch_{};
+
+  void processSection(const BiquadSection &section, SectionState &state, size_t framesToProcess);
+};
+
+} // namespace dsp
+} // namespace audioapi
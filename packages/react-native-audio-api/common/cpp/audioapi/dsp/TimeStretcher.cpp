@@ -0,0 +1,245 @@
+#include <audioapi/dsp/TimeStretcher.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+// Float port of the "fast" mode of audio-stretch by David Bryant (BSD license),
+// see audioapi/libs/audio-stretch for the original 16-bit implementation.
+
+namespace audioapi::dsp {
+
+namespace {
+
+// correlation reported for a perfect match, larger than any finite ratio of sums
+constexpr float kMaxCorrelation = 1e30f;
+// number of longest periods buffered, history plus three periods of look-ahead
+constexpr size_t kBufferedPeriods = 4;
+
+} // namespace
+
+TimeStretcher::TimeStretcher(int shortestPeriod, int longestPeriod, size_t numberOfChannels)
+    : numberOfChannels_(numberOfChannels),
+      // the period is searched at half resolution, so both bounds have to be even
+      shortest_(static_cast<size_t>(shortestPeriod) & ~static_cast<size_t>(1)),
+      longest_((static_cast<size_t>(longestPeriod) + 1) & ~static_cast<size_t>(1)),
+      capacity_(longest_ * kBufferedPeriods),
+      input_(numberOfChannels, std::vector<float>(capacity_, 0.0f)),
+      head_(longest_),
+      tail_(longest_),
+      analysis_(longest_, 0.0f),
+      correlations_(longest_ / 2 + 1, 0.0f) {}
+
+size_t TimeStretcher::getOutputCapacity(size_t maxInputFrames, float ratio) const {
+  ratio = std::clamp(ratio, kMinRatio, kMaxRatio);
+  return static_cast<size_t>(
+             std::ceil(static_cast<double>(maxInputFrames) * std::ceil(ratio * 2.0) / 2.0)) +
+      capacity_;
+}
+
+void TimeStretcher::reset() {
+  head_ = tail_ = longest_;
+  outputError_ = 0.0;
+  for (auto &channel : input_) {
+    std::fill(channel.begin(), channel.end(), 0.0f);
+  }
+}
+
+size_t TimeStretcher::process(
+    const float *const *input,
+    size_t inputOffset,
+    size_t framesToProcess,
+    float *const *output,
+    float ratio) {
+  ratio = std::clamp(ratio, kMinRatio, kMaxRatio);
+  size_t outputFrames = 0;
+
+  while (framesToProcess > 0) {
+    size_t framesToCopy = std::min(framesToProcess, capacity_ - head_);
+    for (size_t channel = 0; channel < numberOfChannels_; ++channel) {
+      std::memcpy(
+          input_[channel].data() + head_,
+          input[channel] + inputOffset,
+          framesToCopy * sizeof(float));
+    }
+    framesToProcess -= framesToCopy;
+    inputOffset += framesToCopy;
+    head_ += framesToCopy;
+
+    // each step needs one period of history and three periods of look-ahead
+    while (tail_ >= longest_ && head_ - tail_ >= longest_ * 3) {
+      size_t period = (ratio != 1.0f || outputError_ != 0.0) ? findPeriod() : longest_;
+
+      // Whole periods are copied (1:1), cross-faded into one (2:1), repeated with a
+      // cross-fade (1:2) or a mix of both (2:3). The error term picks the transformation
+      // that brings the output length closest to the requested ratio.
+      float processRatio;
+      if (outputError_ == 0.0) {
+        processRatio = std::floor(ratio * 2.0f + 0.5f) / 2.0f;
+      } else if (outputError_ > 0.0) {
+        processRatio = std::floor(ratio * 2.0f) / 2.0f;
+      } else {
+        processRatio = std::ceil(ratio * 2.0f) / 2.0f;
+      }
+
+      for (size_t channel = 0; channel < numberOfChannels_; ++channel) {
+        const float *source = input_[channel].data() + tail_;
+        float *destination = output[channel] + outputFrames;
+
+        if (processRatio == 0.5f) {
+          mergeBlocks(destination, source, source + period, period);
+        } else if (processRatio == 1.0f) {
+          std::memcpy(destination, source, period * 2 * sizeof(float));
+        } else if (processRatio == 1.5f) {
+          std::memcpy(destination, source, period * sizeof(float));
+          mergeBlocks(destination + period, source + period, source, period);
+          std::memcpy(destination + period * 2, source + period, period * sizeof(float));
+        } else {
+          mergeBlocks(destination, source, source - period, period * 2);
+          mergeBlocks(destination + period * 2, source + period, source, period * 2);
+        }
+      }
+
+      if (processRatio == 0.5f) {
+        outputError_ += static_cast<double>(period) - period * 2.0 * ratio;
+        outputFrames += period;
+      } else if (processRatio == 1.0f) {
+        // with a ratio of exactly 1 the error can never be cancelled, so it is dropped
+        outputError_ = ratio != 1.0f ? outputError_ + period * 2.0 - period * 2.0 * ratio : 0.0;
+        outputFrames += period * 2;
+      } else if (processRatio == 1.5f) {
+        outputError_ += period * 3.0 - period * 2.0 * ratio;
+        outputFrames += period * 3;
+      } else {
+        outputError_ += 2.0 * (period * 2.0 - period * ratio);
+        outputFrames += period * 4;
+      }
+      tail_ += period * 2;
+
+      discardProcessedFrames();
+    }
+  }
+
+  // nothing to compensate for, pending frames can be passed through right away
+  if (ratio == 1.0f && outputError_ == 0.0 && head_ != tail_) {
+    size_t pendingFrames = head_ - tail_;
+    for (size_t channel = 0; channel < numberOfChannels_; ++channel) {
+      std::memcpy(
+          output[channel] + outputFrames,
+          input_[channel].data() + tail_,
+          pendingFrames * sizeof(float));
+    }
+    outputFrames += pendingFrames;
+    tail_ = head_;
+    discardProcessedFrames();
+  }
+
+  return outputFrames;
+}
+
+size_t TimeStretcher::flush(float *const *output) {
+  size_t pendingFrames = head_ - tail_;
+
+  for (size_t channel = 0; channel < numberOfChannels_; ++channel) {
+    std::memcpy(output[channel], input_[channel].data() + tail_, pendingFrames * sizeof(float));
+  }
+
+  reset();
+  return pendingFrames;
+}
+
+size_t TimeStretcher::findPeriod() {
+  // average all channels and pairs of frames into the analysis buffer
+  float scale = 1.0f / static_cast<float>(numberOfChannels_ * 2);
+  float total = 0.0f;
+  for (size_t i = 0; i < longest_; ++i) {
+    float sample = 0.0f;
+    for (size_t channel = 0; channel < numberOfChannels_; ++channel) {
+      const float *source = input_[channel].data() + tail_ + i * 2;
+      sample += source[0] + source[1];
+    }
+    analysis_[i] = sample * scale;
+    total += std::abs(analysis_[i]);
+  }
+
+  if (total == 0.0f) {
+    return longest_;
+  }
+
+  // Picks the period maximizing the sum of magnitudes of two consecutive blocks divided by
+  // the sum of their absolute differences. The numerator is accumulated across periods.
+  size_t period = shortest_ / 2;
+  size_t bestPeriod = period;
+  float bestCorrelation = 0.0f;
+  float sum = 0.0f;
+  for (size_t i = 0; i < period; ++i) {
+    sum += std::abs(analysis_[i]) + std::abs(analysis_[i + period]);
+  }
+
+  while (true) {
+    float difference = 0.0f;
+    for (size_t i = 0; i < period; ++i) {
+      difference += std::abs(analysis_[i] - analysis_[i + period]);
+    }
+
+    correlations_[period] = difference > 0.0f ? sum / difference : kMaxCorrelation;
+    if (correlations_[period] >= bestCorrelation) {
+      bestCorrelation = correlations_[period];
+      bestPeriod = period;
+    }
+
+    if (period * 2 == longest_) {
+      break;
+    }
+
+    sum += std::abs(analysis_[period * 2]) + std::abs(analysis_[period * 2 + 1]);
+    ++period;
+  }
+
+  // refine to full resolution by comparing correlations on both sides of the peak
+  if (bestPeriod * 2 == shortest_ || bestPeriod * 2 == longest_) {
+    return bestPeriod * 2;
+  }
+
+  float highSideDifference = correlations_[bestPeriod] - correlations_[bestPeriod + 1];
+  float lowSideDifference = correlations_[bestPeriod] - correlations_[bestPeriod - 1];
+  if (lowSideDifference / 2.0f > highSideDifference) {
+    return bestPeriod * 2 + 1;
+  }
+  if (highSideDifference / 2.0f > lowSideDifference) {
+    return bestPeriod * 2 - 1;
+  }
+  return bestPeriod * 2;
+}
+
+void TimeStretcher::mergeBlocks(
+    float *output,
+    const float *first,
+    const float *second,
+    size_t frames) const {
+  // linear cross-fade, so the merged block blends with the blocks around it
+  float step = 1.0f / static_cast<float>(frames);
+  for (size_t i = 0; i < frames; ++i) {
+    float weight = static_cast<float>(i) * step;
+    output[i] = first[i] + (second[i] - first[i]) * weight;
+  }
+}
+
+void TimeStretcher::discardProcessedFrames() {
+  // keep one longest period of history in front of the pending frames
+  size_t discardedFrames = tail_ - longest_;
+  if (discardedFrames == 0) {
+    return;
+  }
+
+  for (auto &channel : input_) {
+    std::memmove(
+        channel.data(),
+        channel.data() + discardedFrames,
+        (head_ - discardedFrames) * sizeof(float));
+  }
+  head_ -= discardedFrames;
+  tail_ = longest_;
+}
+
+} // namespace audioapi::dsp
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace audioapi::dsp {
+
+/// @brief Time domain harmonic scaler working on planar float audio.
+/// Changes the duration of a signal by 0.5x to 2x without altering its pitch, by detecting
+/// the pitch period and dropping, repeating or cross-fading whole periods.
+/// @note The period is detected on the average of all channels and the same transformation
+/// is applied to every channel, so channels stay sample-aligned.
+/// @note Input is buffered internally, at most four longest periods per channel.
+/// @note Not thread-safe.
+class TimeStretcher {
+ public:
+  static constexpr float kMinRatio = 0.5f;
+  static constexpr float kMaxRatio = 2.0f;
+
+  /// @param shortestPeriod Shortest detectable pitch period in frames.
+  /// @param longestPeriod Longest detectable pitch period in frames, bounds the latency.
+  /// @param numberOfChannels Number of channels of the processed signal.
+  TimeStretcher(int shortestPeriod, int longestPeriod, size_t numberOfChannels);
+
+  /// @brief Maximum number of frames a single process or flush call can produce.
+  /// @param maxInputFrames Maximum number of frames passed to a single process call.
+  /// @param ratio Maximum ratio passed to process.
+  [[nodiscard]] size_t getOutputCapacity(size_t maxInputFrames, float ratio) const;
+
+  /// @brief Stretches the given frames, buffering whatever can not be processed yet.
+  /// @param input Pointers to numberOfChannels planar input channels.
+  /// @param inputOffset Index of the first frame to read from each input channel.
+  /// @param framesToProcess Number of frames to read.
+  /// @param output Pointers to numberOfChannels planar output channels,
+  /// each with room for getOutputCapacity frames.
+  /// @param ratio Output duration divided by input duration, clamped to [kMinRatio, kMaxRatio].
+  /// @return Number of frames written to each output channel.
+  size_t process(
+      const float *const *input,
+      size_t inputOffset,
+      size_t framesToProcess,
+      float *const *output,
+      float ratio);
+
+  /// @brief Writes out buffered frames at normal speed.
+  /// @return Number of frames written to each output channel.
+  size_t flush(float *const *output);
+
+  void reset();
+
+ private:
+  size_t numberOfChannels_;
+  size_t shortest_;
+  size_t longest_;
+  size_t capacity_;
+  // [ ONE LONGEST PERIOD OF HISTORY | PENDING FRAMES ]
+  std::vector<std::vector<float>> input_;
+  size_t head_;
+  size_t tail_;
+  // output frames produced minus output frames expected by the ratio
+  double outputError_ = 0.0;
+
+  // scratch for period detection, 2:1 decimated average of all channels
+  std::vector<float> analysis_;
+  std::vector<float> correlations_;
+
+  [[nodiscard]] size_t findPeriod();
+  void mergeBlocks(float *output, const float *first, const float *second, size_t frames) const;
+  void discardProcessedFrames();
+};
+
+} // namespace audioapi::dsp
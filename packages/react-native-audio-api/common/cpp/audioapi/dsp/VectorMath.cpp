@@ -817,4 +817,89 @@ void interleaveStereo(
 
 #endif
 
+void convertInt16ToFloat(
+    const int16_t *inputVector,
+    float *outputVector,
+    size_t numberOfElementsToProcess) {
+#if defined(HAVE_ACCELERATE)
+  vDSP_vflt16(inputVector, 1, outputVector, 1, numberOfElementsToProcess);
+  float scale = 1.0f / INT16_MAX;
+  vDSP_vsmul(outputVector, 1, &scale, outputVector, 1, numberOfElementsToProcess);
+#else
+  size_t k = 0;
+
+#if defined(HAVE_ARM_NEON_INTRINSICS)
+  const float32x4_t scale = vdupq_n_f32(1.0f / INT16_MAX);
+  for (; k + 8 <= numberOfElementsToProcess; k += 8) {
+    int16x8_t samples = vld1q_s16(inputVector + k);
+    float32x4_t low = vcvtq_f32_s32(vmovl_s16(vget_low_s16(samples)));
+    float32x4_t high = vcvtq_f32_s32(vmovl_s16(vget_high_s16(samples)));
+    vst1q_f32(outputVector + k, vmulq_f32(low, scale));
+    vst1q_f32(outputVector + k + 4, vmulq_f32(high, scale));
+  }
+#elif defined(HAVE_X86_SSE2)
+  const __m128 scale = _mm_set1_ps(1.0f / INT16_MAX);
+  for (; k + 8 <= numberOfElementsToProcess; k += 8) {
+    __m128i samples = _mm_loadu_si128(reinterpret_cast<const __m128i *>(inputVector + k));
+    // unpacking a sample into both halves and shifting it back down extends the sign
+    __m128i low = _mm_srai_epi32(_mm_unpacklo_epi16(samples, samples), 16);
+    __m128i high = _mm_srai_epi32(_mm_unpackhi_epi16(samples, samples), 16);
+    _mm_storeu_ps(outputVector + k, _mm_mul_ps(_mm_cvtepi32_ps(low), scale));
+    _mm_storeu_ps(outputVector + k + 4, _mm_mul_ps(_mm_cvtepi32_ps(high), scale));
+  }
+#endif
+
+  for (; k < numberOfElementsToProcess; ++k) {
+    outputVector[k] = int16ToFloat(inputVector[k]);
+  }
+#endif
+}
+
+void convertFloat16ToFloat(
+    const uint16_t *inputVector,
+    float *outputVector,
+    size_t numberOfElementsToProcess) {
+#if defined(HAVE_ACCELERATE)
+  vImage_Buffer source = {
+      const_cast<uint16_t *>(inputVector),
+      1,
+      numberOfElementsToProcess,
+      numberOfElementsToProcess * sizeof(uint16_t)};
+  vImage_Buffer destination = {
+      outputVector, 1, numberOfElementsToProcess, numberOfElementsToProcess * sizeof(float)};
+  vImageConvert_Planar16FtoPlanarF(&source, &destination, kvImageNoFlags);
+#else
+  size_t k = 0;
+
+#if defined(HAVE_ARM_NEON_INTRINSICS) && defined(__aarch64__)
+  for (; k + 4 <= numberOfElementsToProcess; k += 4) {
+    float16x4_t halves = vreinterpret_f16_u16(vld1_u16(inputVector + k));
+    vst1q_f32(outputVector + k, vcvt_f32_f16(halves));
+  }
+#elif defined(HAVE_X86_SSE2)
+  const __m128i magnitudeMask = _mm_set1_epi32(0x7fff);
+  const __m128 exponentScale = _mm_set1_ps(0x1.0p112f);
+  const __m128i zero = _mm_setzero_si128();
+
+  // same bit manipulation as float16ToFloat, 4 samples at a time
+  auto convert = [&](__m128i halves) {
+    __m128i magnitude = _mm_slli_epi32(_mm_and_si128(halves, magnitudeMask), 13);
+    __m128i sign = _mm_slli_epi32(_mm_andnot_si128(magnitudeMask, halves), 16);
+    __m128 result = _mm_mul_ps(_mm_castsi128_ps(magnitude), exponentScale);
+    return _mm_or_ps(result, _mm_castsi128_ps(sign));
+  };
+
+  for (; k + 8 <= numberOfElementsToProcess; k += 8) {
+    __m128i halves = _mm_loadu_si128(reinterpret_cast<const __m128i *>(inputVector + k));
+    _mm_storeu_ps(outputVector + k, convert(_mm_unpacklo_epi16(halves, zero)));
+    _mm_storeu_ps(outputVector + k + 4, convert(_mm_unpackhi_epi16(halves, zero)));
+  }
+#endif
+
+  for (; k < numberOfElementsToProcess; ++k) {
+    outputVector[k] = float16ToFloat(inputVector[k]);
+  }
+#endif
+}
+
 } // namespace audioapi::dsp
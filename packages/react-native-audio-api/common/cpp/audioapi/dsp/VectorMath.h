@@ -31,6 +31,7 @@
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 
 namespace audioapi::dsp {
 
@@ -83,4 +84,16 @@ void deinterleaveStereo(
     float *outputRight,
     size_t numberOfFrames);
 
+// Converts int16 samples to floats in [-1, 1], as int16ToFloat does.
+void convertInt16ToFloat(
+    const int16_t *inputVector,
+    float *outputVector,
+    size_t numberOfElementsToProcess);
+
+// Converts IEEE 754 half precision samples to floats, as float16ToFloat does.
+void convertFloat16ToFloat(
+    const uint16_t *inputVector,
+    float *outputVector,
+    size_t numberOfElementsToProcess);
+
 } // namespace audioapi::dsp
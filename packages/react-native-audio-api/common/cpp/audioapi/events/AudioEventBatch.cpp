@@ -0,0 +1,30 @@
+#include <audioapi/events/AudioEventBatch.h>
+
+namespace audioapi {
+
+bool AudioEventBatch::add(const AudioEventRecord &record) {
+  if (!isCoalesced(record.event)) {
+    records_.push_back(record);
+    return false;
+  }
+
+  auto [it, isInserted] = coalescedIndices_.try_emplace(record.listenerId, records_.size());
+  records_.push_back(record);
+  if (isInserted) {
+    return false;
+  }
+
+  // the earlier event is only marked, so the order of the remaining ones is kept
+  records_[it->second].listenerId = kReplacedListenerId;
+  it->second = records_.size() - 1;
+  replacedCount_++;
+  return true;
+}
+
+void AudioEventBatch::clear() noexcept {
+  records_.clear();
+  coalescedIndices_.clear();
+  replacedCount_ = 0;
+}
+
+} // namespace audioapi
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <audioapi/events/AudioEvent.h>
+#include <audioapi/events/AudioEventRecord.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace audioapi {
+
+struct AudioEventCounters {
+  /// Events passed to a handler.
+  uint64_t dispatched = 0;
+  /// Events replaced by a later event of the same listener before being dispatched.
+  uint64_t coalesced = 0;
+};
+
+/// @brief Events drained from the event queues in one JS frame, in order.
+/// An event of a coalesced type replaces the earlier event of its listener,
+/// so e.g. only the latest position is delivered, after the events that preceded it.
+/// @note Not thread safe, meant to be reused by the consumer thread.
+class AudioEventBatch {
+ public:
+  [[nodiscard]] static constexpr bool isCoalesced(AudioEvent event) noexcept {
+    return event == AudioEvent::POSITION_CHANGED;
+  }
+
+  /// @return true if the record replaced an earlier event of its listener.
+  bool add(const AudioEventRecord &record);
+
+  /// @brief Passes every event that was not replaced to the callback, in order.
+  template <typename F>
+  void forEach(F &&callback) const {
+    for (const auto &record : records_) {
+      if (record.listenerId != kReplacedListenerId) {
+        callback(record);
+      }
+    }
+  }
+
+  /// @brief Removes the events, keeping the memory for the next frame.
+  void clear() noexcept;
+
+  [[nodiscard]] size_t size() const noexcept {
+    return records_.size() - replacedCount_;
+  }
+
+ private:
+  // registry listener ids start at 1
+  static constexpr uint64_t kReplacedListenerId = 0;
+
+  std::vector<AudioEventRecord> records_;
+  // listener id, unique across events -> index of its latest event of a coalesced type
+  std::unordered_map<uint64_t, size_t> coalescedIndices_;
+  size_t replacedCount_ = 0;
+};
+
+} // namespace audioapi
@@ -1,8 +1,12 @@
 #include <audioapi/HostObjects/sources/AudioBufferHostObject.h>
 #include <audioapi/events/AudioEventHandlerRegistry.h>
+#include <algorithm>
+#include <exception>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
+#include <utility>
 
 namespace audioapi {
 
@@ -12,12 +16,36 @@ AudioEventHandlerRegistry::AudioEventHandlerRegistry(
     : IAudioEventHandlerRegistry(), callInvoker_(callInvoker), runtime_(runtime) {}
 
 AudioEventHandlerRegistry::~AudioEventHandlerRegistry() {
+  {
+    std::lock_guard lock(eventQueuesMutex_);
+    isDrainThreadStopped_ = true;
+  }
+  eventQueuesCondition_.notify_all();
+  isDrainThreadWaiting_->store(false, std::memory_order_release);
+  isDrainThreadWaiting_->notify_all();
+  if (drainThread_.joinable()) {
+    drainThread_.join();
+  }
+
   eventHandlers_.clear();
 }
 
 uint64_t AudioEventHandlerRegistry::registerHandler(
     AudioEvent eventName,
     const std::shared_ptr<jsi::Function> &handler) {
+  return registerHandler(eventName, handler, false);
+}
+
+uint64_t AudioEventHandlerRegistry::registerBatchHandler(
+    AudioEvent eventName,
+    const std::shared_ptr<jsi::Function> &handler) {
+  return registerHandler(eventName, handler, true);
+}
+
+uint64_t AudioEventHandlerRegistry::registerHandler(
+    AudioEvent eventName,
+    const std::shared_ptr<jsi::Function> &handler,
+    bool isBatched) {
   auto listenerId = listenerIdCounter_.fetch_add(1, std::memory_order_relaxed);
 
   if (callInvoker_ == nullptr || runtime_ == nullptr) {
@@ -28,9 +56,12 @@ uint64_t AudioEventHandlerRegistry::registerHandler(
   auto weakSelf = weak_from_this();
 
   // Read/Write on eventHandlers_ map only on the JS thread
-  callInvoker_->invokeAsync([weakSelf, eventName, listenerId, handler]() {
+  callInvoker_->invokeAsync([weakSelf, eventName, listenerId, handler, isBatched]() {
     if (auto self = weakSelf.lock()) {
       self->eventHandlers_[eventName][listenerId] = handler;
+      if (isBatched) {
+        self->batchedListeners_.insert(listenerId);
+      }
     }
   });
 
@@ -50,6 +81,8 @@ void AudioEventHandlerRegistry::unregisterHandler(
   // Read/Write on eventHandlers_ map only on the JS thread
   callInvoker_->invokeAsync([weakSelf, eventName, listenerId]() {
     if (auto self = weakSelf.lock()) {
+        self->batchedListeners_.erase(listenerId);
+
         auto it = self->eventHandlers_.find(eventName);
 
         if (it == self->eventHandlers_.end()) {
@@ -87,11 +120,9 @@ void AudioEventHandlerRegistry::invokeHandlerWithEventBody(
             return;
         }
 
-        auto handlersMap = it->second;
-
-        for (const auto &pair: handlersMap) {
-            auto handler = pair.second;
-
+        // handlers are only added and removed by tasks posted to the JS thread,
+        // so the map does not change while it is iterated
+        for (const auto &[listenerId, handler] : it->second) {
             if (!handler || !handler->isFunction(*self->runtime_)) {
                 // If the handler is not valid, we can skip it
                 continue;
@@ -111,7 +142,7 @@ void AudioEventHandlerRegistry::invokeHandlerWithEventBody(
                 } else {
                     eventObject = self->createEventObject(body);
                 }
-                handler->call(*self->runtime_, eventObject);
+                self->invokeHandler(eventName, listenerId, handler, std::move(eventObject));
             } catch (const std::exception &e) {
                 // re-throw the exception to be handled by the caller
                 // std::exception is safe to parse by the rn bridge
@@ -181,7 +212,7 @@ void AudioEventHandlerRegistry::invokeHandlerWithEventBody(
               } else {
                   eventObject = self->createEventObject(body);
               }
-              handlerIt->second->call(*self->runtime_, eventObject);
+              self->invokeHandler(eventName, listenerId, handlerIt->second, std::move(eventObject));
           } catch (const std::exception &e) {
               // re-throw the exception to be handled by the caller
               // std::exception is safe to parse by the rn bridge
@@ -195,6 +226,207 @@ void AudioEventHandlerRegistry::invokeHandlerWithEventBody(
   });
 }
 
+std::shared_ptr<AudioEventQueue> AudioEventHandlerRegistry::createEventQueue(size_t capacity) {
+  // without a JS runtime the events are never drained, the full queue drops them
+  if (callInvoker_ == nullptr || runtime_ == nullptr) {
+    return std::make_shared<AudioEventQueue>(capacity);
+  }
+
+  auto queue = std::make_shared<AudioEventQueue>(capacity, isDrainThreadWaiting_);
+
+  std::lock_guard lock(eventQueuesMutex_);
+  eventQueues_.push_back(queue);
+  if (!drainThread_.joinable()) {
+    drainThread_ = std::thread(&AudioEventHandlerRegistry::runDrainLoop, this);
+  }
+
+  return queue;
+}
+
+void AudioEventHandlerRegistry::runDrainLoop() {
+  std::unique_lock lock(eventQueuesMutex_);
+
+  while (!isDrainThreadStopped_) {
+    if (!hasQueuedEvents()) {
+      // sleeps until a producer pushes an event instead of polling empty queues,
+      // the flag is set under the lock, so the destructor clears it after it is set
+      isDrainThreadWaiting_->store(true, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+
+      if (!hasQueuedEvents()) {
+        lock.unlock();
+        isDrainThreadWaiting_->wait(true, std::memory_order_acquire);
+        lock.lock();
+        continue;
+      }
+
+      isDrainThreadWaiting_->store(false, std::memory_order_relaxed);
+    }
+
+    if (!isDrainScheduled_.exchange(true, std::memory_order_acq_rel)) {
+      lock.unlock();
+      auto weakSelf = weak_from_this();
+      callInvoker_->invokeAsync([weakSelf]() {
+        if (auto self = weakSelf.lock()) {
+          self->drainEventQueues();
+        }
+      });
+      lock.lock();
+    }
+
+    eventQueuesCondition_.wait_for(lock, kDrainInterval, [this] { return isDrainThreadStopped_; });
+  }
+}
+
+bool AudioEventHandlerRegistry::hasQueuedEvents() {
+  eventQueues_.erase(
+      std::remove_if(
+          eventQueues_.begin(),
+          eventQueues_.end(),
+          [](const std::weak_ptr<AudioEventQueue> &queue) { return queue.expired(); }),
+      eventQueues_.end());
+
+  return std::any_of(
+      eventQueues_.begin(), eventQueues_.end(), [](const std::weak_ptr<AudioEventQueue> &queue) {
+        auto lockedQueue = queue.lock();
+        return lockedQueue != nullptr && !lockedQueue->isEmpty();
+      });
+}
+
+AudioEventHandlerRegistry::Stats AudioEventHandlerRegistry::getStats() {
+  uint64_t dropped = 0;
+  {
+    std::lock_guard lock(eventQueuesMutex_);
+    for (const auto &queue : eventQueues_) {
+      if (auto lockedQueue = queue.lock()) {
+        dropped += lockedQueue->getDroppedCount();
+      }
+    }
+  }
+
+  return {eventCounters_, dropped};
+}
+
+void AudioEventHandlerRegistry::drainEventQueues() {
+  // events queued from now on are drained by the next task
+  isDrainScheduled_.store(false, std::memory_order_release);
+
+  {
+    std::lock_guard lock(eventQueuesMutex_);
+    for (const auto &queue : eventQueues_) {
+      if (auto lockedQueue = queue.lock()) {
+        drainedEventQueues_.push_back(std::move(lockedQueue));
+      }
+    }
+  }
+
+  for (const auto &queue : drainedEventQueues_) {
+    queue->drain([this](const AudioEventRecord &record) {
+      if (eventBatch_.add(record)) {
+        eventCounters_[record.event].coalesced++;
+      }
+    });
+  }
+  drainedEventQueues_.clear();
+
+  // a handler that throws loses only its own events, the first exception is re-thrown
+  // once every other handler has got its events
+  std::exception_ptr error;
+  std::unordered_map<uint64_t, PendingBatch> pendingBatches;
+  eventBatch_.forEach([this, &pendingBatches, &error](const AudioEventRecord &record) {
+    dispatchEvent(record, pendingBatches, error);
+  });
+  eventBatch_.clear();
+
+  for (auto &[listenerId, batch] : pendingBatches) {
+    invokeBatchHandler(batch, error);
+  }
+
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+void AudioEventHandlerRegistry::dispatchEvent(
+    const AudioEventRecord &record,
+    std::unordered_map<uint64_t, PendingBatch> &pendingBatches,
+    std::exception_ptr &error) {
+  auto it = eventHandlers_.find(record.event);
+  if (it == eventHandlers_.end()) {
+    return;
+  }
+
+  auto handlerIt = it->second.find(record.listenerId);
+  if (handlerIt == it->second.end()) {
+    return;
+  }
+
+  const auto &handler = handlerIt->second;
+  if (!handler || !handler->isFunction(*runtime_)) {
+    return;
+  }
+
+  if (batchedListeners_.contains(record.listenerId)) {
+    auto &batch = pendingBatches[record.listenerId];
+    batch.eventName = record.event;
+    batch.handler = handler;
+    batch.events.emplace_back(createEventObject(record));
+    eventCounters_[record.event].dispatched++;
+    return;
+  }
+
+  try {
+    invokeHandler(record.event, record.listenerId, handler, createEventObject(record));
+  } catch (const std::exception &e) {
+    // re-thrown by the caller, std::exception is safe to parse by the rn bridge
+    if (!error) {
+      error = std::current_exception();
+    }
+  } catch (...) {
+    printf(
+        "Unknown exception occurred while invoking handler for event: %d\n",
+        static_cast<int>(record.event));
+  }
+}
+
+void AudioEventHandlerRegistry::invokeHandler(
+    AudioEvent eventName,
+    uint64_t listenerId,
+    const std::shared_ptr<jsi::Function> &handler,
+    jsi::Object eventObject) {
+  eventCounters_[eventName].dispatched++;
+
+  if (!batchedListeners_.contains(listenerId)) {
+    handler->call(*runtime_, eventObject);
+    return;
+  }
+
+  auto events = jsi::Array(*runtime_, 1);
+  events.setValueAtIndex(*runtime_, 0, std::move(eventObject));
+  handler->call(*runtime_, events);
+}
+
+void AudioEventHandlerRegistry::invokeBatchHandler(
+    PendingBatch &batch,
+    std::exception_ptr &error) {
+  try {
+    auto events = jsi::Array(*runtime_, batch.events.size());
+    for (size_t i = 0; i < batch.events.size(); ++i) {
+      events.setValueAtIndex(*runtime_, i, std::move(batch.events[i]));
+    }
+    batch.handler->call(*runtime_, events);
+  } catch (const std::exception &e) {
+    // re-thrown by the caller, std::exception is safe to parse by the rn bridge
+    if (!error) {
+      error = std::current_exception();
+    }
+  } catch (...) {
+    printf(
+        "Unknown exception occurred while invoking handler for event: %d\n",
+        static_cast<int>(batch.eventName));
+  }
+}
+
 jsi::Object AudioEventHandlerRegistry::createEventObject(
     const std::unordered_map<std::string, EventValue> &body) {
   auto eventObject = jsi::Object(*runtime_);
@@ -231,4 +463,23 @@ jsi::Object AudioEventHandlerRegistry::createEventObject(
   return eventObject;
 }
 
+jsi::Object AudioEventHandlerRegistry::createEventObject(const AudioEventRecord &record) {
+  auto eventObject = jsi::Object(*runtime_);
+
+  for (size_t i = 0; i < record.fieldCount; ++i) {
+    const auto &[name, value] = record.fields[i];
+
+    if (std::holds_alternative<double>(value)) {
+      eventObject.setProperty(*runtime_, name, std::get<double>(value));
+    } else if (std::holds_alternative<bool>(value)) {
+      eventObject.setProperty(*runtime_, name, std::get<bool>(value));
+    } else if (std::holds_alternative<AudioEventId>(value)) {
+      auto id = static_cast<uint64_t>(std::get<AudioEventId>(value));
+      eventObject.setProperty(*runtime_, name, std::to_string(id));
+    }
+  }
+
+  return eventObject;
+}
+
 } // namespace audioapi
@@ -2,14 +2,23 @@
 
 #include <ReactCommon/CallInvoker.h>
 #include <audioapi/events/AudioEvent.h>
+#include <audioapi/events/AudioEventBatch.h>
+#include <audioapi/events/AudioEventQueue.h>
 #include <audioapi/events/IAudioEventHandlerRegistry.h>
 #include <jsi/jsi.h>
 #include <array>
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
+#include <unordered_set>
 #include <variant>
+#include <vector>
 
 namespace audioapi {
 using namespace facebook;
@@ -37,6 +46,15 @@ class AudioEventHandlerRegistry : public IAudioEventHandlerRegistry,
   uint64_t registerHandler(AudioEvent eventName, const std::shared_ptr<jsi::Function> &handler)
       override;
 
+  /// @brief Registers an event handler that receives an array of events.
+  /// The events queued for the listener in one JS frame are passed in a single call,
+  /// after the handlers of single events.
+  /// @return A unique listener ID for the registered handler.
+  /// @note Thread safe
+  uint64_t registerBatchHandler(
+      AudioEvent eventName,
+      const std::shared_ptr<jsi::Function> &handler);
+
   /// @brief Unregisters an event handler for a specific audio event using its listener ID.
   /// @param eventName The name of the audio event.
   /// @param listenerId The unique listener ID of the handler to be unregistered.
@@ -56,18 +74,77 @@ class AudioEventHandlerRegistry : public IAudioEventHandlerRegistry,
       uint64_t listenerId,
       const std::unordered_map<std::string, EventValue> &body) override;
 
+  /// @brief Creates a ring of events for one producer thread.
+  /// Queued events are drained on the JS thread by at most one task per frame.
+  /// @note Thread safe
+  std::shared_ptr<AudioEventQueue> createEventQueue(size_t capacity) override;
+
+  struct Stats {
+    std::unordered_map<AudioEvent, AudioEventCounters> counters;
+    /// Events dropped by the full queues of the live producers.
+    uint64_t dropped;
+  };
+
+  /// @note To be called on the JS thread.
+  [[nodiscard]] Stats getStats();
+
  private:
+  // events arriving within one interval are drained by one task
+  static constexpr std::chrono::milliseconds kDrainInterval{16};
+
   std::atomic<uint64_t> listenerIdCounter_{1}; // Atomic counter for listener IDs
 
   std::shared_ptr<react::CallInvoker> callInvoker_;
   jsi::Runtime *runtime_;
   std::unordered_map<AudioEvent, std::unordered_map<uint64_t, std::shared_ptr<jsi::Function>>>
       eventHandlers_;
+  std::unordered_set<uint64_t> batchedListeners_;
+  std::unordered_map<AudioEvent, AudioEventCounters> eventCounters_;
+
+  // the drain thread schedules draining of the event queues on the JS thread,
+  // so that the producers never have to call the CallInvoker
+  std::mutex eventQueuesMutex_;
+  std::condition_variable eventQueuesCondition_;
+  std::vector<std::weak_ptr<AudioEventQueue>> eventQueues_;
+  std::vector<std::shared_ptr<AudioEventQueue>> drainedEventQueues_; // JS thread only
+  AudioEventBatch eventBatch_; // JS thread only
+  std::thread drainThread_;
+  bool isDrainThreadStopped_ = false;
+  // set while the drain thread sleeps until the next pushed event
+  std::shared_ptr<std::atomic<bool>> isDrainThreadWaiting_ =
+      std::make_shared<std::atomic<bool>>(false);
+  std::atomic<bool> isDrainScheduled_{false};
+
+  struct PendingBatch {
+    AudioEvent eventName;
+    std::shared_ptr<jsi::Function> handler;
+    std::vector<jsi::Value> events;
+  };
+
+  uint64_t registerHandler(
+      AudioEvent eventName,
+      const std::shared_ptr<jsi::Function> &handler,
+      bool isBatched);
+
+  void runDrainLoop();
+  bool hasQueuedEvents();
+  void drainEventQueues();
+  void dispatchEvent(
+      const AudioEventRecord &record,
+      std::unordered_map<uint64_t, PendingBatch> &pendingBatches,
+      std::exception_ptr &error);
+  void invokeHandler(
+      AudioEvent eventName,
+      uint64_t listenerId,
+      const std::shared_ptr<jsi::Function> &handler,
+      jsi::Object eventObject);
+  void invokeBatchHandler(PendingBatch &batch, std::exception_ptr &error);
 
   jsi::Object createEventObject(const std::unordered_map<std::string, EventValue> &body);
   jsi::Object createEventObject(
       const std::unordered_map<std::string, EventValue> &body,
       size_t memoryPressure);
+  jsi::Object createEventObject(const AudioEventRecord &record);
 };
 
 } // namespace audioapi
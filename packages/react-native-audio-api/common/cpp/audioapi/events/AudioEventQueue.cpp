@@ -0,0 +1,37 @@
+#include <audioapi/events/AudioEventQueue.h>
+
+#include <utility>
+
+namespace audioapi {
+
+AudioEventQueue::AudioEventQueue(
+    size_t capacity,
+    std::shared_ptr<std::atomic<bool>> isConsumerWaiting)
+    : isConsumerWaiting_(std::move(isConsumerWaiting)) {
+  auto [sender, receiver] = channels::spsc::channel<AudioEventRecord>(capacity);
+  sender_ = std::move(sender);
+  receiver_ = std::move(receiver);
+}
+
+bool AudioEventQueue::push(const AudioEventRecord &record) noexcept {
+  // counted before sending, so the count never drops below the events in the ring
+  size_.fetch_add(1, std::memory_order_release);
+  if (sender_.try_send(record) != channels::spsc::ResponseStatus::SUCCESS) {
+    size_.fetch_sub(1, std::memory_order_relaxed);
+    droppedCount_.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+
+  if (isConsumerWaiting_ != nullptr) {
+    // pairs with the fence of the consumer, which sets the flag and then checks the size
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    // the wake up is a system call, so only the first event after the consumer sleeps makes it
+    if (isConsumerWaiting_->load(std::memory_order_relaxed) &&
+        isConsumerWaiting_->exchange(false, std::memory_order_acq_rel)) {
+      isConsumerWaiting_->notify_one();
+    }
+  }
+  return true;
+}
+
+} // namespace audioapi
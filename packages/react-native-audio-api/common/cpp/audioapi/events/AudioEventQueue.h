@@ -0,0 +1,60 @@
+#pragma once
+
+#include <audioapi/events/AudioEventRecord.h>
+#include <audioapi/utils/SpscChannel.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace audioapi {
+
+/// @brief Preallocated ring of events from one producer thread, e.g. the audio thread of a context.
+/// Emitting never allocates nor locks. When the ring is full, the event is dropped and counted.
+/// @note push is to be called from the producer thread, drain from the consumer thread.
+class AudioEventQueue {
+ public:
+  static constexpr size_t kDefaultCapacity = 1024;
+
+  /// @param isConsumerWaiting Set by a consumer sleeping until the next event of any of its
+  /// queues. The push that finds it set clears it and wakes the consumer.
+  explicit AudioEventQueue(
+      size_t capacity = kDefaultCapacity,
+      std::shared_ptr<std::atomic<bool>> isConsumerWaiting = nullptr);
+
+  /// @return false if the ring was full and the event was dropped.
+  /// @note Wait-free.
+  bool push(const AudioEventRecord &record) noexcept;
+
+  /// @brief Passes every queued event to the callback, in order.
+  /// @return Number of events drained.
+  template <typename F>
+  size_t drain(F &&callback) {
+    size_t count = 0;
+    AudioEventRecord record;
+    while (receiver_.try_receive(record) == channels::spsc::ResponseStatus::SUCCESS) {
+      size_.fetch_sub(1, std::memory_order_relaxed);
+      callback(record);
+      count++;
+    }
+    return count;
+  }
+
+  [[nodiscard]] bool isEmpty() const noexcept {
+    return size_.load(std::memory_order_acquire) == 0;
+  }
+
+  [[nodiscard]] uint64_t getDroppedCount() const noexcept {
+    return droppedCount_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  channels::spsc::Sender<AudioEventRecord> sender_;
+  channels::spsc::Receiver<AudioEventRecord> receiver_;
+  std::atomic<size_t> size_{0};
+  std::atomic<uint64_t> droppedCount_{0};
+  std::shared_ptr<std::atomic<bool>> isConsumerWaiting_;
+};
+
+} // namespace audioapi
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <audioapi/events/AudioEvent.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <variant>
+
+namespace audioapi {
+
+/// @brief Identifier passed to JS as a string, e.g. bufferId.
+enum class AudioEventId : uint64_t {};
+
+using AudioEventFieldValue = std::variant<double, bool, AudioEventId>;
+
+struct AudioEventField {
+  /// Must point to a string literal, as records outlive the code that emits them.
+  const char *name;
+  AudioEventFieldValue value;
+};
+
+/// @brief Event emitted from the audio thread, with a small fixed-size body.
+/// The JS event object is built from it on the JS thread.
+struct AudioEventRecord {
+  static constexpr size_t kMaxFields = 2;
+
+  AudioEvent event = AudioEvent::ENDED;
+  uint64_t listenerId = 0;
+  size_t fieldCount = 0;
+  std::array<AudioEventField, kMaxFields> fields{};
+
+  AudioEventRecord() = default;
+  AudioEventRecord(AudioEvent event, uint64_t listenerId) : event(event), listenerId(listenerId) {}
+
+  AudioEventRecord &add(const char *name, AudioEventFieldValue value) {
+    if (fieldCount < kMaxFields) {
+      fields[fieldCount++] = {name, value};
+    }
+    return *this;
+  }
+};
+
+static_assert(
+    std::is_trivially_copyable_v<AudioEventRecord>,
+    "AudioEventRecord is copied through a lock-free ring");
+
+} // namespace audioapi
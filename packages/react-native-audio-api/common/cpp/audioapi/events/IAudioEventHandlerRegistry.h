@@ -2,6 +2,7 @@
 
 #include <ReactCommon/CallInvoker.h>
 #include <audioapi/events/AudioEvent.h>
+#include <audioapi/events/AudioEventQueue.h>
 #include <jsi/jsi.h>
 #include <memory>
 #include <string>
@@ -29,6 +30,10 @@ class IAudioEventHandlerRegistry {
       AudioEvent eventName,
       uint64_t listenerId,
       const std::unordered_map<std::string, EventValue> &body) = 0;
+
+  /// @brief Creates a ring of events for one producer thread, e.g. the audio thread of a context.
+  /// Its events are delivered to the handlers registered for their listener ids.
+  virtual std::shared_ptr<AudioEventQueue> createEventQueue(size_t capacity) = 0;
 };
 
 } // namespace audioapi
@@ -1,5 +1,8 @@
 #include <audioapi/jsi/JsiPromise.h>
+#include <algorithm>
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
 #include <utility>
@@ -8,12 +11,29 @@ namespace audioapi {
 
 using namespace facebook;
 
-jsi::Value PromiseVendor::createAsyncPromise(std::function<PromiseResolver()> &&function) {
+std::shared_ptr<WorkStealingExecutor> PromiseVendor::getSharedExecutor() {
+  static std::mutex sharedMutex;
+  static std::weak_ptr<WorkStealingExecutor> shared;
+
+  std::lock_guard<std::mutex> lock(sharedMutex);
+  auto executor = shared.lock();
+  if (executor == nullptr) {
+    executor =
+        std::make_shared<WorkStealingExecutor>(audioapi::PROMISE_VENDOR_THREAD_POOL_WORKER_COUNT);
+    shared = executor;
+  }
+  return executor;
+}
+
+jsi::Value PromiseVendor::createAsyncPromise(
+    std::function<PromiseResolver()> &&function,
+    TaskPriority priority) {
   auto &runtime = *runtime_;
   auto callInvoker = callInvoker_;
-  auto threadPool = threadPool_;
+  auto executor = executor_;
   auto promiseCtor = runtime.global().getPropertyAsFunction(runtime, "Promise");
-  auto promiseLambda = [threadPool = std::move(threadPool),
+  auto promiseLambda = [executor = std::move(executor),
+                        priority,
                         callInvoker = std::move(callInvoker),
                         function = std::move(function)](
                            jsi::Runtime &runtime,
@@ -25,7 +45,8 @@ jsi::Value PromiseVendor::createAsyncPromise(std::function<PromiseResolver()> &&
     auto rejectLocal = arguments[1].asObject(runtime).asFunction(runtime);
     auto reject = std::make_shared<jsi::Function>(std::move(rejectLocal));
 
-    threadPool->schedule(
+    executor->schedule(
+        priority,
         &PromiseVendor::asyncPromiseJob,
         std::move(callInvoker),
         std::move(function),
@@ -38,12 +59,15 @@ jsi::Value PromiseVendor::createAsyncPromise(std::function<PromiseResolver()> &&
   return promiseCtor.callAsConstructor(runtime, std::move(promiseFunction));
 }
 
-jsi::Value PromiseVendor::createAsyncPromise(std::function<void(Promise &&)> &&function) {
+jsi::Value PromiseVendor::createAsyncPromise(
+    std::function<void(Promise &&)> &&function,
+    TaskPriority priority) {
   auto &runtime = *runtime_;
   auto callInvoker = callInvoker_;
-  auto threadPool = threadPool_;
+  auto executor = executor_;
   auto promiseCtor = runtime.global().getPropertyAsFunction(runtime, "Promise");
-  auto promiseLambda = [threadPool = std::move(threadPool),
+  auto promiseLambda = [executor = std::move(executor),
+                        priority,
                         callInvoker = std::move(callInvoker),
                         function = std::move(function)](
                            jsi::Runtime &runtime,
@@ -55,8 +79,76 @@ jsi::Value PromiseVendor::createAsyncPromise(std::function<void(Promise &&)> &&f
 
     Promise promise(std::move(callInvoker), std::move(resolveLocal), std::move(rejectLocal));
 
-    threadPool->schedule(std::move(function), std::move(promise));
+    executor->schedule(priority, std::move(function), std::move(promise));
+
+    return jsi::Value::undefined();
+  };
+  auto promiseFunction = jsi::Function::createFromHostFunction(
+      runtime, jsi::PropNameID::forUtf8(runtime, "asyncPromise"), 2, std::move(promiseLambda));
+  return promiseCtor.callAsConstructor(runtime, std::move(promiseFunction));
+}
+
+jsi::Value PromiseVendor::createParallelAsyncPromise(
+    std::function<size_t()> &&split,
+    std::function<void(size_t)> &&part,
+    std::function<PromiseResolver()> &&complete,
+    TaskPriority priority) {
+  struct Job {
+    std::atomic<size_t> remainingParts;
+    std::function<size_t()> split;
+    std::function<void(size_t)> part;
+    std::function<PromiseResolver()> complete;
+    std::shared_ptr<react::CallInvoker> callInvoker;
+    // only moved out by the last part and released with the result on the JS thread, so the
+    // workers finishing the other parts never drop a function
+    std::shared_ptr<jsi::Function> resolve;
+    std::shared_ptr<jsi::Function> reject;
+
+    void finishPart() {
+      // the last part to finish observes the writes of all the others
+      if (remainingParts.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        asyncPromiseJob(
+            std::move(callInvoker), std::move(complete), std::move(resolve), std::move(reject));
+      }
+    }
+  };
+
+  auto &runtime = *runtime_;
+  auto executor = executor_;
+  auto job = std::make_shared<Job>();
+  job->split = std::move(split);
+  job->part = std::move(part);
+  job->complete = std::move(complete);
+  job->callInvoker = callInvoker_;
+  auto promiseCtor = runtime.global().getPropertyAsFunction(runtime, "Promise");
+  auto promiseLambda = [executor = std::move(executor), priority, job = std::move(job)](
+                           jsi::Runtime &runtime,
+                           const jsi::Value &thisValue,
+                           const jsi::Value *arguments,
+                           size_t count) mutable -> jsi::Value {
+    auto resolveLocal = arguments[0].asObject(runtime).asFunction(runtime);
+    job->resolve = std::make_shared<jsi::Function>(std::move(resolveLocal));
+    auto rejectLocal = arguments[1].asObject(runtime).asFunction(runtime);
+    job->reject = std::make_shared<jsi::Function>(std::move(rejectLocal));
+
+    // the split may open files, so it runs on a worker as well, which then fans the parts out,
+    // the executor outlives the tasks it runs, including the ones they schedule
+    executor->schedule(priority, [job, executor = executor.get(), priority]() {
+      auto numberOfParts = job->split();
+      job->remainingParts.store(std::max<size_t>(numberOfParts, 1), std::memory_order_relaxed);
+
+      for (size_t index = 1; index < numberOfParts; ++index) {
+        executor->schedule(priority, [job, index]() {
+          job->part(index);
+          job->finishPart();
+        });
+      }
 
+      if (numberOfParts > 0) {
+        job->part(0);
+      }
+      job->finishPart();
+    });
     return jsi::Value::undefined();
   };
   auto promiseFunction = jsi::Function::createFromHostFunction(
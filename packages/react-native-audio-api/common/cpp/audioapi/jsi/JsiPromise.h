@@ -2,7 +2,7 @@
 
 #include <ReactCommon/CallInvoker.h>
 #include <audioapi/core/utils/Constants.h>
-#include <audioapi/utils/ThreadPool.hpp>
+#include <audioapi/utils/WorkStealingExecutor.h>
 #include <jsi/jsi.h>
 #include <functional>
 #include <memory>
@@ -70,19 +70,13 @@ using PromiseResolver = std::function<std::variant<jsi::Value, std::string>(jsi:
 class PromiseVendor {
  public:
   PromiseVendor(jsi::Runtime *runtime, const std::shared_ptr<react::CallInvoker> &callInvoker)
-      : runtime_(runtime),
-        callInvoker_(callInvoker),
-        threadPool_(
-            std::make_shared<ThreadPool>(
-                audioapi::PROMISE_VENDOR_THREAD_POOL_WORKER_COUNT,
-                audioapi::PROMISE_VENDOR_THREAD_POOL_LOAD_BALANCER_QUEUE_SIZE,
-                audioapi::PROMISE_VENDOR_THREAD_POOL_WORKER_QUEUE_SIZE)) {}
+      : runtime_(runtime), callInvoker_(callInvoker), executor_(getSharedExecutor()) {}
 
   /// @brief Creates an asynchronous promise.
   /// @param function The function to execute asynchronously. It should return either a jsi::Value on success or a std::string error message on failure.
+  /// @param priority BULK for work that may take seconds, e.g. decoding, so it does not delay the other promises.
   /// @return The created promise.
   /// @note The function is executed on a different thread, and the promise is resolved or rejected based on the function's outcome.
-  /// @note IMPORTANT: This function is not thread-safe and should be called from a single thread only. (comes from underlying ThreadPool implementation)
   /// @example
   /// ```cpp
   /// auto promise = promiseVendor_->createAsyncPromise(
@@ -97,19 +91,39 @@ class PromiseVendor {
   /// );
   ///
   /// return promise;
-  jsi::Value createAsyncPromise(std::function<PromiseResolver()> &&function);
+  jsi::Value createAsyncPromise(
+      std::function<PromiseResolver()> &&function,
+      TaskPriority priority = TaskPriority::INTERACTIVE);
 
   /// @brief Creates an asynchronous promise.
   /// @param function The function to execute asynchronously. It receives a Promise object to resolve or reject the promise.
+  /// @param priority BULK for work that may take seconds, e.g. decoding, so it does not delay the other promises.
   /// @return The created promise.
   /// @note The function is executed on a different thread, the promise should be resolved or rejected using the provided Promise object.
-  /// @note IMPORTANT: This function is not thread-safe and should be called from a single thread only. (comes from underlying ThreadPool implementation)
-  jsi::Value createAsyncPromise(std::function<void(Promise &&)> &&function);
+  jsi::Value createAsyncPromise(
+      std::function<void(Promise &&)> &&function,
+      TaskPriority priority = TaskPriority::INTERACTIVE);
+
+  /// @brief Creates an asynchronous promise whose work is split into parts run concurrently.
+  /// @param split Called first on a worker thread, returns the number of parts, 0 to go straight to complete.
+  /// @param part Called once for every part index on a worker thread, idle workers steal them.
+  /// @param complete Called on the worker that finished the last part, prepares the result.
+  /// @param priority BULK for work that may take seconds, e.g. decoding, so it does not delay the other promises.
+  /// @return The created promise.
+  jsi::Value createParallelAsyncPromise(
+      std::function<size_t()> &&split,
+      std::function<void(size_t)> &&part,
+      std::function<PromiseResolver()> &&complete,
+      TaskPriority priority = TaskPriority::INTERACTIVE);
 
  private:
   jsi::Runtime *runtime_;
   std::shared_ptr<react::CallInvoker> callInvoker_;
-  std::shared_ptr<ThreadPool> threadPool_;
+  std::shared_ptr<WorkStealingExecutor> executor_;
+
+  /// @brief Workers shared by the vendors of all the contexts, so the number of threads does not
+  /// grow with the number of contexts. The executor is released once no vendor uses it.
+  static std::shared_ptr<WorkStealingExecutor> getSharedExecutor();
 
   static void asyncPromiseJob(
       std::shared_ptr<react::CallInvoker> callInvoker,
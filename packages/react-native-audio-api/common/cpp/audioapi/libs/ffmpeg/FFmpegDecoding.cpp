@@ -13,6 +13,7 @@
 #endif // RN_AUDIO_API_FFMPEG_DISABLED
 #include <audioapi/utils/AudioArray.h>
 #include <audioapi/utils/AudioBuffer.h>
+#include <audioapi/utils/AudioBufferBuilder.h>
 #include <functional>
 
 namespace audioapi::ffmpegdecoder {
@@ -59,8 +60,7 @@ void convertFrameToBuffer(
     SwrContext *swr,
     AVFrame *frame,
     int output_channel_count,
-    std::vector<float> &buffer,
-    size_t &framesRead,
+    AudioBufferBuilder &builder,
     uint8_t **&resampled_data,
     int &max_resampled_samples) {
   const int out_samples = swr_get_out_samples(swr, frame->nb_samples);
@@ -74,7 +74,7 @@ void convertFrameToBuffer(
             nullptr,
             output_channel_count,
             max_resampled_samples,
-            AV_SAMPLE_FMT_FLT,
+            AV_SAMPLE_FMT_FLTP,
             0) < 0) {
       return;
     }
@@ -87,29 +87,46 @@ void convertFrameToBuffer(
       const_cast<const uint8_t **>(frame->data),
       frame->nb_samples);
 
+  // planar output, one plane per channel, is appended without deinterleaving
   if (converted_samples > 0) {
-    const size_t current_size = buffer.size();
-    const size_t new_samples = static_cast<size_t>(converted_samples) * output_channel_count;
-    buffer.resize(current_size + new_samples);
-    memcpy(buffer.data() + current_size, resampled_data[0], new_samples * sizeof(float));
-    framesRead += converted_samples;
+    builder.appendPlanar(
+        reinterpret_cast<const float *const *>(resampled_data),
+        static_cast<size_t>(converted_samples));
   }
 }
 
-std::vector<float> readAllPcmFrames(
+size_t estimateFrameCount(AVFormatContext *fmt_ctx, int audio_stream_index, int out_sample_rate) {
+  AVStream *stream = fmt_ctx->streams[audio_stream_index];
+
+  if (stream->duration != AV_NOPTS_VALUE && stream->duration > 0) {
+    return static_cast<size_t>(
+        av_rescale_q(stream->duration, stream->time_base, AVRational{1, out_sample_rate}));
+  }
+
+  if (fmt_ctx->duration != AV_NOPTS_VALUE && fmt_ctx->duration > 0) {
+    return static_cast<size_t>(av_rescale(fmt_ctx->duration, out_sample_rate, AV_TIME_BASE));
+  }
+
+  return 0;
+}
+
+std::shared_ptr<AudioBuffer> readAllPcmFrames(
     AVFormatContext *fmt_ctx,
     AVCodecContext *codec_ctx,
     int out_sample_rate,
     int output_channel_count,
     int audio_stream_index,
-    size_t &framesRead) {
-  framesRead = 0;
-  std::vector<float> buffer;
+    const std::string &paged_file_directory) {
+  AudioBufferBuilder builder(
+      output_channel_count,
+      static_cast<float>(out_sample_rate),
+      estimateFrameCount(fmt_ctx, audio_stream_index, out_sample_rate),
+      paged_file_directory);
   auto swr = std::unique_ptr<SwrContext, std::function<void(SwrContext *)>>(
       swr_alloc(), [](SwrContext *ctx) { swr_free(&ctx); });
 
   if (swr == nullptr)
-    return buffer;
+    return nullptr;
 
   av_opt_set_chlayout(swr.get(), "in_chlayout", &codec_ctx->ch_layout, 0);
   av_opt_set_int(swr.get(), "in_sample_rate", codec_ctx->sample_rate, 0);
@@ -119,11 +136,11 @@ std::vector<float> readAllPcmFrames(
   av_channel_layout_default(&out_ch_layout, output_channel_count);
   av_opt_set_chlayout(swr.get(), "out_chlayout", &out_ch_layout, 0);
   av_opt_set_int(swr.get(), "out_sample_rate", out_sample_rate, 0);
-  av_opt_set_sample_fmt(swr.get(), "out_sample_fmt", AV_SAMPLE_FMT_FLT, 0);
+  av_opt_set_sample_fmt(swr.get(), "out_sample_fmt", AV_SAMPLE_FMT_FLTP, 0);
 
   if (swr_init(swr.get()) < 0) {
     av_channel_layout_uninit(&out_ch_layout);
-    return buffer;
+    return nullptr;
   }
 
   auto packet = std::unique_ptr<AVPacket, std::function<void(AVPacket *)>>(
@@ -133,7 +150,7 @@ std::vector<float> readAllPcmFrames(
 
   if (packet == nullptr || frame == nullptr) {
     av_channel_layout_uninit(&out_ch_layout);
-    return buffer;
+    return nullptr;
   }
 
   // Allocate buffer for resampled data
@@ -144,10 +161,10 @@ std::vector<float> readAllPcmFrames(
           nullptr,
           output_channel_count,
           max_resampled_samples,
-          AV_SAMPLE_FMT_FLT,
+          AV_SAMPLE_FMT_FLTP,
           0) < 0) {
     av_channel_layout_uninit(&out_ch_layout);
-    return buffer;
+    return nullptr;
   }
 
   while (av_read_frame(fmt_ctx, packet.get()) >= 0) {
@@ -158,8 +175,7 @@ std::vector<float> readAllPcmFrames(
               swr.get(),
               frame.get(),
               output_channel_count,
-              buffer,
-              framesRead,
+              builder,
               resampled_data,
               max_resampled_samples);
         }
@@ -175,8 +191,7 @@ std::vector<float> readAllPcmFrames(
         swr.get(),
         frame.get(),
         output_channel_count,
-        buffer,
-        framesRead,
+        builder,
         resampled_data,
         max_resampled_samples);
   }
@@ -185,7 +200,7 @@ std::vector<float> readAllPcmFrames(
   av_freep(&resampled_data);
   av_channel_layout_uninit(&out_ch_layout);
 
-  return buffer;
+  return builder.build();
 }
 
 inline int findAudioStreamIndex(AVFormatContext *fmt_ctx) {
@@ -232,29 +247,18 @@ std::shared_ptr<AudioBuffer> decodeAudioFrames(
     AVFormatContext *fmt_ctx,
     AVCodecContext *codec_ctx,
     int audio_stream_index,
-    int sample_rate) {
-  size_t framesRead = 0;
+    int sample_rate,
+    const std::string &paged_file_directory) {
   int output_sample_rate = (sample_rate > 0) ? sample_rate : codec_ctx->sample_rate;
   int output_channel_count = codec_ctx->ch_layout.nb_channels;
 
-  std::vector<float> decoded_buffer = readAllPcmFrames(
-      fmt_ctx, codec_ctx, output_sample_rate, output_channel_count, audio_stream_index, framesRead);
-
-  if (framesRead == 0 || decoded_buffer.empty()) {
-    return nullptr;
-  }
-
-  auto outputFrames = decoded_buffer.size() / output_channel_count;
-  auto audioBuffer =
-      std::make_shared<AudioBuffer>(outputFrames, output_channel_count, output_sample_rate);
-
-  for (size_t ch = 0; ch < output_channel_count; ++ch) {
-    auto channelData = audioBuffer->getChannel(ch)->span();
-    for (int i = 0; i < outputFrames; ++i) {
-      channelData[i] = decoded_buffer[i * output_channel_count + ch];
-    }
-  }
-  return audioBuffer;
+  return readAllPcmFrames(
+      fmt_ctx,
+      codec_ctx,
+      output_sample_rate,
+      output_channel_count,
+      audio_stream_index,
+      paged_file_directory);
 }
 
 std::shared_ptr<AudioBuffer> decodeWithMemoryBlock(const void *data, size_t size, int sample_rate) {
@@ -305,7 +309,10 @@ std::shared_ptr<AudioBuffer> decodeWithMemoryBlock(const void *data, size_t size
   return decodeAudioFrames(fmt_ctx.get(), codec_ctx.get(), audio_stream_index, sample_rate);
 }
 
-std::shared_ptr<AudioBuffer> decodeWithFilePath(const std::string &path, int sample_rate) {
+std::shared_ptr<AudioBuffer> decodeWithFilePath(
+    const std::string &path,
+    int sample_rate,
+    const std::string &paged_file_directory) {
   if (path.empty()) {
     return nullptr;
   }
@@ -328,7 +335,8 @@ std::shared_ptr<AudioBuffer> decodeWithFilePath(const std::string &path, int sam
     return nullptr;
   }
 
-  return decodeAudioFrames(fmt_ctx.get(), codec_ctx.get(), audio_stream_index, sample_rate);
+  return decodeAudioFrames(
+      fmt_ctx.get(), codec_ctx.get(), audio_stream_index, sample_rate, paged_file_directory);
 }
 
 } // namespace audioapi::ffmpegdecoder
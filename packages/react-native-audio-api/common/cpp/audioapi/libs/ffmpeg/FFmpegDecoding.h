@@ -9,8 +9,10 @@
  */
 
 #include <audioapi/utils/AudioBuffer.h>
+#include <audioapi/utils/AudioBufferBuilder.h>
 #include <iostream>
 #include <memory>
+#include <string>
 #include <vector>
 
 extern "C" {
@@ -38,20 +40,20 @@ struct AudioStreamContext {
 int read_packet(void *opaque, uint8_t *buf, int buf_size);
 int64_t seek_packet(void *opaque, int64_t offset, int whence);
 inline int findAudioStreamIndex(AVFormatContext *fmt_ctx);
-std::vector<float> readAllPcmFrames(
+size_t estimateFrameCount(AVFormatContext *fmt_ctx, int audio_stream_index, int out_sample_rate);
+std::shared_ptr<AudioBuffer> readAllPcmFrames(
     AVFormatContext *fmt_ctx,
     AVCodecContext *codec_ctx,
     int out_sample_rate,
     int output_channel_count,
     int audio_stream_index,
-    size_t &framesRead);
+    const std::string &paged_file_directory = "");
 
 void convertFrameToBuffer(
     SwrContext *swr,
     AVFrame *frame,
     int output_channel_count,
-    std::vector<float> &buffer,
-    size_t &framesRead,
+    AudioBufferBuilder &builder,
     uint8_t **&resampled_data,
     int &max_resampled_samples);
 bool setupDecoderContext(
@@ -62,10 +64,16 @@ std::shared_ptr<AudioBuffer> decodeAudioFrames(
     AVFormatContext *fmt_ctx,
     AVCodecContext *codec_ctx,
     int audio_stream_index,
-    int sample_rate);
+    int sample_rate,
+    const std::string &paged_file_directory = "");
 
 std::shared_ptr<AudioBuffer> decodeWithMemoryBlock(const void *data, size_t size, int sample_rate);
 
-std::shared_ptr<AudioBuffer> decodeWithFilePath(const std::string &path, int sample_rate);
+/// @param paged_file_directory Directory of a memory-mapped cache file for the decoded audio,
+/// empty to decode into memory.
+std::shared_ptr<AudioBuffer> decodeWithFilePath(
+    const std::string &path,
+    int sample_rate,
+    const std::string &paged_file_directory = "");
 
 } // namespace audioapi::ffmpegdecoder
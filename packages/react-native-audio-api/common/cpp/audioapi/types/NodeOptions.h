@@ -14,6 +14,7 @@
 #include <audioapi/utils/AudioArray.h>
 #include <audioapi/utils/AudioArrayBuffer.hpp>
 #include <audioapi/utils/AudioBuffer.h>
+#include <audioapi/utils/CompactAudioBuffer.h>
 
 namespace audioapi {
 struct AudioNodeOptions {
@@ -38,6 +39,14 @@ struct AudioScheduledSourceNodeOptions : AudioNodeOptions {
   }
 };
 
+struct WorkletProcessingOptions : AudioNodeOptions {
+  explicit WorkletProcessingOptions(int channelCount) {
+    // the worklet buffers are allocated once, so the input is always mixed to their channels
+    this->channelCount = channelCount;
+    channelCountMode = ChannelCountMode::EXPLICIT;
+  }
+};
+
 struct GainOptions : AudioNodeOptions {
   float gain = 1.0f;
 };
@@ -101,6 +110,8 @@ struct BaseAudioBufferSourceOptions : AudioScheduledSourceNodeOptions {
 
 struct AudioBufferSourceOptions : BaseAudioBufferSourceOptions {
   std::shared_ptr<AudioBuffer> buffer;
+  // takes precedence over buffer when set
+  std::shared_ptr<CompactAudioBuffer> compactBuffer;
   float loopStart = 0.0f;
   float loopEnd = 0.0f;
   bool loop = false;
@@ -108,6 +119,8 @@ struct AudioBufferSourceOptions : BaseAudioBufferSourceOptions {
 
 struct StreamerOptions : AudioScheduledSourceNodeOptions {
   std::string streamPath;
+  float prebufferDuration = 0.5f;
+  float lowWaterDuration = 1.0f;
 };
 
 struct DelayOptions : AudioNodeOptions {
@@ -127,15 +140,23 @@ struct IIRFilterOptions : AudioNodeOptions {
   std::vector<float> feedforward;
   std::vector<float> feedback;
 
-  IIRFilterOptions() = default;
+  IIRFilterOptions() {
+    requiresTailProcessing = true;
+  }
 
-  explicit IIRFilterOptions(const AudioNodeOptions options) : AudioNodeOptions(options) {}
+  explicit IIRFilterOptions(const AudioNodeOptions options) : AudioNodeOptions(options) {
+    requiresTailProcessing = true;
+  }
 
   IIRFilterOptions(const std::vector<float> &ff, const std::vector<float> &fb)
-      : feedforward(ff), feedback(fb) {}
+      : feedforward(ff), feedback(fb) {
+    requiresTailProcessing = true;
+  }
 
   IIRFilterOptions(std::vector<float> &&ff, std::vector<float> &&fb)
-      : feedforward(std::move(ff)), feedback(std::move(fb)) {}
+      : feedforward(std::move(ff)), feedback(std::move(fb)) {
+    requiresTailProcessing = true;
+  }
 };
 
 struct WaveShaperOptions : AudioNodeOptions {
@@ -9,33 +9,40 @@ namespace audioapi {
 
 AudioArray::AudioArray(size_t size) : size_(size) {
   if (size_ > 0) {
-    data_ = std::make_unique<float[]>(size_);
+    allocate(size_);
     zero();
   }
 }
 
 AudioArray::AudioArray(const float *data, size_t size) : size_(size) {
   if (size_ > 0) {
-    data_ = std::make_unique<float[]>(size_);
+    allocate(size_);
     copy(data, 0, 0, size_);
   }
 }
 
+AudioArray::AudioArray(float *data, size_t size, std::shared_ptr<void> storage)
+    : data_(data), size_(size), storage_(std::move(storage)) {}
+
 AudioArray::AudioArray(const AudioArray &other) : size_(other.size_) {
   if (size_ > 0 && other.data_) {
-    data_ = std::make_unique<float[]>(size_);
+    allocate(size_);
     copy(other);
   }
 }
 
 AudioArray::AudioArray(audioapi::AudioArray &&other) noexcept
-    : data_(std::move(other.data_)), size_(std::exchange(other.size_, 0)) {}
+    : data_(std::exchange(other.data_, nullptr)),
+      size_(std::exchange(other.size_, 0)),
+      ownedData_(std::move(other.ownedData_)),
+      storage_(std::move(other.storage_)) {}
 
 AudioArray &AudioArray::operator=(const audioapi::AudioArray &other) {
   if (this != &other) {
     if (size_ != other.size_) {
       size_ = other.size_;
-      data_ = (size_ > 0) ? std::make_unique<float[]>(size_) : nullptr;
+      storage_.reset();
+      allocate(size_);
     }
 
     if (size_ > 0 && data_) {
@@ -48,19 +55,30 @@ AudioArray &AudioArray::operator=(const audioapi::AudioArray &other) {
 
 AudioArray &AudioArray::operator=(audioapi::AudioArray &&other) noexcept {
   if (this != &other) {
-    data_ = std::move(other.data_);
+    data_ = std::exchange(other.data_, nullptr);
     size_ = std::exchange(other.size_, 0);
+    ownedData_ = std::move(other.ownedData_);
+    storage_ = std::move(other.storage_);
   }
 
   return *this;
 }
 
+void AudioArray::allocate(size_t size) {
+  ownedData_ = (size > 0) ? std::make_unique<float[]>(size) : nullptr;
+  data_ = ownedData_.get();
+}
+
 void AudioArray::zero() noexcept {
   zero(0, size_);
 }
 
 void AudioArray::zero(size_t start, size_t length) noexcept {
-  memset(data_.get() + start, 0, length * sizeof(float));
+  memset(data_ + start, 0, length * sizeof(float));
+}
+
+void AudioArray::truncate(size_t size) noexcept {
+  size_ = std::min(size_, size);
 }
 
 void AudioArray::sum(const AudioArray &source, float gain) {
@@ -78,8 +96,8 @@ void AudioArray::sum(
   }
 
   // Using restrict to inform the compiler that the source and destination do not overlap
-  float *__restrict dest = data_.get() + destinationStart;
-  const float *__restrict src = source.data_.get() + sourceStart;
+  float *__restrict dest = data_ + destinationStart;
+  const float *__restrict src = source.data_ + sourceStart;
 
   dsp::multiplyByScalarThenAddToOutput(src, gain, dest, length);
 }
@@ -93,8 +111,8 @@ void AudioArray::multiply(const audioapi::AudioArray &source, size_t length) {
     throw std::out_of_range("Not enough data to perform vector multiplication.");
   }
 
-  float *__restrict dest = data_.get();
-  const float *__restrict src = source.data_.get();
+  float *__restrict dest = data_;
+  const float *__restrict src = source.data_;
 
   dsp::multiply(src, dest, dest, length);
 }
@@ -112,7 +130,7 @@ void AudioArray::copy(
     throw std::out_of_range("Not enough data to copy from source.");
   }
 
-  copy(source.data_.get(), sourceStart, destinationStart, length);
+  copy(source.data_, sourceStart, destinationStart, length);
 }
 
 void AudioArray::copy(
@@ -124,7 +142,7 @@ void AudioArray::copy(
     throw std::out_of_range("Not enough space to copy to destination.");
   }
 
-  memcpy(data_.get() + destinationStart, source + sourceStart, length * sizeof(float));
+  memcpy(data_ + destinationStart, source + sourceStart, length * sizeof(float));
 }
 
 void AudioArray::copyReverse(
@@ -154,7 +172,7 @@ void AudioArray::copyTo(
     throw std::out_of_range("Not enough data to copy from source.");
   }
 
-  memcpy(destination + destinationStart, data_.get() + sourceStart, length * sizeof(float));
+  memcpy(destination + destinationStart, data_ + sourceStart, length * sizeof(float));
 }
 
 void AudioArray::copyWithin(size_t sourceStart, size_t destinationStart, size_t length) {
@@ -162,7 +180,7 @@ void AudioArray::copyWithin(size_t sourceStart, size_t destinationStart, size_t
     throw std::out_of_range("Not enough space for moving data or data to move.");
   }
 
-  memmove(data_.get() + destinationStart, data_.get() + sourceStart, length * sizeof(float));
+  memmove(data_ + destinationStart, data_ + sourceStart, length * sizeof(float));
 }
 
 void AudioArray::reverse() {
@@ -180,15 +198,15 @@ void AudioArray::normalize() {
     return;
   }
 
-  dsp::multiplyByScalar(data_.get(), 1.0f / maxAbsValue, data_.get(), size_);
+  dsp::multiplyByScalar(data_, 1.0f / maxAbsValue, data_, size_);
 }
 
 void AudioArray::scale(float value) {
-  dsp::multiplyByScalar(data_.get(), value, data_.get(), size_);
+  dsp::multiplyByScalar(data_, value, data_, size_);
 }
 
 float AudioArray::getMaxAbsValue() const {
-  return dsp::maximumMagnitude(data_.get(), size_);
+  return dsp::maximumMagnitude(data_, size_);
 }
 
 float AudioArray::computeConvolution(const audioapi::AudioArray &kernel, size_t startIndex) const {
@@ -196,7 +214,7 @@ float AudioArray::computeConvolution(const audioapi::AudioArray &kernel, size_t
     throw std::out_of_range("Kernal size exceeds available data for convolution.");
   }
 
-  return dsp::computeConvolution(data_.get() + startIndex, kernel.data_.get(), kernel.size_);
+  return dsp::computeConvolution(data_ + startIndex, kernel.data_, kernel.size_);
 }
 
 } // namespace audioapi
@@ -10,7 +10,8 @@ namespace audioapi {
 
 /// @brief AudioArray is a simple wrapper around a float array for audio data manipulation.
 /// It provides various utility functions for audio processing.
-/// @note AudioArray manages its own memory and provides copy and move semantics.
+/// @note AudioArray manages its own memory and provides copy and move semantics,
+/// unless constructed as a view of external storage.
 /// @note Not thread-safe.
 class AudioArray {
  public:
@@ -19,6 +20,11 @@ class AudioArray {
   /// @brief Constructs an AudioArray from existing data.
   /// @note The data is copied, so it does not take ownership of the pointer
   AudioArray(const float *data, size_t size);
+
+  /// @brief Constructs an AudioArray viewing memory it does not own, e.g. a memory-mapped file.
+  /// @param storage Keeps the memory alive as long as the array views it.
+  /// @note Copies of the array own their memory, moves keep viewing the storage.
+  AudioArray(float *data, size_t size, std::shared_ptr<void> storage);
   ~AudioArray() = default;
 
   AudioArray(const AudioArray &other);
@@ -38,25 +44,25 @@ class AudioArray {
   }
 
   [[nodiscard]] float *begin() noexcept {
-    return data_.get();
+    return data_;
   }
   [[nodiscard]] float *end() noexcept {
-    return data_.get() + size_;
+    return data_ + size_;
   }
 
   [[nodiscard]] const float *begin() const noexcept {
-    return data_.get();
+    return data_;
   }
   [[nodiscard]] const float *end() const noexcept {
-    return data_.get() + size_;
+    return data_ + size_;
   }
 
   [[nodiscard]] std::span<float> span() noexcept {
-    return {data_.get(), size_};
+    return {data_, size_};
   }
 
   [[nodiscard]] std::span<const float> span() const noexcept {
-    return {data_.get(), size_};
+    return {data_, size_};
   }
 
   [[nodiscard]] std::span<float> subSpan(size_t length, size_t offset = 0) {
@@ -64,12 +70,16 @@ class AudioArray {
       throw std::out_of_range("AudioArray::subSpan - offset + length exceeds array size");
     }
 
-    return {data_.get() + offset, length};
+    return {data_ + offset, length};
   }
 
   void zero() noexcept;
   void zero(size_t start, size_t length) noexcept;
 
+  /// @brief Shrinks the array to the given size, keeping the existing allocation.
+  /// @param size The new size, ignored if it is not smaller than the current one.
+  void truncate(size_t size) noexcept;
+
   /// @brief Sums the source AudioArray into this AudioArray with an optional gain.
   /// @param source The source AudioArray to sum from.
   /// @param gain The gain to apply to the source before summing. Default is 1.0f.
@@ -152,8 +162,14 @@ class AudioArray {
   [[nodiscard]] float computeConvolution(const AudioArray &kernel, size_t startIndex = 0) const;
 
  protected:
-  std::unique_ptr<float[]> data_ = nullptr;
+  float *data_ = nullptr;
   size_t size_ = 0;
+
+ private:
+  std::unique_ptr<float[]> ownedData_ = nullptr;
+  std::shared_ptr<void> storage_ = nullptr;
+
+  void allocate(size_t size);
 };
 
 } // namespace audioapi
@@ -18,20 +18,22 @@ class AudioArrayBuffer : public JsiBuffer, public AudioArray {
  public:
   explicit AudioArrayBuffer(size_t size) : AudioArray(size) {};
   AudioArrayBuffer(const float *data, size_t size) : AudioArray(data, size) {};
+  AudioArrayBuffer(float *data, size_t size, std::shared_ptr<void> storage)
+      : AudioArray(data, size, std::move(storage)) {};
 
 #if !RN_AUDIO_API_TEST
   [[nodiscard]] size_t size() const override {
     return size_ * sizeof(float);
   }
   uint8_t *data() override {
-    return reinterpret_cast<uint8_t *>(data_.get());
+    return reinterpret_cast<uint8_t *>(data_);
   }
 #else
   [[nodiscard]] size_t size() const {
     return size_ * sizeof(float);
   }
   uint8_t *data() {
-    return reinterpret_cast<uint8_t *>(data_.get());
+    return reinterpret_cast<uint8_t *>(data_);
   }
 #endif
 };
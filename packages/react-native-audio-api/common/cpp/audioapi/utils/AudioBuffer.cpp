@@ -3,6 +3,7 @@
 #include <audioapi/utils/AudioArray.h>
 #include <audioapi/utils/AudioArrayBuffer.hpp>
 #include <audioapi/utils/AudioBuffer.h>
+#include <audioapi/utils/PagedAudioFile.h>
 
 #include <algorithm>
 #include <memory>
@@ -22,6 +23,16 @@ AudioBuffer::AudioBuffer(size_t size, int numberOfChannels, float sampleRate)
   }
 }
 
+AudioBuffer::AudioBuffer(
+    std::vector<std::shared_ptr<AudioArrayBuffer>> channels,
+    float sampleRate,
+    std::shared_ptr<PagedAudioFile> pagedFile)
+    : channels_(std::move(channels)),
+      pagedFile_(std::move(pagedFile)),
+      numberOfChannels_(channels_.size()),
+      sampleRate_(sampleRate),
+      size_(channels_.empty() ? 0 : channels_.front()->getSize()) {}
+
 AudioBuffer::AudioBuffer(const AudioBuffer &other)
     : numberOfChannels_(other.numberOfChannels_),
       sampleRate_(other.sampleRate_),
@@ -34,6 +45,7 @@ AudioBuffer::AudioBuffer(const AudioBuffer &other)
 
 AudioBuffer::AudioBuffer(audioapi::AudioBuffer &&other) noexcept
     : channels_(std::move(other.channels_)),
+      pagedFile_(std::move(other.pagedFile_)),
       numberOfChannels_(std::exchange(other.numberOfChannels_, 0)),
       sampleRate_(std::exchange(other.sampleRate_, 0.0f)),
       size_(std::exchange(other.size_, 0)) {}
@@ -45,6 +57,7 @@ AudioBuffer &AudioBuffer::operator=(const AudioBuffer &other) {
     if (numberOfChannels_ != other.numberOfChannels_) {
       numberOfChannels_ = other.numberOfChannels_;
       size_ = other.size_;
+      pagedFile_.reset();
       channels_.clear();
       channels_.reserve(numberOfChannels_);
 
@@ -56,7 +69,9 @@ AudioBuffer &AudioBuffer::operator=(const AudioBuffer &other) {
     }
 
     if (size_ != other.size_) {
+      // channels of a different size are reallocated in memory
       size_ = other.size_;
+      pagedFile_.reset();
     }
 
     for (size_t i = 0; i < numberOfChannels_; ++i) {
@@ -70,6 +85,7 @@ AudioBuffer &AudioBuffer::operator=(const AudioBuffer &other) {
 AudioBuffer &AudioBuffer::operator=(audioapi::AudioBuffer &&other) noexcept {
   if (this != &other) {
     channels_ = std::move(other.channels_);
+    pagedFile_ = std::move(other.pagedFile_);
 
     numberOfChannels_ = std::exchange(other.numberOfChannels_, 0);
     sampleRate_ = std::exchange(other.sampleRate_, 0.0f);
@@ -101,6 +117,12 @@ std::shared_ptr<AudioArrayBuffer> AudioBuffer::getSharedChannel(size_t index) co
   return channels_[index];
 }
 
+bool AudioBuffer::isChannelDataShared() const noexcept {
+  return std::any_of(channels_.begin(), channels_.end(), [](const auto &channel) {
+    return channel.use_count() > 1;
+  });
+}
+
 void AudioBuffer::zero() {
   zero(0, getSize());
 }
@@ -111,6 +133,17 @@ void AudioBuffer::zero(size_t start, size_t length) {
   }
 }
 
+void AudioBuffer::truncate(size_t size) {
+  if (size >= size_) {
+    return;
+  }
+
+  for (auto &channel : channels_) {
+    channel->truncate(size);
+  }
+  size_ = size;
+}
+
 void AudioBuffer::sum(const AudioBuffer &source, ChannelInterpretation interpretation) {
   sum(source, 0, 0, getSize(), interpretation);
 }
@@ -13,6 +13,7 @@
 namespace audioapi {
 
 class AudioArrayBuffer;
+class PagedAudioFile;
 
 class AudioBuffer {
  public:
@@ -28,6 +29,13 @@ class AudioBuffer {
 
   explicit AudioBuffer() = default;
   explicit AudioBuffer(size_t size, int numberOfChannels, float sampleRate);
+
+  /// @brief Constructs a buffer from existing channels of equal size.
+  /// @param pagedFile Memory-mapped file the channels view, if any.
+  AudioBuffer(
+      std::vector<std::shared_ptr<AudioArrayBuffer>> channels,
+      float sampleRate,
+      std::shared_ptr<PagedAudioFile> pagedFile = nullptr);
   AudioBuffer(const AudioBuffer &other);
   AudioBuffer(AudioBuffer &&other) noexcept;
   AudioBuffer &operator=(const AudioBuffer &other);
@@ -48,6 +56,12 @@ class AudioBuffer {
     return static_cast<double>(size_) / static_cast<double>(getSampleRate());
   }
 
+  /// @brief Memory-mapped file the channels view, nullptr for buffers kept in memory.
+  /// @note Copies of a paged buffer are kept in memory.
+  [[nodiscard]] const std::shared_ptr<PagedAudioFile> &getPagedFile() const noexcept {
+    return pagedFile_;
+  }
+
   /// @brief Get the AudioArray for a specific channel index.
   /// @param index The channel index.
   /// @return Pointer to the AudioArray for the specified channel - not owning.
@@ -65,6 +79,9 @@ class AudioBuffer {
   /// @return Copy of shared pointer to the AudioArray for the specified channel
   [[nodiscard]] std::shared_ptr<AudioArrayBuffer> getSharedChannel(size_t index) const;
 
+  /// @brief Whether any channel is referenced outside of this buffer, e.g. by a JS array.
+  [[nodiscard]] bool isChannelDataShared() const noexcept;
+
   AudioArray &operator[](size_t index) {
     return *channels_[index];
   }
@@ -75,6 +92,10 @@ class AudioBuffer {
   void zero();
   void zero(size_t start, size_t length);
 
+  /// @brief Shrinks all channels to the given number of frames without reallocating.
+  /// @param size The new size, ignored if it is not smaller than the current one.
+  void truncate(size_t size);
+
   /// @brief Sums audio data from a source AudioBuffer into this AudioBuffer.
   /// @param source The source AudioBuffer to sum from.
   /// @param interpretation The channel interpretation to use for summing (default is SPEAKERS).
@@ -139,6 +160,7 @@ class AudioBuffer {
 
  private:
   std::vector<std::shared_ptr<AudioArrayBuffer>> channels_;
+  std::shared_ptr<PagedAudioFile> pagedFile_;
 
   size_t numberOfChannels_ = 0;
   float sampleRate_ = 0.0f;
@@ -0,0 +1,159 @@
+#include <audioapi/dsp/VectorMath.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBuffer.h>
+#include <audioapi/utils/AudioBufferBuilder.h>
+#include <audioapi/utils/PagedAudioFile.h>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace audioapi {
+
+AudioBufferBuilder::AudioBufferBuilder(
+    int numberOfChannels,
+    float sampleRate,
+    size_t expectedFrames,
+    std::string pagedFileDirectory)
+    : numberOfChannels_(numberOfChannels),
+      sampleRate_(sampleRate),
+      pagedFileDirectory_(std::move(pagedFileDirectory)) {
+  if (expectedFrames == 0) {
+    return;
+  }
+
+  if (auto paged = allocatePaged(expectedFrames + kExpectedFramesMargin)) {
+    chunks_.emplace_back(std::move(paged));
+    return;
+  }
+
+  allocateChunk(expectedFrames + kExpectedFramesMargin);
+}
+
+void AudioBufferBuilder::allocateChunk(size_t frames) {
+  chunks_.emplace_back(std::make_shared<AudioBuffer>(frames, numberOfChannels_, sampleRate_));
+  chunkFrames_ = 0;
+  allocatedFrames_ += frames;
+  peakAllocatedFrames_ = std::max(peakAllocatedFrames_, allocatedFrames_);
+}
+
+std::shared_ptr<AudioBuffer> AudioBufferBuilder::allocatePaged(size_t frames) const {
+  if (pagedFileDirectory_.empty()) {
+    return nullptr;
+  }
+
+  auto pagedFile =
+      PagedAudioFile::create(pagedFileDirectory_, frames, numberOfChannels_, sampleRate_);
+  return pagedFile ? pagedFile->createBuffer(frames) : nullptr;
+}
+
+template <typename WriteFrames>
+void AudioBufferBuilder::append(size_t frames, WriteFrames &&writeFrames) {
+  size_t sourceOffset = 0;
+
+  while (sourceOffset < frames) {
+    if (chunks_.empty() || chunkFrames_ == chunks_.back()->getSize()) {
+      allocateChunk(kChunkFrames);
+    }
+
+    auto &chunk = *chunks_.back();
+    size_t framesToWrite = std::min(frames - sourceOffset, chunk.getSize() - chunkFrames_);
+    writeFrames(chunk, chunkFrames_, sourceOffset, framesToWrite);
+
+    chunkFrames_ += framesToWrite;
+    sourceOffset += framesToWrite;
+  }
+
+  numberOfFrames_ += frames;
+}
+
+void AudioBufferBuilder::appendInterleaved(const float *source, size_t frames) {
+  append(
+      frames,
+      [this, source](
+          AudioBuffer &chunk, size_t destinationOffset, size_t sourceOffset, size_t length) {
+        const float *interleaved = source + sourceOffset * numberOfChannels_;
+
+        if (numberOfChannels_ == 1) {
+          chunk.getChannel(0)->copy(interleaved, 0, destinationOffset, length);
+          return;
+        }
+
+        if (numberOfChannels_ == 2) {
+          dsp::deinterleaveStereo(
+              interleaved,
+              chunk.getChannel(0)->begin() + destinationOffset,
+              chunk.getChannel(1)->begin() + destinationOffset,
+              length);
+          return;
+        }
+
+        for (int ch = 0; ch < numberOfChannels_; ++ch) {
+          float *destination = chunk.getChannel(ch)->begin() + destinationOffset;
+          for (size_t i = 0; i < length; ++i) {
+            destination[i] = interleaved[i * numberOfChannels_ + ch];
+          }
+        }
+      });
+}
+
+void AudioBufferBuilder::appendPlanar(const float *const *source, size_t frames) {
+  append(
+      frames,
+      [this, source](
+          AudioBuffer &chunk, size_t destinationOffset, size_t sourceOffset, size_t length) {
+        for (int ch = 0; ch < numberOfChannels_; ++ch) {
+          chunk.getChannel(ch)->copy(source[ch], sourceOffset, destinationOffset, length);
+        }
+      });
+}
+
+std::shared_ptr<AudioBuffer> AudioBufferBuilder::build() {
+  if (numberOfFrames_ == 0) {
+    return nullptr;
+  }
+
+  // a single chunk, either sized from the expected length or a short stream,
+  // is handed out as is, without copying
+  if (chunks_.size() == 1) {
+    auto audioBuffer = std::move(chunks_.front());
+    audioBuffer->truncate(numberOfFrames_);
+    chunks_.clear();
+    allocatedFrames_ = 0;
+
+    if (const auto &pagedFile = audioBuffer->getPagedFile()) {
+      pagedFile->startPaging();
+    }
+    return audioBuffer;
+  }
+
+  auto audioBuffer = allocatePaged(numberOfFrames_);
+  if (!audioBuffer) {
+    audioBuffer = std::make_shared<AudioBuffer>(numberOfFrames_, numberOfChannels_, sampleRate_);
+    allocatedFrames_ += numberOfFrames_;
+    peakAllocatedFrames_ = std::max(peakAllocatedFrames_, allocatedFrames_);
+  }
+
+  // chunks are released as soon as they are copied
+  size_t offset = 0;
+  for (size_t i = 0; i < chunks_.size(); ++i) {
+    size_t frames = i + 1 == chunks_.size() ? chunkFrames_ : chunks_[i]->getSize();
+    audioBuffer->copy(*chunks_[i], 0, offset, frames);
+    offset += frames;
+    chunks_[i].reset();
+  }
+
+  chunks_.clear();
+
+  if (const auto &pagedFile = audioBuffer->getPagedFile()) {
+    allocatedFrames_ = 0;
+    pagedFile->startPaging();
+  } else {
+    allocatedFrames_ = numberOfFrames_;
+  }
+  return audioBuffer;
+}
+
+} // namespace audioapi
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace audioapi {
+
+class AudioBuffer;
+
+/// @brief Assembles a planar AudioBuffer from blocks of decoded audio.
+/// When the expected length is known the frames are written straight into a single buffer
+/// of that size, otherwise into a list of fixed-size chunks joined together by build.
+/// Given a directory, the built buffer is a memory-mapped PagedAudioFile and the frames are
+/// written straight into the file when the expected length is known.
+/// @note Not thread-safe.
+class AudioBufferBuilder {
+ public:
+  /// @param numberOfChannels Number of channels of the appended audio.
+  /// @param sampleRate Sample rate of the built buffer.
+  /// @param expectedFrames Length reported by the container or 0 if unknown.
+  /// @param pagedFileDirectory Directory of the cache file, empty to keep the audio in memory.
+  /// Falls back to memory if the file cannot be created.
+  AudioBufferBuilder(
+      int numberOfChannels,
+      float sampleRate,
+      size_t expectedFrames = 0,
+      std::string pagedFileDirectory = {});
+
+  /// @brief Appends frames of interleaved audio [L0, R0, L1, R1, ...].
+  void appendInterleaved(const float *source, size_t frames);
+
+  /// @brief Appends frames of planar audio, one pointer per channel.
+  void appendPlanar(const float *const *source, size_t frames);
+
+  /// @brief Moves the appended audio into a buffer of the exact appended length.
+  /// @return The buffer or nullptr if no frames were appended.
+  std::shared_ptr<AudioBuffer> build();
+
+  [[nodiscard]] size_t getNumberOfFrames() const noexcept {
+    return numberOfFrames_;
+  }
+
+  /// @brief Largest number of frames per channel allocated in memory at once, including build.
+  [[nodiscard]] size_t getPeakAllocatedFrames() const noexcept {
+    return peakAllocatedFrames_;
+  }
+
+ private:
+  static constexpr size_t kChunkFrames = 65536;
+  // reported lengths may be a few frames short, e.g. after resampling or encoder padding
+  static constexpr size_t kExpectedFramesMargin = 4096;
+
+  int numberOfChannels_;
+  float sampleRate_;
+  std::string pagedFileDirectory_;
+  std::vector<std::shared_ptr<AudioBuffer>> chunks_;
+  // frames written into the last chunk
+  size_t chunkFrames_ = 0;
+  size_t numberOfFrames_ = 0;
+  size_t allocatedFrames_ = 0;
+  size_t peakAllocatedFrames_ = 0;
+
+  void allocateChunk(size_t frames);
+
+  /// @brief Allocates a buffer in a paged file, nullptr if there is no directory or it fails.
+  std::shared_ptr<AudioBuffer> allocatePaged(size_t frames) const;
+
+  template <typename WriteFrames>
+  void append(size_t frames, WriteFrames &&writeFrames);
+};
+
+} // namespace audioapi
@@ -8,32 +8,6 @@
 
 namespace audioapi {
 
-AudioFileProperties::AudioFileProperties(
-    FileDirectory directory,
-    const std::string &subDirectory,
-    const std::string &fileNamePrefix,
-    int channelCount,
-    size_t batchDurationSeconds,
-    Format format,
-    float sampleRate,
-    size_t bitRate,
-    BitDepth bitDepth,
-    int flacCompressionLevel,
-    int androidFlushIntervalMs,
-    IOSAudioQuality iosAudioQuality)
-    : directory(directory),
-      subDirectory(subDirectory),
-      fileNamePrefix(fileNamePrefix),
-      channelCount(channelCount),
-      batchDurationSeconds(batchDurationSeconds),
-      format(format),
-      sampleRate(sampleRate),
-      bitRate(bitRate),
-      bitDepth(bitDepth),
-      flacCompressionLevel(flacCompressionLevel),
-      androidFlushIntervalMs(androidFlushIntervalMs),
-      iosAudioQuality(iosAudioQuality) {}
-
 std::shared_ptr<AudioFileProperties> AudioFileProperties::CreateFromJSIValue(
     facebook::jsi::Runtime &runtime,
     const facebook::jsi::Value &value) {
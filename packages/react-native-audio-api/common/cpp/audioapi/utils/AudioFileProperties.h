@@ -53,7 +53,19 @@ class AudioFileProperties {
       BitDepth bitDepth,
       int flacCompressionLevel,
       int androidFlushIntervalMs,
-      IOSAudioQuality iosAudioQuality);
+      IOSAudioQuality iosAudioQuality)
+      : directory(directory),
+        subDirectory(subDirectory),
+        fileNamePrefix(fileNamePrefix),
+        channelCount(channelCount),
+        batchDurationSeconds(batchDurationSeconds),
+        format(format),
+        sampleRate(sampleRate),
+        bitRate(bitRate),
+        bitDepth(bitDepth),
+        flacCompressionLevel(flacCompressionLevel),
+        androidFlushIntervalMs(androidFlushIntervalMs),
+        iosAudioQuality(iosAudioQuality) {}
 
   static std::shared_ptr<AudioFileProperties> CreateFromJSIValue(
       facebook::jsi::Runtime &runtime,
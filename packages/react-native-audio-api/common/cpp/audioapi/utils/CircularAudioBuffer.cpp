@@ -0,0 +1,119 @@
+#include <audioapi/utils/CircularAudioBuffer.h>
+
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBuffer.h>
+
+#include <algorithm>
+
+namespace audioapi {
+
+CircularAudioBuffer::CircularAudioBuffer(
+    size_t capacity,
+    int numberOfChannels,
+    float sampleRate,
+    OverflowPolicy overflowPolicy)
+    : data_(capacity, numberOfChannels, sampleRate),
+      capacity_(capacity),
+      overflowPolicy_(overflowPolicy) {}
+
+size_t CircularAudioBuffer::write(const AudioBuffer &source, size_t frames) {
+  return write(frames, [&source](size_t channel) { return source.getChannel(channel)->begin(); });
+}
+
+size_t CircularAudioBuffer::read(AudioBuffer &destination, size_t frames) {
+  auto writePosition = writePosition_.load(std::memory_order_acquire);
+  auto readPosition = readPosition_.load(std::memory_order_relaxed);
+
+  if (writePosition - readPosition > capacity_) {
+    // the writer lapped the reader, skipping to the middle of the ring
+    // leaves room for the writes that happen while reading
+    auto skippedFrames = writePosition - readPosition - capacity_ / 2;
+    overflowFrames_.fetch_add(skippedFrames, std::memory_order_relaxed);
+    readPosition += skippedFrames;
+  }
+
+  auto framesToRead = std::min(frames, static_cast<size_t>(writePosition - readPosition));
+  underflowFrames_.fetch_add(frames - framesToRead, std::memory_order_relaxed);
+
+  auto index = static_cast<size_t>(readPosition % capacity_);
+  auto partSize = std::min(framesToRead, capacity_ - index);
+  auto numberOfChannels = std::min(destination.getNumberOfChannels(), getNumberOfChannels());
+
+  for (size_t channel = 0; channel < numberOfChannels; ++channel) {
+    auto *output = destination.getChannel(channel)->begin();
+    data_.getChannel(channel)->copyTo(output, index, 0, partSize);
+    data_.getChannel(channel)->copyTo(output, 0, partSize, framesToRead - partSize);
+  }
+
+  if (overflowPolicy_ == OverflowPolicy::OVERWRITE_OLDEST) {
+    // frames overwritten while they were copied are played anyway, but counted
+    auto lastWritePosition = writePosition_.load(std::memory_order_acquire);
+    if (lastWritePosition - readPosition > capacity_) {
+      auto overwrittenFrames = std::min(
+          static_cast<uint64_t>(framesToRead), lastWritePosition - readPosition - capacity_);
+      overflowFrames_.fetch_add(overwrittenFrames, std::memory_order_relaxed);
+    }
+  }
+
+  readPosition_.store(readPosition + framesToRead, std::memory_order_release);
+  readFrames_.fetch_add(framesToRead, std::memory_order_relaxed);
+
+  return framesToRead;
+}
+
+size_t CircularAudioBuffer::getNumberOfAvailableFrames() const {
+  auto readPosition = readPosition_.load(std::memory_order_acquire);
+  auto writePosition = writePosition_.load(std::memory_order_acquire);
+  return static_cast<size_t>(
+      std::min(writePosition - readPosition, static_cast<uint64_t>(capacity_)));
+}
+
+CircularAudioBuffer::Stats CircularAudioBuffer::getStats() const {
+  return {
+      writtenFrames_.load(std::memory_order_relaxed),
+      readFrames_.load(std::memory_order_relaxed),
+      overflowFrames_.load(std::memory_order_relaxed),
+      underflowFrames_.load(std::memory_order_relaxed),
+      getNumberOfAvailableFrames()};
+}
+
+void CircularAudioBuffer::clear() {
+  readPosition_.store(writePosition_.load(std::memory_order_relaxed), std::memory_order_release);
+}
+
+CircularAudioBuffer::WriteRange CircularAudioBuffer::beginWrite(size_t frames) {
+  auto writePosition = writePosition_.load(std::memory_order_relaxed);
+  auto framesToWrite = std::min(frames, capacity_);
+  size_t sourceOffset = 0;
+
+  if (overflowPolicy_ == OverflowPolicy::DROP_NEWEST) {
+    auto bufferedFrames = writePosition - readPosition_.load(std::memory_order_acquire);
+    framesToWrite = std::min(framesToWrite, capacity_ - static_cast<size_t>(bufferedFrames));
+  } else {
+    // the oldest frames of a write longer than the ring would be overwritten by its own newest
+    sourceOffset = frames - framesToWrite;
+  }
+
+  overflowFrames_.fetch_add(frames - framesToWrite, std::memory_order_relaxed);
+  return {writePosition, sourceOffset, framesToWrite};
+}
+
+void CircularAudioBuffer::writeChannel(
+    size_t channel,
+    const float *source,
+    uint64_t start,
+    size_t frames) {
+  auto index = static_cast<size_t>(start % capacity_);
+  auto partSize = std::min(frames, capacity_ - index);
+
+  data_.getChannel(channel)->copy(source, 0, index, partSize);
+  data_.getChannel(channel)->copy(source, partSize, 0, frames - partSize);
+}
+
+void CircularAudioBuffer::endWrite(uint64_t end) {
+  auto start = writePosition_.load(std::memory_order_relaxed);
+  writePosition_.store(end, std::memory_order_release);
+  writtenFrames_.fetch_add(end - start, std::memory_order_relaxed);
+}
+
+} // namespace audioapi
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <audioapi/utils/AudioBuffer.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace audioapi {
+
+/// @brief Planar multi-channel ring of audio frames between one writer and one reader thread.
+/// All channels share one pair of frame positions, so the reader never sees the channels
+/// at different positions. Writing and reading are wait-free.
+/// When the writer gets ahead of the reader, the overflow policy decides which frames are lost.
+/// Lost frames and frames the reader asked for before they were written are counted,
+/// so a drift between the writer and reader clocks shows in the stats.
+/// @note write is to be called from one thread, read from another one, getStats from any thread.
+class CircularAudioBuffer {
+ public:
+  enum class OverflowPolicy {
+    /// Frames that do not fit are dropped, the buffered ones are kept.
+    DROP_NEWEST,
+    /// The writer never drops, the reader skips the frames that were overwritten.
+    OVERWRITE_OLDEST,
+  };
+
+  struct Stats {
+    uint64_t writtenFrames;
+    uint64_t readFrames;
+    /// Frames dropped by the writer or skipped by the reader.
+    uint64_t overflowFrames;
+    /// Frames the reader asked for that were not written yet.
+    uint64_t underflowFrames;
+    size_t availableFrames;
+  };
+
+  CircularAudioBuffer(
+      size_t capacity,
+      int numberOfChannels,
+      float sampleRate,
+      OverflowPolicy overflowPolicy);
+
+  [[nodiscard]] size_t getCapacity() const noexcept {
+    return capacity_;
+  }
+
+  [[nodiscard]] size_t getNumberOfChannels() const noexcept {
+    return data_.getNumberOfChannels();
+  }
+
+  /// @brief Appends frames from the source, which has at least as many channels as the ring.
+  /// @return Number of frames written.
+  size_t write(const AudioBuffer &source, size_t frames);
+
+  /// @brief Appends planar frames.
+  /// @param channelData Callable returning the samples of a channel, by channel index.
+  /// @return Number of frames written.
+  template <typename F>
+  size_t write(size_t frames, F &&channelData) {
+    auto range = beginWrite(frames);
+    for (size_t channel = 0; channel < getNumberOfChannels(); ++channel) {
+      writeChannel(channel, channelData(channel) + range.sourceOffset, range.start, range.frames);
+    }
+    endWrite(range.start + range.frames);
+    return range.frames;
+  }
+
+  /// @brief Moves the oldest frames into the destination, which holds at least that many frames.
+  /// Frames that were not written yet are left untouched in the destination.
+  /// @return Number of frames read.
+  size_t read(AudioBuffer &destination, size_t frames);
+
+  [[nodiscard]] size_t getNumberOfAvailableFrames() const;
+
+  [[nodiscard]] Stats getStats() const;
+
+  /// @brief Drops the buffered frames.
+  /// @note To be called only when neither thread uses the ring.
+  void clear();
+
+ private:
+  AudioBuffer data_;
+  size_t capacity_;
+  OverflowPolicy overflowPolicy_;
+
+  // total frames written and read, the index in the ring is the position modulo the capacity
+  std::atomic<uint64_t> writePosition_{0};
+  std::atomic<uint64_t> readPosition_{0};
+
+  std::atomic<uint64_t> writtenFrames_{0};
+  std::atomic<uint64_t> readFrames_{0};
+  std::atomic<uint64_t> overflowFrames_{0};
+  std::atomic<uint64_t> underflowFrames_{0};
+
+  struct WriteRange {
+    /// Position in the ring to write at.
+    uint64_t start;
+    /// Source frames skipped, so that only the newest ones are written.
+    size_t sourceOffset;
+    /// Number of frames that fit.
+    size_t frames;
+  };
+
+  WriteRange beginWrite(size_t frames);
+  void writeChannel(size_t channel, const float *source, uint64_t start, size_t frames);
+  void endWrite(uint64_t end);
+};
+
+} // namespace audioapi
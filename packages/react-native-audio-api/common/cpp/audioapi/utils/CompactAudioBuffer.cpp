@@ -0,0 +1,101 @@
+#include <audioapi/dsp/AudioUtils.hpp>
+#include <audioapi/dsp/VectorMath.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBuffer.h>
+#include <audioapi/utils/CompactAudioBuffer.h>
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+
+namespace audioapi {
+
+CompactAudioBuffer::CompactAudioBuffer(const AudioBuffer &buffer, SampleFormat format)
+    : format_(format),
+      numberOfChannels_(buffer.getNumberOfChannels()),
+      size_(buffer.getSize()),
+      sampleRate_(buffer.getSampleRate()),
+      data_(numberOfChannels_ * size_) {
+  if (format_ == SampleFormat::FLOAT32) {
+    throw std::invalid_argument("Compact buffers store int16 or float16 samples.");
+  }
+
+  for (size_t ch = 0; ch < numberOfChannels_; ++ch) {
+    const float *source = buffer.getChannel(ch)->begin();
+    uint16_t *destination = data_.data() + ch * size_;
+
+    if (format_ == SampleFormat::INT16) {
+      for (size_t i = 0; i < size_; ++i) {
+        destination[i] = static_cast<uint16_t>(dsp::floatToInt16(source[i]));
+      }
+    } else {
+      for (size_t i = 0; i < size_; ++i) {
+        destination[i] = dsp::floatToFloat16(source[i]);
+      }
+    }
+  }
+}
+
+void CompactAudioBuffer::copyChannelTo(
+    size_t channel,
+    float *destination,
+    size_t sourceStart,
+    size_t length) const {
+  size_t available = sourceStart < size_ ? std::min(length, size_ - sourceStart) : 0;
+  const uint16_t *source = data_.data() + channel * size_ + sourceStart;
+
+  if (format_ == SampleFormat::INT16) {
+    dsp::convertInt16ToFloat(reinterpret_cast<const int16_t *>(source), destination, available);
+  } else {
+    dsp::convertFloat16ToFloat(source, destination, available);
+  }
+
+  std::fill(destination + available, destination + length, 0.0f);
+}
+
+void CompactAudioBuffer::copyTo(
+    AudioBuffer &destination,
+    size_t sourceStart,
+    size_t destinationStart,
+    size_t length) const {
+  for (size_t ch = 0; ch < destination.getNumberOfChannels(); ++ch) {
+    float *output = destination.getChannel(ch)->begin() + destinationStart;
+    auto sourceChannel = getSourceChannel(ch);
+
+    if (sourceChannel < numberOfChannels_) {
+      copyChannelTo(sourceChannel, output, sourceStart, length);
+    } else {
+      std::fill(output, output + length, 0.0f);
+    }
+  }
+}
+
+void CompactAudioBuffer::copyReverseTo(
+    AudioBuffer &destination,
+    size_t sourceStart,
+    size_t destinationStart,
+    size_t length) const {
+  for (size_t ch = 0; ch < destination.getNumberOfChannels(); ++ch) {
+    float *output = destination.getChannel(ch)->begin() + destinationStart;
+    auto sourceChannel = getSourceChannel(ch);
+
+    if (sourceChannel >= numberOfChannels_) {
+      std::fill(output, output + length, 0.0f);
+      continue;
+    }
+
+    // indices before the start wrap around and read as silence, as past the end
+    for (size_t i = 0; i < length; ++i) {
+      output[i] = getSample(sourceChannel, sourceStart - i);
+    }
+  }
+}
+
+std::shared_ptr<AudioBuffer> CompactAudioBuffer::toAudioBuffer() const {
+  auto buffer =
+      std::make_shared<AudioBuffer>(size_, static_cast<int>(numberOfChannels_), sampleRate_);
+  copyTo(*buffer, 0, 0, size_);
+  return buffer;
+}
+
+} // namespace audioapi
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <audioapi/core/types/SampleFormat.h>
+#include <audioapi/dsp/AudioUtils.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace audioapi {
+
+class AudioBuffer;
+
+/// @brief Immutable planar audio stored as 16-bit samples, either int16 or IEEE 754 half floats,
+/// taking half the memory of an AudioBuffer. Samples are converted back to float as they are read.
+/// @note Reads past the end of the audio return silence.
+class CompactAudioBuffer {
+ public:
+  /// @brief Converts the audio of the buffer to the format.
+  /// @param format SampleFormat::INT16 or SampleFormat::FLOAT16.
+  /// @note int16 samples are clamped to [-1, 1], half floats keep about 11 bits of precision
+  /// at any level.
+  CompactAudioBuffer(const AudioBuffer &buffer, SampleFormat format);
+
+  [[nodiscard]] SampleFormat getFormat() const noexcept {
+    return format_;
+  }
+  [[nodiscard]] size_t getNumberOfChannels() const noexcept {
+    return numberOfChannels_;
+  }
+  [[nodiscard]] size_t getSize() const noexcept {
+    return size_;
+  }
+  [[nodiscard]] float getSampleRate() const noexcept {
+    return sampleRate_;
+  }
+  [[nodiscard]] double getDuration() const noexcept {
+    return static_cast<double>(size_) / static_cast<double>(sampleRate_);
+  }
+  [[nodiscard]] size_t getSizeInBytes() const noexcept {
+    return data_.size() * sizeof(uint16_t);
+  }
+
+  /// @brief Converts a single sample, 0 past the end of the audio.
+  [[nodiscard]] float getSample(size_t channel, size_t index) const noexcept {
+    if (index >= size_) {
+      return 0.0f;
+    }
+
+    auto sample = data_[channel * size_ + index];
+    return format_ == SampleFormat::INT16 ? dsp::int16ToFloat(static_cast<int16_t>(sample))
+                                          : dsp::float16ToFloat(sample);
+  }
+
+  /// @brief Converts samples of a channel into the destination.
+  /// @param sourceStart The starting index in the channel.
+  /// @param length The number of samples to convert.
+  void copyChannelTo(size_t channel, float *destination, size_t sourceStart, size_t length) const;
+
+  /// @brief Converts audio data into the destination AudioBuffer.
+  /// @param sourceStart The starting index in this buffer.
+  /// @param destinationStart The starting index in the destination.
+  /// @param length The number of frames to convert.
+  /// @note Mono audio is copied to every destination channel, otherwise destination channels
+  /// missing in this buffer are zeroed.
+  void copyTo(
+      AudioBuffer &destination,
+      size_t sourceStart,
+      size_t destinationStart,
+      size_t length) const;
+
+  /// @brief Converts audio data into the destination AudioBuffer, reading backwards.
+  /// @param sourceStart The index in this buffer of the first frame to be written.
+  /// @note Channels are mapped as in copyTo.
+  void copyReverseTo(
+      AudioBuffer &destination,
+      size_t sourceStart,
+      size_t destinationStart,
+      size_t length) const;
+
+  /// @brief Converts the whole audio back to a float AudioBuffer.
+  [[nodiscard]] std::shared_ptr<AudioBuffer> toAudioBuffer() const;
+
+ private:
+  SampleFormat format_;
+  size_t numberOfChannels_;
+  size_t size_;
+  float sampleRate_;
+  std::vector<uint16_t> data_;
+
+  [[nodiscard]] size_t getSourceChannel(size_t destinationChannel) const noexcept {
+    return numberOfChannels_ == 1 ? 0 : destinationChannel;
+  }
+};
+
+} // namespace audioapi
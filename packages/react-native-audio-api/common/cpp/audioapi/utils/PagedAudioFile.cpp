@@ -0,0 +1,273 @@
+#include <audioapi/utils/AudioArrayBuffer.hpp>
+#include <audioapi/utils/AudioBuffer.h>
+#include <audioapi/utils/PagedAudioFile.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace audioapi {
+
+namespace {
+
+size_t roundUp(size_t value, size_t alignment) {
+  return (value + alignment - 1) / alignment * alignment;
+}
+
+// disk space is reserved up front, writing into a sparse mapping
+// on a full disk would raise SIGBUS instead of failing here
+bool reserve(int fd, size_t size) {
+#if defined(__APPLE__)
+  fstore_t store = {F_ALLOCATEALL, F_PEOFPOSMODE, 0, static_cast<off_t>(size), 0};
+  if (fcntl(fd, F_PREALLOCATE, &store) == -1) {
+    return false;
+  }
+  return ftruncate(fd, static_cast<off_t>(size)) == 0;
+#else
+  return posix_fallocate(fd, 0, static_cast<off_t>(size)) == 0;
+#endif
+}
+
+} // namespace
+
+std::shared_ptr<PagedAudioFile> PagedAudioFile::create(
+    const std::string &directory,
+    size_t frames,
+    int numberOfChannels,
+    float sampleRate) {
+  if (frames == 0 || numberOfChannels <= 0) {
+    return nullptr;
+  }
+
+  auto pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  size_t mappingSize =
+      roundUp((frames + kPaddingFrames) * sizeof(float), pageSize) * numberOfChannels;
+
+  std::string path = directory + "/audioapi-paged-XXXXXX";
+  int fd = mkstemp(path.data());
+  if (fd < 0) {
+    return nullptr;
+  }
+
+  // the open descriptor and then the mapping keep the file alive,
+  // so nothing is left behind even if the app is killed
+  unlink(path.c_str());
+
+  void *mapping = MAP_FAILED;
+  if (reserve(fd, mappingSize)) {
+    mapping = mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  }
+  close(fd);
+
+  if (mapping == MAP_FAILED) {
+    return nullptr;
+  }
+
+  return std::shared_ptr<PagedAudioFile>(
+      new PagedAudioFile(mapping, mappingSize, pageSize, numberOfChannels, sampleRate));
+}
+
+PagedAudioFile::PagedAudioFile(
+    void *mapping,
+    size_t mappingSize,
+    size_t pageSize,
+    int numberOfChannels,
+    float sampleRate)
+    : mapping_(mapping),
+      mappingSize_(mappingSize),
+      pageSize_(pageSize),
+      capacity_(mappingSize / numberOfChannels / sizeof(float)),
+      numberOfChannels_(numberOfChannels),
+      sampleRate_(sampleRate),
+      headFrames_(std::min(static_cast<size_t>(kHeadSeconds * sampleRate), capacity_)),
+      aheadFrames_(static_cast<size_t>(kPrefetchAheadSeconds * sampleRate)),
+      behindFrames_(static_cast<size_t>(kKeepBehindSeconds * sampleRate)) {}
+
+PagedAudioFile::~PagedAudioFile() {
+  {
+    std::lock_guard lock(mutex_);
+    isStopped_ = true;
+  }
+  condition_.notify_all();
+
+  if (pagingThread_.joinable()) {
+    pagingThread_.join();
+  }
+
+  munmap(mapping_, mappingSize_);
+}
+
+std::shared_ptr<AudioBuffer> PagedAudioFile::createBuffer(size_t frames) {
+  frames = std::min(frames, capacity_);
+  auto self = shared_from_this();
+
+  std::vector<std::shared_ptr<AudioArrayBuffer>> channels;
+  channels.reserve(numberOfChannels_);
+  for (int ch = 0; ch < numberOfChannels_; ++ch) {
+    channels.emplace_back(std::make_shared<AudioArrayBuffer>(getChannelData(ch), frames, self));
+  }
+
+  return std::make_shared<AudioBuffer>(std::move(channels), sampleRate_, std::move(self));
+}
+
+void PagedAudioFile::startPaging() {
+  // clean pages can be dropped and faulted back in from the file,
+  // dirty ones would keep counting towards the memory footprint
+  msync(mapping_, mappingSize_, MS_SYNC);
+  release(0, capacity_);
+  prefetch(0, headFrames_);
+
+  pagingThread_ = std::thread(&PagedAudioFile::pagingLoop, this);
+}
+
+size_t PagedAudioFile::getMaxResidentSizeInBytes() const noexcept {
+  size_t frames = headFrames_ + behindFrames_ + aheadFrames_;
+  // windows are extended to whole pages on both ends
+  return roundUp(frames * sizeof(float), pageSize_) * numberOfChannels_ +
+      2 * pageSize_ * numberOfChannels_;
+}
+
+void PagedAudioFile::pagingLoop() {
+  std::unique_lock lock(mutex_);
+
+  while (!isStopped_) {
+    lock.unlock();
+    updateWindow();
+    lock.lock();
+
+    condition_.wait_for(lock, kPagingInterval, [this] { return isStopped_; });
+  }
+}
+
+std::unique_ptr<PagedAudioFile::ResidentRegion> PagedAudioFile::keepResident(
+    size_t begin,
+    size_t end) {
+  begin = std::min(begin, capacity_);
+  end = std::min(end, capacity_);
+
+  {
+    std::lock_guard lock(regionsMutex_);
+    residentRegions_.push_back({begin, end});
+  }
+
+  // registered first, so the paging thread can not drop the pages faulted in here
+  prefetch(begin, end);
+
+  return std::unique_ptr<ResidentRegion>(new ResidentRegion(shared_from_this(), begin, end));
+}
+
+PagedAudioFile::ResidentRegion::~ResidentRegion() {
+  file_->removeResidentRegion(begin_, end_);
+}
+
+void PagedAudioFile::removeResidentRegion(size_t begin, size_t end) {
+  std::lock_guard lock(regionsMutex_);
+
+  auto it = std::find_if(residentRegions_.begin(), residentRegions_.end(), [&](const Window &r) {
+    return r.begin == begin && r.end == end;
+  });
+  if (it != residentRegions_.end()) {
+    residentRegions_.erase(it);
+  }
+
+  // nothing is dropped before paging starts
+  if (pagingThread_.joinable()) {
+    releaseUnused(begin, end);
+  }
+}
+
+void PagedAudioFile::updateWindow() {
+  size_t position = std::min(readPosition_.load(std::memory_order_relaxed), capacity_);
+  size_t begin = position > behindFrames_ ? position - behindFrames_ : 0;
+  size_t end = std::min(position + aheadFrames_, capacity_);
+
+  size_t oldBegin = windowBegin_.load(std::memory_order_relaxed);
+  size_t oldEnd = windowEnd_.load(std::memory_order_relaxed);
+  if (begin == oldBegin && end == oldEnd) {
+    return;
+  }
+
+  // parts of the new window outside of the previous one
+  prefetch(begin, std::min(end, oldBegin));
+  prefetch(std::max(begin, oldEnd), end);
+
+  std::lock_guard lock(regionsMutex_);
+  windowBegin_.store(begin, std::memory_order_relaxed);
+  windowEnd_.store(end, std::memory_order_relaxed);
+
+  // parts of the previous window outside of the new one
+  releaseUnused(oldBegin, std::min(oldEnd, begin));
+  releaseUnused(std::max(oldBegin, end), oldEnd);
+}
+
+void PagedAudioFile::releaseUnused(size_t begin, size_t end) const {
+  if (begin >= end) {
+    return;
+  }
+
+  std::vector<Window> kept = residentRegions_;
+  kept.push_back({0, headFrames_});
+  kept.push_back(getWindow());
+  std::sort(kept.begin(), kept.end(), [](const Window &a, const Window &b) {
+    return a.begin < b.begin;
+  });
+
+  // releases the gaps between the kept ranges
+  size_t position = begin;
+  for (const auto &range : kept) {
+    if (range.begin >= end) {
+      break;
+    }
+    if (range.end <= position) {
+      continue;
+    }
+    release(position, range.begin);
+    position = std::max(position, range.end);
+  }
+  release(position, end);
+}
+
+float *PagedAudioFile::getChannelData(int channel) const noexcept {
+  return static_cast<float *>(mapping_) + capacity_ * channel;
+}
+
+void PagedAudioFile::prefetch(size_t begin, size_t end) const {
+  if (begin >= end) {
+    return;
+  }
+
+  for (int ch = 0; ch < numberOfChannels_; ++ch) {
+    auto first = reinterpret_cast<uintptr_t>(getChannelData(ch) + begin) / pageSize_ * pageSize_;
+    auto last = reinterpret_cast<uintptr_t>(getChannelData(ch) + end);
+    madvise(reinterpret_cast<void *>(first), last - first, MADV_WILLNEED);
+
+    // WILLNEED only starts reading the file, touching every page maps it into
+    // this process, so the audio thread does not fault on it later
+    for (auto page = first; page < last; page += pageSize_) {
+      static_cast<void>(*reinterpret_cast<const volatile char *>(page));
+    }
+  }
+}
+
+void PagedAudioFile::release(size_t begin, size_t end) const {
+  if (begin >= end) {
+    return;
+  }
+
+  for (int ch = 0; ch < numberOfChannels_; ++ch) {
+    auto first = roundUp(reinterpret_cast<uintptr_t>(getChannelData(ch) + begin), pageSize_);
+    auto last = reinterpret_cast<uintptr_t>(getChannelData(ch) + end) / pageSize_ * pageSize_;
+    if (first < last) {
+      madvise(reinterpret_cast<void *>(first), last - first, MADV_DONTNEED);
+    }
+  }
+}
+
+} // namespace audioapi
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace audioapi {
+
+class AudioBuffer;
+
+/// @brief Planar float audio stored in a memory-mapped cache file instead of memory.
+/// Each channel is a page-aligned region of the file, followed by at least kPaddingFrames
+/// of silence. Once paging starts, a background thread keeps the pages around the published
+/// read position resident, prefetching ahead of it and dropping the ones left behind,
+/// so the resident size is bounded by the window no matter how long the audio is.
+/// Regions a reader is about to jump to, like a start offset or a loop start, are kept
+/// resident on top of the window while a ResidentRegion is held.
+/// @note The file is unlinked as soon as it is mapped and removed once the mapping is gone.
+/// @note setReadPosition is real-time safe, the remaining methods are not.
+class PagedAudioFile : public std::enable_shared_from_this<PagedAudioFile> {
+ public:
+  static constexpr size_t kPaddingFrames = 16384;
+  static constexpr double kPrefetchAheadSeconds = 4.0;
+  static constexpr double kKeepBehindSeconds = 1.0;
+  // the beginning stays resident for starts and loops back to the start
+  static constexpr double kHeadSeconds = 1.0;
+  static constexpr std::chrono::milliseconds kPagingInterval{10};
+
+  /// @brief Frames kept resident around the read position, the head excluded.
+  struct Window {
+    size_t begin;
+    size_t end;
+  };
+
+  /// @brief Keeps frames of the file resident for as long as it is held.
+  /// @note Not real-time safe, destroyed off the audio thread.
+  class ResidentRegion {
+   public:
+    ~ResidentRegion();
+    ResidentRegion(const ResidentRegion &) = delete;
+    ResidentRegion &operator=(const ResidentRegion &) = delete;
+
+   private:
+    friend class PagedAudioFile;
+
+    ResidentRegion(std::shared_ptr<PagedAudioFile> file, size_t begin, size_t end)
+        : file_(std::move(file)), begin_(begin), end_(end) {}
+
+    std::shared_ptr<PagedAudioFile> file_;
+    size_t begin_;
+    size_t end_;
+  };
+
+  /// @brief Creates a zeroed cache file in the directory and maps it.
+  /// @param frames Number of frames per channel to be written.
+  /// @return nullptr if the file cannot be created or mapped.
+  [[nodiscard]] static std::shared_ptr<PagedAudioFile>
+  create(const std::string &directory, size_t frames, int numberOfChannels, float sampleRate);
+
+  ~PagedAudioFile();
+  PagedAudioFile(const PagedAudioFile &) = delete;
+  PagedAudioFile &operator=(const PagedAudioFile &) = delete;
+
+  /// @brief Frames per channel that can be viewed, the padding included.
+  [[nodiscard]] size_t getCapacity() const noexcept {
+    return capacity_;
+  }
+
+  /// @brief Creates a buffer viewing the first frames of every channel.
+  /// @param frames Number of frames, up to getCapacity(). Frames never written read as 0.
+  [[nodiscard]] std::shared_ptr<AudioBuffer> createBuffer(size_t frames);
+
+  /// @brief Flushes the written audio to the file, drops it from memory and starts paging.
+  /// @note To be called once, after the audio has been written through a buffer view.
+  void startPaging();
+
+  /// @brief Faults in frames [begin, end) on the calling thread and keeps them resident,
+  /// regardless of the read position, until the returned region is destroyed.
+  /// Used for the frames a reader jumps to, so the jump does not fault on the audio thread.
+  /// @note Not real-time safe.
+  [[nodiscard]] std::unique_ptr<ResidentRegion> keepResident(size_t begin, size_t end);
+
+  /// @brief Publishes the frame being read, the resident window follows it.
+  void setReadPosition(size_t frame) noexcept {
+    readPosition_.store(frame, std::memory_order_relaxed);
+  }
+
+  [[nodiscard]] Window getWindow() const noexcept {
+    return {
+        windowBegin_.load(std::memory_order_relaxed), windowEnd_.load(std::memory_order_relaxed)};
+  }
+
+  /// @brief Upper bound of the resident size once paging has started, resident regions
+  /// excluded.
+  [[nodiscard]] size_t getMaxResidentSizeInBytes() const noexcept;
+
+ private:
+  PagedAudioFile(
+      void *mapping,
+      size_t mappingSize,
+      size_t pageSize,
+      int numberOfChannels,
+      float sampleRate);
+
+  void *mapping_;
+  size_t mappingSize_;
+  size_t pageSize_;
+  size_t capacity_;
+  int numberOfChannels_;
+  float sampleRate_;
+  size_t headFrames_;
+  size_t aheadFrames_;
+  size_t behindFrames_;
+
+  std::atomic<size_t> readPosition_{0};
+  std::atomic<size_t> windowBegin_{0};
+  std::atomic<size_t> windowEnd_{0};
+
+  std::thread pagingThread_;
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  bool isStopped_ = false;
+  // guards the resident regions and releasing pages, so no kept page is dropped
+  std::mutex regionsMutex_;
+  std::vector<Window> residentRegions_;
+
+  void pagingLoop();
+  void updateWindow();
+  void removeResidentRegion(size_t begin, size_t end);
+
+  /// @brief Drops the pages of frames [begin, end) outside of the head, the window and
+  /// the resident regions.
+  /// @note To be called with regionsMutex_ held.
+  void releaseUnused(size_t begin, size_t end) const;
+
+  [[nodiscard]] float *getChannelData(int channel) const noexcept;
+
+  /// @brief Faults in the pages holding frames [begin, end) of every channel.
+  void prefetch(size_t begin, size_t end) const;
+
+  /// @brief Drops the pages lying entirely within frames [begin, end) of every channel.
+  void release(size_t begin, size_t end) const;
+};
+
+} // namespace audioapi
@@ -0,0 +1,174 @@
+#include <audioapi/utils/WorkStealingExecutor.h>
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace audioapi {
+
+namespace {
+
+// lets tasks scheduled from a worker land in its own queue
+thread_local const WorkStealingExecutor *currentExecutor = nullptr;
+thread_local size_t currentWorker = 0;
+
+} // namespace
+
+WorkStealingExecutor::WorkStealingExecutor(size_t numThreads)
+    : maxBulkTasks_(std::max<size_t>(numThreads, 2) - 1) {
+  numThreads = std::max<size_t>(numThreads, 1);
+  workers_.reserve(numThreads);
+  for (size_t i = 0; i < numThreads; ++i) {
+    workers_.push_back(std::make_unique<Worker>());
+  }
+
+  threads_.reserve(numThreads);
+  for (size_t i = 0; i < numThreads; ++i) {
+    threads_.emplace_back(&WorkStealingExecutor::run, this, i);
+  }
+}
+
+WorkStealingExecutor::~WorkStealingExecutor() {
+  {
+    std::lock_guard<std::mutex> lock(sleepMutex_);
+    isExiting_.store(true, std::memory_order_release);
+  }
+  wakeUp_.notify_all();
+
+  for (auto &thread : threads_) {
+    thread.join();
+  }
+}
+
+void WorkStealingExecutor::submit(TaskPriority priority, Task &&task) {
+  auto lane = static_cast<size_t>(priority);
+  auto index = currentExecutor == this
+      ? currentWorker
+      : nextWorker_.fetch_add(1, std::memory_order_relaxed) % workers_.size();
+  auto &worker = *workers_[index];
+
+  {
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    worker.queues[lane].push_back(std::move(task));
+    queuedTasks_[lane].fetch_add(1, std::memory_order_release);
+  }
+
+  wakeUpWorker();
+}
+
+void WorkStealingExecutor::run(size_t index) {
+  currentExecutor = this;
+  currentWorker = index;
+
+  Task task;
+  TaskPriority priority = TaskPriority::INTERACTIVE;
+
+  while (true) {
+    if (tryTake(index, task, priority)) {
+      task();
+      // the captured state is released before the worker looks for the next task
+      task = nullptr;
+
+      if (priority == TaskPriority::BULK) {
+        runningBulkTasks_.fetch_sub(1, std::memory_order_acq_rel);
+        // a bulk task may have been held back by the one that just finished
+        auto queuedBulkTasks =
+            queuedTasks_[static_cast<size_t>(TaskPriority::BULK)].load(std::memory_order_acquire);
+        if (queuedBulkTasks > 0) {
+          wakeUpWorker();
+        }
+      }
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock(sleepMutex_);
+    // the queued tasks are run before the worker exits
+    if (isExiting_.load(std::memory_order_acquire) &&
+        std::ranges::all_of(queuedTasks_, [](const std::atomic<size_t> &queued) {
+          return queued.load(std::memory_order_acquire) == 0;
+        })) {
+      return;
+    }
+    wakeUp_.wait(lock, [this]() {
+      return isExiting_.load(std::memory_order_acquire) || hasTakeableTask();
+    });
+  }
+}
+
+bool WorkStealingExecutor::tryTake(size_t index, Task &task, TaskPriority &priority) {
+  if (tryTakeFrom(index, TaskPriority::INTERACTIVE, task)) {
+    priority = TaskPriority::INTERACTIVE;
+    return true;
+  }
+
+  auto queuedBulkTasks =
+      queuedTasks_[static_cast<size_t>(TaskPriority::BULK)].load(std::memory_order_acquire);
+  if (queuedBulkTasks == 0 || !tryAcquireBulkSlot()) {
+    return false;
+  }
+
+  if (tryTakeFrom(index, TaskPriority::BULK, task)) {
+    priority = TaskPriority::BULK;
+    return true;
+  }
+
+  runningBulkTasks_.fetch_sub(1, std::memory_order_acq_rel);
+  return false;
+}
+
+bool WorkStealingExecutor::tryTakeFrom(size_t index, TaskPriority priority, Task &task) {
+  auto lane = static_cast<size_t>(priority);
+
+  // the worker's own queue first, then the others in order
+  for (size_t i = 0; i < workers_.size(); ++i) {
+    auto &worker = *workers_[(index + i) % workers_.size()];
+    std::lock_guard<std::mutex> lock(worker.mutex);
+
+    auto &queue = worker.queues[lane];
+    if (!queue.empty()) {
+      task = std::move(queue.front());
+      queue.pop_front();
+      queuedTasks_[lane].fetch_sub(1, std::memory_order_release);
+      return true;
+    }
+  }
+
+  return false;
+}
+
+bool WorkStealingExecutor::tryAcquireBulkSlot() {
+  // the limit is lifted while exiting, so the remaining bulk tasks run on all the workers
+  if (isExiting_.load(std::memory_order_acquire)) {
+    runningBulkTasks_.fetch_add(1, std::memory_order_acq_rel);
+    return true;
+  }
+
+  auto running = runningBulkTasks_.load(std::memory_order_acquire);
+  while (running < maxBulkTasks_) {
+    if (runningBulkTasks_.compare_exchange_weak(
+            running, running + 1, std::memory_order_acq_rel, std::memory_order_acquire)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool WorkStealingExecutor::hasTakeableTask() const {
+  auto queuedInteractiveTasks =
+      queuedTasks_[static_cast<size_t>(TaskPriority::INTERACTIVE)].load(std::memory_order_acquire);
+  auto queuedBulkTasks =
+      queuedTasks_[static_cast<size_t>(TaskPriority::BULK)].load(std::memory_order_acquire);
+
+  return queuedInteractiveTasks > 0 ||
+      (queuedBulkTasks > 0 &&
+       runningBulkTasks_.load(std::memory_order_acquire) < maxBulkTasks_);
+}
+
+void WorkStealingExecutor::wakeUpWorker() {
+  // taking the lock orders this wake up after the check of a worker going to sleep
+  { std::lock_guard<std::mutex> lock(sleepMutex_); }
+  wakeUp_.notify_one();
+}
+
+} // namespace audioapi
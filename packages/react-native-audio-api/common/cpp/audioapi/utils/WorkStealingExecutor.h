@@ -0,0 +1,103 @@
+#pragma once
+
+#include <audioapi/utils/MoveOnlyFunction.hpp>
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace audioapi {
+
+/// @brief Lane a task is scheduled in.
+/// INTERACTIVE tasks are short and awaited by the user, e.g. resuming a context.
+/// BULK tasks may take seconds, e.g. decoding or stretching a file.
+enum class TaskPriority { INTERACTIVE, BULK };
+
+/// @brief A thread pool where every worker has its own task queues and takes tasks from the
+/// queues of the other workers once its own are empty, so no task waits behind a long one while
+/// another worker is idle.
+/// @note Tasks can be scheduled from any thread, including the workers.
+/// @note INTERACTIVE tasks are always taken before BULK ones, and BULK tasks never occupy all the
+/// workers, so an interactive task does not wait for a bulk one to finish.
+class WorkStealingExecutor {
+ public:
+  using Task = audioapi::move_only_function<void()>;
+
+  /// @brief Construct a new WorkStealingExecutor
+  /// @param numThreads The number of worker threads to create
+  explicit WorkStealingExecutor(size_t numThreads);
+
+  /// @brief Runs the tasks still queued and joins the workers.
+  ~WorkStealingExecutor();
+
+  WorkStealingExecutor(const WorkStealingExecutor &) = delete;
+  WorkStealingExecutor &operator=(const WorkStealingExecutor &) = delete;
+
+  /// @brief Schedule a task to be executed by one of the workers
+  /// @param priority The lane the task is scheduled in
+  /// @param task The task function to be executed
+  /// @param args The arguments to be passed to the task function
+  /// @note Please remember that the task will be executed in a different thread, so make sure to pass any required variables by value or with std::move.
+  /// @note The task should not throw exceptions, as they will not be caught.
+  template <
+      typename Func,
+      typename... Args,
+      typename = std::enable_if_t<std::is_invocable_r_v<void, Func, Args...>>>
+  void schedule(TaskPriority priority, Func &&task, Args &&...args) {
+    submit(
+        priority,
+        Task([f = std::forward<Func>(task), ... capturedArgs = std::forward<Args>(args)]() mutable {
+          f(std::forward<Args>(capturedArgs)...);
+        }));
+  }
+
+  /// @brief Schedule a type erased task, see schedule
+  void submit(TaskPriority priority, Task &&task);
+
+  [[nodiscard]] size_t getNumberOfThreads() const {
+    return threads_.size();
+  }
+
+ private:
+  static constexpr size_t kNumberOfPriorities = 2;
+
+  struct Worker {
+    /// @brief Queued tasks, one queue per priority, guarded by mutex
+    std::array<std::deque<Task>, kNumberOfPriorities> queues;
+    std::mutex mutex;
+  };
+
+  std::vector<std::unique_ptr<Worker>> workers_;
+  std::vector<std::thread> threads_;
+
+  /// @brief Number of tasks queued in every priority, changed under the lock of the queue
+  std::array<std::atomic<size_t>, kNumberOfPriorities> queuedTasks_{};
+
+  /// @brief Number of workers running a BULK task, at most maxBulkTasks_
+  std::atomic<size_t> runningBulkTasks_{0};
+  size_t maxBulkTasks_;
+
+  /// @brief Worker queue of the next task scheduled from outside of the pool
+  std::atomic<size_t> nextWorker_{0};
+
+  std::atomic<bool> isExiting_{false};
+  std::mutex sleepMutex_;
+  std::condition_variable wakeUp_;
+
+  void run(size_t index);
+  bool tryTake(size_t index, Task &task, TaskPriority &priority);
+  bool tryTakeFrom(size_t index, TaskPriority priority, Task &task);
+  bool tryAcquireBulkSlot();
+  [[nodiscard]] bool hasTakeableTask() const;
+  void wakeUpWorker();
+};
+
+} // namespace audioapi
@@ -0,0 +1,100 @@
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBuffer.h>
+#include <audioapi/utils/AudioBufferBuilder.h>
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+
+using namespace audioapi;
+
+class AudioBufferBuilderTest : public ::testing::Test {
+ protected:
+  static constexpr float sampleRate = 44100.0f;
+  static constexpr size_t decodeChunkFrames = 4096;
+
+  // frame i of channel ch holds i * 10 + ch
+  static void appendInterleavedRamp(AudioBufferBuilder &builder, int channels, size_t frames) {
+    std::vector<float> chunk(decodeChunkFrames * channels);
+    for (size_t start = 0; start < frames; start += decodeChunkFrames) {
+      size_t length = std::min(decodeChunkFrames, frames - start);
+      for (size_t i = 0; i < length; ++i) {
+        for (int ch = 0; ch < channels; ++ch) {
+          chunk[i * channels + ch] = static_cast<float>((start + i) * 10 + ch);
+        }
+      }
+      builder.appendInterleaved(chunk.data(), length);
+    }
+  }
+
+  static void expectRamp(const AudioBuffer &buffer, int channels, size_t frames) {
+    ASSERT_EQ(buffer.getNumberOfChannels(), channels);
+    ASSERT_EQ(buffer.getSize(), frames);
+    for (int ch = 0; ch < channels; ++ch) {
+      for (size_t i = 0; i < frames; ++i) {
+        ASSERT_FLOAT_EQ((*buffer.getChannel(ch))[i], static_cast<float>(i * 10 + ch));
+      }
+    }
+  }
+};
+
+TEST_F(AudioBufferBuilderTest, EmptyBuilderReturnsNull) {
+  AudioBufferBuilder builder(2, sampleRate, 1000);
+  EXPECT_EQ(builder.build(), nullptr);
+}
+
+TEST_F(AudioBufferBuilderTest, KnownLengthIsDecodedInPlace) {
+  static constexpr size_t frames = 200000;
+  AudioBufferBuilder builder(2, sampleRate, frames);
+  appendInterleavedRamp(builder, 2, frames);
+
+  auto buffer = builder.build();
+  ASSERT_NE(buffer, nullptr);
+  expectRamp(*buffer, 2, frames);
+
+  // one allocation of the reported length plus a small margin, never a second copy
+  EXPECT_LT(builder.getPeakAllocatedFrames(), frames + decodeChunkFrames * 2);
+}
+
+TEST_F(AudioBufferBuilderTest, OverestimatedLengthIsTruncated) {
+  static constexpr size_t frames = 100000;
+  AudioBufferBuilder builder(3, sampleRate, frames + 500);
+  appendInterleavedRamp(builder, 3, frames);
+
+  auto buffer = builder.build();
+  ASSERT_NE(buffer, nullptr);
+  expectRamp(*buffer, 3, frames);
+  EXPECT_LT(builder.getPeakAllocatedFrames(), frames + decodeChunkFrames * 2);
+}
+
+TEST_F(AudioBufferBuilderTest, UnknownLengthFallsBackToChunks) {
+  static constexpr size_t frames = 300001;
+  AudioBufferBuilder builder(1, sampleRate);
+  appendInterleavedRamp(builder, 1, frames);
+
+  auto buffer = builder.build();
+  ASSERT_NE(buffer, nullptr);
+  expectRamp(*buffer, 1, frames);
+
+  // chunks plus the joined buffer, no regrowth of a contiguous vector
+  EXPECT_LE(builder.getPeakAllocatedFrames(), frames * 2 + 65536);
+}
+
+TEST_F(AudioBufferBuilderTest, PlanarFramesAreAppended) {
+  static constexpr size_t frames = 10000;
+  std::vector<float> left(frames);
+  std::vector<float> right(frames);
+  for (size_t i = 0; i < frames; ++i) {
+    left[i] = static_cast<float>(i * 10);
+    right[i] = static_cast<float>(i * 10 + 1);
+  }
+
+  AudioBufferBuilder builder(2, sampleRate);
+  for (size_t start = 0; start < frames; start += 1000) {
+    const float *planes[] = {left.data() + start, right.data() + start};
+    builder.appendPlanar(planes, 1000);
+  }
+
+  auto buffer = builder.build();
+  ASSERT_NE(buffer, nullptr);
+  expectRamp(*buffer, 2, frames);
+}
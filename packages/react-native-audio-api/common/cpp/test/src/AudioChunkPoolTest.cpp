@@ -0,0 +1,268 @@
+#include <audioapi/core/utils/AudioChunkPool.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBuffer.h>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace audioapi;
+
+class AudioChunkPoolTest : public ::testing::Test {
+ protected:
+  static constexpr float sampleRate = 8000.0f;
+  static constexpr int channels = 2;
+  static constexpr size_t chunkFrames = 64;
+  static constexpr size_t quantum = 128;
+
+  std::vector<float> left;
+  std::vector<float> right;
+
+  // writes frames counting up from start, negated on the right channel
+  void write(AudioChunkPool &pool, size_t start, size_t frames) {
+    left.resize(frames);
+    right.resize(frames);
+    for (size_t i = 0; i < frames; ++i) {
+      left[i] = static_cast<float>(start + i);
+      right[i] = -static_cast<float>(start + i);
+    }
+    const float *data[] = {left.data(), right.data()};
+    ASSERT_TRUE(pool.write(data, 0, frames));
+  }
+
+  static void expectFrames(const AudioBuffer &buffer, size_t offset, size_t start, size_t frames) {
+    for (size_t i = 0; i < frames; ++i) {
+      ASSERT_EQ((*buffer.getChannel(0))[offset + i], static_cast<float>(start + i));
+      ASSERT_EQ((*buffer.getChannel(1))[offset + i], -static_cast<float>(start + i));
+    }
+  }
+
+  static void expectSilence(const AudioBuffer &buffer, size_t offset, size_t frames) {
+    for (size_t i = 0; i < frames; ++i) {
+      ASSERT_EQ((*buffer.getChannel(0))[offset + i], 0.0f);
+      ASSERT_EQ((*buffer.getChannel(1))[offset + i], 0.0f);
+    }
+  }
+};
+
+TEST_F(AudioChunkPoolTest, PlaybackStartsAfterPrebuffering) {
+  AudioChunkPool pool(channels, sampleRate, 8, chunkFrames, 256, 0);
+  AudioBuffer output(quantum, channels, sampleRate);
+
+  write(pool, 1, 200);
+  EXPECT_EQ(pool.read(output, 0, quantum), 0);
+  expectSilence(output, 0, quantum);
+  EXPECT_TRUE(pool.getStats().isBuffering);
+
+  write(pool, 201, 100);
+  EXPECT_EQ(pool.read(output, 0, quantum), quantum);
+  expectFrames(output, 0, 1, quantum);
+  EXPECT_EQ(pool.read(output, 0, quantum), quantum);
+  expectFrames(output, 0, 1 + quantum, quantum);
+
+  auto stats = pool.getStats();
+  EXPECT_FALSE(stats.isBuffering);
+  EXPECT_EQ(stats.underruns, 0);
+  EXPECT_EQ(stats.underrunFrames, quantum);
+  // the last 44 frames are still held by the writer
+  EXPECT_EQ(stats.bufferedFrames, 0);
+}
+
+TEST_F(AudioChunkPoolTest, UnderrunRestartsPrebuffering) {
+  AudioChunkPool pool(channels, sampleRate, 8, chunkFrames, 128, 0);
+  AudioBuffer output(quantum, channels, sampleRate);
+
+  write(pool, 1, 192);
+  EXPECT_EQ(pool.read(output, 0, quantum), quantum);
+  EXPECT_EQ(pool.read(output, 0, quantum), 64);
+  expectFrames(output, 0, 1 + quantum, 64);
+  expectSilence(output, 64, 64);
+
+  auto stats = pool.getStats();
+  EXPECT_EQ(stats.underruns, 1);
+  EXPECT_EQ(stats.underrunFrames, 64);
+  EXPECT_TRUE(stats.isBuffering);
+
+  // not enough to resume yet
+  write(pool, 193, 64);
+  EXPECT_EQ(pool.read(output, 0, quantum), 0);
+  write(pool, 257, 64);
+  EXPECT_EQ(pool.read(output, 0, quantum), quantum);
+  expectFrames(output, 0, 193, quantum);
+}
+
+TEST_F(AudioChunkPoolTest, ReadsIntoTheMiddleOfTheBuffer) {
+  AudioChunkPool pool(channels, sampleRate, 8, chunkFrames, 0, 0);
+  AudioBuffer output(quantum, channels, sampleRate);
+
+  write(pool, 1, 128);
+  EXPECT_EQ(pool.read(output, 32, 96), 96);
+  expectSilence(output, 0, 32);
+  expectFrames(output, 32, 1, 96);
+}
+
+TEST_F(AudioChunkPoolTest, FinishPlaysTheRemainderWithoutUnderrun) {
+  AudioChunkPool pool(channels, sampleRate, 8, chunkFrames, 1000, 0);
+  AudioBuffer output(quantum, channels, sampleRate);
+
+  write(pool, 1, 100);
+  pool.finish();
+
+  EXPECT_EQ(pool.read(output, 0, quantum), 100);
+  expectFrames(output, 0, 1, 100);
+  expectSilence(output, 100, quantum - 100);
+  EXPECT_EQ(pool.getStats().underruns, 0);
+}
+
+TEST_F(AudioChunkPoolTest, WriterWaitsForTheLowWaterMark) {
+  static constexpr size_t numberOfChunks = 8;
+  AudioChunkPool pool(channels, sampleRate, numberOfChunks, chunkFrames, 0, 128);
+  ASSERT_EQ(pool.getCapacity(), (numberOfChunks - 1) * chunkFrames);
+
+  std::atomic<size_t> written{0};
+  std::thread writer([&] {
+    for (size_t i = 0; i < 16; ++i) {
+      write(pool, 1 + i * chunkFrames, chunkFrames);
+      written.fetch_add(chunkFrames);
+    }
+  });
+
+  auto waitForWritten = [&](size_t frames) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (written.load() < frames && std::chrono::steady_clock::now() < deadline) {
+      std::this_thread::sleep_for(AudioChunkPool::kWriterPollInterval);
+    }
+    return written.load();
+  };
+
+  // every chunk is filled
+  EXPECT_EQ(waitForWritten(numberOfChunks * chunkFrames), numberOfChunks * chunkFrames);
+  std::this_thread::sleep_for(AudioChunkPool::kWriterPollInterval * 4);
+  EXPECT_EQ(written.load(), numberOfChunks * chunkFrames);
+
+  // freeing chunks above the low-water mark does not wake the writer
+  AudioBuffer output(quantum, channels, sampleRate);
+  EXPECT_EQ(pool.read(output, 0, quantum), quantum);
+  EXPECT_EQ(pool.read(output, 0, quantum), quantum);
+  std::this_thread::sleep_for(AudioChunkPool::kWriterPollInterval * 4);
+  EXPECT_EQ(written.load(), numberOfChunks * chunkFrames);
+
+  // below it, the pool is refilled with every free chunk
+  EXPECT_EQ(pool.read(output, 0, quantum), quantum);
+  EXPECT_EQ(pool.read(output, 0, 64), 64);
+  EXPECT_EQ(waitForWritten(15 * chunkFrames), 15 * chunkFrames);
+
+  size_t start = 1 + 3 * quantum + 64;
+  auto readChunk = [&] {
+    ASSERT_EQ(pool.read(output, 0, chunkFrames), chunkFrames);
+    expectFrames(output, 0, start, chunkFrames);
+    start += chunkFrames;
+  };
+
+  while (pool.getStats().bufferedFrames >= 128) {
+    readChunk();
+  }
+  EXPECT_EQ(waitForWritten(16 * chunkFrames), 16 * chunkFrames);
+  writer.join();
+
+  while (start < 1 + 16 * chunkFrames) {
+    readChunk();
+  }
+  EXPECT_EQ(pool.getStats().underruns, 0);
+}
+
+TEST_F(AudioChunkPoolTest, CloseStopsAWaitingWriter) {
+  AudioChunkPool pool(channels, sampleRate, 2, chunkFrames, 0, 0);
+
+  std::atomic<bool> result{true};
+  std::thread writer([&] {
+    std::vector<float> data(chunkFrames * 4, 0.5f);
+    const float *channelData[] = {data.data(), data.data()};
+    result = pool.write(channelData, 0, data.size());
+  });
+
+  std::this_thread::sleep_for(AudioChunkPool::kWriterPollInterval * 4);
+  pool.close();
+  writer.join();
+  EXPECT_FALSE(result.load());
+}
+
+TEST_F(AudioChunkPoolTest, FlushDropsTheBufferedAudio) {
+  AudioChunkPool pool(channels, sampleRate, 8, chunkFrames, 128, 0);
+  AudioBuffer output(quantum, channels, sampleRate);
+
+  write(pool, 1, 256);
+  EXPECT_EQ(pool.read(output, 0, 64), 64);
+
+  pool.flush();
+  const float *data[] = {left.data(), right.data()};
+  EXPECT_FALSE(pool.write(data, 0, 64));
+
+  // until acknowledged, the audio thread drops what it gets
+  EXPECT_EQ(pool.read(output, 0, quantum), 0);
+  expectSilence(output, 0, quantum);
+  EXPECT_EQ(pool.getStats().bufferedFrames, 0);
+
+  pool.acknowledgeFlush();
+  write(pool, 1001, 100);
+  EXPECT_EQ(pool.read(output, 0, quantum), 0);
+  write(pool, 1101, 100);
+  EXPECT_EQ(pool.read(output, 0, quantum), quantum);
+  expectFrames(output, 0, 1001, quantum);
+  EXPECT_EQ(pool.getStats().underruns, 0);
+}
+
+TEST_F(AudioChunkPoolTest, FlushIsPendingUntilAcknowledged) {
+  AudioChunkPool pool(channels, sampleRate, 8, chunkFrames, 0, 0);
+  EXPECT_FALSE(pool.isFlushPending());
+
+  pool.flush();
+  EXPECT_TRUE(pool.isFlushPending());
+  left.assign(chunkFrames, 0.0f);
+  right.assign(chunkFrames, 0.0f);
+  const float *data[] = {left.data(), right.data()};
+  EXPECT_FALSE(pool.write(data, 0, chunkFrames));
+
+  // a second flush before the acknowledgement is covered by it
+  pool.flush();
+  pool.acknowledgeFlush();
+  EXPECT_FALSE(pool.isFlushPending());
+  write(pool, 0, chunkFrames);
+}
+
+TEST_F(AudioChunkPoolTest, FlushWakesAWriterAfterTheEnd) {
+  AudioChunkPool pool(channels, sampleRate, 8, chunkFrames, 0, 0);
+
+  write(pool, 1, 100);
+  pool.finish();
+
+  std::atomic<bool> isFlushed{false};
+  std::thread writer([&] { isFlushed = pool.waitForFlush(); });
+  pool.flush();
+  writer.join();
+  EXPECT_TRUE(isFlushed.load());
+
+  pool.acknowledgeFlush();
+  AudioBuffer output(quantum, channels, sampleRate);
+  write(pool, 501, 128);
+  EXPECT_EQ(pool.read(output, 0, quantum), quantum);
+  expectFrames(output, 0, 501, quantum);
+
+  std::thread closed([&] { isFlushed = pool.waitForFlush(); });
+  pool.close();
+  closed.join();
+  EXPECT_FALSE(isFlushed.load());
+}
+
+TEST_F(AudioChunkPoolTest, TooFewChunksAreRaisedToTheMinimum) {
+  AudioChunkPool pool(channels, sampleRate, 0, chunkFrames, 1000, 1000);
+  EXPECT_EQ(pool.getCapacity(), (AudioChunkPool::kMinNumberOfChunks - 1) * chunkFrames);
+
+  // the thresholds are clamped to the single playable chunk
+  write(pool, 0, chunkFrames);
+  pool.finish();
+  AudioBuffer output(chunkFrames, channels, sampleRate);
+  EXPECT_EQ(pool.read(output, 0, chunkFrames), chunkFrames);
+  expectFrames(output, 0, 0, chunkFrames);
+}
@@ -0,0 +1,71 @@
+#include <audioapi/events/AudioEvent.h>
+#include <audioapi/events/AudioEventBatch.h>
+#include <audioapi/events/AudioEventRecord.h>
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <vector>
+
+using namespace audioapi;
+
+namespace {
+
+AudioEventRecord positionChanged(uint64_t listenerId, double position) {
+  return AudioEventRecord{AudioEvent::POSITION_CHANGED, listenerId}.add("value", position);
+}
+
+std::vector<AudioEventRecord> collect(const AudioEventBatch &batch) {
+  std::vector<AudioEventRecord> records;
+  batch.forEach([&records](const AudioEventRecord &record) { records.push_back(record); });
+  return records;
+}
+
+} // namespace
+
+TEST(AudioEventBatchTest, OnlyTheLatestPositionOfAListenerIsKept) {
+  AudioEventBatch batch;
+
+  EXPECT_FALSE(batch.add(positionChanged(1, 0.1)));
+  EXPECT_FALSE(batch.add(positionChanged(2, 0.5)));
+  EXPECT_TRUE(batch.add(positionChanged(1, 0.2)));
+  EXPECT_TRUE(batch.add(positionChanged(1, 0.3)));
+
+  auto records = collect(batch);
+  ASSERT_EQ(batch.size(), 2);
+  ASSERT_EQ(records.size(), 2);
+  EXPECT_EQ(records[0].listenerId, 2);
+  EXPECT_EQ(std::get<double>(records[0].fields[0].value), 0.5);
+  EXPECT_EQ(records[1].listenerId, 1);
+  EXPECT_EQ(std::get<double>(records[1].fields[0].value), 0.3);
+}
+
+TEST(AudioEventBatchTest, OtherEventsAreNotCoalesced) {
+  AudioEventBatch batch;
+
+  EXPECT_FALSE(batch.add(AudioEventRecord{AudioEvent::LOOP_ENDED, 1}));
+  EXPECT_FALSE(batch.add(positionChanged(2, 1.0)));
+  EXPECT_FALSE(batch.add(AudioEventRecord{AudioEvent::LOOP_ENDED, 1}));
+  EXPECT_FALSE(batch.add(AudioEventRecord{AudioEvent::ENDED, 3}));
+  EXPECT_TRUE(batch.add(positionChanged(2, 2.0)));
+
+  auto records = collect(batch);
+  ASSERT_EQ(records.size(), 4);
+  EXPECT_EQ(records[0].event, AudioEvent::LOOP_ENDED);
+  EXPECT_EQ(records[1].event, AudioEvent::LOOP_ENDED);
+  EXPECT_EQ(records[2].event, AudioEvent::ENDED);
+  // the latest position comes after the events that preceded it
+  EXPECT_EQ(records[3].event, AudioEvent::POSITION_CHANGED);
+}
+
+TEST(AudioEventBatchTest, ClearStartsANewFrame) {
+  AudioEventBatch batch;
+
+  batch.add(positionChanged(1, 0.1));
+  batch.add(positionChanged(1, 0.2));
+  batch.clear();
+  EXPECT_EQ(batch.size(), 0);
+
+  EXPECT_FALSE(batch.add(positionChanged(1, 0.3)));
+  auto records = collect(batch);
+  ASSERT_EQ(records.size(), 1);
+  EXPECT_EQ(std::get<double>(records[0].fields[0].value), 0.3);
+}
@@ -0,0 +1,93 @@
+#include <audioapi/events/AudioEventQueue.h>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <variant>
+#include <vector>
+
+using namespace audioapi;
+
+TEST(AudioEventQueueTest, DeliversRecordsInOrder) {
+  AudioEventQueue queue(16);
+  EXPECT_TRUE(queue.isEmpty());
+
+  queue.push(AudioEventRecord(AudioEvent::POSITION_CHANGED, 1).add("value", 0.5));
+  queue.push(AudioEventRecord(AudioEvent::BUFFER_ENDED, 2)
+                 .add("bufferId", AudioEventId{7})
+                 .add("isLastBufferInQueue", true));
+  EXPECT_FALSE(queue.isEmpty());
+
+  std::vector<AudioEventRecord> records;
+  EXPECT_EQ(queue.drain([&](const AudioEventRecord &record) { records.push_back(record); }), 2);
+  EXPECT_TRUE(queue.isEmpty());
+
+  ASSERT_EQ(records.size(), 2);
+  EXPECT_EQ(records[0].event, AudioEvent::POSITION_CHANGED);
+  EXPECT_EQ(records[0].listenerId, 1);
+  ASSERT_EQ(records[0].fieldCount, 1);
+  EXPECT_STREQ(records[0].fields[0].name, "value");
+  EXPECT_EQ(std::get<double>(records[0].fields[0].value), 0.5);
+
+  EXPECT_EQ(records[1].event, AudioEvent::BUFFER_ENDED);
+  ASSERT_EQ(records[1].fieldCount, 2);
+  EXPECT_EQ(std::get<AudioEventId>(records[1].fields[0].value), AudioEventId{7});
+  EXPECT_TRUE(std::get<bool>(records[1].fields[1].value));
+}
+
+TEST(AudioEventQueueTest, ExtraFieldsAreIgnored) {
+  AudioEventRecord record(AudioEvent::ENDED, 1);
+  for (size_t i = 0; i < AudioEventRecord::kMaxFields + 2; ++i) {
+    record.add("value", static_cast<double>(i));
+  }
+  EXPECT_EQ(record.fieldCount, AudioEventRecord::kMaxFields);
+}
+
+TEST(AudioEventQueueTest, DropsEventsWhenFull) {
+  // the capacity is rounded up to a power of two minus one
+  AudioEventQueue queue(4);
+  size_t pushed = 0;
+  while (queue.push(AudioEventRecord(AudioEvent::ENDED, pushed + 1))) {
+    pushed++;
+  }
+  EXPECT_EQ(pushed, 3);
+  EXPECT_EQ(queue.getDroppedCount(), 1);
+
+  EXPECT_EQ(queue.drain([](const AudioEventRecord &) {}), pushed);
+  EXPECT_TRUE(queue.push(AudioEventRecord(AudioEvent::ENDED, 1)));
+}
+
+TEST(AudioEventQueueTest, DrainsConcurrentlyWithPushing) {
+  static constexpr uint64_t events = 100000;
+  AudioEventQueue queue(64);
+
+  std::thread producer([&] {
+    for (uint64_t i = 1; i <= events; ++i) {
+      while (!queue.push(AudioEventRecord(AudioEvent::POSITION_CHANGED, i))) {
+        std::this_thread::yield();
+      }
+    }
+  });
+
+  uint64_t expected = 1;
+  while (expected <= events) {
+    queue.drain([&](const AudioEventRecord &record) {
+      ASSERT_EQ(record.listenerId, expected);
+      expected++;
+    });
+  }
+  producer.join();
+  EXPECT_TRUE(queue.isEmpty());
+}
+
+TEST(AudioEventQueueTest, PushWakesAWaitingConsumer) {
+  auto isConsumerWaiting = std::make_shared<std::atomic<bool>>(true);
+  AudioEventQueue queue(16, isConsumerWaiting);
+
+  std::thread consumer([&]() { isConsumerWaiting->wait(true); });
+  queue.push(AudioEventRecord(AudioEvent::ENDED, 1));
+  consumer.join();
+
+  EXPECT_FALSE(isConsumerWaiting->load());
+  EXPECT_FALSE(queue.isEmpty());
+}
@@ -0,0 +1,213 @@
+#include <audioapi/core/OfflineAudioContext.h>
+#include <audioapi/core/destinations/AudioDestinationNode.h>
+#include <audioapi/core/effects/GainNode.h>
+#include <audioapi/core/sources/ConstantSourceNode.h>
+#include <audioapi/core/sources/OscillatorNode.h>
+#include <audioapi/core/utils/AudioGraphManager.h>
+#include <audioapi/core/utils/Constants.h>
+#include <audioapi/core/utils/VoicePool.h>
+#include <audioapi/core/utils/worklets/SafeIncludes.h>
+#include <audioapi/types/NodeOptions.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBuffer.h>
+#include <gtest/gtest.h>
+#include <test/src/MockAudioEventHandlerRegistry.h>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+using namespace audioapi;
+
+class AudioGraphManagerTest : public ::testing::Test {
+ protected:
+  std::shared_ptr<MockAudioEventHandlerRegistry> eventRegistry;
+  std::shared_ptr<OfflineAudioContext> context;
+  std::shared_ptr<AudioBuffer> buffer;
+  static constexpr int sampleRate = 44100;
+
+  void SetUp() override {
+    eventRegistry = std::make_shared<MockAudioEventHandlerRegistry>();
+    context = std::make_shared<OfflineAudioContext>(
+        1, 5 * sampleRate, sampleRate, eventRegistry, RuntimeRegistry{});
+    context->initialize();
+    buffer = std::make_shared<AudioBuffer>(RENDER_QUANTUM_SIZE, 1, sampleRate);
+  }
+
+  float renderQuantum() {
+    context->getDestination()->renderAudio(buffer, RENDER_QUANTUM_SIZE);
+    return (*buffer->getChannel(0))[RENDER_QUANTUM_SIZE - 1];
+  }
+
+  // constant source -> gain -> destination, the way a voice is built from JS
+  void createVoice(float gain) {
+    auto gainOptions = GainOptions();
+    gainOptions.gain = gain;
+
+    auto source = context->createConstantSource(ConstantSourceOptions());
+    auto gainNode = context->createGain(gainOptions);
+    source->connect(gainNode);
+    gainNode->connect(context->getDestination());
+    source->start(0);
+  }
+
+  // idle nodes ahead of the tested one, more than a sweep checks in one quantum
+  std::vector<std::shared_ptr<OscillatorNode>> createIdleOscillators() {
+    std::vector<std::shared_ptr<OscillatorNode>> oscillators;
+    for (int i = 0; i < 300; i++) {
+      oscillators.push_back(context->createOscillator(OscillatorOptions()));
+    }
+    return oscillators;
+  }
+
+  uint64_t getRecycledOscillators() {
+    return context->getGraphManager()->getVoicePool().getStats(VoiceType::OSCILLATOR).recycled;
+  }
+};
+
+TEST_F(AudioGraphManagerTest, BatchReachesTheGraphWhenCommitted) {
+  auto graphManager = context->getGraphManager();
+
+  graphManager->beginBatch();
+  createVoice(0.5f);
+  EXPECT_FLOAT_EQ(renderQuantum(), 0.0f);
+
+  graphManager->commitBatch();
+  EXPECT_FLOAT_EQ(renderQuantum(), 0.5f);
+}
+
+TEST_F(AudioGraphManagerTest, BatchesAndSingleEventsKeepTheirOrder) {
+  auto graphManager = context->getGraphManager();
+
+  createVoice(0.25f);
+  graphManager->beginBatch();
+  createVoice(0.5f);
+  graphManager->commitBatch();
+  createVoice(0.125f);
+
+  EXPECT_FLOAT_EQ(renderQuantum(), 0.875f);
+}
+
+TEST_F(AudioGraphManagerTest, DiscardedBatchNeverReachesTheGraph) {
+  auto graphManager = context->getGraphManager();
+
+  graphManager->beginBatch();
+  createVoice(0.5f);
+  graphManager->discardBatch();
+
+  createVoice(0.25f);
+  EXPECT_FLOAT_EQ(renderQuantum(), 0.25f);
+}
+
+TEST_F(AudioGraphManagerTest, NestedBatchIsSentWithTheOutermostOne) {
+  auto graphManager = context->getGraphManager();
+
+  graphManager->beginBatch();
+  createVoice(0.5f);
+  graphManager->beginBatch();
+  createVoice(0.25f);
+  graphManager->commitBatch();
+  EXPECT_FLOAT_EQ(renderQuantum(), 0.0f);
+
+  graphManager->commitBatch();
+  EXPECT_FLOAT_EQ(renderQuantum(), 0.75f);
+}
+
+TEST_F(AudioGraphManagerTest, DiscardedInnerBatchKeepsTheOuterEvents) {
+  auto graphManager = context->getGraphManager();
+
+  graphManager->beginBatch();
+  createVoice(0.5f);
+  graphManager->beginBatch();
+  createVoice(0.25f);
+  graphManager->discardBatch();
+  graphManager->commitBatch();
+
+  EXPECT_FLOAT_EQ(renderQuantum(), 0.5f);
+}
+
+TEST_F(AudioGraphManagerTest, TransactionIsDiscardedOnException) {
+  auto graphManager = context->getGraphManager();
+
+  try {
+    AudioGraphManager::Transaction transaction(*graphManager);
+    createVoice(0.5f);
+    throw std::runtime_error("failed to build the voice");
+  } catch (const std::runtime_error &) {
+  }
+
+  {
+    AudioGraphManager::Transaction transaction(*graphManager);
+    createVoice(0.25f);
+  }
+
+  EXPECT_FLOAT_EQ(renderQuantum(), 0.25f);
+}
+
+TEST_F(AudioGraphManagerTest, EventsBeyondTheChannelCapacityAreStaged) {
+  // each voice takes four events, so most of them do not fit in the channel
+  for (int i = 0; i < 1000; i++) {
+    createVoice(0.0005f);
+  }
+
+  EXPECT_NEAR(renderQuantum(), 0.5f, 1e-4f);
+}
+
+TEST_F(AudioGraphManagerTest, StagedEventsKeepTheirOrder) {
+  auto gainNode = context->createGain(GainOptions());
+  auto source = context->createConstantSource(ConstantSourceOptions());
+  source->connect(gainNode);
+  source->start(0);
+
+  for (int i = 0; i < 2000; i++) {
+    gainNode->connect(context->getDestination());
+  }
+  gainNode->disconnect();
+
+  EXPECT_FLOAT_EQ(renderQuantum(), 0.0f);
+}
+
+TEST_F(AudioGraphManagerTest, ReleasedNodeIsReclaimedInTheNextQuantum) {
+  auto idleOscillators = createIdleOscillators();
+  auto oscillator = context->createOscillator(OscillatorOptions());
+  renderQuantum();
+
+  oscillator->release();
+  oscillator.reset();
+  renderQuantum();
+
+  EXPECT_EQ(getRecycledOscillators(), 1);
+}
+
+TEST_F(AudioGraphManagerTest, FinishedNodeIsReclaimedInTheNextQuantum) {
+  auto idleOscillators = createIdleOscillators();
+  auto oscillator = context->createOscillator(OscillatorOptions());
+  oscillator->connect(context->getDestination());
+  oscillator->start(0.0);
+  oscillator->stop(static_cast<double>(2 * RENDER_QUANTUM_SIZE) / sampleRate);
+  renderQuantum();
+
+  // released while playing, so it is only reclaimed once it finishes
+  oscillator->release();
+  oscillator.reset();
+  renderQuantum();
+  EXPECT_EQ(getRecycledOscillators(), 0);
+
+  renderQuantum();
+  renderQuantum();
+  EXPECT_EQ(getRecycledOscillators(), 1);
+}
+
+TEST_F(AudioGraphManagerTest, UnmarkedNodeIsReclaimedBySweep) {
+  auto idleOscillators = createIdleOscillators();
+  auto oscillator = context->createOscillator(OscillatorOptions());
+  renderQuantum();
+
+  oscillator.reset();
+  renderQuantum();
+  EXPECT_EQ(getRecycledOscillators(), 0);
+
+  for (int i = 0; i < 20; i++) {
+    renderQuantum();
+  }
+  EXPECT_EQ(getRecycledOscillators(), 1);
+}
@@ -1,8 +1,14 @@
 #include <audioapi/core/AudioParam.h>
 #include <audioapi/core/OfflineAudioContext.h>
+#include <audioapi/core/destinations/AudioDestinationNode.h>
+#include <audioapi/core/utils/Constants.h>
 #include <audioapi/core/utils/worklets/SafeIncludes.h>
+#include <audioapi/utils/AudioBuffer.h>
+#include <audioapi/utils/Benchmark.hpp>
 #include <gtest/gtest.h>
 #include <test/src/MockAudioEventHandlerRegistry.h>
+#include <algorithm>
+#include <cstdio>
 #include <memory>
 #include <vector>
 
@@ -21,6 +27,15 @@ class AudioParamTest : public ::testing::Test {
   }
 };
 
+/// @brief Bulk scheduling reads the current time, which needs the destination of the context.
+class AudioParamSchedulingTest : public AudioParamTest {
+ protected:
+  void SetUp() override {
+    AudioParamTest::SetUp();
+    context->initialize();
+  }
+};
+
 TEST_F(AudioParamTest, ValueSetters) {
   auto param = AudioParam(0.5, 0.0, 1.0, context);
   param.setValue(0.8);
@@ -210,3 +225,225 @@ TEST_F(AudioParamTest, CancelAndHoldAtTime) {
   value = param.processKRateParam(1, 0.25);
   EXPECT_FLOAT_EQ(value, 0.9);
 }
+
+TEST_F(AudioParamTest, ThousandsOfEventsAreKept) {
+  static constexpr int events = 5000;
+  auto param = AudioParam(0.0, 0.0, 1.0, context);
+
+  for (int i = 0; i < events; ++i) {
+    param.setValueAtTime(static_cast<float>(i % 100) / 100.0f, 0.001 * (i + 1));
+  }
+
+  for (int i = 0; i < events; i += 7) {
+    float value = param.processKRateParam(1, 0.001 * (i + 1) + 0.0005);
+    EXPECT_FLOAT_EQ(value, static_cast<float>(i % 100) / 100.0f) << "event " << i;
+  }
+}
+
+TEST_F(AudioParamTest, EventsScheduledWhileRendering) {
+  auto param = AudioParam(0.0, 0.0, 1.0, context);
+  param.setValueAtTime(1.0, 0.0);
+
+  // every scheduled event is rendered right away, so old events are dropped as storage grows
+  for (int i = 0; i < 2000; ++i) {
+    auto time = 0.01 * i;
+    param.linearRampToValueAtTime(static_cast<float>(i % 2), time + 0.01);
+
+    float value = param.processKRateParam(1, time + 0.005);
+    EXPECT_NEAR(value, 0.5f, 1e-4) << "ramp " << i;
+  }
+
+  float value = param.processKRateParam(1, 100.0);
+  EXPECT_FLOAT_EQ(value, 1.0);
+}
+
+TEST_F(AudioParamTest, SetTargetIsConnectedToNextEvent) {
+  auto param = AudioParam(0.0, 0.0, 1.0, context);
+  param.setTargetAtTime(1.0, 0.1, 0.1);
+  param.setValueAtTime(0.2, 0.3);
+  param.linearRampToValueAtTime(0.6, 0.4);
+
+  float value = param.processKRateParam(1, 0.2);
+  EXPECT_NEAR(value, 0.632120, 1e-5);
+
+  value = param.processKRateParam(1, 0.3);
+  EXPECT_FLOAT_EQ(value, 0.2);
+
+  value = param.processKRateParam(1, 0.35);
+  EXPECT_FLOAT_EQ(value, 0.4);
+}
+
+TEST_F(AudioParamTest, CancelAndHoldDuringSetTarget) {
+  auto param = AudioParam(0.0, 0.0, 1.0, context);
+  param.setTargetAtTime(1.0, 0.1, 0.1);
+  param.cancelAndHoldAtTime(0.2);
+
+  float value = param.processKRateParam(1, 0.15);
+  EXPECT_NEAR(value, 0.393469, 1e-5);
+
+  value = param.processKRateParam(1, 0.2);
+  EXPECT_NEAR(value, 0.632120, 1e-5);
+
+  value = param.processKRateParam(1, 0.5);
+  EXPECT_NEAR(value, 0.632120, 1e-5);
+}
+
+TEST_F(AudioParamSchedulingTest, ScheduleEvents) {
+  auto param = AudioParam(0.0, 0.0, 1.0, context);
+  auto setValue = static_cast<double>(ParamAutomationType::SET_VALUE);
+  auto linearRamp = static_cast<double>(ParamAutomationType::LINEAR_RAMP);
+  auto setTarget = static_cast<double>(ParamAutomationType::SET_TARGET);
+  auto cancel = static_cast<double>(ParamAutomationType::CANCEL_SCHEDULED_VALUES);
+
+  std::vector<double> events = {
+      setValue, 0.1, 0.8, 0.0,
+      linearRamp, 0.2, 0.4, 0.0,
+      // unknown types and negative times are skipped
+      42.0, 0.25, 1.0, 0.0,
+      setValue, -1.0, 1.0, 0.0,
+      setTarget, 0.3, 1.0, 0.1,
+      setValue, 0.5, 0.2, 0.0,
+      cancel, 0.45, 0.0, 0.0,
+  };
+  param.scheduleEvents(events);
+
+  EXPECT_FLOAT_EQ(param.processKRateParam(1, 0.05), 0.0);
+  EXPECT_FLOAT_EQ(param.processKRateParam(1, 0.1), 0.8);
+  EXPECT_FLOAT_EQ(param.processKRateParam(1, 0.15), 0.6);
+  EXPECT_FLOAT_EQ(param.processKRateParam(1, 0.25), 0.4);
+  EXPECT_NEAR(param.processKRateParam(1, 0.4), 0.4 + 0.6 * (1 - std::exp(-1.0)), 1e-5);
+  // the step at 0.5 is cancelled, the target keeps going
+  EXPECT_NEAR(param.processKRateParam(1, 0.6), 0.4 + 0.6 * (1 - std::exp(-3.0)), 1e-5);
+}
+
+TEST_F(AudioParamSchedulingTest, ScheduleEventsOfManyParams) {
+  auto first = AudioParam(0.0, 0.0, 1.0, context);
+  auto second = AudioParam(0.0, 0.0, 1.0, context);
+  std::vector<AudioParam *> params = {&first, &second};
+  auto setValue = static_cast<double>(ParamAutomationType::SET_VALUE);
+
+  std::vector<double> events = {
+      0, setValue, 0.1, 0.5, 0.0,
+      1, setValue, 0.1, 0.25, 0.0,
+      // out of range params are skipped
+      2, setValue, 0.1, 1.0, 0.0,
+      1, setValue, 0.2, 0.75, 0.0,
+  };
+  AudioParam::scheduleEvents(params, events);
+
+  EXPECT_FLOAT_EQ(first.processKRateParam(1, 0.15), 0.5);
+  EXPECT_FLOAT_EQ(second.processKRateParam(1, 0.15), 0.25);
+  EXPECT_FLOAT_EQ(first.processKRateParam(1, 0.25), 0.5);
+  EXPECT_FLOAT_EQ(second.processKRateParam(1, 0.25), 0.75);
+}
+
+TEST_F(AudioParamSchedulingTest, ScheduledCancelKeepsItsTime) {
+  auto single = AudioParam(0.0, 0.0, 1.0, context);
+  auto bulk = AudioParam(0.0, 0.0, 1.0, context);
+  auto setValue = static_cast<double>(ParamAutomationType::SET_VALUE);
+  auto linearRamp = static_cast<double>(ParamAutomationType::LINEAR_RAMP);
+  auto cancel = static_cast<double>(ParamAutomationType::CANCEL_SCHEDULED_VALUES);
+
+  single.setValueAtTime(0.0, 0.0);
+  single.linearRampToValueAtTime(1.0, 1.0);
+  bulk.scheduleEvents(std::vector<double>{setValue, 0.0, 0.0, 0.0, linearRamp, 1.0, 1.0, 0.0});
+
+  // the ramp is in progress when it is cancelled
+  auto buffer = std::make_shared<AudioBuffer>(RENDER_QUANTUM_SIZE, 2, sampleRate);
+  while (context->getCurrentTime() < 0.5) {
+    context->getDestination()->renderAudio(buffer, RENDER_QUANTUM_SIZE);
+  }
+  EXPECT_NEAR(single.processKRateParam(1, 0.5), 0.5, 1e-5);
+  EXPECT_NEAR(bulk.processKRateParam(1, 0.5), 0.5, 1e-5);
+
+  single.cancelScheduledValues(0.0);
+  bulk.scheduleEvents(std::vector<double>{cancel, 0.0, 0.0, 0.0});
+
+  auto value = single.processKRateParam(1, 0.75);
+  EXPECT_LT(value, 0.75);
+  EXPECT_FLOAT_EQ(bulk.processKRateParam(1, 0.75), value);
+}
+
+TEST_F(AudioParamSchedulingTest, BenchmarkScheduling) {
+  // measures the native ingest only, from JS every one by one event also costs a JSI call
+  // a 4 bar sequence of 16th notes at 120 BPM, a step and a ramp per note, repeated on 32 params
+  static constexpr int params = 32;
+  static constexpr int notes = 4 * 16;
+  static constexpr int repeats = 50;
+  static constexpr int eventsPerParam = 2 * notes * repeats;
+  static constexpr int events = params * eventsPerParam;
+  static constexpr int rounds = 5;
+  auto setValue = static_cast<double>(ParamAutomationType::SET_VALUE);
+  auto linearRamp = static_cast<double>(ParamAutomationType::LINEAR_RAMP);
+
+  std::vector<double> tuples;
+  tuples.reserve(events * 5);
+
+  for (int note = 0; note < notes * repeats; ++note) {
+    auto time = 0.125 * note;
+
+    for (int param = 0; param < params; ++param) {
+      tuples.insert(tuples.end(), {static_cast<double>(param), setValue, time, 1.0, 0.0});
+      tuples.insert(tuples.end(), {static_cast<double>(param), linearRamp, time + 0.1, 0.0, 0.0});
+    }
+  }
+
+  auto createParams = [this]() {
+    std::vector<std::unique_ptr<AudioParam>> created;
+    for (int param = 0; param < params; ++param) {
+      created.push_back(std::make_unique<AudioParam>(0.0, 0.0, 1.0, context));
+    }
+    return created;
+  };
+
+  // the best of a few rounds, each on fresh params, so one slow round does not decide
+  double oneByOneTime = 0.0;
+  double bulkTime = 0.0;
+
+  for (int round = 0; round < rounds; ++round) {
+    auto oneByOne = createParams();
+    auto bulk = createParams();
+    std::vector<AudioParam *> bulkParams;
+
+    for (auto &param : bulk) {
+      bulkParams.push_back(param.get());
+    }
+
+    auto roundOneByOneTime = benchmarks::getExecutionTime([&]() {
+      for (size_t i = 0; i < tuples.size(); i += 5) {
+        auto &param = *oneByOne[static_cast<size_t>(tuples[i])];
+
+        if (tuples[i + 1] == setValue) {
+          param.setValueAtTime(static_cast<float>(tuples[i + 3]), tuples[i + 2]);
+        } else {
+          param.linearRampToValueAtTime(static_cast<float>(tuples[i + 3]), tuples[i + 2]);
+        }
+      }
+    });
+
+    auto roundBulkTime =
+        benchmarks::getExecutionTime([&]() { AudioParam::scheduleEvents(bulkParams, tuples); });
+
+    oneByOneTime = round == 0 ? roundOneByOneTime : std::min(oneByOneTime, roundOneByOneTime);
+    bulkTime = round == 0 ? roundBulkTime : std::min(bulkTime, roundBulkTime);
+
+    if (round > 0) {
+      continue;
+    }
+
+    // both end up with the same automation
+    for (int param = 0; param < params; ++param) {
+      for (double time = 0.0; time < 0.125 * notes * repeats; time += 0.0625) {
+        ASSERT_FLOAT_EQ(
+            oneByOne[param]->processKRateParam(1, time), bulk[param]->processKRateParam(1, time));
+      }
+    }
+  }
+
+  printf(
+      "[ BENCH    ] schedule %d events on %d params: one by one %6.2f M/s, bulk %6.2f M/s\n",
+      events,
+      params,
+      events / oneByOneTime * 1e3,
+      events / bulkTime * 1e3);
+}
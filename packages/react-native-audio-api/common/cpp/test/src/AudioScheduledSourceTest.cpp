@@ -2,10 +2,12 @@
 #include <audioapi/core/destinations/AudioDestinationNode.h>
 #include <audioapi/core/sources/AudioScheduledSourceNode.h>
 #include <audioapi/core/utils/worklets/SafeIncludes.h>
+#include <audioapi/events/AudioEventQueue.h>
 #include <audioapi/utils/AudioBuffer.h>
 #include <gtest/gtest.h>
 #include <test/src/MockAudioEventHandlerRegistry.h>
 #include <memory>
+#include <vector>
 
 using namespace audioapi;
 static constexpr int SAMPLE_RATE = 44100;
@@ -128,3 +130,23 @@ TEST_F(AudioScheduledSourceTest, IsFinishedStateSetCorrectly) {
   sourceNode.playFrames(1);
   EXPECT_TRUE(sourceNode.isFinished());
 }
+
+TEST_F(AudioScheduledSourceTest, EndedEventIsQueuedForTheJsThread) {
+  auto sourceNode = TestableAudioScheduledSourceNode(context);
+  sourceNode.setOnEndedCallbackId(42);
+  sourceNode.start(0);
+  sourceNode.stop(RENDER_QUANTUM_TIME);
+  sourceNode.playFrames(1); // start playing
+
+  sourceNode.playFrames(RENDER_QUANTUM);
+  EXPECT_TRUE(context->getEventQueue()->isEmpty());
+  sourceNode.playFrames(1);
+
+  std::vector<AudioEventRecord> records;
+  context->getEventQueue()->drain(
+      [&](const AudioEventRecord &record) { records.push_back(record); });
+  ASSERT_EQ(records.size(), 1);
+  EXPECT_EQ(records[0].event, AudioEvent::ENDED);
+  EXPECT_EQ(records[0].listenerId, 42);
+  EXPECT_EQ(records[0].fieldCount, 0);
+}
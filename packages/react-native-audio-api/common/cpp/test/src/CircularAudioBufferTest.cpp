@@ -0,0 +1,127 @@
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBuffer.h>
+#include <audioapi/utils/CircularAudioBuffer.h>
+#include <gtest/gtest.h>
+#include <cstddef>
+
+using namespace audioapi;
+
+namespace {
+
+constexpr float SAMPLE_RATE = 48000.0f;
+
+/// @brief Fills each channel with consecutive values, offset by 1000 per channel.
+AudioBuffer createRamp(size_t frames, int numberOfChannels, float start) {
+  AudioBuffer buffer(frames, numberOfChannels, SAMPLE_RATE);
+  for (int channel = 0; channel < numberOfChannels; ++channel) {
+    auto *data = buffer.getChannel(channel)->begin();
+    for (size_t i = 0; i < frames; ++i) {
+      data[i] = start + static_cast<float>(i) + 1000.0f * static_cast<float>(channel);
+    }
+  }
+  return buffer;
+}
+
+} // namespace
+
+TEST(CircularAudioBufferTest, ChannelsStayAlignedAcrossTheWrap) {
+  CircularAudioBuffer ring(8, 2, SAMPLE_RATE, CircularAudioBuffer::OverflowPolicy::DROP_NEWEST);
+  AudioBuffer output(8, 2, SAMPLE_RATE);
+
+  EXPECT_EQ(ring.write(createRamp(6, 2, 0.0f), 6), 6);
+  EXPECT_EQ(ring.read(output, 4), 4);
+  EXPECT_EQ(ring.write(createRamp(5, 2, 6.0f), 5), 5);
+  EXPECT_EQ(ring.getNumberOfAvailableFrames(), 7);
+
+  EXPECT_EQ(ring.read(output, 7), 7);
+  for (size_t i = 0; i < 7; ++i) {
+    EXPECT_EQ((*output.getChannel(0))[i], 4.0f + static_cast<float>(i));
+    EXPECT_EQ((*output.getChannel(1))[i], 1004.0f + static_cast<float>(i));
+  }
+}
+
+TEST(CircularAudioBufferTest, DropNewestKeepsTheBufferedFrames) {
+  CircularAudioBuffer ring(8, 1, SAMPLE_RATE, CircularAudioBuffer::OverflowPolicy::DROP_NEWEST);
+  AudioBuffer output(8, 1, SAMPLE_RATE);
+
+  EXPECT_EQ(ring.write(createRamp(6, 1, 0.0f), 6), 6);
+  EXPECT_EQ(ring.write(createRamp(6, 1, 6.0f), 6), 2);
+
+  EXPECT_EQ(ring.read(output, 8), 8);
+  for (size_t i = 0; i < 8; ++i) {
+    EXPECT_EQ((*output.getChannel(0))[i], static_cast<float>(i));
+  }
+
+  auto stats = ring.getStats();
+  EXPECT_EQ(stats.writtenFrames, 8);
+  EXPECT_EQ(stats.readFrames, 8);
+  EXPECT_EQ(stats.overflowFrames, 4);
+  EXPECT_EQ(stats.underflowFrames, 0);
+}
+
+TEST(CircularAudioBufferTest, OverwriteOldestSkipsTheLappedFrames) {
+  CircularAudioBuffer ring(
+      8, 1, SAMPLE_RATE, CircularAudioBuffer::OverflowPolicy::OVERWRITE_OLDEST);
+  AudioBuffer output(8, 1, SAMPLE_RATE);
+
+  EXPECT_EQ(ring.write(createRamp(6, 1, 0.0f), 6), 6);
+  EXPECT_EQ(ring.write(createRamp(6, 1, 6.0f), 6), 6);
+  EXPECT_EQ(ring.getNumberOfAvailableFrames(), 8);
+
+  // the reader skips to half of the ring behind the writer
+  EXPECT_EQ(ring.read(output, 8), 4);
+  for (size_t i = 0; i < 4; ++i) {
+    EXPECT_EQ((*output.getChannel(0))[i], 8.0f + static_cast<float>(i));
+  }
+
+  auto stats = ring.getStats();
+  EXPECT_EQ(stats.writtenFrames, 12);
+  EXPECT_EQ(stats.readFrames, 4);
+  EXPECT_EQ(stats.overflowFrames, 8);
+  EXPECT_EQ(stats.underflowFrames, 4);
+}
+
+TEST(CircularAudioBufferTest, OverwriteOldestKeepsTheNewestFramesOfALongWrite) {
+  CircularAudioBuffer ring(
+      8, 2, SAMPLE_RATE, CircularAudioBuffer::OverflowPolicy::OVERWRITE_OLDEST);
+  AudioBuffer output(8, 2, SAMPLE_RATE);
+
+  EXPECT_EQ(ring.write(createRamp(12, 2, 0.0f), 12), 8);
+  EXPECT_EQ(ring.read(output, 8), 8);
+  for (int channel = 0; channel < 2; ++channel) {
+    for (size_t i = 0; i < 8; ++i) {
+      EXPECT_EQ(
+          (*output.getChannel(channel))[i],
+          4.0f + static_cast<float>(i) + 1000.0f * static_cast<float>(channel));
+    }
+  }
+  EXPECT_EQ(ring.getStats().overflowFrames, 4);
+}
+
+TEST(CircularAudioBufferTest, MissingFramesAreCountedAndLeftUntouched) {
+  CircularAudioBuffer ring(8, 1, SAMPLE_RATE, CircularAudioBuffer::OverflowPolicy::DROP_NEWEST);
+  AudioBuffer output(4, 1, SAMPLE_RATE);
+
+  ring.write(createRamp(1, 1, 5.0f), 1);
+  for (size_t i = 0; i < 4; ++i) {
+    (*output.getChannel(0))[i] = -1.0f;
+  }
+
+  EXPECT_EQ(ring.read(output, 4), 1);
+  EXPECT_EQ((*output.getChannel(0))[0], 5.0f);
+  EXPECT_EQ((*output.getChannel(0))[1], -1.0f);
+  EXPECT_EQ(ring.getStats().underflowFrames, 3);
+}
+
+TEST(CircularAudioBufferTest, ClearDropsTheBufferedFrames) {
+  CircularAudioBuffer ring(8, 2, SAMPLE_RATE, CircularAudioBuffer::OverflowPolicy::DROP_NEWEST);
+  AudioBuffer output(8, 2, SAMPLE_RATE);
+
+  ring.write(createRamp(5, 2, 0.0f), 5);
+  ring.clear();
+  EXPECT_EQ(ring.getNumberOfAvailableFrames(), 0);
+
+  EXPECT_EQ(ring.write(createRamp(8, 2, 10.0f), 8), 8);
+  EXPECT_EQ(ring.read(output, 8), 8);
+  EXPECT_EQ((*output.getChannel(1))[7], 1017.0f);
+}
@@ -0,0 +1,274 @@
+#include <audioapi/core/AudioParam.h>
+#include <audioapi/core/OfflineAudioContext.h>
+#include <audioapi/core/sources/AudioBufferSourceNode.h>
+#include <audioapi/core/utils/Constants.h>
+#include <audioapi/core/utils/worklets/SafeIncludes.h>
+#include <audioapi/dsp/AudioUtils.hpp>
+#include <audioapi/dsp/VectorMath.h>
+#include <audioapi/types/NodeOptions.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBuffer.h>
+#include <audioapi/utils/Benchmark.hpp>
+#include <audioapi/utils/CompactAudioBuffer.h>
+#include <gtest/gtest.h>
+#include <test/src/MockAudioEventHandlerRegistry.h>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace audioapi;
+
+class CompactAudioBufferTest : public ::testing::Test {
+ protected:
+  std::shared_ptr<MockAudioEventHandlerRegistry> eventRegistry;
+  std::shared_ptr<OfflineAudioContext> context;
+  static constexpr int sampleRate = 44100;
+
+  void SetUp() override {
+    eventRegistry = std::make_shared<MockAudioEventHandlerRegistry>();
+    context = std::make_shared<OfflineAudioContext>(
+        2, 5 * sampleRate, sampleRate, eventRegistry, RuntimeRegistry{});
+    context->initialize();
+  }
+
+  static std::shared_ptr<AudioBuffer> makeNoise(size_t frames, int channels) {
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+
+    auto buffer = std::make_shared<AudioBuffer>(frames, channels, sampleRate);
+    for (int ch = 0; ch < channels; ++ch) {
+      for (size_t i = 0; i < frames; ++i) {
+        (*buffer->getChannel(ch))[i] = distribution(generator);
+      }
+    }
+    return buffer;
+  }
+};
+
+class TestableAudioBufferSourceNode : public AudioBufferSourceNode {
+ public:
+  TestableAudioBufferSourceNode(
+      const std::shared_ptr<BaseAudioContext> &context,
+      const AudioBufferSourceOptions &options)
+      : AudioBufferSourceNode(context, options) {}
+
+  std::shared_ptr<AudioBuffer> processNode(
+      const std::shared_ptr<AudioBuffer> &processingBuffer,
+      int framesToProcess) override {
+    return AudioBufferSourceNode::processNode(processingBuffer, framesToProcess);
+  }
+};
+
+TEST_F(CompactAudioBufferTest, Int16RoundTrip) {
+  for (float sample : {0.0f, 1.0f, -1.0f, 0.5f, -0.25f, 1e-6f}) {
+    EXPECT_NEAR(dsp::int16ToFloat(dsp::floatToInt16(sample)), sample, 0.5f / INT16_MAX);
+  }
+
+  // out of range samples are clipped
+  EXPECT_EQ(dsp::floatToInt16(2.0f), INT16_MAX);
+  EXPECT_EQ(dsp::floatToInt16(-2.0f), -INT16_MAX);
+  EXPECT_EQ(dsp::floatToInt16(NAN), 0);
+}
+
+TEST_F(CompactAudioBufferTest, Float16RoundTrip) {
+  for (float sample : {0.0f, 1.0f, -1.0f, 0.5f, -0.25f, 65504.0f, std::ldexp(1.0f, -24)}) {
+    EXPECT_EQ(dsp::float16ToFloat(dsp::floatToFloat16(sample)), sample);
+  }
+  EXPECT_EQ(dsp::floatToFloat16(1.0f), 0x3c00);
+  EXPECT_EQ(dsp::floatToFloat16(-2.0f), 0xc000);
+
+  std::mt19937 generator(7);
+  std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+  for (int i = 0; i < 10000; ++i) {
+    float sample = distribution(generator);
+    float relativeError =
+        std::fabs(dsp::float16ToFloat(dsp::floatToFloat16(sample)) - sample) / std::fabs(sample);
+    ASSERT_LE(relativeError, std::ldexp(1.0f, -11));
+  }
+
+  // ties round to even
+  EXPECT_EQ(dsp::floatToFloat16(1.0f + std::ldexp(1.0f, -11)), 0x3c00);
+  EXPECT_EQ(dsp::floatToFloat16(1.0f + 3 * std::ldexp(1.0f, -11)), 0x3c02);
+
+  // values out of range saturate
+  EXPECT_EQ(dsp::floatToFloat16(1e6f), 0x7bff);
+  EXPECT_EQ(dsp::floatToFloat16(-INFINITY), 0xfbff);
+  EXPECT_EQ(dsp::floatToFloat16(NAN), 0);
+}
+
+TEST_F(CompactAudioBufferTest, VectorConversionsMatchScalar) {
+  // odd length to go through both the vector loop and the tail
+  std::vector<int16_t> samples;
+  std::vector<uint16_t> halves;
+  for (uint32_t bits = 0; bits <= 0xffff; ++bits) {
+    samples.push_back(static_cast<int16_t>(bits));
+    // infinities and NaNs are never stored
+    if ((bits & 0x7c00u) != 0x7c00u) {
+      halves.push_back(static_cast<uint16_t>(bits));
+    }
+  }
+  samples.push_back(INT16_MIN);
+  halves.push_back(0x3555);
+  ASSERT_EQ(samples.size() % 8, 1u);
+
+  std::vector<float> output(samples.size());
+  dsp::convertInt16ToFloat(samples.data(), output.data(), samples.size());
+  for (size_t i = 0; i < samples.size(); ++i) {
+    ASSERT_EQ(output[i], dsp::int16ToFloat(samples[i])) << i;
+  }
+
+  output.resize(halves.size());
+  dsp::convertFloat16ToFloat(halves.data(), output.data(), halves.size());
+  for (size_t i = 0; i < halves.size(); ++i) {
+    ASSERT_EQ(output[i], dsp::float16ToFloat(halves[i])) << i;
+  }
+}
+
+TEST_F(CompactAudioBufferTest, StoresHalfTheSize) {
+  auto buffer = makeNoise(1000, 2);
+
+  for (auto format : {SampleFormat::INT16, SampleFormat::FLOAT16}) {
+    CompactAudioBuffer compact(*buffer, format);
+    EXPECT_EQ(compact.getFormat(), format);
+    EXPECT_EQ(compact.getSize(), 1000);
+    EXPECT_EQ(compact.getNumberOfChannels(), 2);
+    EXPECT_EQ(compact.getSampleRate(), sampleRate);
+    EXPECT_EQ(compact.getSizeInBytes(), 1000 * 2 * sizeof(float) / 2);
+
+    auto restored = compact.toAudioBuffer();
+    for (int ch = 0; ch < 2; ++ch) {
+      for (size_t i = 0; i < 1000; ++i) {
+        ASSERT_NEAR((*restored->getChannel(ch))[i], (*buffer->getChannel(ch))[i], 1e-3f);
+      }
+    }
+  }
+
+  EXPECT_THROW(CompactAudioBuffer(*buffer, SampleFormat::FLOAT32), std::invalid_argument);
+}
+
+TEST_F(CompactAudioBufferTest, ReadsPastTheEndAreSilent) {
+  auto buffer = std::make_shared<AudioBuffer>(100, 1, sampleRate);
+  for (size_t i = 0; i < 100; ++i) {
+    (*buffer->getChannel(0))[i] = 0.5f;
+  }
+  CompactAudioBuffer compact(*buffer, SampleFormat::FLOAT16);
+
+  // mono audio is copied to every channel
+  AudioBuffer destination(64, 2, sampleRate);
+  compact.copyTo(destination, 80, 0, 64);
+  for (int ch = 0; ch < 2; ++ch) {
+    for (size_t i = 0; i < 64; ++i) {
+      ASSERT_EQ((*destination.getChannel(ch))[i], i < 20 ? 0.5f : 0.0f);
+    }
+  }
+
+  compact.copyReverseTo(destination, 10, 0, 64);
+  for (size_t i = 0; i < 64; ++i) {
+    ASSERT_EQ((*destination.getChannel(1))[i], i <= 10 ? 0.5f : 0.0f);
+  }
+
+  EXPECT_EQ(compact.getSample(0, 99), 0.5f);
+  EXPECT_EQ(compact.getSample(0, 100), 0.0f);
+}
+
+TEST_F(CompactAudioBufferTest, SourceNodePlaysCompactAudio) {
+  static constexpr size_t frames = RENDER_QUANTUM_SIZE * 8;
+  auto buffer = makeNoise(frames, 2);
+
+  for (float playbackRate : {1.0f, 0.75f}) {
+    AudioBufferSourceOptions floatOptions;
+    floatOptions.buffer = buffer;
+    AudioBufferSourceOptions compactOptions;
+    compactOptions.compactBuffer =
+        std::make_shared<CompactAudioBuffer>(*buffer, SampleFormat::INT16);
+
+    TestableAudioBufferSourceNode floatNode(context, floatOptions);
+    TestableAudioBufferSourceNode compactNode(context, compactOptions);
+    EXPECT_EQ(compactNode.getBuffer(), nullptr);
+    EXPECT_EQ(compactNode.getCompactBuffer(), compactOptions.compactBuffer);
+
+    auto floatOutput = std::make_shared<AudioBuffer>(RENDER_QUANTUM_SIZE, 2, sampleRate);
+    auto compactOutput = std::make_shared<AudioBuffer>(RENDER_QUANTUM_SIZE, 2, sampleRate);
+
+    for (auto *node : {&floatNode, &compactNode}) {
+      node->getPlaybackRateParam()->setValue(playbackRate);
+      node->start(0.0, 0.0);
+    }
+
+    for (int quantum = 0; quantum < 4; ++quantum) {
+      floatNode.processNode(floatOutput, RENDER_QUANTUM_SIZE);
+      compactNode.processNode(compactOutput, RENDER_QUANTUM_SIZE);
+      ASSERT_GT(floatOutput->maxAbsValue(), 0.0f);
+
+      for (int ch = 0; ch < 2; ++ch) {
+        for (size_t i = 0; i < RENDER_QUANTUM_SIZE; ++i) {
+          ASSERT_NEAR(
+              (*compactOutput->getChannel(ch))[i], (*floatOutput->getChannel(ch))[i], 1e-4f);
+        }
+      }
+    }
+  }
+}
+
+TEST_F(CompactAudioBufferTest, BenchmarkPlayback) {
+  static constexpr int kQuanta = 2000;
+  static constexpr size_t frames = RENDER_QUANTUM_SIZE * 256;
+  auto buffer = makeNoise(frames, 2);
+  auto output = std::make_shared<AudioBuffer>(RENDER_QUANTUM_SIZE, 2, sampleRate);
+
+  auto run = [&](const AudioBufferSourceOptions &options, float playbackRate) {
+    TestableAudioBufferSourceNode node(context, options);
+    node.setLoop(true);
+    node.getPlaybackRateParam()->setValue(playbackRate);
+    node.start(0.0, 0.0);
+
+    return benchmarks::getExecutionTime([&]() {
+             for (int i = 0; i < kQuanta; ++i) {
+               node.processNode(output, RENDER_QUANTUM_SIZE);
+             }
+           }) /
+        kQuanta;
+  };
+
+  for (float playbackRate : {1.0f, 0.75f}) {
+    AudioBufferSourceOptions floatOptions;
+    floatOptions.buffer = buffer;
+    double floatTime = run(floatOptions, playbackRate);
+
+    for (auto format : {SampleFormat::INT16, SampleFormat::FLOAT16}) {
+      AudioBufferSourceOptions compactOptions;
+      compactOptions.compactBuffer = std::make_shared<CompactAudioBuffer>(*buffer, format);
+      double compactTime = run(compactOptions, playbackRate);
+
+      printf(
+          "[ BENCH    ] playback rate %.2f: float32 %6.0f ns/quantum, %s %6.0f ns/quantum, "
+          "%zu vs %zu bytes\n",
+          playbackRate,
+          floatTime,
+          format == SampleFormat::INT16 ? "int16  " : "float16",
+          compactTime,
+          frames * 2 * sizeof(float),
+          compactOptions.compactBuffer->getSizeInBytes());
+    }
+  }
+
+  std::vector<int16_t> samples(frames);
+  std::vector<uint16_t> halves(frames);
+  std::vector<float> floats(frames);
+  std::vector<float> destination(frames);
+  double copyTime = benchmarks::getExecutionTime(
+      [&]() { std::memcpy(destination.data(), floats.data(), frames * sizeof(float)); });
+  double int16Time = benchmarks::getExecutionTime(
+      [&]() { dsp::convertInt16ToFloat(samples.data(), destination.data(), frames); });
+  double float16Time = benchmarks::getExecutionTime(
+      [&]() { dsp::convertFloat16ToFloat(halves.data(), destination.data(), frames); });
+  printf(
+      "[ BENCH    ] %zu samples: memcpy %8.0f ns, int16 %8.0f ns, float16 %8.0f ns\n",
+      frames,
+      copyTime,
+      int16Time,
+      float16Time);
+}
@@ -0,0 +1,179 @@
+#include <audioapi/core/utils/DecodedAudioCache.h>
+#include <audioapi/utils/AudioBuffer.h>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace audioapi;
+
+class DecodedAudioCacheTest : public ::testing::Test {
+ protected:
+  static constexpr float sampleRate = 44100.0f;
+  // mono buffers of 1000 frames take 4000 bytes
+  static constexpr size_t frames = 1000;
+  static constexpr size_t bufferSize = frames * sizeof(float);
+
+  static std::shared_ptr<AudioBuffer> makeBuffer() {
+    return std::make_shared<AudioBuffer>(frames, 1, sampleRate);
+  }
+
+  static std::shared_ptr<AudioBuffer> decode(DecodedAudioCache &cache, const std::string &key) {
+    auto lookup = cache.lookup(key);
+    if (lookup.buffer) {
+      return lookup.buffer;
+    }
+    EXPECT_TRUE(lookup.isOwner);
+    auto buffer = makeBuffer();
+    cache.complete(key, buffer);
+    return buffer;
+  }
+};
+
+TEST_F(DecodedAudioCacheTest, HitsReturnTheSameBuffer) {
+  DecodedAudioCache cache(bufferSize * 4);
+
+  auto first = decode(cache, "a");
+  auto second = decode(cache, "a");
+  EXPECT_EQ(first, second);
+
+  auto stats = cache.getStats();
+  EXPECT_EQ(stats.hits, 1);
+  EXPECT_EQ(stats.misses, 1);
+  EXPECT_EQ(stats.entries, 1);
+  EXPECT_EQ(stats.sizeInBytes, bufferSize);
+}
+
+TEST_F(DecodedAudioCacheTest, LeastRecentlyUsedEntryIsEvicted) {
+  DecodedAudioCache cache(bufferSize * 2);
+
+  auto a = decode(cache, "a");
+  decode(cache, "b");
+  // touching a makes b the least recently used entry
+  decode(cache, "a");
+  decode(cache, "c");
+
+  auto stats = cache.getStats();
+  EXPECT_EQ(stats.evictions, 1);
+  EXPECT_EQ(stats.entries, 2);
+  EXPECT_EQ(cache.lookup("a").buffer, a);
+  EXPECT_NE(cache.lookup("c").buffer, nullptr);
+  EXPECT_TRUE(cache.lookup("b").isOwner);
+}
+
+TEST_F(DecodedAudioCacheTest, BudgetChangesEvictImmediately) {
+  DecodedAudioCache cache(bufferSize * 3);
+  decode(cache, "a");
+  decode(cache, "b");
+  decode(cache, "c");
+
+  cache.setBudget(bufferSize);
+  auto stats = cache.getStats();
+  EXPECT_EQ(stats.entries, 1);
+  EXPECT_EQ(stats.evictions, 2);
+  EXPECT_NE(cache.lookup("c").buffer, nullptr);
+
+  // nothing is cached with a budget of 0
+  cache.setBudget(0);
+  decode(cache, "d");
+  EXPECT_EQ(cache.getStats().entries, 0);
+  EXPECT_EQ(cache.getStats().sizeInBytes, 0);
+}
+
+TEST_F(DecodedAudioCacheTest, ConcurrentDecodesAreDeduplicated) {
+  DecodedAudioCache cache(bufferSize * 4);
+
+  auto owner = cache.lookup("a");
+  ASSERT_TRUE(owner.isOwner);
+
+  std::vector<std::shared_ptr<AudioBuffer>> results;
+  auto joined = cache.lookup("a");
+  ASSERT_FALSE(joined.isOwner);
+  ASSERT_NE(joined.pending, nullptr);
+  joined.pending->then(
+      [&](const std::shared_ptr<AudioBuffer> &buffer) { results.push_back(buffer); });
+  EXPECT_TRUE(results.empty());
+
+  auto buffer = makeBuffer();
+  cache.complete("a", buffer);
+  ASSERT_EQ(results.size(), 1);
+  EXPECT_EQ(results[0], buffer);
+
+  // callbacks registered after completion run right away
+  joined.pending->then(
+      [&](const std::shared_ptr<AudioBuffer> &buffer) { results.push_back(buffer); });
+  ASSERT_EQ(results.size(), 2);
+  EXPECT_EQ(results[1], buffer);
+
+  auto stats = cache.getStats();
+  EXPECT_EQ(stats.misses, 1);
+  EXPECT_EQ(stats.inFlightJoins, 1);
+}
+
+TEST_F(DecodedAudioCacheTest, CompleteReportsSharedBuffers) {
+  DecodedAudioCache cache(bufferSize * 4);
+
+  ASSERT_TRUE(cache.lookup("a").isOwner);
+  EXPECT_TRUE(cache.complete("a", makeBuffer()));
+
+  // neither cached nor waited for, the caller is the only owner
+  cache.setBudget(0);
+  ASSERT_TRUE(cache.lookup("b").isOwner);
+  EXPECT_FALSE(cache.complete("b", makeBuffer()));
+
+  // a caller joining before completion gets the same buffer
+  ASSERT_TRUE(cache.lookup("c").isOwner);
+  auto joined = cache.lookup("c");
+  ASSERT_NE(joined.pending, nullptr);
+  EXPECT_TRUE(cache.complete("c", makeBuffer()));
+}
+
+TEST_F(DecodedAudioCacheTest, WritesToADetachedBufferStayLocal) {
+  DecodedAudioCache cache(bufferSize * 4);
+  decode(cache, "a");
+
+  // what getChannelData of a shared buffer hands out
+  auto first = DecodedAudioCache::detach(cache.lookup("a").buffer);
+  first->getChannel(0)->span()[0] = 1.0f;
+
+  auto second = cache.lookup("a").buffer;
+  ASSERT_NE(second, nullptr);
+  EXPECT_NE(second, first);
+  EXPECT_EQ(second->getChannel(0)->span()[0], 0.0f);
+}
+
+TEST_F(DecodedAudioCacheTest, FailedDecodesAreNotCached) {
+  DecodedAudioCache cache(bufferSize * 4);
+
+  ASSERT_TRUE(cache.lookup("a").isOwner);
+  auto joined = cache.lookup("a");
+
+  bool notified = false;
+  joined.pending->then([&](const std::shared_ptr<AudioBuffer> &buffer) {
+    notified = true;
+    EXPECT_EQ(buffer, nullptr);
+  });
+  cache.complete("a", nullptr);
+
+  EXPECT_TRUE(notified);
+  EXPECT_TRUE(cache.lookup("a").isOwner);
+}
+
+TEST_F(DecodedAudioCacheTest, KeysDependOnContentAndSampleRate) {
+  std::vector<uint8_t> first(1001, 1);
+  std::vector<uint8_t> second(first);
+  second[1000] = 2;
+
+  EXPECT_EQ(
+      DecodedAudioCache::makeMemoryKey(first.data(), first.size(), 44100.0f),
+      DecodedAudioCache::makeMemoryKey(first.data(), first.size(), 44100.0f));
+  EXPECT_NE(
+      DecodedAudioCache::makeMemoryKey(first.data(), first.size(), 44100.0f),
+      DecodedAudioCache::makeMemoryKey(second.data(), second.size(), 44100.0f));
+  EXPECT_NE(
+      DecodedAudioCache::makeMemoryKey(first.data(), first.size(), 44100.0f),
+      DecodedAudioCache::makeMemoryKey(first.data(), first.size(), 48000.0f));
+  EXPECT_NE(
+      DecodedAudioCache::makeFileKey("/sounds/a.wav", 44100.0f),
+      DecodedAudioCache::makeFileKey("/sounds/b.wav", 44100.0f));
+}
@@ -0,0 +1,81 @@
+#include <audioapi/core/utils/AudioDestructor.hpp>
+#include <audioapi/core/utils/DeferredReclaimer.h>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <utility>
+
+using namespace audioapi;
+
+namespace {
+
+struct Tracked {
+  explicit Tracked(std::atomic<int> &destroyed) : destroyed(destroyed) {}
+  virtual ~Tracked() {
+    destroyed.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  std::atomic<int> &destroyed;
+};
+
+struct DerivedTracked : Tracked {
+  using Tracked::Tracked;
+};
+
+bool waitFor(const std::atomic<int> &value, int expected) {
+  for (int i = 0; i < 1000 && value.load() != expected; i++) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  return value.load() == expected;
+}
+
+} // namespace
+
+TEST(DeferredReclaimerTest, DestructorsShareOneReclaimer) {
+  AudioDestructor<Tracked> first;
+  AudioDestructor<Tracked> second;
+
+  auto shared = DeferredReclaimer::getShared();
+  EXPECT_EQ(DeferredReclaimer::getShared(), shared);
+  // the shared instance plus one reference per destructor lane
+  EXPECT_EQ(shared.use_count(), 3);
+}
+
+TEST(DeferredReclaimerTest, ObjectsOfAllLanesAreDestroyedOnTheReclaimerThread) {
+  std::atomic<int> destroyed{0};
+  AudioDestructor<Tracked> first;
+  AudioDestructor<Tracked> second;
+
+  for (int i = 0; i < 10; i++) {
+    auto object = std::make_shared<Tracked>(destroyed);
+    ASSERT_TRUE((i % 2 == 0 ? first : second).tryAddForDeconstruction(std::move(object)));
+    EXPECT_EQ(object, nullptr);
+  }
+
+  EXPECT_TRUE(waitFor(destroyed, 10));
+}
+
+TEST(DeferredReclaimerTest, DerivedObjectIsDestroyedThroughItsOwnDestructor) {
+  std::atomic<int> destroyed{0};
+  AudioDestructor<Tracked> destructor;
+
+  std::shared_ptr<DerivedTracked> object = std::make_shared<DerivedTracked>(destroyed);
+  ASSERT_TRUE(destructor.tryAddForDeconstruction(std::move(object)));
+
+  EXPECT_TRUE(waitFor(destroyed, 1));
+}
+
+TEST(DeferredReclaimerTest, RemainingObjectsAreDestroyedWithTheirLane) {
+  std::atomic<int> destroyed{0};
+
+  {
+    AudioDestructor<Tracked> destructor;
+    for (int i = 0; i < 100; i++) {
+      destructor.tryAddForDeconstruction(std::make_shared<Tracked>(destroyed));
+    }
+  }
+
+  EXPECT_EQ(destroyed.load(), 100);
+}
@@ -115,3 +115,77 @@ TEST_F(DelayTest, DelayHandlesTailCorrectly) {
     }
   }
 }
+
+TEST_F(DelayTest, DelayInterpolatesFractionalDelay) {
+  float DELAY_TIME = 10.5f / sampleRate;
+  static constexpr int FRAMES_TO_PROCESS = 128;
+  auto options = DelayOptions();
+  options.maxDelayTime = 1.0f;
+  auto delayNode = TestableDelayNode(context, options);
+  delayNode.setDelayTimeParam(DELAY_TIME);
+
+  auto buffer = std::make_shared<audioapi::AudioBuffer>(FRAMES_TO_PROCESS, 1, sampleRate);
+  for (size_t i = 0; i < buffer->getSize(); ++i) {
+    (*buffer->getChannel(0))[i] = i + 1;
+  }
+
+  // cubic interpolation reproduces a linear signal exactly
+  auto resultBuffer = delayNode.processNode(buffer, FRAMES_TO_PROCESS);
+  for (size_t i = 12; i < FRAMES_TO_PROCESS; ++i) {
+    EXPECT_NEAR((*resultBuffer->getChannel(0))[i], static_cast<float>(i + 1) - 10.5f, 1e-3);
+  }
+}
+
+TEST_F(DelayTest, DelayTimeIsAppliedPerSample) {
+  static constexpr int FRAMES_TO_PROCESS = 128;
+  auto options = DelayOptions();
+  options.maxDelayTime = 1.0f;
+  auto delayNode = TestableDelayNode(context, options);
+  auto delayTime = delayNode.getDelayTimeParam();
+  delayTime->setValueAtTime(10.0f / sampleRate, 0.0);
+  delayTime->linearRampToValueAtTime(
+      30.0f / sampleRate, FRAMES_TO_PROCESS / static_cast<double>(sampleRate));
+
+  auto buffer = std::make_shared<audioapi::AudioBuffer>(FRAMES_TO_PROCESS, 1, sampleRate);
+  for (size_t i = 0; i < buffer->getSize(); ++i) {
+    (*buffer->getChannel(0))[i] = i + 1;
+  }
+  delayNode.processNode(buffer, FRAMES_TO_PROCESS);
+
+  for (size_t i = 0; i < buffer->getSize(); ++i) {
+    (*buffer->getChannel(0))[i] = FRAMES_TO_PROCESS + i + 1;
+  }
+  auto resultBuffer = delayNode.processNode(buffer, FRAMES_TO_PROCESS);
+
+  // context time does not advance, so both quanta follow the same ramp from 10 to 30 frames
+  for (size_t i = 0; i < FRAMES_TO_PROCESS; ++i) {
+    float delayFrames = 10.0f + 20.0f * static_cast<float>(i) / FRAMES_TO_PROCESS;
+    EXPECT_NEAR(
+        (*resultBuffer->getChannel(0))[i],
+        static_cast<float>(FRAMES_TO_PROCESS + i + 1) - delayFrames,
+        1e-2);
+  }
+}
+
+TEST_F(DelayTest, DelayWrapsAroundRingBuffer) {
+  static constexpr int FRAMES_TO_PROCESS = 128;
+  static constexpr int DELAY_FRAMES = 300;
+  auto options = DelayOptions();
+  options.maxDelayTime = 512.0f / sampleRate;
+  auto delayNode = TestableDelayNode(context, options);
+  delayNode.setDelayTimeParam(static_cast<float>(DELAY_FRAMES) / sampleRate);
+
+  auto buffer = std::make_shared<audioapi::AudioBuffer>(FRAMES_TO_PROCESS, 1, sampleRate);
+  for (int quantum = 0; quantum < 20; ++quantum) {
+    for (size_t i = 0; i < buffer->getSize(); ++i) {
+      (*buffer->getChannel(0))[i] = static_cast<float>(quantum * FRAMES_TO_PROCESS + i + 1);
+    }
+
+    auto resultBuffer = delayNode.processNode(buffer, FRAMES_TO_PROCESS);
+    for (size_t i = 0; i < FRAMES_TO_PROCESS; ++i) {
+      int source = quantum * FRAMES_TO_PROCESS + static_cast<int>(i) - DELAY_FRAMES;
+      EXPECT_FLOAT_EQ(
+          (*resultBuffer->getChannel(0))[i], source < 0 ? 0.0f : static_cast<float>(source + 1));
+    }
+  }
+}
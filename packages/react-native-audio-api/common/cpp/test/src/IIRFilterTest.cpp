@@ -2,16 +2,22 @@
 #include <audioapi/core/OfflineAudioContext.h>
 #include <audioapi/core/effects/IIRFilterNode.h>
 #include <audioapi/core/utils/worklets/SafeIncludes.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBuffer.h>
+#include <audioapi/utils/Benchmark.hpp>
 #include <gtest/gtest.h>
 #include <test/src/MockAudioEventHandlerRegistry.h>
 #include <algorithm>
 #include <complex>
+#include <cstdio>
 #include <memory>
 #include <numbers>
+#include <random>
 #include <vector>
 
 using namespace audioapi;
 
+namespace audioapi {
 class IIRFilterTest : public ::testing::Test {
  protected:
   std::shared_ptr<MockAudioEventHandlerRegistry> eventRegistry;
@@ -26,6 +32,125 @@ class IIRFilterTest : public ::testing::Test {
         2, 5 * sampleRate, sampleRate, eventRegistry, RuntimeRegistry{});
   }
 
+  static std::vector<double> multiplyPolynomials(
+      const std::vector<double> &lhs,
+      const std::vector<double> &rhs) {
+    std::vector<double> result(lhs.size() + rhs.size() - 1, 0.0);
+    for (size_t i = 0; i < lhs.size(); ++i) {
+      for (size_t j = 0; j < rhs.size(); ++j) {
+        result[i + j] += lhs[i] * rhs[j];
+      }
+    }
+    return result;
+  }
+
+  /// Stable lowpass of the given order built from RBJ lowpass biquads
+  /// and a one-pole section for odd orders, expanded into direct form.
+  static std::pair<std::vector<float>, std::vector<float>> makeLowpass(int order) {
+    std::vector<double> numerator = {1.0};
+    std::vector<double> denominator = {1.0};
+
+    for (int k = 0; k < order / 2; ++k) {
+      double omega = 2.0 * std::numbers::pi * (1000.0 + 2000.0 * k) / sampleRate;
+      double alpha = std::sin(omega) / (2.0 * 0.7);
+      double cosOmega = std::cos(omega);
+      double a0 = 1.0 + alpha;
+      numerator = multiplyPolynomials(
+          numerator,
+          {(1.0 - cosOmega) / (2.0 * a0), (1.0 - cosOmega) / a0, (1.0 - cosOmega) / (2.0 * a0)});
+      denominator =
+          multiplyPolynomials(denominator, {1.0, -2.0 * cosOmega / a0, (1.0 - alpha) / a0});
+    }
+
+    if (order % 2 == 1) {
+      numerator = multiplyPolynomials(numerator, {0.05, 0.05});
+      denominator = multiplyPolynomials(denominator, {1.0, -0.9});
+    }
+
+    return {
+        std::vector<float>(numerator.begin(), numerator.end()),
+        std::vector<float>(denominator.begin(), denominator.end())};
+  }
+
+  /// Reference direct form filter computed in double precision.
+  static std::vector<float> filterReference(
+      const std::vector<float> &feedforward,
+      const std::vector<float> &feedback,
+      const std::vector<float> &input) {
+    std::vector<double> x(input.begin(), input.end());
+    std::vector<double> y(input.size(), 0.0);
+
+    for (size_t n = 0; n < input.size(); ++n) {
+      double value = 0.0;
+      for (size_t k = 0; k < feedforward.size() && k <= n; ++k) {
+        value += static_cast<double>(feedforward[k]) * x[n - k];
+      }
+      for (size_t k = 1; k < feedback.size() && k <= n; ++k) {
+        value -= static_cast<double>(feedback[k]) * y[n - k];
+      }
+      y[n] = value / feedback[0];
+    }
+
+    return {y.begin(), y.end()};
+  }
+
+  static std::vector<float> makeNoise(size_t length) {
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+    std::vector<float> noise(length);
+    for (auto &sample : noise) {
+      sample = distribution(generator);
+    }
+    return noise;
+  }
+
+  /// Processes the input in render quanta and returns the output of the given channel.
+  static std::vector<float> processThroughNode(
+      IIRFilterNode &node,
+      const std::vector<float> &input,
+      int numberOfChannels = 1) {
+    std::vector<float> output;
+    auto buffer =
+        std::make_shared<AudioBuffer>(RENDER_QUANTUM_SIZE, numberOfChannels, sampleRate);
+
+    for (size_t offset = 0; offset < input.size(); offset += RENDER_QUANTUM_SIZE) {
+      for (int c = 0; c < numberOfChannels; ++c) {
+        buffer->getChannel(c)->copy(input.data(), offset, 0, RENDER_QUANTUM_SIZE);
+      }
+      auto result = node.processNode(buffer, RENDER_QUANTUM_SIZE);
+      for (int c = 1; c < numberOfChannels; ++c) {
+        for (size_t i = 0; i < RENDER_QUANTUM_SIZE; ++i) {
+          EXPECT_EQ((*result->getChannel(c))[i], (*result->getChannel(0))[i]);
+        }
+      }
+      auto channel = result->getChannel(0)->span();
+      output.insert(output.end(), channel.begin(), channel.end());
+    }
+
+    return output;
+  }
+
+  static void processQuantum(IIRFilterNode &node, const std::shared_ptr<AudioBuffer> &buffer) {
+    node.processNode(buffer, RENDER_QUANTUM_SIZE);
+  }
+
+  static size_t getNumberOfSections(const IIRFilterNode &node) {
+    return node.cascade_ == nullptr ? 0 : node.cascade_->getNumberOfSections();
+  }
+
+  static void useDirectForm(IIRFilterNode &node) {
+    node.cascade_ = nullptr;
+  }
+
+  static int getTailFrames(const IIRFilterNode &node) {
+    return node.tailFrames_;
+  }
+
+  static void connectInputAndDisconnect(IIRFilterNode &node) {
+    node.numberOfEnabledInputNodes_ = 1;
+    node.onInputDisabled();
+  }
+
   static std::complex<double>
   evaluatePolynomial(std::span<const double> coefficients, std::complex<double> z, int order) {
     // Use Horner's method to evaluate the polynomial P(z) = sum(coef[k]*z^k, k, 0, order);
@@ -88,6 +213,7 @@ class IIRFilterTest : public ::testing::Test {
     }
   }
 };
+} // namespace audioapi
 
 TEST_F(IIRFilterTest, IIRFilterCanBeCreated) {
   const std::vector<float> feedforward = {1.0};
@@ -152,3 +278,115 @@ TEST_F(IIRFilterTest, GetFrequencyResponse) {
     }
   }
 }
+
+TEST_F(IIRFilterTest, ProcessMatchesDirectForm) {
+  const std::vector<float> feedforward = {0.0050662636, 0.0101325272, 0.0050662636};
+  const std::vector<float> feedback = {1.0632762845, -1.9797349456, 0.9367237155};
+
+  auto node = IIRFilterNode(context, IIRFilterOptions(feedforward, feedback));
+  EXPECT_EQ(getNumberOfSections(node), 1);
+
+  auto input = makeNoise(8 * RENDER_QUANTUM_SIZE);
+  auto expected = filterReference(feedforward, feedback, input);
+  auto output = processThroughNode(node, input, 2);
+
+  for (size_t i = 0; i < input.size(); ++i) {
+    EXPECT_NEAR(output[i], expected[i], tolerance) << "Sample " << i;
+  }
+}
+
+TEST_F(IIRFilterTest, HighOrderFiltersAreFactoredIntoSections) {
+  for (int order = 2; order <= 19; ++order) {
+    auto [feedforward, feedback] = makeLowpass(order);
+    auto node = IIRFilterNode(context, IIRFilterOptions(feedforward, feedback));
+    EXPECT_EQ(getNumberOfSections(node), (order + 1) / 2) << "Order " << order;
+
+    auto input = makeNoise(16 * RENDER_QUANTUM_SIZE);
+    auto expected = filterReference(feedforward, feedback, input);
+    auto output = processThroughNode(node, input, 5);
+
+    for (size_t i = 0; i < input.size(); ++i) {
+      ASSERT_NEAR(output[i], expected[i], 1e-3f) << "Order " << order << ", sample " << i;
+    }
+  }
+}
+
+TEST_F(IIRFilterTest, LeadingZerosDelayTheSignal) {
+  const std::vector<float> feedforward = {0.0f, 0.0f, 0.5f};
+  const std::vector<float> feedback = {1.0f};
+
+  auto node = IIRFilterNode(context, IIRFilterOptions(feedforward, feedback));
+  EXPECT_EQ(getNumberOfSections(node), 1);
+
+  auto input = makeNoise(RENDER_QUANTUM_SIZE * 2);
+  auto output = processThroughNode(node, input);
+
+  EXPECT_FLOAT_EQ(output[0], 0.0f);
+  EXPECT_FLOAT_EQ(output[1], 0.0f);
+  for (size_t i = 2; i < input.size(); ++i) {
+    EXPECT_FLOAT_EQ(output[i], 0.5f * input[i - 2]);
+  }
+}
+
+TEST_F(IIRFilterTest, FilterRingsOutAfterInputIsDisabled) {
+  const std::vector<float> feedforward = {1.0f};
+  const std::vector<float> feedback = {1.0f, -0.99f};
+
+  auto node = IIRFilterNode(context, IIRFilterOptions(feedforward, feedback));
+  // 0.99^n drops below 1/32768 after 1035 frames
+  EXPECT_EQ(getTailFrames(node), 9 * RENDER_QUANTUM_SIZE);
+
+  std::vector<float> input(RENDER_QUANTUM_SIZE, 0.0f);
+  input[0] = 1.0f;
+  processThroughNode(node, input);
+  connectInputAndDisconnect(node);
+
+  std::vector<float> silence(RENDER_QUANTUM_SIZE, 0.0f);
+  for (int i = 0; i < 9; ++i) {
+    auto output = processThroughNode(node, silence);
+    EXPECT_TRUE(node.isEnabled());
+    EXPECT_NEAR(output[0], std::pow(0.99f, (i + 1) * RENDER_QUANTUM_SIZE), tolerance);
+  }
+
+  processThroughNode(node, silence);
+  EXPECT_FALSE(node.isEnabled());
+}
+
+TEST_F(IIRFilterTest, BenchmarkOrders2To20) {
+  static constexpr int kQuanta = 500;
+  static constexpr int kChannels = 2;
+  auto buffer = std::make_shared<AudioBuffer>(RENDER_QUANTUM_SIZE, kChannels, sampleRate);
+  auto noise = makeNoise(RENDER_QUANTUM_SIZE);
+  const double quantumDuration = 1e9 * RENDER_QUANTUM_SIZE / sampleRate;
+
+  auto run = [&](IIRFilterNode &node) {
+    return benchmarks::getExecutionTime([&]() {
+             for (int i = 0; i < kQuanta; ++i) {
+               for (int c = 0; c < kChannels; ++c) {
+                 buffer->getChannel(c)->copy(noise.data(), 0, 0, RENDER_QUANTUM_SIZE);
+               }
+               processQuantum(node, buffer);
+             }
+           }) /
+        kQuanta;
+  };
+
+  for (int order = 2; order <= 20; ++order) {
+    auto [feedforward, feedback] = makeLowpass(order);
+    auto sections = IIRFilterNode(context, IIRFilterOptions(feedforward, feedback));
+    auto directForm = IIRFilterNode(context, IIRFilterOptions(feedforward, feedback));
+    useDirectForm(directForm);
+    ASSERT_GT(getNumberOfSections(sections), 0);
+
+    double sectionsTime = run(sections);
+    double directFormTime = run(directForm);
+    printf(
+        "[ BENCH    ] IIR order %2d: sections %8.0f ns/quantum, direct form %8.0f ns/quantum\n",
+        order,
+        sectionsTime,
+        directFormTime);
+
+    // a quantum has to be filtered faster than it plays, whatever the order
+    EXPECT_LT(sectionsTime, quantumDuration) << "order " << order;
+  }
+}
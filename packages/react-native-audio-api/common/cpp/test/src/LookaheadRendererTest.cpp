@@ -0,0 +1,167 @@
+#include <audioapi/core/utils/LookaheadRenderer.h>
+#include <audioapi/utils/AudioArray.h>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace audioapi;
+
+namespace {
+
+constexpr size_t kBlockSize = 16;
+constexpr float kSampleRate = 48000.0f;
+
+LookaheadRenderer::Block *waitForBlock(LookaheadRenderer &renderer) {
+  for (int i = 0; i < 1000; i++) {
+    if (auto *block = renderer.acquire()) {
+      return block;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  return nullptr;
+}
+
+// acquire counts every miss as an underrun, so with more blocks in flight wait for them first
+bool waitForRenderedBlocks(const LookaheadRenderer &renderer, uint64_t count) {
+  for (int i = 0; i < 1000; i++) {
+    if (renderer.getStats().renderedBlocks >= count) {
+      return true;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  return false;
+}
+
+bool doubleInput(LookaheadRenderer::Block &block) {
+  auto &input = *block.input->getChannel(0);
+  auto &output = *block.output->getChannel(0);
+  for (size_t i = 0; i < kBlockSize; i++) {
+    output[i] = input[i] * 2.0f;
+  }
+  return true;
+}
+
+} // namespace
+
+TEST(LookaheadRendererTest, OutputIsDelayedByTheLookahead) {
+  LookaheadRenderer renderer(3, kBlockSize, 1, 1, kSampleRate, doubleInput);
+
+  for (int quantum = 0; quantum < 10; quantum++) {
+    ASSERT_TRUE(waitForRenderedBlocks(renderer, quantum < 3 ? 0 : quantum - 2));
+    auto *block = renderer.acquire();
+    ASSERT_NE(block, nullptr);
+
+    float expected = quantum < 3 ? 0.0f : static_cast<float>(quantum - 3 + 1) * 2.0f;
+    EXPECT_FLOAT_EQ((*block->output->getChannel(0))[kBlockSize - 1], expected);
+
+    auto &input = *block->input->getChannel(0);
+    std::fill(input.begin(), input.end(), static_cast<float>(quantum + 1));
+    renderer.submit(block);
+  }
+
+  EXPECT_EQ(renderer.getStats().latencyFrames, 3 * kBlockSize);
+}
+
+TEST(LookaheadRendererTest, LateBlockIsCountedAsUnderrun) {
+  std::atomic<bool> releaseRender{false};
+  LookaheadRenderer renderer(
+      1, kBlockSize, 1, 1, kSampleRate, [&](LookaheadRenderer::Block &block) {
+        while (!releaseRender.load()) {
+          std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return doubleInput(block);
+      });
+
+  auto *block = renderer.acquire();
+  ASSERT_NE(block, nullptr);
+  renderer.submit(block);
+
+  EXPECT_EQ(renderer.acquire(), nullptr);
+  EXPECT_EQ(renderer.getStats().underruns, 1);
+
+  releaseRender.store(true);
+  EXPECT_NE(waitForBlock(renderer), nullptr);
+  EXPECT_EQ(renderer.getStats().renderedBlocks, 1);
+}
+
+TEST(LookaheadRendererTest, LateBlockIsSkippedToKeepTheLookahead) {
+  // the block with a negative input stalls until released
+  std::atomic<bool> releaseRender{false};
+  LookaheadRenderer renderer(
+      2, kBlockSize, 1, 1, kSampleRate, [&](LookaheadRenderer::Block &block) {
+        while ((*block.input->getChannel(0))[0] < 0.0f && !releaseRender.load()) {
+          std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return doubleInput(block);
+      });
+
+  auto submitInput = [&](LookaheadRenderer::Block *block, float value) {
+    auto &input = *block->input->getChannel(0);
+    std::fill(input.begin(), input.end(), value);
+    renderer.submit(block);
+  };
+
+  submitInput(renderer.acquire(), 1.0f);
+  submitInput(renderer.acquire(), -1.0f);
+
+  ASSERT_TRUE(waitForRenderedBlocks(renderer, 1));
+  auto *block = renderer.acquire();
+  ASSERT_NE(block, nullptr);
+  EXPECT_FLOAT_EQ((*block->output->getChannel(0))[0], 2.0f);
+  submitInput(block, 3.0f);
+
+  // the stalled block misses its quantum, then both blocks in flight get rendered
+  EXPECT_EQ(renderer.acquire(), nullptr);
+  releaseRender.store(true);
+  ASSERT_TRUE(waitForRenderedBlocks(renderer, 3));
+
+  // the late block is skipped, the next one plays in its own quantum
+  block = renderer.acquire();
+  ASSERT_NE(block, nullptr);
+  EXPECT_FLOAT_EQ((*block->output->getChannel(0))[0], 6.0f);
+  submitInput(block, 5.0f);
+
+  // the skipped block comes back silent in place of the input dropped by the underrun
+  for (int i = 0; i < 1000 && renderer.getStats().skippedBlocks == 0; i++) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  block = renderer.acquire();
+  ASSERT_NE(block, nullptr);
+  EXPECT_FLOAT_EQ((*block->output->getChannel(0))[0], 0.0f);
+  submitInput(block, 7.0f);
+
+  ASSERT_TRUE(waitForRenderedBlocks(renderer, 4));
+  block = renderer.acquire();
+  ASSERT_NE(block, nullptr);
+  EXPECT_FLOAT_EQ((*block->output->getChannel(0))[0], 10.0f);
+  EXPECT_EQ(renderer.getStats().underruns, 1);
+  EXPECT_EQ(renderer.getStats().renderedBlocks, 4);
+  EXPECT_EQ(renderer.getStats().skippedBlocks, 1);
+}
+
+TEST(LookaheadRendererTest, FailedRenderIsSilent) {
+  LookaheadRenderer renderer(
+      1, kBlockSize, 1, 1, kSampleRate, [](LookaheadRenderer::Block &block) {
+        auto &output = *block.output->getChannel(0);
+        std::fill(output.begin(), output.end(), 1.0f);
+        return false;
+      });
+
+  auto *block = waitForBlock(renderer);
+  ASSERT_NE(block, nullptr);
+  renderer.submit(block);
+
+  block = waitForBlock(renderer);
+  ASSERT_NE(block, nullptr);
+  EXPECT_FLOAT_EQ((*block->output->getChannel(0))[0], 0.0f);
+}
+
+TEST(LookaheadRendererTest, LookaheadIsClamped) {
+  LookaheadRenderer none(0, kBlockSize, 1, 1, kSampleRate, doubleInput);
+  EXPECT_EQ(none.getLookahead(), LookaheadRenderer::MIN_LOOKAHEAD);
+
+  LookaheadRenderer tooMany(1000, kBlockSize, 1, 1, kSampleRate, doubleInput);
+  EXPECT_EQ(tooMany.getLookahead(), LookaheadRenderer::MAX_LOOKAHEAD);
+}
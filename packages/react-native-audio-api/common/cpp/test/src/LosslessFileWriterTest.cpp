@@ -0,0 +1,256 @@
+#include <audioapi/core/utils/LosslessFileWriter.h>
+#include <audioapi/libs/miniaudio/miniaudio.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBuffer.h>
+#include <audioapi/utils/AudioFileProperties.h>
+#include <audioapi/utils/Benchmark.hpp>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace audioapi;
+
+class LosslessFileWriterTest : public ::testing::Test {
+ protected:
+  static constexpr float sampleRate = 48000.0f;
+  static constexpr int channels = 2;
+  // three full FLAC blocks and a partial one
+  static constexpr size_t frames = 3 * 4096 + 1000;
+
+  std::string directory;
+
+  void SetUp() override {
+    directory = (std::filesystem::temp_directory_path() / "lossless_file_writer_test").string();
+    std::filesystem::create_directories(directory);
+  }
+
+  void TearDown() override {
+    std::filesystem::remove_all(directory);
+  }
+
+  static std::shared_ptr<AudioFileProperties> makeProperties(
+      AudioFileProperties::Format format,
+      AudioFileProperties::BitDepth bitDepth,
+      int channelCount = channels,
+      float fileSampleRate = sampleRate) {
+    return std::make_shared<AudioFileProperties>(
+        AudioFileProperties::FileDirectory::Cache,
+        "",
+        "",
+        channelCount,
+        0,
+        format,
+        fileSampleRate,
+        0,
+        bitDepth,
+        -1,
+        0,
+        AudioFileProperties::IOSAudioQuality::High);
+  }
+
+  /// @brief Correlated stereo tones with a stretch of silence and a stretch of noise, so that
+  /// every kind of FLAC subframe is used.
+  static std::vector<float> makeInterleaved() {
+    std::vector<float> interleaved(frames * channels);
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<float> noise(-1.0f, 1.0f);
+
+    for (size_t i = 0; i < frames; ++i) {
+      auto tone = 0.6f * std::sin(2.0f * static_cast<float>(M_PI) * 440.0f * i / sampleRate);
+      float left = tone;
+      float right = 0.8f * tone + 0.05f * std::sin(0.01f * i);
+
+      if (i >= 4096 && i < 8192) {
+        left = right = 0.0f;
+      } else if (i >= 8192 && i < 12288) {
+        left = noise(generator);
+        right = noise(generator);
+      }
+
+      interleaved[i * channels] = left;
+      interleaved[i * channels + 1] = right;
+    }
+
+    return interleaved;
+  }
+
+  static int32_t quantize(float sample, int bitsPerSample) {
+    auto scale = static_cast<float>(1 << (bitsPerSample - 1));
+    auto value = std::lrint(std::clamp(sample, -1.0f, 1.0f) * scale);
+    return static_cast<int32_t>(std::min(value, static_cast<long>(scale) - 1));
+  }
+
+  /// @brief Decodes the file with miniaudio as 32 bit integers.
+  static std::vector<int32_t> decode(const std::string &path, ma_uint32 &decodedChannels) {
+    ma_decoder_config config = ma_decoder_config_init(ma_format_s32, 0, 0);
+    ma_decoder decoder;
+    EXPECT_EQ(ma_decoder_init_file(path.c_str(), &config, &decoder), MA_SUCCESS);
+
+    ma_uint64 length = 0;
+    ma_decoder_get_length_in_pcm_frames(&decoder, &length);
+    decodedChannels = decoder.outputChannels;
+
+    std::vector<int32_t> samples(length * decodedChannels);
+    ma_uint64 framesRead = 0;
+    ma_decoder_read_pcm_frames(&decoder, samples.data(), length, &framesRead);
+    samples.resize(framesRead * decodedChannels);
+    ma_decoder_uninit(&decoder);
+    return samples;
+  }
+
+  void expectLossless(
+      AudioFileProperties::Format format,
+      AudioFileProperties::BitDepth bitDepth,
+      int bitsPerSample) {
+    auto path = directory + "/recording";
+    auto input = makeInterleaved();
+
+    LosslessFileWriter writer(nullptr, makeProperties(format, bitDepth));
+    ASSERT_TRUE(writer.openFile(path, sampleRate, channels).is_ok());
+
+    // uneven writes, like the ones of a recorder
+    for (size_t offset = 0; offset < frames; offset += 480) {
+      auto count = std::min<size_t>(480, frames - offset);
+      writer.writeAudioData(input.data() + offset * channels, count);
+    }
+
+    auto result = writer.closeFile();
+    ASSERT_TRUE(result.is_ok());
+    auto [fileSizeInMB, duration] = result.unwrap();
+    EXPECT_NEAR(duration, static_cast<double>(frames) / sampleRate, 1e-9);
+    EXPECT_NEAR(fileSizeInMB * 1024 * 1024, std::filesystem::file_size(path), 1.0);
+    EXPECT_EQ(writer.getDroppedFrames(), 0);
+
+    ma_uint32 decodedChannels = 0;
+    auto decoded = decode(path, decodedChannels);
+    ASSERT_EQ(decodedChannels, channels);
+    ASSERT_EQ(decoded.size(), input.size());
+
+    for (size_t i = 0; i < input.size(); ++i) {
+      ASSERT_EQ(decoded[i] >> (32 - bitsPerSample), quantize(input[i], bitsPerSample))
+          << "sample " << i;
+    }
+  }
+};
+
+TEST_F(LosslessFileWriterTest, Wav16IsLossless) {
+  expectLossless(AudioFileProperties::Format::WAV, AudioFileProperties::BitDepth::Bit16, 16);
+}
+
+TEST_F(LosslessFileWriterTest, Wav24IsLossless) {
+  expectLossless(AudioFileProperties::Format::WAV, AudioFileProperties::BitDepth::Bit24, 24);
+}
+
+TEST_F(LosslessFileWriterTest, Flac16IsLossless) {
+  expectLossless(AudioFileProperties::Format::FLAC, AudioFileProperties::BitDepth::Bit16, 16);
+}
+
+TEST_F(LosslessFileWriterTest, Flac24IsLossless) {
+  expectLossless(AudioFileProperties::Format::FLAC, AudioFileProperties::BitDepth::Bit24, 24);
+}
+
+TEST_F(LosslessFileWriterTest, WavFloatKeepsTheSamples) {
+  auto path = directory + "/recording.wav";
+  auto input = makeInterleaved();
+
+  auto buffer = std::make_shared<AudioBuffer>(frames, channels, sampleRate);
+  for (int channel = 0; channel < channels; ++channel) {
+    for (size_t i = 0; i < frames; ++i) {
+      (*buffer->getChannel(channel))[i] = input[i * channels + channel];
+    }
+  }
+
+  LosslessFileWriter writer(
+      nullptr,
+      makeProperties(AudioFileProperties::Format::WAV, AudioFileProperties::BitDepth::Bit32));
+  ASSERT_TRUE(writer.openFile(path, sampleRate, channels).is_ok());
+  writer.writeAudioData(*buffer, frames);
+  ASSERT_TRUE(writer.closeFile().is_ok());
+
+  ma_decoder_config config = ma_decoder_config_init(ma_format_f32, 0, 0);
+  ma_decoder decoder;
+  ASSERT_EQ(ma_decoder_init_file(path.c_str(), &config, &decoder), MA_SUCCESS);
+  std::vector<float> decoded(input.size());
+  ma_uint64 framesRead = 0;
+  ma_decoder_read_pcm_frames(&decoder, decoded.data(), frames, &framesRead);
+  ma_decoder_uninit(&decoder);
+
+  ASSERT_EQ(framesRead, frames);
+  EXPECT_EQ(decoded, input);
+}
+
+TEST_F(LosslessFileWriterTest, StreamIsConvertedToTheFileFormat) {
+  auto path = directory + "/converted.flac";
+  auto input = makeInterleaved();
+
+  LosslessFileWriter writer(
+      nullptr,
+      makeProperties(
+          AudioFileProperties::Format::FLAC, AudioFileProperties::BitDepth::Bit16, 1, 24000.0f));
+  ASSERT_TRUE(writer.openFile(path, sampleRate, channels).is_ok());
+  writer.writeAudioData(input.data(), frames);
+  auto result = writer.closeFile();
+  ASSERT_TRUE(result.is_ok());
+
+  ma_uint32 decodedChannels = 0;
+  auto decoded = decode(path, decodedChannels);
+  EXPECT_EQ(decodedChannels, 1);
+  // the frames held back by the resampler are written too
+  EXPECT_EQ(decoded.size(), frames / 2);
+  EXPECT_NEAR(std::get<1>(result.unwrap()), static_cast<double>(frames) / sampleRate, 1e-9);
+}
+
+TEST_F(LosslessFileWriterTest, UnsupportedFormatIsRejected) {
+  LosslessFileWriter writer(
+      nullptr,
+      makeProperties(AudioFileProperties::Format::M4A, AudioFileProperties::BitDepth::Bit16));
+  EXPECT_FALSE(writer.openFile(directory + "/recording.m4a", sampleRate, channels).is_ok());
+  EXPECT_FALSE(writer.closeFile().is_ok());
+}
+
+TEST_F(LosslessFileWriterTest, BenchmarkEncoding) {
+  static constexpr size_t kSeconds = 30;
+  auto input = makeInterleaved();
+  auto totalFrames = kSeconds * static_cast<size_t>(sampleRate);
+
+  for (auto format : {AudioFileProperties::Format::WAV, AudioFileProperties::Format::FLAC}) {
+    auto properties = makeProperties(format, AudioFileProperties::BitDepth::Bit16);
+    auto encoder = LosslessEncoder::create(*properties);
+    EncodedBytes output;
+
+    double encodingTime = benchmarks::getExecutionTime([&]() {
+      for (size_t encodedFrames = 0; encodedFrames < totalFrames; encodedFrames += frames) {
+        encoder->encode(input.data(), frames, output);
+        output.clear();
+      }
+      encoder->finish(output);
+    });
+
+    // the recorder side only copies into a block, the encoding happens on the writer thread
+    LosslessFileWriter writer(nullptr, properties);
+    ASSERT_TRUE(writer.openFile(directory + "/benchmark", sampleRate, channels).is_ok());
+    double writeTime = 0.0;
+    size_t writes = 0;
+
+    for (size_t offset = 0; offset + 128 <= frames; offset += 128, ++writes) {
+      writeTime += benchmarks::getExecutionTime(
+          [&]() { writer.writeAudioData(input.data() + offset * channels, 128); });
+    }
+
+    ASSERT_TRUE(writer.closeFile().is_ok());
+
+    printf(
+        "[ BENCH    ] %s: %zu s of stereo audio encoded in %6.1f ms, %5.0f ns per 128 frames "
+        "written\n",
+        format == AudioFileProperties::Format::WAV ? "wav 16 " : "flac 16",
+        kSeconds,
+        encodingTime / 1e6,
+        writeTime / writes);
+  }
+}
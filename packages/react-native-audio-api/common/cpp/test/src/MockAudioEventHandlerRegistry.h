@@ -24,4 +24,9 @@ class MockAudioEventHandlerRegistry : public IAudioEventHandlerRegistry {
   MOCK_METHOD3(
       invokeHandlerWithEventBody,
       void(AudioEvent eventName, uint64_t listenerId, const EventMap &body));
+
+  // a real queue, so that tests can inspect the events emitted from the audio thread
+  std::shared_ptr<AudioEventQueue> createEventQueue(size_t capacity) override {
+    return std::make_shared<AudioEventQueue>(capacity);
+  }
 };
@@ -0,0 +1,227 @@
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBuffer.h>
+#include <audioapi/utils/AudioBufferBuilder.h>
+#include <audioapi/utils/PagedAudioFile.h>
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace audioapi;
+
+class PagedAudioFileTest : public ::testing::Test {
+ protected:
+  static constexpr float sampleRate = 8000.0f;
+  static constexpr int channels = 2;
+
+  std::string directory;
+
+  void SetUp() override {
+    directory = (std::filesystem::temp_directory_path() / "paged_audio_file_test").string();
+    std::filesystem::create_directories(directory);
+  }
+
+  void TearDown() override {
+    std::filesystem::remove_all(directory);
+  }
+
+  static float sampleAt(int channel, size_t frame) {
+    return static_cast<float>(frame % 1000) / 1000.0f + static_cast<float>(channel);
+  }
+
+  static std::vector<float> makeInterleaved(size_t frames) {
+    std::vector<float> interleaved(frames * channels);
+    for (size_t i = 0; i < frames; ++i) {
+      for (int ch = 0; ch < channels; ++ch) {
+        interleaved[i * channels + ch] = sampleAt(ch, i);
+      }
+    }
+    return interleaved;
+  }
+
+  static void expectContent(const AudioBuffer &buffer, size_t frames) {
+    ASSERT_EQ(buffer.getSize(), frames);
+    for (int ch = 0; ch < channels; ++ch) {
+      for (size_t i = 0; i < frames; ++i) {
+        ASSERT_EQ((*buffer.getChannel(ch))[i], sampleAt(ch, i));
+      }
+    }
+  }
+
+  // pages of the mapping holding the address mapped into this process, -1 where unknown
+  static long long residentBytes(const void *address) {
+    std::ifstream smaps("/proc/self/smaps");
+    auto target = reinterpret_cast<uintptr_t>(address);
+    bool inMapping = false;
+    std::string line;
+
+    while (std::getline(smaps, line)) {
+      uintptr_t begin = 0;
+      uintptr_t end = 0;
+      char dash = 0;
+      std::istringstream header(line);
+      if (header >> std::hex >> begin >> dash >> end && dash == '-') {
+        inMapping = begin <= target && target < end;
+      } else if (inMapping && line.rfind("Rss:", 0) == 0) {
+        return std::stoll(line.substr(4)) * 1024;
+      }
+    }
+    return -1;
+  }
+
+  static bool waitForWindow(const PagedAudioFile &file, size_t begin) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (std::chrono::steady_clock::now() < deadline) {
+      if (file.getWindow().begin == begin) {
+        return true;
+      }
+      std::this_thread::sleep_for(PagedAudioFile::kPagingInterval);
+    }
+    return false;
+  }
+};
+
+TEST_F(PagedAudioFileTest, AudioSurvivesPagingOut) {
+  static constexpr size_t frames = 100000;
+  auto file = PagedAudioFile::create(directory, frames, channels, sampleRate);
+  ASSERT_NE(file, nullptr);
+  EXPECT_GE(file->getCapacity(), frames + PagedAudioFile::kPaddingFrames);
+
+  auto buffer = file->createBuffer(frames);
+  auto interleaved = makeInterleaved(frames);
+  buffer->deinterleaveFrom(interleaved.data(), frames);
+  file->startPaging();
+
+  expectContent(*buffer, frames);
+
+  // the padding reads as silence
+  auto padded = file->createBuffer(frames + PagedAudioFile::kPaddingFrames);
+  for (int ch = 0; ch < channels; ++ch) {
+    for (size_t i = frames; i < padded->getSize(); ++i) {
+      ASSERT_EQ((*padded->getChannel(ch))[i], 0.0f);
+    }
+  }
+}
+
+TEST_F(PagedAudioFileTest, FileIsRemovedFromTheDirectory) {
+  auto file = PagedAudioFile::create(directory, 1000, channels, sampleRate);
+  ASSERT_NE(file, nullptr);
+  EXPECT_TRUE(std::filesystem::is_empty(directory));
+}
+
+TEST_F(PagedAudioFileTest, BufferKeepsTheFileAlive) {
+  std::shared_ptr<AudioBuffer> buffer;
+  {
+    auto file = PagedAudioFile::create(directory, 1000, channels, sampleRate);
+    buffer = file->createBuffer(1000);
+  }
+
+  ASSERT_NE(buffer->getPagedFile(), nullptr);
+  buffer->getChannel(1)->copy(std::vector<float>(1000, 0.5f).data(), 0, 0, 1000);
+  EXPECT_EQ((*buffer->getChannel(1))[999], 0.5f);
+
+  // copies are kept in memory
+  AudioBuffer copy(*buffer);
+  EXPECT_EQ(copy.getPagedFile(), nullptr);
+  EXPECT_EQ((*copy.getChannel(1))[999], 0.5f);
+}
+
+TEST_F(PagedAudioFileTest, WindowFollowsTheReadPosition) {
+  static constexpr size_t frames = static_cast<size_t>(sampleRate) * 60;
+  auto file = PagedAudioFile::create(directory, frames, channels, sampleRate);
+  ASSERT_NE(file, nullptr);
+  file->startPaging();
+
+  auto behind = static_cast<size_t>(PagedAudioFile::kKeepBehindSeconds * sampleRate);
+  auto ahead = static_cast<size_t>(PagedAudioFile::kPrefetchAheadSeconds * sampleRate);
+
+  size_t position = frames / 2;
+  file->setReadPosition(position);
+  ASSERT_TRUE(waitForWindow(*file, position - behind));
+  EXPECT_EQ(file->getWindow().end, position + ahead);
+
+  // jumping back, e.g. on a loop
+  file->setReadPosition(0);
+  ASSERT_TRUE(waitForWindow(*file, 0));
+  EXPECT_EQ(file->getWindow().end, ahead);
+
+  EXPECT_LT(file->getMaxResidentSizeInBytes(), frames * channels * sizeof(float) / 4);
+}
+
+TEST_F(PagedAudioFileTest, ResidentRegionsAreKeptOutsideOfTheWindow) {
+  static constexpr size_t frames = static_cast<size_t>(sampleRate) * 60;
+  auto file = PagedAudioFile::create(directory, frames, channels, sampleRate);
+  ASSERT_NE(file, nullptr);
+  auto buffer = file->createBuffer(frames);
+  auto interleaved = makeInterleaved(frames);
+  buffer->deinterleaveFrom(interleaved.data(), frames);
+  file->startPaging();
+
+  // a loop starting in the middle, the read position passes it and jumps back to the start
+  size_t loopStart = frames / 2;
+  auto behind = static_cast<size_t>(PagedAudioFile::kKeepBehindSeconds * sampleRate);
+  auto ahead = static_cast<size_t>(PagedAudioFile::kPrefetchAheadSeconds * sampleRate);
+  auto region = file->keepResident(loopStart, loopStart + ahead);
+
+  file->setReadPosition(loopStart);
+  ASSERT_TRUE(waitForWindow(*file, loopStart - behind));
+  file->setReadPosition(0);
+  ASSERT_TRUE(waitForWindow(*file, 0));
+
+  // measured before reading the region, reads fault dropped pages back in
+  auto address = buffer->getChannel(0)->begin();
+  auto withRegion = residentBytes(address);
+  region.reset();
+  auto withoutRegion = residentBytes(address);
+
+  for (int ch = 0; ch < channels; ++ch) {
+    for (size_t i = loopStart; i < loopStart + ahead; ++i) {
+      ASSERT_EQ((*buffer->getChannel(ch))[i], sampleAt(ch, i));
+    }
+  }
+
+  if (withRegion < 0) {
+    GTEST_SKIP() << "resident size of a mapping is not available";
+  }
+  auto regionBytes = static_cast<long long>(ahead * channels * sizeof(float));
+  EXPECT_GE(withRegion - withoutRegion, regionBytes / 2);
+}
+
+TEST_F(PagedAudioFileTest, BuilderWritesStraightIntoTheFile) {
+  static constexpr size_t frames = 50000;
+  auto interleaved = makeInterleaved(frames);
+
+  AudioBufferBuilder builder(channels, sampleRate, frames, directory);
+  for (size_t offset = 0; offset < frames; offset += 4096) {
+    builder.appendInterleaved(
+        interleaved.data() + offset * channels, std::min<size_t>(4096, frames - offset));
+  }
+  auto buffer = builder.build();
+
+  ASSERT_NE(buffer, nullptr);
+  EXPECT_NE(buffer->getPagedFile(), nullptr);
+  EXPECT_EQ(builder.getPeakAllocatedFrames(), 0);
+  expectContent(*buffer, frames);
+}
+
+TEST_F(PagedAudioFileTest, BuilderPagesStreamsOfUnknownLength) {
+  static constexpr size_t frames = 200000;
+  auto interleaved = makeInterleaved(frames);
+
+  AudioBufferBuilder builder(channels, sampleRate, 0, directory);
+  for (size_t offset = 0; offset < frames; offset += 4096) {
+    builder.appendInterleaved(
+        interleaved.data() + offset * channels, std::min<size_t>(4096, frames - offset));
+  }
+  auto buffer = builder.build();
+
+  ASSERT_NE(buffer, nullptr);
+  EXPECT_NE(buffer->getPagedFile(), nullptr);
+  expectContent(*buffer, frames);
+}
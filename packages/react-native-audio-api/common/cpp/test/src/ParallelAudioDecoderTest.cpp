@@ -0,0 +1,231 @@
+#include <audioapi/core/utils/ParallelAudioDecoder.h>
+#include <audioapi/libs/miniaudio/miniaudio.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBuffer.h>
+#include <audioapi/utils/Benchmark.hpp>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace audioapi;
+
+class ParallelAudioDecoderTest : public ::testing::Test {
+ protected:
+  static constexpr int sampleRate = 44100;
+  static constexpr int channels = 2;
+
+  std::string path;
+
+  void SetUp() override {
+    path = (std::filesystem::temp_directory_path() / "parallel_audio_decoder_test.wav").string();
+  }
+
+  void TearDown() override {
+    std::remove(path.c_str());
+  }
+
+  // 16-bit stereo noise, so every frame differs and misplaced ranges are caught
+  void writeWav(size_t frames) const {
+    ma_encoder_config config =
+        ma_encoder_config_init(ma_encoding_format_wav, ma_format_s16, channels, sampleRate);
+    ma_encoder encoder;
+    ASSERT_EQ(ma_encoder_init_file(path.c_str(), &config, &encoder), MA_SUCCESS);
+
+    std::vector<int16_t> samples(frames * channels);
+    uint32_t state = 12345;
+    for (auto &sample : samples) {
+      state = state * 1664525u + 1013904223u;
+      sample = static_cast<int16_t>(state >> 16);
+    }
+
+    ma_uint64 framesWritten = 0;
+    ma_encoder_write_pcm_frames(&encoder, samples.data(), frames, &framesWritten);
+    ma_encoder_uninit(&encoder);
+    ASSERT_EQ(framesWritten, frames);
+  }
+
+  std::shared_ptr<AudioBuffer> decodeSequentially(int outputSampleRate) const {
+    ma_decoder_config config = ma_decoder_config_init(ma_format_f32, 0, outputSampleRate);
+    ma_decoder decoder;
+    if (ma_decoder_init_file(path.c_str(), &config, &decoder) != MA_SUCCESS) {
+      return nullptr;
+    }
+
+    std::vector<float> interleaved;
+    std::vector<float> temp(4096 * channels);
+    while (true) {
+      ma_uint64 framesRead = 0;
+      ma_decoder_read_pcm_frames(&decoder, temp.data(), 4096, &framesRead);
+      if (framesRead == 0) {
+        break;
+      }
+      interleaved.insert(interleaved.end(), temp.begin(), temp.begin() + framesRead * channels);
+    }
+    ma_decoder_uninit(&decoder);
+
+    auto buffer = std::make_shared<AudioBuffer>(
+        interleaved.size() / channels, channels, static_cast<float>(outputSampleRate));
+    buffer->deinterleaveFrom(interleaved.data(), buffer->getSize());
+    return buffer;
+  }
+};
+
+TEST_F(ParallelAudioDecoderTest, RangesAreStitchedSampleExactly) {
+  static constexpr size_t frames = ParallelAudioDecoder::kMinFramesPerPart * 3 + 12345;
+  writeWav(frames);
+
+  ParallelAudioDecoder parallelDecoder(path, static_cast<float>(sampleRate), 4);
+  auto parallel = parallelDecoder.decode();
+  auto sequential = decodeSequentially(sampleRate);
+  ASSERT_NE(parallel, nullptr);
+  ASSERT_NE(sequential, nullptr);
+
+  ASSERT_EQ(parallel->getNumberOfChannels(), channels);
+  ASSERT_EQ(parallel->getSize(), frames);
+  ASSERT_EQ(sequential->getSize(), frames);
+  for (int ch = 0; ch < channels; ++ch) {
+    for (size_t i = 0; i < frames; ++i) {
+      ASSERT_EQ((*parallel->getChannel(ch))[i], (*sequential->getChannel(ch))[i]);
+    }
+  }
+}
+
+TEST_F(ParallelAudioDecoderTest, PartsCanRunConcurrently) {
+  static constexpr size_t frames = ParallelAudioDecoder::kMinFramesPerPart * 4;
+  writeWav(frames);
+
+  ParallelAudioDecoder parallelDecoder(path, 0.0f, 4);
+  std::vector<std::thread> workers;
+  for (size_t part = 0; part < parallelDecoder.getMaxNumberOfParts(); ++part) {
+    workers.emplace_back([&parallelDecoder, part]() { parallelDecoder.decodePart(part); });
+  }
+  for (auto &worker : workers) {
+    worker.join();
+  }
+
+  auto parallel = parallelDecoder.getResult();
+  auto sequential = decodeSequentially(0);
+  ASSERT_NE(parallel, nullptr);
+  ASSERT_EQ(parallel->getSize(), sequential->getSize());
+  for (int ch = 0; ch < channels; ++ch) {
+    for (size_t i = 0; i < frames; ++i) {
+      ASSERT_EQ((*parallel->getChannel(ch))[i], (*sequential->getChannel(ch))[i]);
+    }
+  }
+}
+
+TEST_F(ParallelAudioDecoderTest, ResampledRangesMatchSequentialResampling) {
+  static constexpr size_t frames = ParallelAudioDecoder::kMinFramesPerPart * 2;
+  writeWav(frames);
+
+  ParallelAudioDecoder parallelDecoder(path, 48000.0f, 4);
+  auto parallel = parallelDecoder.decode();
+  auto sequential = decodeSequentially(48000);
+  ASSERT_NE(parallel, nullptr);
+  EXPECT_EQ(parallel->getSampleRate(), 48000.0f);
+  EXPECT_NEAR(
+      static_cast<double>(parallel->getSize()), static_cast<double>(sequential->getSize()), 2.0);
+
+  size_t length = std::min(parallel->getSize(), sequential->getSize());
+  for (int ch = 0; ch < channels; ++ch) {
+    for (size_t i = 0; i < length; ++i) {
+      ASSERT_NEAR((*parallel->getChannel(ch))[i], (*sequential->getChannel(ch))[i], 1e-5f);
+    }
+  }
+}
+
+TEST_F(ParallelAudioDecoderTest, ResampledBoundariesStayCloseToSequentialResampling) {
+  // downsampling has the lowest filter cutoff, so its state takes longest to settle
+  static constexpr size_t frames = ParallelAudioDecoder::kMinFramesPerPart * 4;
+  static constexpr int outputSampleRate = 8000;
+  static constexpr size_t window = 256;
+  writeWav(frames);
+
+  ParallelAudioDecoder parallelDecoder(path, static_cast<float>(outputSampleRate), 4);
+  size_t numberOfParts = parallelDecoder.split();
+  ASSERT_EQ(numberOfParts, 4);
+  auto parallel = parallelDecoder.decode();
+  auto sequential = decodeSequentially(outputSampleRate);
+  ASSERT_NE(parallel, nullptr);
+  ASSERT_NE(sequential, nullptr);
+
+  size_t length = std::min(parallel->getSize(), sequential->getSize());
+  for (size_t part = 1; part < numberOfParts; ++part) {
+    // first output frame of the part, see ParallelAudioDecoder::getOutputFrame
+    auto start = static_cast<uint64_t>(frames * part / numberOfParts);
+    auto boundary = static_cast<size_t>((start * outputSampleRate + sampleRate - 1) / sampleRate);
+    ASSERT_LT(boundary + window, length);
+
+    float maxError = 0.0f;
+    for (int ch = 0; ch < channels; ++ch) {
+      for (size_t i = boundary - window; i < boundary + window; ++i) {
+        maxError = std::max(
+            maxError, std::abs((*parallel->getChannel(ch))[i] - (*sequential->getChannel(ch))[i]));
+      }
+    }
+    EXPECT_LE(maxError, 1e-6f) << "at the start of part " << part;
+  }
+}
+
+TEST_F(ParallelAudioDecoderTest, ShortFilesAreLeftToSequentialDecoding) {
+  writeWav(ParallelAudioDecoder::kMinFramesPerPart);
+
+  ParallelAudioDecoder parallelDecoder(path, static_cast<float>(sampleRate), 4);
+  EXPECT_EQ(parallelDecoder.split(), 0);
+  EXPECT_EQ(parallelDecoder.decode(), nullptr);
+}
+
+TEST_F(ParallelAudioDecoderTest, UnsupportedExtensionsAreNotProbed) {
+  writeWav(ParallelAudioDecoder::kMinFramesPerPart * 2);
+  auto oggPath = path + ".ogg";
+  std::filesystem::copy_file(path, oggPath, std::filesystem::copy_options::overwrite_existing);
+
+  ParallelAudioDecoder parallelDecoder(oggPath, static_cast<float>(sampleRate), 4);
+  EXPECT_EQ(parallelDecoder.split(), 0);
+  std::remove(oggPath.c_str());
+}
+
+TEST_F(ParallelAudioDecoderTest, BenchmarkAgainstSequentialDecode) {
+  // about three minutes of stereo audio
+  static constexpr size_t frames = ParallelAudioDecoder::kMinFramesPerPart * 16;
+  writeWav(frames);
+
+  auto hardwareThreads = std::max(std::thread::hardware_concurrency(), 1u);
+  for (size_t numberOfParts = 2; numberOfParts <= 8; numberOfParts *= 2) {
+    // the same ranges decoded one after another on this thread, so only the threads differ
+    double sequentialTime = benchmarks::getExecutionTime([&]() {
+      ParallelAudioDecoder parallelDecoder(path, static_cast<float>(sampleRate), numberOfParts);
+      ASSERT_NE(parallelDecoder.decode(), nullptr);
+    });
+
+    double parallelTime = benchmarks::getExecutionTime([&]() {
+      ParallelAudioDecoder parallelDecoder(path, static_cast<float>(sampleRate), numberOfParts);
+      std::vector<std::thread> workers;
+      for (size_t part = 0; part < numberOfParts; ++part) {
+        workers.emplace_back([&parallelDecoder, part]() { parallelDecoder.decodePart(part); });
+      }
+      for (auto &worker : workers) {
+        worker.join();
+      }
+      ASSERT_NE(parallelDecoder.getResult(), nullptr);
+    });
+
+    printf(
+        "[ BENCH    ] decode %zu frames, %u cores: %zu parts sequential %6.1f ms, parallel %6.1f ms\n",
+        frames,
+        hardwareThreads,
+        numberOfParts,
+        sequentialTime / 1e6,
+        parallelTime / 1e6);
+
+    // decoding has to keep well ahead of playback on any machine running the suite
+    EXPECT_LT(parallelTime / 1e9, static_cast<double>(frames) / sampleRate);
+  }
+}
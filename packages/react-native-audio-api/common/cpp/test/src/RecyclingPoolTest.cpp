@@ -0,0 +1,64 @@
+#include <audioapi/core/utils/RecyclingPool.h>
+#include <audioapi/utils/AudioBuffer.h>
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+
+using namespace audioapi;
+
+namespace {
+
+std::vector<std::shared_ptr<AudioBuffer>> createBuffers(size_t count) {
+  std::vector<std::shared_ptr<AudioBuffer>> buffers;
+  for (size_t i = 0; i < count; ++i) {
+    buffers.push_back(std::make_shared<AudioBuffer>(128, 2, 48000.0f));
+  }
+  return buffers;
+}
+
+bool isChannelDataShared(const AudioBuffer &buffer) {
+  return buffer.isChannelDataShared();
+}
+
+} // namespace
+
+TEST(RecyclingPoolTest, ObjectsAreReusedOnceReleased) {
+  RecyclingPool<AudioBuffer> pool(createBuffers(2));
+
+  auto first = pool.acquire();
+  auto second = pool.acquire();
+  ASSERT_NE(first, nullptr);
+  ASSERT_NE(second, nullptr);
+  EXPECT_NE(first, second);
+
+  EXPECT_EQ(pool.acquire(), nullptr);
+  EXPECT_EQ(pool.getMissedCount(), 1);
+
+  auto *released = first.get();
+  first.reset();
+  EXPECT_EQ(pool.acquire().get(), released);
+  EXPECT_EQ(pool.getAcquiredCount(), 3);
+}
+
+TEST(RecyclingPoolTest, ObjectsAreHandedOutInTurn) {
+  RecyclingPool<AudioBuffer> pool(createBuffers(3));
+
+  auto *first = pool.acquire().get();
+  auto *second = pool.acquire().get();
+  auto *third = pool.acquire().get();
+
+  // all of them are free again, the least recently used one comes first
+  EXPECT_EQ(pool.acquire().get(), first);
+  EXPECT_EQ(pool.acquire().get(), second);
+  EXPECT_EQ(pool.acquire().get(), third);
+}
+
+TEST(RecyclingPoolTest, SharedChannelDataKeepsTheBufferInUse) {
+  RecyclingPool<AudioBuffer> pool(createBuffers(1), isChannelDataShared);
+
+  auto channel = pool.acquire()->getSharedChannel(1);
+  EXPECT_EQ(pool.acquire(), nullptr);
+
+  channel.reset();
+  EXPECT_NE(pool.acquire(), nullptr);
+}
@@ -0,0 +1,61 @@
+#include <audioapi/core/utils/SeekIndex.h>
+#include <gtest/gtest.h>
+
+using namespace audioapi;
+
+TEST(SeekIndexTest, FindsThePrecedingEntry) {
+  SeekIndex index(100, 64);
+  for (int64_t timestamp = 0; timestamp < 1000; timestamp += 10) {
+    index.add(timestamp, timestamp * 4);
+  }
+  EXPECT_EQ(index.size(), 10);
+
+  auto entry = index.find(450);
+  ASSERT_TRUE(entry.has_value());
+  EXPECT_EQ(entry->timestamp, 400);
+  EXPECT_EQ(entry->position, 1600);
+
+  entry = index.find(400);
+  ASSERT_TRUE(entry.has_value());
+  EXPECT_EQ(entry->timestamp, 400);
+
+  EXPECT_FALSE(index.find(-1).has_value());
+}
+
+TEST(SeekIndexTest, SkipsPartsThatWereNotRead) {
+  SeekIndex index(100, 64);
+  for (int64_t timestamp = 0; timestamp < 500; timestamp += 10) {
+    index.add(timestamp, timestamp);
+  }
+  // seeked forward, then read on from there
+  for (int64_t timestamp = 2000; timestamp < 2500; timestamp += 10) {
+    index.add(timestamp, timestamp);
+  }
+
+  EXPECT_TRUE(index.find(550).has_value());
+  EXPECT_FALSE(index.find(1500).has_value());
+  EXPECT_EQ(index.find(2150)->timestamp, 2100);
+
+  // the gap fills in when the stream is read again
+  for (int64_t timestamp = 500; timestamp < 2000; timestamp += 10) {
+    index.add(timestamp, timestamp);
+  }
+  EXPECT_EQ(index.find(1550)->timestamp, 1500);
+}
+
+TEST(SeekIndexTest, ReducesWhenFull) {
+  SeekIndex index(10, 16);
+  for (int64_t timestamp = 0; timestamp < 10000; ++timestamp) {
+    index.add(timestamp, timestamp);
+  }
+
+  EXPECT_LT(index.size(), 16);
+  EXPECT_GT(index.getMinDistance(), 10);
+
+  // the whole stream stays covered
+  for (int64_t timestamp = 0; timestamp < 10000; timestamp += 97) {
+    auto entry = index.find(timestamp);
+    ASSERT_TRUE(entry.has_value());
+    EXPECT_LE(entry->timestamp, timestamp);
+  }
+}
@@ -0,0 +1,209 @@
+#include <audioapi/core/AudioParam.h>
+#include <audioapi/core/OfflineAudioContext.h>
+#include <audioapi/core/destinations/AudioDestinationNode.h>
+#include <audioapi/core/effects/GainNode.h>
+#include <audioapi/core/sources/AudioBufferSourceNode.h>
+#include <audioapi/core/sources/OscillatorNode.h>
+#include <audioapi/core/utils/AudioGraphManager.h>
+#include <audioapi/core/utils/Constants.h>
+#include <audioapi/core/utils/VoicePool.h>
+#include <audioapi/core/utils/worklets/SafeIncludes.h>
+#include <audioapi/types/NodeOptions.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBuffer.h>
+#include <gtest/gtest.h>
+#include <test/src/MockAudioEventHandlerRegistry.h>
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <numbers>
+
+using namespace audioapi;
+
+class VoicePoolTest : public ::testing::Test {
+ protected:
+  std::shared_ptr<MockAudioEventHandlerRegistry> eventRegistry;
+  std::shared_ptr<OfflineAudioContext> context;
+  std::shared_ptr<AudioBuffer> buffer;
+  static constexpr int sampleRate = 44100;
+
+  void SetUp() override {
+    eventRegistry = std::make_shared<MockAudioEventHandlerRegistry>();
+    context = std::make_shared<OfflineAudioContext>(
+        1, 5 * sampleRate, sampleRate, eventRegistry, RuntimeRegistry{});
+    context->initialize();
+    buffer = std::make_shared<AudioBuffer>(RENDER_QUANTUM_SIZE, 1, sampleRate);
+  }
+
+  void renderQuanta(int count) {
+    for (int i = 0; i < count; i++) {
+      context->getDestination()->renderAudio(buffer, RENDER_QUANTUM_SIZE);
+    }
+  }
+
+  VoicePool &getVoicePool() {
+    return context->getGraphManager()->getVoicePool();
+  }
+
+  // plays a quantum and drops the node, the way a finished voice is released from JS
+  OscillatorNode *playAndReleaseOscillator(float frequency) {
+    auto options = OscillatorOptions();
+    options.frequency = frequency;
+
+    auto oscillator = context->createOscillator(options);
+    oscillator->connect(context->getDestination());
+    oscillator->getFrequencyParam()->setValueAtTime(2 * frequency, 0.0);
+    oscillator->start(0.0);
+    oscillator->stop(static_cast<double>(RENDER_QUANTUM_SIZE) / sampleRate);
+    renderQuanta(3);
+
+    auto *node = oscillator.get();
+    oscillator.reset();
+    renderQuanta(1);
+    return node;
+  }
+};
+
+TEST_F(VoicePoolTest, FinishedNodeIsRecycled) {
+  playAndReleaseOscillator(880.0f);
+
+  auto stats = getVoicePool().getStats(VoiceType::OSCILLATOR);
+  EXPECT_EQ(stats.recycled, 1);
+  EXPECT_EQ(stats.available, 1);
+}
+
+TEST_F(VoicePoolTest, RecycledNodePlaysLikeANewOne) {
+  auto *recycledNode = playAndReleaseOscillator(880.0f);
+
+  auto options = OscillatorOptions();
+  options.frequency = 440.0f;
+  auto oscillator = context->createOscillator(options);
+
+  auto stats = getVoicePool().getStats(VoiceType::OSCILLATOR);
+  EXPECT_EQ(oscillator.get(), recycledNode);
+  EXPECT_EQ(stats.hits, 1);
+  EXPECT_EQ(stats.available, 0);
+  EXPECT_FLOAT_EQ(oscillator->getFrequencyParam()->getValue(), 440.0f);
+
+  auto startTime = context->getCurrentTime();
+  oscillator->connect(context->getDestination());
+  oscillator->start(startTime);
+  renderQuanta(1);
+
+  // the previous automation is gone and the phase starts over
+  auto output = buffer->getChannel(0)->span();
+  for (size_t i = 0; i < RENDER_QUANTUM_SIZE; i += 16) {
+    auto expected = std::sin(2.0 * std::numbers::pi * 440.0 * static_cast<double>(i) / sampleRate);
+    EXPECT_NEAR(output[i], expected, 1e-2) << "frame " << i;
+  }
+}
+
+TEST_F(VoicePoolTest, EmptyPoolCountsAMiss) {
+  auto oscillator = context->createOscillator(OscillatorOptions());
+
+  auto stats = getVoicePool().getStats(VoiceType::OSCILLATOR);
+  EXPECT_EQ(stats.hits, 0);
+  EXPECT_EQ(stats.misses, 1);
+}
+
+TEST_F(VoicePoolTest, PoolKeepsAtMostItsCapacity) {
+  getVoicePool().setCapacity(VoiceType::OSCILLATOR, 1);
+
+  auto first = context->createOscillator(OscillatorOptions());
+  auto second = context->createOscillator(OscillatorOptions());
+  renderQuanta(1);
+
+  first.reset();
+  second.reset();
+  renderQuanta(1);
+
+  auto stats = getVoicePool().getStats(VoiceType::OSCILLATOR);
+  EXPECT_EQ(stats.recycled, 1);
+  EXPECT_EQ(stats.available, 1);
+  EXPECT_EQ(stats.capacity, 1);
+
+  getVoicePool().setCapacity(VoiceType::OSCILLATOR, 0);
+  EXPECT_EQ(getVoicePool().getStats(VoiceType::OSCILLATOR).available, 0);
+}
+
+TEST_F(VoicePoolTest, NodeWithParamHeldElsewhereIsNotRecycled) {
+  auto oscillator = context->createOscillator(OscillatorOptions());
+  auto frequencyParam = oscillator->getFrequencyParam();
+  renderQuanta(1);
+
+  oscillator.reset();
+  renderQuanta(1);
+
+  EXPECT_EQ(getVoicePool().getStats(VoiceType::OSCILLATOR).recycled, 0);
+}
+
+TEST_F(VoicePoolTest, RecycledNodeNoLongerModulatesItsParams) {
+  auto gain = context->createGain(GainOptions());
+  gain->connect(context->getDestination());
+
+  auto lfo = context->createOscillator(OscillatorOptions());
+  lfo->connect(gain->getGainParam());
+  lfo->start(0.0);
+  lfo->stop(static_cast<double>(RENDER_QUANTUM_SIZE) / sampleRate);
+  renderQuanta(3);
+
+  auto *recycledNode = lfo.get();
+  lfo.reset();
+  renderQuanta(1);
+  ASSERT_EQ(getVoicePool().getStats(VoiceType::OSCILLATOR).recycled, 1);
+
+  // the new voice plays elsewhere, the gain it used to modulate keeps its own value
+  auto oscillator = context->createOscillator(OscillatorOptions());
+  ASSERT_EQ(oscillator.get(), recycledNode);
+  oscillator->connect(context->getDestination());
+  oscillator->start(context->getCurrentTime());
+  renderQuanta(1);
+
+  auto gainValues = gain->getGainParam()
+                        ->processARateParam(RENDER_QUANTUM_SIZE, context->getCurrentTime())
+                        ->getChannel(0)
+                        ->span();
+  for (size_t i = 0; i < RENDER_QUANTUM_SIZE; i += 16) {
+    EXPECT_FLOAT_EQ(gainValues[i], 1.0f) << "frame " << i;
+  }
+}
+
+TEST_F(VoicePoolTest, RecycledBufferSourcePlaysTheNewBuffer) {
+  auto firstBuffer = std::make_shared<AudioBuffer>(RENDER_QUANTUM_SIZE, 1, sampleRate);
+  std::ranges::fill(firstBuffer->getChannel(0)->span(), 0.25f);
+
+  auto firstOptions = AudioBufferSourceOptions();
+  firstOptions.buffer = firstBuffer;
+  firstOptions.loop = true;
+
+  auto bufferSource = context->createBufferSource(firstOptions);
+  bufferSource->connect(context->getDestination());
+  bufferSource->start(0.0);
+  bufferSource->stop(static_cast<double>(RENDER_QUANTUM_SIZE) / sampleRate);
+  renderQuanta(3);
+
+  auto *recycledNode = bufferSource.get();
+  bufferSource.reset();
+  renderQuanta(1);
+
+  auto secondBuffer = std::make_shared<AudioBuffer>(RENDER_QUANTUM_SIZE, 1, sampleRate);
+  std::ranges::fill(secondBuffer->getChannel(0)->span(), 0.5f);
+
+  auto secondOptions = AudioBufferSourceOptions();
+  secondOptions.buffer = secondBuffer;
+  bufferSource = context->createBufferSource(secondOptions);
+
+  EXPECT_EQ(bufferSource.get(), recycledNode);
+  EXPECT_FALSE(bufferSource->getLoop());
+  EXPECT_EQ(bufferSource->getBuffer(), secondBuffer);
+
+  bufferSource->connect(context->getDestination());
+  bufferSource->start(context->getCurrentTime());
+  renderQuanta(1);
+  EXPECT_FLOAT_EQ((*buffer->getChannel(0))[0], 0.5f);
+  EXPECT_FLOAT_EQ((*buffer->getChannel(0))[RENDER_QUANTUM_SIZE - 1], 0.5f);
+
+  // the buffer is not looped, so the node goes silent once it has been played
+  renderQuanta(1);
+  EXPECT_FLOAT_EQ((*buffer->getChannel(0))[RENDER_QUANTUM_SIZE - 1], 0.0f);
+}
@@ -0,0 +1,98 @@
+#include <audioapi/utils/WorkStealingExecutor.h>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace audioapi;
+
+namespace {
+
+bool waitFor(const std::atomic<int> &value, int expected) {
+  for (int i = 0; i < 2000 && value.load() != expected; i++) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  return value.load() == expected;
+}
+
+} // namespace
+
+TEST(WorkStealingExecutorTest, RunsTasksScheduledFromManyThreads) {
+  std::atomic<int> done{0};
+  WorkStealingExecutor executor(4);
+
+  std::vector<std::thread> producers;
+  for (int i = 0; i < 4; i++) {
+    producers.emplace_back([&executor, &done, i]() {
+      auto priority = i % 2 == 0 ? TaskPriority::INTERACTIVE : TaskPriority::BULK;
+      for (int j = 0; j < 250; j++) {
+        executor.schedule(priority, [&done]() { done.fetch_add(1); });
+      }
+    });
+  }
+  for (auto &producer : producers) {
+    producer.join();
+  }
+
+  EXPECT_TRUE(waitFor(done, 1000));
+}
+
+TEST(WorkStealingExecutorTest, InteractiveTaskDoesNotWaitForBulkTasks) {
+  std::atomic<bool> releaseBulkTasks{false};
+  std::atomic<int> startedBulkTasks{0};
+  std::atomic<int> interactiveTasks{0};
+  WorkStealingExecutor executor(4);
+
+  // more long bulk tasks than workers, like a decode split into parts
+  for (int i = 0; i < 8; i++) {
+    executor.schedule(TaskPriority::BULK, [&]() {
+      startedBulkTasks.fetch_add(1);
+      while (!releaseBulkTasks.load()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+    });
+  }
+  ASSERT_TRUE(waitFor(startedBulkTasks, 3));
+
+  executor.schedule(TaskPriority::INTERACTIVE, [&]() { interactiveTasks.fetch_add(1); });
+  EXPECT_TRUE(waitFor(interactiveTasks, 1));
+  // one worker is always kept for interactive tasks
+  EXPECT_EQ(startedBulkTasks.load(), 3);
+
+  releaseBulkTasks.store(true);
+  EXPECT_TRUE(waitFor(startedBulkTasks, 8));
+}
+
+TEST(WorkStealingExecutorTest, TaskScheduledFromATaskIsStolenByIdleWorkers) {
+  std::atomic<int> done{0};
+  WorkStealingExecutor executor(4);
+
+  // every nested task lands in the queue of the worker running the outer one
+  executor.schedule(TaskPriority::INTERACTIVE, [&]() {
+    for (int i = 0; i < 4; i++) {
+      executor.schedule(TaskPriority::INTERACTIVE, [&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        done.fetch_add(1);
+      });
+    }
+  });
+
+  auto start = std::chrono::steady_clock::now();
+  ASSERT_TRUE(waitFor(done, 4));
+  EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(150));
+}
+
+TEST(WorkStealingExecutorTest, QueuedTasksRunBeforeDestruction) {
+  std::atomic<int> done{0};
+
+  {
+    WorkStealingExecutor executor(2);
+    for (int i = 0; i < 100; i++) {
+      executor.schedule(TaskPriority::BULK, [&done]() { done.fetch_add(1); });
+    }
+  }
+
+  EXPECT_EQ(done.load(), 100);
+}
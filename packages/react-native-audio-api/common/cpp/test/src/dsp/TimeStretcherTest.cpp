@@ -0,0 +1,126 @@
+#include <audioapi/core/utils/AudioStretcher.h>
+#include <audioapi/core/utils/Constants.h>
+#include <audioapi/dsp/TimeStretcher.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBuffer.h>
+#include <gtest/gtest.h>
+#include <cmath>
+#include <memory>
+#include <numbers>
+#include <vector>
+
+using namespace audioapi;
+
+class TimeStretcherTest : public ::testing::Test {
+ protected:
+  static constexpr float sampleRate = 44100.0f;
+
+  static std::shared_ptr<AudioBuffer> makeSine(size_t frames, int channels, float frequency) {
+    auto buffer = std::make_shared<AudioBuffer>(frames, channels, sampleRate);
+    for (int ch = 0; ch < channels; ++ch) {
+      auto data = buffer->getChannel(ch)->span();
+      for (size_t i = 0; i < frames; ++i) {
+        data[i] = 0.5f * std::sin(2.0f * std::numbers::pi_v<float> * frequency * i / sampleRate);
+      }
+    }
+    return buffer;
+  }
+
+  static size_t countRisingZeroCrossings(const AudioArray &channel, size_t start, size_t end) {
+    size_t crossings = 0;
+    for (size_t i = start + 1; i < end; ++i) {
+      if (channel[i - 1] < 0.0f && channel[i] >= 0.0f) {
+        ++crossings;
+      }
+    }
+    return crossings;
+  }
+};
+
+TEST_F(TimeStretcherTest, OutputLengthFollowsPlaybackSpeed) {
+  auto input = makeSine(static_cast<size_t>(sampleRate), 2, 220.0f);
+
+  for (float playbackSpeed : {0.5f, 0.8f, 1.25f, 2.0f}) {
+    auto output = AudioStretcher::changePlaybackSpeed(*input, playbackSpeed);
+    ASSERT_NE(output, nullptr);
+    EXPECT_EQ(output->getNumberOfChannels(), 2);
+    EXPECT_EQ(output->getSize(), static_cast<size_t>(std::lround(sampleRate / playbackSpeed)));
+  }
+}
+
+TEST_F(TimeStretcherTest, PitchIsPreserved) {
+  static constexpr float frequency = 220.0f;
+  auto input = makeSine(static_cast<size_t>(sampleRate), 1, frequency);
+  auto output = AudioStretcher::changePlaybackSpeed(*input, 0.5f);
+  ASSERT_NE(output, nullptr);
+
+  // one second in the middle of the two second output still holds ~220 periods
+  auto crossings = countRisingZeroCrossings(
+      *output->getChannel(0),
+      static_cast<size_t>(sampleRate / 2),
+      static_cast<size_t>(sampleRate * 1.5f));
+  EXPECT_NEAR(static_cast<float>(crossings), frequency, frequency * 0.02f);
+}
+
+TEST_F(TimeStretcherTest, ChannelsStayAligned) {
+  auto input = makeSine(static_cast<size_t>(sampleRate), 2, 330.0f);
+  input->getChannel(1)->scale(0.5f);
+  auto output = AudioStretcher::changePlaybackSpeed(*input, 1.5f);
+  ASSERT_NE(output, nullptr);
+
+  for (size_t i = 0; i < output->getSize(); ++i) {
+    ASSERT_NEAR((*output->getChannel(1))[i], 0.5f * (*output->getChannel(0))[i], 1e-6f);
+  }
+}
+
+TEST_F(TimeStretcherTest, ChunkSizeDoesNotChangeOutput) {
+  static constexpr size_t frames = 20000;
+  auto input = makeSine(frames, 1, 440.0f);
+  const float *source = input->getChannel(0)->begin();
+
+  auto stretch = [&](size_t chunkFrames) {
+    dsp::TimeStretcher stretcher(
+        static_cast<int>(sampleRate / UPPER_FREQUENCY_LIMIT_DETECTION),
+        static_cast<int>(sampleRate / LOWER_FREQUENCY_LIMIT_DETECTION),
+        1);
+    std::vector<float> result;
+    std::vector<float> scratch(stretcher.getOutputCapacity(chunkFrames, 1.5f));
+    float *destination = scratch.data();
+
+    for (size_t offset = 0; offset < frames; offset += chunkFrames) {
+      size_t produced = stretcher.process(
+          &source, offset, std::min(chunkFrames, frames - offset), &destination, 1.5f);
+      result.insert(result.end(), scratch.begin(), scratch.begin() + produced);
+    }
+    size_t flushed = stretcher.flush(&destination);
+    result.insert(result.end(), scratch.begin(), scratch.begin() + flushed);
+    return result;
+  };
+
+  auto whole = stretch(frames);
+  auto chunked = stretch(RENDER_QUANTUM_SIZE);
+  ASSERT_EQ(whole.size(), chunked.size());
+  for (size_t i = 0; i < whole.size(); ++i) {
+    ASSERT_FLOAT_EQ(whole[i], chunked[i]);
+  }
+}
+
+TEST_F(TimeStretcherTest, ReportsProgressAndCanBeCancelled) {
+  auto input = makeSine(static_cast<size_t>(sampleRate * 2), 1, 220.0f);
+
+  std::vector<float> progress;
+  auto output = AudioStretcher::changePlaybackSpeed(
+      *input, 1.25f, [&](float value) { progress.push_back(value); });
+  ASSERT_NE(output, nullptr);
+  ASSERT_FALSE(progress.empty());
+  EXPECT_FLOAT_EQ(progress.back(), 1.0f);
+  for (size_t i = 1; i < progress.size(); ++i) {
+    EXPECT_GT(progress[i], progress[i - 1]);
+  }
+
+  size_t chunks = 0;
+  auto cancelled = AudioStretcher::changePlaybackSpeed(
+      *input, 1.25f, nullptr, [&]() { return ++chunks > 2; });
+  EXPECT_EQ(cancelled, nullptr);
+  EXPECT_EQ(chunks, 3);
+}
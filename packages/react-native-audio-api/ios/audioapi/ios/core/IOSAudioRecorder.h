@@ -48,7 +48,8 @@ class IOSAudioRecorder : public AudioRecorder {
       float sampleRate,
       size_t bufferLength,
       int channelCount,
-      uint64_t callbackId) override;
+      uint64_t callbackId,
+      size_t bufferPoolSize) override;
   void clearOnAudioReadyCallback() override;
 
  protected:
@@ -19,7 +19,6 @@
 #include <audioapi/utils/AudioBuffer.h>
 #include <audioapi/utils/AudioFileProperties.h>
 #include <audioapi/utils/CircularAudioArray.h>
-#include <audioapi/utils/CircularOverflowableAudioArray.h>
 #include <audioapi/utils/Result.hpp>
 
 namespace audioapi {
@@ -50,11 +49,9 @@ IOSAudioRecorder::IOSAudioRecorder(
 
     if (isConnected()) {
       if (auto lock = Locker::tryLock(adapterNodeMutex_)) {
-        for (size_t channel = 0; channel < adapterNode_->channelCount_; ++channel) {
-          auto data = (float *)inputBuffer->mBuffers[channel].mData;
-
-          adapterNode_->buff_[channel]->write(data, numFrames);
-        }
+        adapterNode_->buff_->write(numFrames, [inputBuffer](size_t channel) {
+          return static_cast<const float *>(inputBuffer->mBuffers[channel].mData);
+        });
       }
     }
   };
@@ -313,12 +310,18 @@ Result<NoneType, std::string> IOSAudioRecorder::setOnAudioReadyCallback(
     float sampleRate,
     size_t bufferLength,
     int channelCount,
-    uint64_t callbackId)
+    uint64_t callbackId,
+    size_t bufferPoolSize)
 {
   std::scoped_lock lock(callbackMutex_, errorCallbackMutex_);
 
   dataCallback_ = std::make_shared<IOSRecorderCallback>(
-      audioEventHandlerRegistry_, sampleRate, bufferLength, channelCount, callbackId);
+      audioEventHandlerRegistry_,
+      sampleRate,
+      bufferLength,
+      channelCount,
+      callbackId,
+      bufferPoolSize);
 
   if (!isIdle()) {
     auto result = std::static_pointer_cast<IOSRecorderCallback>(dataCallback_)
@@ -11,17 +11,29 @@
 #endif // RN_AUDIO_API_FFMPEG_DISABLED
 #include <audioapi/utils/AudioArray.h>
 #include <audioapi/utils/AudioBuffer.h>
+#include <audioapi/utils/AudioBufferBuilder.h>
 
 namespace audioapi {
 
-// Decoding audio in fixed-size chunks because total frame count can't be
-// determined in advance. Note: ma_decoder_get_length_in_pcm_frames() always
-// returns 0 for Vorbis decoders.
-std::vector<float> AudioDecoder::readAllPcmFrames(ma_decoder &decoder, int outputChannels)
+// Decoding audio in fixed-size chunks straight into planar storage. The buffer is sized
+// up front when the decoder knows the length, otherwise chunks are joined at the end.
+// Note: ma_decoder_get_length_in_pcm_frames() always returns 0 for Vorbis decoders.
+std::shared_ptr<AudioBuffer> AudioDecoder::readAllPcmFrames(
+    ma_decoder &decoder,
+    const std::string &pagedFileDirectory)
 {
-  std::vector<float> buffer;
+  auto outputChannels = static_cast<int>(decoder.outputChannels);
+  ma_uint64 expectedFrames = 0;
+  if (ma_decoder_get_length_in_pcm_frames(&decoder, &expectedFrames) != MA_SUCCESS) {
+    expectedFrames = 0;
+  }
+
+  AudioBufferBuilder builder(
+      outputChannels,
+      static_cast<float>(decoder.outputSampleRate),
+      expectedFrames,
+      pagedFileDirectory);
   std::vector<float> temp(CHUNK_SIZE * outputChannels);
-  ma_uint64 outFramesRead = 0;
 
   while (true) {
     ma_uint64 tempFramesDecoded = 0;
@@ -30,40 +42,24 @@ std::vector<float> AudioDecoder::readAllPcmFrames(ma_decoder &decoder, int outpu
       break;
     }
 
-    buffer.insert(buffer.end(), temp.data(), temp.data() + tempFramesDecoded * outputChannels);
-    outFramesRead += tempFramesDecoded;
+    builder.appendInterleaved(temp.data(), tempFramesDecoded);
   }
 
-  if (outFramesRead == 0) {
+  if (builder.getNumberOfFrames() == 0) {
     NSLog(@"Failed to decode");
   }
-  return buffer;
-}
-
-std::shared_ptr<AudioBuffer> AudioDecoder::makeAudioBufferFromFloatBuffer(
-    const std::vector<float> &buffer,
-    float outputSampleRate,
-    int outputChannels)
-{
-  if (buffer.empty()) {
-    return nullptr;
-  }
-
-  auto outputFrames = buffer.size() / outputChannels;
-  auto audioBuffer = std::make_shared<AudioBuffer>(outputFrames, outputChannels, outputSampleRate);
-
-  audioBuffer->deinterleaveFrom(buffer.data(), outputFrames);
-
-  return audioBuffer;
+  return builder.build();
 }
 
 std::shared_ptr<AudioBuffer> AudioDecoder::decodeWithFilePath(
     const std::string &path,
-    float sampleRate)
+    float sampleRate,
+    const std::string &pagedFileDirectory)
 {
   if (AudioDecoder::pathHasExtension(path, {".mp4", ".m4a", ".aac"})) {
 #if !RN_AUDIO_API_FFMPEG_DISABLED
-    auto buffer = ffmpegdecoder::decodeWithFilePath(path, static_cast<int>(sampleRate));
+    auto buffer = ffmpegdecoder::decodeWithFilePath(
+        path, static_cast<int>(sampleRate), pagedFileDirectory);
     if (buffer == nullptr) {
       NSLog(@"Failed to decode with FFmpeg: %s", path.c_str());
       return nullptr;
@@ -88,12 +84,9 @@ std::shared_ptr<AudioBuffer> AudioDecoder::decodeWithFilePath(
     return nullptr;
   }
 
-  auto outputSampleRate = static_cast<float>(decoder.outputSampleRate);
-  auto outputChannels = static_cast<int>(decoder.outputChannels);
-
-  std::vector<float> buffer = readAllPcmFrames(decoder, outputChannels);
+  auto audioBuffer = readAllPcmFrames(decoder, pagedFileDirectory);
   ma_decoder_uninit(&decoder);
-  return makeAudioBufferFromFloatBuffer(buffer, outputSampleRate, outputChannels);
+  return audioBuffer;
 }
 
 std::shared_ptr<AudioBuffer>
@@ -128,12 +121,14 @@ AudioDecoder::decodeWithMemoryBlock(const void *data, size_t size, float sampleR
     return nullptr;
   }
 
-  auto outputSampleRate = static_cast<float>(decoder.outputSampleRate);
-  auto outputChannels = static_cast<int>(decoder.outputChannels);
-
-  std::vector<float> buffer = readAllPcmFrames(decoder, outputChannels);
+  auto audioBuffer = readAllPcmFrames(decoder);
   ma_decoder_uninit(&decoder);
-  return makeAudioBufferFromFloatBuffer(buffer, outputSampleRate, outputChannels);
+  return audioBuffer;
+}
+
+std::string AudioDecoder::getPagedFileDirectory()
+{
+  return [NSTemporaryDirectory() UTF8String];
 }
 
 std::shared_ptr<AudioBuffer> AudioDecoder::decodeWithPCMInBase64(
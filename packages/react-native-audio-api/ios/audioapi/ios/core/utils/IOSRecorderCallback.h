@@ -19,7 +19,6 @@ struct CallbackData {
 namespace audioapi {
 
 class AudioBuffer;
-class CircularAudioArray;
 class AudioEventHandlerRegistry;
 
 class IOSRecorderCallback : public AudioRecorderCallback {
@@ -29,7 +28,8 @@ class IOSRecorderCallback : public AudioRecorderCallback {
       float sampleRate,
       size_t bufferLength,
       int channelCount,
-      uint64_t callbackId);
+      uint64_t callbackId,
+      size_t bufferPoolSize);
   ~IOSRecorderCallback();
 
   Result<NoneType, std::string> prepare(AVAudioFormat *bufferFormat, size_t maxInputBufferLength);
@@ -8,7 +8,7 @@
 #include <audioapi/ios/core/utils/IOSRecorderCallback.h>
 #include <audioapi/utils/AudioArray.h>
 #include <audioapi/utils/AudioBuffer.h>
-#include <audioapi/utils/CircularAudioArray.h>
+#include <audioapi/utils/CircularAudioBuffer.h>
 #include <audioapi/utils/Result.hpp>
 #include <algorithm>
 #include <utility>
@@ -20,13 +20,15 @@ IOSRecorderCallback::IOSRecorderCallback(
     float sampleRate,
     size_t bufferLength,
     int channelCount,
-    uint64_t callbackId)
+    uint64_t callbackId,
+    size_t bufferPoolSize)
     : AudioRecorderCallback(
           audioEventHandlerRegistry,
           sampleRate,
           bufferLength,
           channelCount,
-          callbackId)
+          callbackId,
+          bufferPoolSize)
 {
 }
 
@@ -39,9 +41,7 @@ IOSRecorderCallback::~IOSRecorderCallback()
     converterInputBuffer_ = nil;
     converterOutputBuffer_ = nil;
 
-    for (size_t i = 0; i < channelCount_; ++i) {
-      circularBuffer_[i]->zero();
-    }
+    circularBuffer_->clear();
   }
 }
 
@@ -105,7 +105,7 @@ Result<NoneType, std::string> IOSRecorderCallback::prepare(
 void IOSRecorderCallback::cleanup()
 {
   @autoreleasepool {
-    if (circularBuffer_[0]->getNumberOfAvailableFrames() > 0) {
+    if (circularBuffer_->getNumberOfAvailableFrames() > 0) {
       emitAudioData(true);
     }
 
@@ -115,9 +115,7 @@ void IOSRecorderCallback::cleanup()
     converterInputBuffer_ = nil;
     converterOutputBuffer_ = nil;
 
-    for (size_t i = 0; i < channelCount_; ++i) {
-      circularBuffer_[i]->zero();
-    }
+    circularBuffer_->clear();
     offloader_.reset();
   }
 }
@@ -147,12 +145,11 @@ void IOSRecorderCallback::taskOffloaderFunction(CallbackData data)
     if (bufferFormat_.sampleRate == sampleRate_ && bufferFormat_.channelCount == channelCount_ &&
         !bufferFormat_.isInterleaved) {
       // Directly write to circular buffer
-      for (size_t i = 0; i < channelCount_; ++i) {
-        auto *data = static_cast<float *>(inputBuffer->mBuffers[i].mData);
-        circularBuffer_[i]->push_back(data, numFrames);
-      }
+      circularBuffer_->write(numFrames, [inputBuffer](size_t channel) {
+        return static_cast<const float *>(inputBuffer->mBuffers[channel].mData);
+      });
 
-      if (circularBuffer_[0]->getNumberOfAvailableFrames() >= bufferLength_) {
+      if (circularBuffer_->getNumberOfAvailableFrames() >= bufferLength_) {
         emitAudioData();
       }
       return;
@@ -193,12 +190,12 @@ void IOSRecorderCallback::taskOffloaderFunction(CallbackData data)
       return;
     }
 
-    for (size_t i = 0; i < channelCount_; ++i) {
-      auto *data = static_cast<float *>(converterOutputBuffer_.audioBufferList->mBuffers[i].mData);
-      circularBuffer_[i]->push_back(data, outputFrameCount);
-    }
+    const AudioBufferList *outputBufferList = converterOutputBuffer_.audioBufferList;
+    circularBuffer_->write(outputFrameCount, [outputBufferList](size_t channel) {
+      return static_cast<const float *>(outputBufferList->mBuffers[channel].mData);
+    });
 
-    if (circularBuffer_[0]->getNumberOfAvailableFrames() >= bufferLength_) {
+    if (circularBuffer_->getNumberOfAvailableFrames() >= bufferLength_) {
       emitAudioData();
     }
   }
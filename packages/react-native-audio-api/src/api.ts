@@ -5,13 +5,23 @@ export { default as AudioBuffer } from './core/AudioBuffer';
 export { default as AudioBufferQueueSourceNode } from './core/AudioBufferQueueSourceNode';
 export { default as AudioBufferSourceNode } from './core/AudioBufferSourceNode';
 export { default as AudioContext } from './core/AudioContext';
-export { decodeAudioData, decodePCMInBase64 } from './core/AudioDecoder';
+export {
+  clearDecodedAudioCache,
+  decodeAudioData,
+  decodePagedAudioData,
+  decodePCMInBase64,
+  getDecodedAudioCacheStats,
+  setDecodedAudioCacheBudget,
+} from './core/AudioDecoder';
 export { default as AudioDestinationNode } from './core/AudioDestinationNode';
 export { default as AudioNode } from './core/AudioNode';
 export { default as AudioParam } from './core/AudioParam';
 export { default as AudioRecorder } from './core/AudioRecorder';
 export { default as AudioScheduledSourceNode } from './core/AudioScheduledSourceNode';
-export { default as changePlaybackSpeed } from './core/AudioStretcher';
+export {
+  default as changePlaybackSpeed,
+  cancelPlaybackSpeedChange,
+} from './core/AudioStretcher';
 export { default as BaseAudioContext } from './core/BaseAudioContext';
 export { default as BiquadFilterNode } from './core/BiquadFilterNode';
 export { default as ConstantSourceNode } from './core/ConstantSourceNode';
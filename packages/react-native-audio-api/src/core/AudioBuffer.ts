@@ -1,6 +1,6 @@
 import { IAudioBuffer } from '../interfaces';
 import { IndexSizeError, NotSupportedError } from '../errors';
-import { AudioBufferOptions } from '../types';
+import { AudioBufferOptions, AudioBufferStorageFormat } from '../types';
 
 export default class AudioBuffer {
   readonly length: number;
@@ -26,6 +26,21 @@ export default class AudioBuffer {
     this.numberOfChannels = this.buffer.numberOfChannels;
   }
 
+  /**
+   * How the samples are stored in memory, see AudioBufferStorageFormat.
+   */
+  public get storageFormat(): AudioBufferStorageFormat {
+    return this.buffer.storageFormat;
+  }
+
+  /**
+   * Converts the samples to the storage format. Reading or writing channel data
+   * with getChannelData or copyToChannel converts a compact buffer back to float32.
+   */
+  public setStorageFormat(format: AudioBufferStorageFormat): void {
+    this.buffer.setStorageFormat(format);
+  }
+
   public getChannelData(channel: number): Float32Array {
     if (channel < 0 || channel >= this.numberOfChannels) {
       throw new IndexSizeError(
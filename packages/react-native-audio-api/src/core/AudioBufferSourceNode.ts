@@ -6,16 +6,28 @@ import { EventEmptyType } from '../events/types';
 import { AudioEventSubscription } from '../events';
 import { AudioBufferSourceOptions } from '../types';
 import BaseAudioContext from './BaseAudioContext';
+import { isNativeNode } from '../utils';
 
 export default class AudioBufferSourceNode extends AudioBufferBaseSourceNode {
   private onLoopEndedSubscription?: AudioEventSubscription;
   private onLoopEndedCallback?: (event: EventEmptyType) => void;
 
-  constructor(context: BaseAudioContext, options?: AudioBufferSourceOptions) {
-    const node = context.context.createBufferSource({
-      ...options,
-      ...(options?.buffer ? { buffer: options.buffer.buffer } : {}),
-    });
+  constructor(context: BaseAudioContext, options?: AudioBufferSourceOptions);
+
+  /** @internal */
+  constructor(context: BaseAudioContext, node: IAudioBufferSourceNode);
+
+  /** @internal */
+  constructor(
+    context: BaseAudioContext,
+    arg?: AudioBufferSourceOptions | IAudioBufferSourceNode
+  ) {
+    const node = isNativeNode<IAudioBufferSourceNode>(arg)
+      ? arg
+      : context.context.createBufferSource({
+          ...arg,
+          ...(arg?.buffer ? { buffer: arg.buffer.buffer } : {}),
+        });
     super(context, node);
   }
 
@@ -1,8 +1,8 @@
 import { Image } from 'react-native';
 
-import { AudioApiError } from '../errors';
+import { AudioApiError, RangeError } from '../errors';
 import { IAudioDecoder } from '../interfaces';
-import { DecodeDataInput } from '../types';
+import { DecodeDataInput, DecodedAudioCacheStats } from '../types';
 import {
   isBase64Source,
   isDataBlobString,
@@ -105,6 +105,36 @@ class AudioDecoder {
     return audioBuffer;
   }
 
+  public async decodePagedAudioDataInstance(
+    input: number | string,
+    sampleRate?: number
+  ): Promise<AudioBuffer> {
+    const stringSource =
+      typeof input === 'number' ? Image.resolveAssetSource(input).uri : input;
+
+    if (
+      typeof stringSource !== 'string' ||
+      isBase64Source(stringSource) ||
+      isDataBlobString(stringSource) ||
+      isRemoteSource(stringSource)
+    ) {
+      throw new AudioApiError(
+        'Paged decoding supports only local files and bundled assets.'
+      );
+    }
+
+    const filePath = stringSource.startsWith('file://')
+      ? stringSource.replace('file://', '')
+      : stringSource;
+
+    const buffer = await this.decoder.decodeWithFilePathPaged(
+      filePath,
+      sampleRate ?? 0
+    );
+
+    return new AudioBuffer(buffer);
+  }
+
   public async decodePCMInBase64Instance(
     base64String: string,
     inputSampleRate: number,
@@ -119,6 +149,24 @@ class AudioDecoder {
     );
     return new AudioBuffer(buffer);
   }
+
+  public getCacheStats(): DecodedAudioCacheStats {
+    return this.decoder.getCacheStats();
+  }
+
+  public setCacheBudget(budgetInBytes: number): void {
+    if (budgetInBytes < 0) {
+      throw new RangeError(
+        `The budget must be non-negative, received: ${budgetInBytes}`
+      );
+    }
+
+    this.decoder.setCacheBudget(budgetInBytes);
+  }
+
+  public clearCache(): void {
+    this.decoder.clearCache();
+  }
 }
 
 export async function decodeAudioData(
@@ -133,6 +181,22 @@ export async function decodeAudioData(
   );
 }
 
+/**
+ * Decodes a long local file or bundled asset into a memory-mapped cache file
+ * instead of memory. Only a few seconds around the playback position of an
+ * AudioBufferSourceNode are kept in memory, the rest is paged in from disk
+ * ahead of playback. Reading the channel data from JS copies it into memory.
+ */
+export async function decodePagedAudioData(
+  input: number | string,
+  sampleRate?: number
+): Promise<AudioBuffer> {
+  return AudioDecoder.getInstance().decodePagedAudioDataInstance(
+    input,
+    sampleRate
+  );
+}
+
 export async function decodePCMInBase64(
   base64String: string,
   inputSampleRate: number,
@@ -146,3 +210,25 @@ export async function decodePCMInBase64(
     isInterleaved
   );
 }
+
+/**
+ * Returns the counters of the native cache of decoded audio, shared by every
+ * decodeAudioData call with a file path or an ArrayBuffer. Cached buffers are
+ * shared between the calls, the first getChannelData or copyToChannel of a
+ * buffer copies its samples, so changes never reach the other calls.
+ */
+export function getDecodedAudioCacheStats(): DecodedAudioCacheStats {
+  return AudioDecoder.getInstance().getCacheStats();
+}
+
+/**
+ * Sets the memory budget of the decoded audio cache, least recently used
+ * buffers are dropped to fit it. A budget of 0 disables caching.
+ */
+export function setDecodedAudioCacheBudget(budgetInBytes: number): void {
+  AudioDecoder.getInstance().setCacheBudget(budgetInBytes);
+}
+
+export function clearDecodedAudioCache(): void {
+  AudioDecoder.getInstance().clearCache();
+}
@@ -23,6 +23,11 @@ export default class AudioNode {
     this.channelInterpretation = this.node.channelInterpretation;
   }
 
+  /** @internal */
+  public getNode(): IAudioNode {
+    return this.node;
+  }
+
   public connect(destination: AudioNode): AudioNode;
   public connect(destination: AudioParam): void;
   public connect(destination: AudioNode | AudioParam): AudioNode | void {
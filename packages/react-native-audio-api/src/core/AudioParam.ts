@@ -143,4 +143,24 @@ export default class AudioParam {
 
     return this;
   }
+
+  /**
+   * Schedules many events with a single native call.
+   *
+   * @param events - Consecutive (type, time, value, extra) tuples, where type
+   * is an `AutomationEventType`. Times before the current time are moved to
+   * it, except the ones of cancels, and tuples with an unknown type or a
+   * negative time are skipped.
+   */
+  public scheduleEvents(events: Float64Array): AudioParam {
+    if (events.length % 4 !== 0) {
+      throw new RangeError(
+        `events must hold (type, time, value, extra) tuples: ${events.length}`
+      );
+    }
+
+    this.audioParam.scheduleEvents(events);
+
+    return this;
+  }
 }
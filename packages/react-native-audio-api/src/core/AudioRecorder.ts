@@ -168,6 +168,7 @@ export default class AudioRecorder {
       bufferLength: options.bufferLength,
       channelCount: options.channelCount,
       callbackId: this.onAudioReadySubscription.subscriptionId,
+      bufferPoolSize: options.bufferPoolSize ?? 0,
     });
   }
 
@@ -5,7 +5,8 @@ import { EventEmptyType } from '../events/types';
 import { AudioEventEmitter, AudioEventSubscription } from '../events';
 
 export default class AudioScheduledSourceNode extends AudioNode {
-  protected hasBeenStarted: boolean = false;
+  /** @internal */
+  public hasBeenStarted: boolean = false;
   protected readonly audioEventEmitter = new AudioEventEmitter(
     global.AudioEventEmitter
   );
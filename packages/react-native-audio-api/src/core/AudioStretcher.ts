@@ -5,6 +5,7 @@ import { AudioApiError } from '../errors';
 class AudioStretcher {
   private static instance: AudioStretcher | null = null;
   protected readonly stretcher: IAudioStretcher;
+  private nextJobId = 0;
 
   private constructor() {
     this.stretcher = global.createAudioStretcher();
@@ -19,26 +20,63 @@ class AudioStretcher {
 
   public async changePlaybackSpeedInstance(
     input: AudioBuffer,
-    playbackSpeed: number
+    playbackSpeed: number,
+    onProgress?: (progress: number) => void,
+    signal?: AbortSignal
   ): Promise<AudioBuffer> {
-    const buffer = await this.stretcher.changePlaybackSpeed(
+    const jobId = this.nextJobId++;
+    const onAbort = () => this.stretcher.cancel(jobId);
+
+    const pending = this.stretcher.changePlaybackSpeed(
       input.buffer,
-      playbackSpeed
+      playbackSpeed,
+      onProgress,
+      jobId
     );
+    if (signal?.aborted) {
+      onAbort();
+    }
+    signal?.addEventListener('abort', onAbort);
 
-    if (!buffer) {
-      throw new AudioApiError('Failed to change playback speed');
+    try {
+      const buffer = await pending;
+      if (!buffer) {
+        throw new AudioApiError('Failed to change playback speed');
+      }
+      return new AudioBuffer(buffer);
+    } finally {
+      signal?.removeEventListener('abort', onAbort);
     }
-    return new AudioBuffer(buffer);
+  }
+
+  public cancel(): void {
+    this.stretcher.cancel();
   }
 }
 
+/**
+ * Changes the duration of the buffer without altering its pitch.
+ * The speed is clamped to [0.5, 2].
+ * @param onProgress called with the processed fraction of the input, in (0, 1]
+ * @param signal rejects only this change when aborted
+ */
 export default async function changePlaybackSpeed(
   input: AudioBuffer,
-  playbackSpeed: number
+  playbackSpeed: number,
+  onProgress?: (progress: number) => void,
+  signal?: AbortSignal
 ): Promise<AudioBuffer> {
   return AudioStretcher.getInstance().changePlaybackSpeedInstance(
     input,
-    playbackSpeed
+    playbackSpeed,
+    onProgress,
+    signal
   );
 }
+
+/**
+ * Rejects every playback speed change that is still in progress.
+ */
+export function cancelPlaybackSpeedChange(): void {
+  AudioStretcher.getInstance().cancel();
+}
@@ -2,9 +2,32 @@ import {
   InvalidAccessError,
   InvalidStateError,
   NotSupportedError,
+  RangeError,
 } from '../errors';
-import { IBaseAudioContext } from '../interfaces';
-import { AudioWorkletRuntime, ContextState, DecodeDataInput } from '../types';
+import {
+  IAudioBufferSourceNode,
+  IAudioNode,
+  IBaseAudioContext,
+  IBiquadFilterNode,
+  IConstantSourceNode,
+  IDelayNode,
+  IGainNode,
+  IOscillatorNode,
+  IStereoPannerNode,
+} from '../interfaces';
+import {
+  AudioWorkletRuntime,
+  ContextState,
+  DecodeDataInput,
+  ISubgraphTemplate,
+  SubgraphConnection,
+  SubgraphNodes,
+  SubgraphNodeTemplate,
+  SubgraphNodeType,
+  SubgraphTemplate,
+  VoicePoolNodeType,
+  VoicePoolStats,
+} from '../types';
 import { assertWorkletsEnabled } from '../utils';
 import AnalyserNode from './AnalyserNode';
 import AudioBuffer from './AudioBuffer';
@@ -12,6 +35,9 @@ import AudioBufferQueueSourceNode from './AudioBufferQueueSourceNode';
 import AudioBufferSourceNode from './AudioBufferSourceNode';
 import { decodeAudioData, decodePCMInBase64 } from './AudioDecoder';
 import AudioDestinationNode from './AudioDestinationNode';
+import AudioNode from './AudioNode';
+import AudioParam from './AudioParam';
+import AudioScheduledSourceNode from './AudioScheduledSourceNode';
 import BiquadFilterNode from './BiquadFilterNode';
 import ConstantSourceNode from './ConstantSourceNode';
 import ConvolverNode from './ConvolverNode';
@@ -72,7 +98,8 @@ export default class BaseAudioContext {
     callback: (audioData: Array<Float32Array>, channelCount: number) => void,
     bufferLength: number,
     inputChannelCount: number,
-    workletRuntime: AudioWorkletRuntime = 'AudioRuntime'
+    workletRuntime: AudioWorkletRuntime = 'AudioRuntime',
+    lookahead: number = 0
   ): WorkletNode {
     if (inputChannelCount < 1 || inputChannelCount > 32) {
       throw new NotSupportedError(
@@ -86,13 +113,15 @@ export default class BaseAudioContext {
       );
     }
 
+    this.assertWorkletLookahead(lookahead);
     assertWorkletsEnabled();
     return new WorkletNode(
       this,
       workletRuntime,
       callback,
       bufferLength,
-      inputChannelCount
+      inputChannelCount,
+      lookahead
     );
   }
 
@@ -103,10 +132,32 @@ export default class BaseAudioContext {
       framesToProcess: number,
       currentTime: number
     ) => void,
-    workletRuntime: AudioWorkletRuntime = 'AudioRuntime'
+    workletRuntime: AudioWorkletRuntime = 'AudioRuntime',
+    lookahead: number = 0,
+    blockSize: number = 128,
+    channelCount: number = 2
   ): WorkletProcessingNode {
+    if (
+      !Number.isInteger(channelCount) ||
+      channelCount < 1 ||
+      channelCount > 32
+    ) {
+      throw new NotSupportedError(
+        `The number of channels provided (${channelCount}) can not be less than 1 or greater than 32`
+      );
+    }
+
+    this.assertWorkletLookahead(lookahead);
+    this.assertWorkletBlockSize(blockSize);
     assertWorkletsEnabled();
-    return new WorkletProcessingNode(this, workletRuntime, callback);
+    return new WorkletProcessingNode(
+      this,
+      workletRuntime,
+      callback,
+      lookahead,
+      blockSize,
+      channelCount
+    );
   }
 
   createWorkletSourceNode(
@@ -116,10 +167,52 @@ export default class BaseAudioContext {
       currentTime: number,
       startOffset: number
     ) => void,
-    workletRuntime: AudioWorkletRuntime = 'AudioRuntime'
+    workletRuntime: AudioWorkletRuntime = 'AudioRuntime',
+    lookahead: number = 0,
+    blockSize: number = 128
   ): WorkletSourceNode {
+    this.assertWorkletLookahead(lookahead);
+    this.assertWorkletBlockSize(blockSize);
     assertWorkletsEnabled();
-    return new WorkletSourceNode(this, workletRuntime, callback);
+    return new WorkletSourceNode(
+      this,
+      workletRuntime,
+      callback,
+      lookahead,
+      blockSize
+    );
+  }
+
+  /**
+   * A worklet created with a lookahead runs on its own thread that many
+   * blocks ahead of the audio thread, 0 runs it on the audio thread.
+   * It locks its runtime while it runs, so it can not share the AudioRuntime
+   * with worklets run on the audio thread, creating such a mix throws.
+   */
+  private assertWorkletLookahead(lookahead: number): void {
+    if (!Number.isInteger(lookahead) || lookahead < 0 || lookahead > 64) {
+      throw new NotSupportedError(
+        `The lookahead provided (${lookahead}) must be an integer in range [0, 64]`
+      );
+    }
+  }
+
+  /**
+   * A worklet called for bigger blocks is called less often, at the cost of
+   * the block of latency a processing worklet gathers its input in. Blocks
+   * are whole render quanta, so they line up with the audio thread.
+   */
+  private assertWorkletBlockSize(blockSize: number): void {
+    if (
+      !Number.isInteger(blockSize) ||
+      blockSize < 128 ||
+      blockSize > 4096 ||
+      blockSize % 128 !== 0
+    ) {
+      throw new NotSupportedError(
+        `The block size provided (${blockSize}) must be a multiple of 128 in range [128, 4096]`
+      );
+    }
   }
 
   createRecorderAdapter(): RecorderAdapterNode {
@@ -237,4 +330,184 @@ export default class BaseAudioContext {
   createWaveShaper(): WaveShaperNode {
     return new WaveShaperNode(this);
   }
+
+  /**
+   * Schedules events of many params with a single native call.
+   *
+   * @param params - The params the events refer to.
+   * @param events - Consecutive (param index, type, time, value, extra)
+   * tuples, see `AudioParam.scheduleEvents`.
+   */
+  scheduleParamEvents(params: AudioParam[], events: Float64Array): void {
+    if (events.length % 5 !== 0) {
+      throw new RangeError(
+        `events must hold (param index, type, time, value, extra) tuples: ${events.length}`
+      );
+    }
+
+    this.context.scheduleParamEvents(
+      params.map((param) => param.audioParam),
+      events
+    );
+  }
+
+  /**
+   * Creates, connects and optionally starts the nodes of a subgraph with a
+   * single native call. The whole subgraph reaches the audio thread at once,
+   * so building a voice costs one call instead of one per node, connection
+   * and start.
+   *
+   * @param subgraph - The nodes to create, the connections between them and
+   * to existing nodes, and the time to start the source nodes at.
+   * @returns The nodes, in the order of their templates.
+   */
+  createSubgraph<const T extends readonly SubgraphNodeTemplate[]>(
+    subgraph: SubgraphTemplate<T>
+  ): SubgraphNodes<T> {
+    if (
+      subgraph.start !== undefined &&
+      !(Number.isFinite(subgraph.start) && subgraph.start >= 0)
+    ) {
+      throw new RangeError(
+        `start must be a finite non-negative number: ${subgraph.start}`
+      );
+    }
+
+    const nativeSubgraph: ISubgraphTemplate = {
+      nodes: subgraph.nodes.map((template) => this.toNativeTemplate(template)),
+      connections: subgraph.connections?.map((connection) =>
+        this.toNativeConnection(connection)
+      ),
+      start: subgraph.start,
+    };
+
+    const nodes = this.context
+      .createSubgraph(nativeSubgraph)
+      .map((node, index) =>
+        this.wrapSubgraphNode(subgraph.nodes[index].type, node)
+      );
+
+    if (subgraph.start !== undefined) {
+      nodes.forEach((node) => {
+        if (node instanceof AudioScheduledSourceNode) {
+          node.hasBeenStarted = true;
+        }
+      });
+    }
+
+    return nodes as SubgraphNodes<T>;
+  }
+
+  /**
+   * Applies the graph edits made by the callback, e.g. creating, connecting
+   * and disconnecting nodes, together within a single render quantum, so the
+   * audio thread never renders a partially edited graph.
+   * The callback has to make its edits synchronously. Edits made before it
+   * throws are applied as well. Calls can be nested.
+   *
+   * @param edits - The callback making the edits.
+   * @returns The value returned by the callback.
+   */
+  batchGraphEdits<T>(edits: () => T): T {
+    this.context.beginGraphBatch();
+
+    try {
+      return edits();
+    } finally {
+      this.context.commitGraphBatch();
+    }
+  }
+
+  /**
+   * Returns the counters of the pools of finished oscillator and buffer
+   * source nodes. Once released, a finished node is kept in the pool of its
+   * type and created again by the next `createOscillator` or
+   * `createBufferSource` call, so triggering voices does not allocate them.
+   */
+  getVoicePoolStats(): Record<VoicePoolNodeType, VoicePoolStats> {
+    return this.context.getVoicePoolStats();
+  }
+
+  /**
+   * Sets the number of finished nodes of the type kept to be created again.
+   *
+   * @param type - The type of the nodes.
+   * @param capacity - The number of nodes, at most 256. 0 disables the pool.
+   */
+  setVoicePoolCapacity(type: VoicePoolNodeType, capacity: number): void {
+    if (!Number.isInteger(capacity) || capacity < 0 || capacity > 256) {
+      throw new RangeError(
+        `capacity must be an integer in the range [0, 256]: ${capacity}`
+      );
+    }
+
+    this.context.setVoicePoolCapacity(type, capacity);
+  }
+
+  private toNativeTemplate(
+    template: SubgraphNodeTemplate
+  ): ISubgraphTemplate['nodes'][number] {
+    if (template.type === 'oscillator' && template.options?.periodicWave) {
+      return {
+        type: template.type,
+        options: {
+          ...template.options,
+          type: 'custom',
+          periodicWave: template.options.periodicWave.periodicWave,
+        },
+      };
+    }
+
+    if (template.type === 'bufferSource' && template.options?.buffer) {
+      return {
+        type: template.type,
+        options: {
+          ...template.options,
+          buffer: template.options.buffer.buffer,
+        },
+      };
+    }
+
+    return template;
+  }
+
+  private toNativeConnection(
+    connection: SubgraphConnection
+  ): NonNullable<ISubgraphTemplate['connections']>[number] {
+    const [from, to, param] = connection;
+
+    if (typeof to === 'number') {
+      return param === undefined ? [from, to] : [from, to, param];
+    }
+
+    if (to.context !== this) {
+      throw new InvalidAccessError(
+        'Source and destination are from different BaseAudioContexts'
+      );
+    }
+
+    return [from, to instanceof AudioParam ? to.audioParam : to.getNode()];
+  }
+
+  private wrapSubgraphNode(
+    type: SubgraphNodeType,
+    node: IAudioNode
+  ): AudioNode {
+    switch (type) {
+      case 'oscillator':
+        return new OscillatorNode(this, node as IOscillatorNode);
+      case 'constantSource':
+        return new ConstantSourceNode(this, node as IConstantSourceNode);
+      case 'bufferSource':
+        return new AudioBufferSourceNode(this, node as IAudioBufferSourceNode);
+      case 'gain':
+        return new GainNode(this, node as IGainNode);
+      case 'stereoPanner':
+        return new StereoPannerNode(this, node as IStereoPannerNode);
+      case 'biquadFilter':
+        return new BiquadFilterNode(this, node as IBiquadFilterNode);
+      case 'delay':
+        return new DelayNode(this, node as IDelayNode);
+    }
+  }
 }
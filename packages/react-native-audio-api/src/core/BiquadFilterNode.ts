@@ -4,6 +4,7 @@ import AudioNode from './AudioNode';
 import AudioParam from './AudioParam';
 import BaseAudioContext from './BaseAudioContext';
 import { BiquadFilterOptions } from '../types';
+import { isNativeNode } from '../utils';
 
 export default class BiquadFilterNode extends AudioNode {
   readonly frequency: AudioParam;
@@ -11,10 +12,19 @@ export default class BiquadFilterNode extends AudioNode {
   readonly Q: AudioParam;
   readonly gain: AudioParam;
 
-  constructor(context: BaseAudioContext, options?: BiquadFilterOptions) {
-    const biquadFilter: IBiquadFilterNode = context.context.createBiquadFilter(
-      options || {}
-    );
+  constructor(context: BaseAudioContext, options?: BiquadFilterOptions);
+
+  /** @internal */
+  constructor(context: BaseAudioContext, node: IBiquadFilterNode);
+
+  /** @internal */
+  constructor(
+    context: BaseAudioContext,
+    arg?: BiquadFilterOptions | IBiquadFilterNode
+  ) {
+    const biquadFilter = isNativeNode<IBiquadFilterNode>(arg)
+      ? arg
+      : context.context.createBiquadFilter(arg || {});
     super(context, biquadFilter);
     this.frequency = new AudioParam(biquadFilter.frequency, context);
     this.detune = new AudioParam(biquadFilter.detune, context);
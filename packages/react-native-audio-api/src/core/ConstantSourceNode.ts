@@ -3,14 +3,24 @@ import { ConstantSourceOptions } from '../types';
 import AudioParam from './AudioParam';
 import AudioScheduledSourceNode from './AudioScheduledSourceNode';
 import BaseAudioContext from './BaseAudioContext';
+import { isNativeNode } from '../utils';
 
 export default class ConstantSourceNode extends AudioScheduledSourceNode {
   readonly offset: AudioParam;
 
-  constructor(context: BaseAudioContext, options?: ConstantSourceOptions) {
-    const node: IConstantSourceNode = context.context.createConstantSource(
-      options || {}
-    );
+  constructor(context: BaseAudioContext, options?: ConstantSourceOptions);
+
+  /** @internal */
+  constructor(context: BaseAudioContext, node: IConstantSourceNode);
+
+  /** @internal */
+  constructor(
+    context: BaseAudioContext,
+    arg?: ConstantSourceOptions | IConstantSourceNode
+  ) {
+    const node: IConstantSourceNode = isNativeNode<IConstantSourceNode>(arg)
+      ? arg
+      : context.context.createConstantSource(arg || {});
     super(context, node);
     this.offset = new AudioParam(node.offset, context);
   }
@@ -1,13 +1,23 @@
+import { IDelayNode } from '../interfaces';
 import AudioNode from './AudioNode';
 import AudioParam from './AudioParam';
 import BaseAudioContext from './BaseAudioContext';
 import { DelayOptions } from '../types';
+import { isNativeNode } from '../utils';
 
 export default class DelayNode extends AudioNode {
   readonly delayTime: AudioParam;
 
-  constructor(context: BaseAudioContext, options?: DelayOptions) {
-    const delay = context.context.createDelay(options || {});
+  constructor(context: BaseAudioContext, options?: DelayOptions);
+
+  /** @internal */
+  constructor(context: BaseAudioContext, node: IDelayNode);
+
+  /** @internal */
+  constructor(context: BaseAudioContext, arg?: DelayOptions | IDelayNode) {
+    const delay = isNativeNode<IDelayNode>(arg)
+      ? arg
+      : context.context.createDelay(arg || {});
     super(context, delay);
     this.delayTime = new AudioParam(delay.delayTime, context);
   }
@@ -3,12 +3,21 @@ import { GainOptions } from '../types';
 import AudioNode from './AudioNode';
 import AudioParam from './AudioParam';
 import BaseAudioContext from './BaseAudioContext';
+import { isNativeNode } from '../utils';
 
 export default class GainNode extends AudioNode {
   readonly gain: AudioParam;
 
-  constructor(context: BaseAudioContext, options?: GainOptions) {
-    const gainNode: IGainNode = context.context.createGain(options || {});
+  constructor(context: BaseAudioContext, options?: GainOptions);
+
+  /** @internal */
+  constructor(context: BaseAudioContext, node: IGainNode);
+
+  /** @internal */
+  constructor(context: BaseAudioContext, arg?: GainOptions | IGainNode) {
+    const gainNode: IGainNode = isNativeNode<IGainNode>(arg)
+      ? arg
+      : context.context.createGain(arg || {});
     super(context, gainNode);
     this.gain = new AudioParam(gainNode.gain, context);
   }
@@ -5,17 +5,34 @@ import BaseAudioContext from './BaseAudioContext';
 import PeriodicWave from './PeriodicWave';
 import { InvalidStateError } from '../errors';
 import { OscillatorOptions } from '../types';
+import { isNativeNode } from '../utils';
 
 export default class OscillatorNode extends AudioScheduledSourceNode {
   readonly frequency: AudioParam;
   readonly detune: AudioParam;
 
-  constructor(context: BaseAudioContext, options?: OscillatorOptions) {
-    if (options?.periodicWave) {
-      options.type = 'custom';
+  constructor(context: BaseAudioContext, options?: OscillatorOptions);
+
+  /** @internal */
+  constructor(context: BaseAudioContext, node: IOscillatorNode);
+
+  /** @internal */
+  constructor(
+    context: BaseAudioContext,
+    arg?: OscillatorOptions | IOscillatorNode
+  ) {
+    if (isNativeNode<IOscillatorNode>(arg)) {
+      super(context, arg);
+      this.frequency = new AudioParam(arg.frequency, context);
+      this.detune = new AudioParam(arg.detune, context);
+      return;
+    }
+
+    if (arg?.periodicWave) {
+      arg.type = 'custom';
     }
 
-    const node = context.context.createOscillator(options || {});
+    const node = context.context.createOscillator(arg || {});
     super(context, node);
     this.frequency = new AudioParam(node.frequency, context);
     this.detune = new AudioParam(node.detune, context);
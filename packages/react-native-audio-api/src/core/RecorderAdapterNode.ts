@@ -1,4 +1,5 @@
 import { IRecorderAdapterNode } from '../interfaces';
+import { RecorderAdapterStats } from '../types';
 import AudioNode from './AudioNode';
 import BaseAudioContext from './BaseAudioContext';
 
@@ -14,4 +15,13 @@ export default class RecorderAdapterNode extends AudioNode {
   public getNode(): IRecorderAdapterNode {
     return this.node as IRecorderAdapterNode;
   }
+
+  /**
+   * Returns how much recorded audio was passed to the graph and lost on the
+   * way. A growing overflow or underflow duration means that the recorder and
+   * the audio output run at slightly different rates.
+   */
+  public getStats(): RecorderAdapterStats {
+    return (this.node as IRecorderAdapterNode).getStats();
+  }
 }
@@ -3,14 +3,24 @@ import { StereoPannerOptions } from '../types';
 import AudioNode from './AudioNode';
 import AudioParam from './AudioParam';
 import BaseAudioContext from './BaseAudioContext';
+import { isNativeNode } from '../utils';
 
 export default class StereoPannerNode extends AudioNode {
   readonly pan: AudioParam;
 
-  constructor(context: BaseAudioContext, options?: StereoPannerOptions) {
-    const pan: IStereoPannerNode = context.context.createStereoPanner(
-      options || {}
-    );
+  constructor(context: BaseAudioContext, options?: StereoPannerOptions);
+
+  /** @internal */
+  constructor(context: BaseAudioContext, node: IStereoPannerNode);
+
+  /** @internal */
+  constructor(
+    context: BaseAudioContext,
+    arg?: StereoPannerOptions | IStereoPannerNode
+  ) {
+    const pan: IStereoPannerNode = isNativeNode<IStereoPannerNode>(arg)
+      ? arg
+      : context.context.createStereoPanner(arg || {});
     super(context, pan);
     this.pan = new AudioParam(pan.pan, context);
   }
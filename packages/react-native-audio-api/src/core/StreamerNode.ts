@@ -1,7 +1,7 @@
 import { IStreamerNode } from '../interfaces';
 import AudioScheduledSourceNode from './AudioScheduledSourceNode';
-import { StreamerOptions } from '../types';
-import { InvalidStateError, NotSupportedError } from '../errors';
+import { StreamerOptions, StreamerStats } from '../types';
+import { InvalidStateError, NotSupportedError, RangeError } from '../errors';
 import BaseAudioContext from './BaseAudioContext';
 
 export default class StreamerNode extends AudioScheduledSourceNode {
@@ -33,4 +33,22 @@ export default class StreamerNode extends AudioScheduledSourceNode {
   public get streamPath(): string {
     return (this.node as IStreamerNode).streamPath;
   }
+
+  /**
+   * Continues the stream from the given time, in seconds from its start.
+   * Decoding restarts from the preceding keyframe, the audio before the time
+   * is discarded natively.
+   */
+  public seek(time: number): void {
+    if (!Number.isFinite(time) || time < 0) {
+      throw new RangeError(
+        `time must be a non-negative finite number: ${time}`
+      );
+    }
+    (this.node as IStreamerNode).seek(time);
+  }
+
+  public getStats(): StreamerStats {
+    return (this.node as IStreamerNode).getStats();
+  }
 }
@@ -1,6 +1,7 @@
 import AudioNode from './AudioNode';
 import BaseAudioContext from './BaseAudioContext';
-import { AudioWorkletRuntime } from '../types';
+import { IWorkletNode } from '../interfaces';
+import { AudioWorkletRuntime, WorkletStats } from '../types';
 import AudioAPIModule from '../AudioAPIModule';
 
 export default class WorkletNode extends AudioNode {
@@ -9,24 +10,33 @@ export default class WorkletNode extends AudioNode {
     runtime: AudioWorkletRuntime,
     callback: (audioData: Array<Float32Array>, channelCount: number) => void,
     bufferLength: number,
-    inputChannelCount: number
+    inputChannelCount: number,
+    lookahead: number = 0
   ) {
+    // the arrays are created once natively and passed to every call
     const shareableWorklet =
       AudioAPIModule.workletsModule!.makeShareableCloneRecursive(
-        (audioBuffers: Array<ArrayBuffer>, channelCount: number) => {
+        (audioData: Array<Float32Array>, channelCount: number) => {
           'worklet';
-          const floatAudioData: Array<Float32Array> = audioBuffers.map(
-            (buffer) => new Float32Array(buffer)
-          );
-          callback(floatAudioData, channelCount);
+          callback(audioData, channelCount);
         }
       );
     const node = context.context.createWorkletNode(
       shareableWorklet,
       runtime === 'UIRuntime',
       bufferLength,
-      inputChannelCount
+      inputChannelCount,
+      lookahead
     );
     super(context, node);
   }
+
+  /**
+   * Returns how the worklet keeps up when it runs ahead on its own thread. An
+   * underrun is a buffer dropped because the worklet was still busy with the
+   * previous ones. The input is passed through as it is, so the latency is 0.
+   */
+  public getStats(): WorkletStats {
+    return (this.node as IWorkletNode).getStats();
+  }
 }
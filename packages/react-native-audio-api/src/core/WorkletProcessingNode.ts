@@ -1,6 +1,7 @@
 import AudioNode from './AudioNode';
 import BaseAudioContext from './BaseAudioContext';
-import { AudioWorkletRuntime } from '../types';
+import { IWorkletProcessingNode } from '../interfaces';
+import { AudioWorkletRuntime, WorkletStats } from '../types';
 import AudioAPIModule from '../AudioAPIModule';
 
 export default class WorkletProcessingNode extends AudioNode {
@@ -12,30 +13,40 @@ export default class WorkletProcessingNode extends AudioNode {
       outputData: Array<Float32Array>,
       framesToProcess: number,
       currentTime: number
-    ) => void
+    ) => void,
+    lookahead: number = 0,
+    blockSize: number = 128,
+    channelCount: number = 2
   ) {
+    // the arrays are created once natively and passed to every call
     const shareableWorklet =
       AudioAPIModule.workletsModule!.makeShareableCloneRecursive(
         (
-          inputBuffers: Array<ArrayBuffer>,
-          outputBuffers: Array<ArrayBuffer>,
+          inputData: Array<Float32Array>,
+          outputData: Array<Float32Array>,
           framesToProcess: number,
           currentTime: number
         ) => {
           'worklet';
-          const inputData: Array<Float32Array> = inputBuffers.map(
-            (buffer) => new Float32Array(buffer, 0, framesToProcess)
-          );
-          const outputData: Array<Float32Array> = outputBuffers.map(
-            (buffer) => new Float32Array(buffer, 0, framesToProcess)
-          );
           callback(inputData, outputData, framesToProcess, currentTime);
         }
       );
     const node = context.context.createWorkletProcessingNode(
       shareableWorklet,
-      runtime === 'UIRuntime'
+      runtime === 'UIRuntime',
+      lookahead,
+      blockSize,
+      channelCount
     );
     super(context, node);
   }
+
+  /**
+   * Returns how the worklet keeps up when it runs ahead on its own thread. An
+   * underrun is a block played as silence because the worklet was not done
+   * with it in time. The latency includes the block the input is gathered in.
+   */
+  public getStats(): WorkletStats {
+    return (this.node as IWorkletProcessingNode).getStats();
+  }
 }
@@ -1,6 +1,7 @@
 import AudioScheduledSourceNode from './AudioScheduledSourceNode';
 import BaseAudioContext from './BaseAudioContext';
-import { AudioWorkletRuntime } from '../types';
+import { IWorkletSourceNode } from '../interfaces';
+import { AudioWorkletRuntime, WorkletStats } from '../types';
 import AudioAPIModule from '../AudioAPIModule';
 
 export default class WorkletSourceNode extends AudioScheduledSourceNode {
@@ -12,27 +13,38 @@ export default class WorkletSourceNode extends AudioScheduledSourceNode {
       framesToProcess: number,
       currentTime: number,
       startOffset: number
-    ) => void
+    ) => void,
+    lookahead: number = 0,
+    blockSize: number = 128
   ) {
+    // the arrays are created once natively and passed to every call
     const shareableWorklet =
       AudioAPIModule.workletsModule!.makeShareableCloneRecursive(
         (
-          audioBuffers: Array<ArrayBuffer>,
+          audioData: Array<Float32Array>,
           framesToProcess: number,
           currentTime: number,
           startOffset: number
         ) => {
           'worklet';
-          const floatAudioData: Array<Float32Array> = audioBuffers.map(
-            (buffer) => new Float32Array(buffer)
-          );
-          callback(floatAudioData, framesToProcess, currentTime, startOffset);
+          callback(audioData, framesToProcess, currentTime, startOffset);
         }
       );
     const node = context.context.createWorkletSourceNode(
       shareableWorklet,
-      runtime === 'UIRuntime'
+      runtime === 'UIRuntime',
+      lookahead,
+      blockSize
     );
     super(context, node);
   }
+
+  /**
+   * Returns how the worklet keeps up when it runs ahead on its own thread. An
+   * underrun is a block played as silence because the worklet was not done
+   * with it in time.
+   */
+  public getStats(): WorkletStats {
+    return (this.node as IWorkletSourceNode).getStats();
+  }
 }
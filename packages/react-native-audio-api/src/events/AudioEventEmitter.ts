@@ -1,4 +1,9 @@
-import { AudioEventName, AudioEventCallback } from './types';
+import {
+  AudioEventName,
+  AudioEventCallback,
+  AudioEventBatchCallback,
+  AudioEventStats,
+} from './types';
 import AudioEventSubscription from './AudioEventSubscription';
 import { IAudioEventEmitter } from '../interfaces';
 
@@ -20,10 +25,28 @@ export default class AudioEventEmitter {
     return new AudioEventSubscription(subscriptionId, name, this);
   }
 
+  /**
+   * Adds a listener that receives the events of one frame in a single call.
+   */
+  addAudioEventBatchListener<Name extends AudioEventName>(
+    name: Name,
+    callback: AudioEventBatchCallback<Name>
+  ): AudioEventSubscription {
+    const subscriptionId = this.audioEventEmitter.addAudioEventBatchListener(
+      name,
+      callback
+    );
+    return new AudioEventSubscription(subscriptionId, name, this);
+  }
+
   removeAudioEventListener<Name extends AudioEventName>(
     name: Name,
     subscriptionId: string
   ): void {
     this.audioEventEmitter.removeAudioEventListener(name, subscriptionId);
   }
+
+  getEventStats(): AudioEventStats {
+    return this.audioEventEmitter.getEventStats();
+  }
 }
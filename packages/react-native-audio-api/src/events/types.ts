@@ -93,3 +93,23 @@ export type AudioEventName = keyof AudioEvents;
 export type AudioEventCallback<Name extends AudioEventName> = (
   event: AudioEvents[Name]
 ) => void;
+
+export type AudioEventBatchCallback<Name extends AudioEventName> = (
+  events: AudioEvents[Name][]
+) => void;
+
+export interface AudioEventCounters {
+  /** Number of events passed to the listeners. */
+  dispatched: number;
+  /**
+   * Number of events replaced by a later event of the same listener before
+   * being delivered, `positionChanged` is delivered at most once per frame.
+   */
+  coalesced: number;
+}
+
+export interface AudioEventStats {
+  events: Partial<Record<AudioEventName, AudioEventCounters>>;
+  /** Number of events dropped because the queue of their context was full. */
+  dropped: number;
+}
@@ -1,14 +1,22 @@
-import { AudioEventCallback, AudioEventName } from './events/types';
+import {
+  AudioEventBatchCallback,
+  AudioEventCallback,
+  AudioEventName,
+  AudioEventStats,
+} from './events/types';
 import type {
+  AudioBufferStorageFormat,
   AudioRecorderCallbackOptions,
   AudioRecorderFileOptions,
   BiquadFilterType,
   ChannelCountMode,
   ChannelInterpretation,
   ContextState,
+  DecodedAudioCacheStats,
   FileInfo,
   OscillatorType,
   OverSampleType,
+  RecorderAdapterStats,
   Result,
   AnalyserOptions,
   BaseAudioBufferSourceOptions,
@@ -19,30 +27,35 @@ import type {
   IAudioBufferSourceOptions,
   IConvolverOptions,
   IIRFilterOptions,
+  ISubgraphTemplate,
   OscillatorOptions,
   StereoPannerOptions,
   StreamerOptions,
+  StreamerStats,
+  VoicePoolNodeType,
+  VoicePoolStats,
   WaveShaperOptions,
   WindowType,
+  WorkletStats,
 } from './types';
 
 // IMPORTANT: use only IClass, because it is a part of contract between cpp host object and js layer
 
 export type WorkletNodeCallback = (
-  audioData: Array<ArrayBuffer>,
+  audioData: Array<Float32Array>,
   channelCount: number
 ) => void;
 
 export type WorkletSourceNodeCallback = (
-  audioData: Array<ArrayBuffer>,
+  audioData: Array<Float32Array>,
   framesToProcess: number,
   currentTime: number,
   startOffset: number
 ) => void;
 
 export type WorkletProcessingNodeCallback = (
-  inputData: Array<ArrayBuffer>,
-  outputData: Array<ArrayBuffer>,
+  inputData: Array<Float32Array>,
+  outputData: Array<Float32Array>,
   framesToProcess: number,
   currentTime: number
 ) => void;
@@ -63,17 +76,23 @@ export interface IBaseAudioContext {
   createRecorderAdapter(): IRecorderAdapterNode;
   createWorkletSourceNode(
     shareableWorklet: ShareableWorkletCallback,
-    shouldUseUiRuntime: boolean
+    shouldUseUiRuntime: boolean,
+    lookahead: number,
+    blockSize: number
   ): IWorkletSourceNode;
   createWorkletNode(
     shareableWorklet: ShareableWorkletCallback,
     shouldUseUiRuntime: boolean,
     bufferLength: number,
-    inputChannelCount: number
+    inputChannelCount: number,
+    lookahead: number
   ): IWorkletNode;
   createWorkletProcessingNode(
     shareableWorklet: ShareableWorkletCallback,
-    shouldUseUiRuntime: boolean
+    shouldUseUiRuntime: boolean,
+    lookahead: number,
+    blockSize: number,
+    channelCount: number
   ): IWorkletProcessingNode;
   createOscillator(oscillatorOptions: OscillatorOptions): IOscillatorNode;
   createConstantSource(
@@ -103,6 +122,12 @@ export interface IBaseAudioContext {
   createConvolver: (convolverOptions?: IConvolverOptions) => IConvolverNode;
   createStreamer: (streamerOptions?: StreamerOptions) => IStreamerNode | null; // null when FFmpeg is not enabled
   createWaveShaper: (waveShaperOptions?: WaveShaperOptions) => IWaveShaperNode;
+  scheduleParamEvents: (params: IAudioParam[], events: Float64Array) => void;
+  createSubgraph: (subgraph: ISubgraphTemplate) => IAudioNode[];
+  beginGraphBatch: () => void;
+  commitGraphBatch: () => void;
+  getVoicePoolStats: () => Record<VoicePoolNodeType, VoicePoolStats>;
+  setVoicePoolCapacity: (type: VoicePoolNodeType, capacity: number) => void;
 }
 
 export interface IAudioContext extends IBaseAudioContext {
@@ -198,6 +223,8 @@ export interface IOscillatorNode extends IAudioScheduledSourceNode {
 export interface IStreamerNode extends IAudioNode {
   readonly streamPath: string;
   initialize(streamPath: string): boolean;
+  getStats(): StreamerStats;
+  seek(time: number): void;
 }
 
 export interface IConstantSourceNode extends IAudioScheduledSourceNode {
@@ -244,6 +271,7 @@ export interface IAudioBuffer {
   readonly duration: number;
   readonly sampleRate: number;
   readonly numberOfChannels: number;
+  readonly storageFormat: AudioBufferStorageFormat;
 
   getChannelData(channel: number): Float32Array;
   copyFromChannel(
@@ -256,6 +284,7 @@ export interface IAudioBuffer {
     channelNumber: number,
     startInChannel: number
   ): void;
+  setStorageFormat(format: AudioBufferStorageFormat): void;
 }
 
 export interface IAudioParam {
@@ -279,6 +308,7 @@ export interface IAudioParam {
   ) => void;
   cancelScheduledValues: (cancelTime: number) => void;
   cancelAndHoldAtTime: (cancelTime: number) => void;
+  scheduleEvents: (events: Float64Array) => void;
 }
 
 export interface IPeriodicWave {}
@@ -297,13 +327,21 @@ export interface IAnalyserNode extends IAudioNode {
   getByteTimeDomainData: (array: Uint8Array) => void;
 }
 
-export interface IRecorderAdapterNode extends IAudioNode {}
+export interface IRecorderAdapterNode extends IAudioNode {
+  getStats(): RecorderAdapterStats;
+}
 
-export interface IWorkletNode extends IAudioNode {}
+export interface IWorkletNode extends IAudioNode {
+  getStats(): WorkletStats;
+}
 
-export interface IWorkletSourceNode extends IAudioScheduledSourceNode {}
+export interface IWorkletSourceNode extends IAudioScheduledSourceNode {
+  getStats(): WorkletStats;
+}
 
-export interface IWorkletProcessingNode extends IAudioNode {}
+export interface IWorkletProcessingNode extends IAudioNode {
+  getStats(): WorkletStats;
+}
 
 export interface IWaveShaperNode extends IAudioNode {
   readonly curve: Float32Array | null;
@@ -314,6 +352,7 @@ export interface IWaveShaperNode extends IAudioNode {
 export interface IAudioRecorderCallbackOptions
   extends AudioRecorderCallbackOptions {
   callbackId: string;
+  bufferPoolSize: number;
 }
 
 export interface IAudioRecorder {
@@ -355,19 +394,30 @@ export interface IAudioDecoder {
     sourcePath: string,
     sampleRate?: number
   ) => Promise<IAudioBuffer>;
+  decodeWithFilePathPaged: (
+    sourcePath: string,
+    sampleRate?: number
+  ) => Promise<IAudioBuffer>;
   decodeWithPCMInBase64: (
     b64: string,
     inputSampleRate: number,
     inputChannelCount: number,
     interleaved?: boolean
   ) => Promise<IAudioBuffer>;
+  getCacheStats: () => DecodedAudioCacheStats;
+  setCacheBudget: (budgetInBytes: number) => void;
+  clearCache: () => void;
 }
 
 export interface IAudioStretcher {
   changePlaybackSpeed: (
     arrayBuffer: IAudioBuffer,
-    playbackSpeed: number
+    playbackSpeed: number,
+    onProgress: ((progress: number) => void) | undefined,
+    jobId: number
   ) => Promise<IAudioBuffer>;
+  // cancels every job in flight when no id is given
+  cancel: (jobId?: number) => void;
 }
 
 export interface IAudioEventEmitter {
@@ -375,8 +425,13 @@ export interface IAudioEventEmitter {
     name: Name,
     callback: AudioEventCallback<Name>
   ): string;
+  addAudioEventBatchListener<Name extends AudioEventName>(
+    name: Name,
+    callback: AudioEventBatchCallback<Name>
+  ): string;
   removeAudioEventListener<Name extends AudioEventName>(
     name: Name,
     subscriptionId: string
   ): void;
+  getEventStats(): AudioEventStats;
 }
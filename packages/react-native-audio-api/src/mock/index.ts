@@ -15,9 +15,11 @@ import {
   OfflineAudioContextOptions,
   OscillatorType,
   OverSampleType,
+  RecorderAdapterStats,
   Result,
   AnalyserOptions,
   AudioBufferSourceOptions,
+  AudioBufferStorageFormat,
   BaseAudioBufferSourceOptions,
   BiquadFilterOptions,
   ConstantSourceOptions,
@@ -28,7 +30,12 @@ import {
   PeriodicWaveOptions,
   StereoPannerOptions,
   StreamerOptions,
+  StreamerStats,
+  SubgraphTemplate,
+  VoicePoolNodeType,
+  VoicePoolStats,
   WaveShaperOptions,
+  WorkletStats,
 } from '../types';
 
 /* eslint-disable no-useless-constructor */
@@ -134,6 +141,10 @@ class AudioParamMock {
   public cancelAndHoldAtTime(_startTime: number): AudioParamMock {
     return this;
   }
+
+  public scheduleEvents(_events: Float64Array): AudioParamMock {
+    return this;
+  }
 }
 
 class AudioBufferMock {
@@ -141,6 +152,7 @@ class AudioBufferMock {
   public length: number;
   public duration: number;
   public numberOfChannels: number;
+  public storageFormat: AudioBufferStorageFormat = 'float32';
 
   constructor(options: {
     numberOfChannels: number;
@@ -168,6 +180,10 @@ class AudioBufferMock {
     _channelNumber: number,
     _startInChannel?: number
   ): void {}
+
+  setStorageFormat(format: AudioBufferStorageFormat): void {
+    this.storageFormat = format;
+  }
 }
 
 class AudioNodeMock {
@@ -427,6 +443,16 @@ class RecorderAdapterNodeMock extends AudioNodeMock {
   getNode(): Record<string, unknown> {
     return {};
   }
+
+  getStats(): RecorderAdapterStats {
+    return {
+      bufferedDuration: 0,
+      recordedDuration: 0,
+      playedDuration: 0,
+      overflowDuration: 0,
+      underflowDuration: 0,
+    };
+  }
 }
 
 class AudioBufferQueueSourceNodeMock extends AudioScheduledSourceNodeMock {
@@ -481,6 +507,17 @@ class StreamerNodeMock extends AudioScheduledSourceNodeMock {
     return this._streamPath;
   }
 
+  seek(_time: number): void {}
+
+  getStats(): StreamerStats {
+    return {
+      bufferedDuration: 0,
+      underrunCount: 0,
+      underrunDuration: 0,
+      isBuffering: false,
+    };
+  }
+
   pause(): void {}
   resume(): void {}
 }
@@ -491,10 +528,20 @@ class WorkletNodeMock extends AudioNodeMock {
     _runtime: AudioWorkletRuntime,
     _callback: (audioData: Array<Float32Array>, channelCount: number) => void,
     _bufferLength: number,
-    _inputChannelCount: number
+    _inputChannelCount: number,
+    _lookahead: number = 0
   ) {
     super(context, {});
   }
+
+  getStats(): WorkletStats {
+    return {
+      latency: 0,
+      underrunCount: 0,
+      renderedBlockCount: 0,
+      skippedBlockCount: 0,
+    };
+  }
 }
 
 class WorkletProcessingNodeMock extends AudioNodeMock {
@@ -506,10 +553,22 @@ class WorkletProcessingNodeMock extends AudioNodeMock {
       outputData: Array<Float32Array>,
       framesToProcess: number,
       currentTime: number
-    ) => void
+    ) => void,
+    _lookahead: number = 0,
+    _blockSize: number = 128,
+    _channelCount: number = 2
   ) {
     super(context, {});
   }
+
+  getStats(): WorkletStats {
+    return {
+      latency: 0,
+      underrunCount: 0,
+      renderedBlockCount: 0,
+      skippedBlockCount: 0,
+    };
+  }
 }
 
 class WorkletSourceNodeMock extends AudioScheduledSourceNodeMock {
@@ -521,10 +580,21 @@ class WorkletSourceNodeMock extends AudioScheduledSourceNodeMock {
       framesToProcess: number,
       currentTime: number,
       startOffset: number
-    ) => void
+    ) => void,
+    _lookahead: number = 0,
+    _blockSize: number = 128
   ) {
     super(context, {});
   }
+
+  getStats(): WorkletStats {
+    return {
+      latency: 0,
+      underrunCount: 0,
+      renderedBlockCount: 0,
+      skippedBlockCount: 0,
+    };
+  }
 }
 
 class PeriodicWaveMock {
@@ -643,6 +713,46 @@ class BaseAudioContextMock {
     return new WaveShaperNodeMock(this, options);
   }
 
+  scheduleParamEvents(_params: AudioParamMock[], _events: Float64Array): void {}
+
+  createSubgraph(subgraph: SubgraphTemplate): AudioNodeMock[] {
+    return subgraph.nodes.map((template) => {
+      switch (template.type) {
+        case 'oscillator':
+          return new OscillatorNodeMock(this, template.options);
+        case 'constantSource':
+          return new ConstantSourceNodeMock(this, template.options);
+        case 'bufferSource':
+          return new AudioBufferSourceNodeMock(this, template.options);
+        case 'gain':
+          return new GainNodeMock(this, template.options);
+        case 'stereoPanner':
+          return new StereoPannerNodeMock(this, template.options);
+        case 'biquadFilter':
+          return new BiquadFilterNodeMock(this, template.options);
+        case 'delay':
+          return new DelayNodeMock(this, template.options);
+      }
+    });
+  }
+
+  batchGraphEdits<T>(edits: () => T): T {
+    return edits();
+  }
+
+  getVoicePoolStats(): Record<VoicePoolNodeType, VoicePoolStats> {
+    const stats = {
+      hits: 0,
+      misses: 0,
+      recycled: 0,
+      available: 0,
+      capacity: 32,
+    };
+    return { oscillator: { ...stats }, bufferSource: { ...stats } };
+  }
+
+  setVoicePoolCapacity(_type: VoicePoolNodeType, _capacity: number): void {}
+
   createRecorderAdapter(): RecorderAdapterNodeMock {
     return new RecorderAdapterNodeMock(this);
   }
@@ -661,21 +771,27 @@ class BaseAudioContextMock {
     _shareableWorklet: Record<string, unknown>,
     _runOnUI: boolean,
     _bufferLength: number,
-    _inputChannelCount: number
+    _inputChannelCount: number,
+    _lookahead: number = 0
   ): WorkletNodeMock {
     return new WorkletNodeMock(this, 'AudioRuntime', noop, 0, 0);
   }
 
   createWorkletProcessingNode(
     _shareableWorklet: Record<string, unknown>,
-    _runOnUI: boolean
+    _runOnUI: boolean,
+    _lookahead: number = 0,
+    _blockSize: number = 128,
+    _channelCount: number = 2
   ): WorkletProcessingNodeMock {
     return new WorkletProcessingNodeMock(this, 'AudioRuntime', noop);
   }
 
   createWorkletSourceNode(
     _shareableWorklet: Record<string, unknown>,
-    _runOnUI: boolean
+    _runOnUI: boolean,
+    _lookahead: number = 0,
+    _blockSize: number = 128
   ): WorkletSourceNodeMock {
     return new WorkletSourceNodeMock(this, 'AudioRuntime', noop);
   }
@@ -852,6 +968,18 @@ const decodeAudioData = (_audioData: ArrayBuffer): Promise<AudioBufferMock> => {
   );
 };
 
+const decodePagedAudioData = (
+  _input: number | string
+): Promise<AudioBufferMock> => {
+  return Promise.resolve(
+    new AudioBufferMock({
+      numberOfChannels: 2,
+      length: 44100,
+      sampleRate: 44100,
+    })
+  );
+};
+
 const decodePCMInBase64 = (_base64Data: string): Promise<AudioBufferMock> => {
   return Promise.resolve(
     new AudioBufferMock({
@@ -864,11 +992,30 @@ const decodePCMInBase64 = (_base64Data: string): Promise<AudioBufferMock> => {
 
 const changePlaybackSpeed = (
   buffer: AudioBufferMock,
-  _speed: number
+  _speed: number,
+  onProgress?: (progress: number) => void,
+  _signal?: AbortSignal
 ): Promise<AudioBufferMock> => {
+  onProgress?.(1);
   return Promise.resolve(buffer);
 };
 
+const cancelPlaybackSpeedChange = (): void => {};
+
+const getDecodedAudioCacheStats = () => ({
+  hits: 0,
+  misses: 0,
+  inFlightJoins: 0,
+  evictions: 0,
+  entries: 0,
+  sizeInBytes: 0,
+  budgetInBytes: 32 * 1024 * 1024,
+});
+
+const setDecodedAudioCacheBudget = (_budgetInBytes: number): void => {};
+
+const clearDecodedAudioCache = (): void => {};
+
 class AudioManagerMock {
   static getDevicePreferredSampleRate(): number {
     return 44100;
@@ -884,6 +1031,10 @@ class AudioManagerMock {
   }
 
   static removeSystemEventListener(_listener: { remove: () => void }): void {}
+
+  static getEventStats(): { events: object; dropped: number } {
+    return { events: {}, dropped: 0 };
+  }
 }
 
 class NotificationManagerMock {
@@ -1032,9 +1183,14 @@ export const AudioApiError = AudioApiErrorMock;
 
 // Export functions
 export {
+  cancelPlaybackSpeedChange,
   changePlaybackSpeed,
+  clearDecodedAudioCache,
   decodeAudioData,
+  decodePagedAudioData,
   decodePCMInBase64,
+  getDecodedAudioCacheStats,
+  setDecodedAudioCacheBudget,
   setMockSystemVolume,
   useSystemVolume,
 };
@@ -1098,6 +1254,7 @@ export {
   PeriodicWaveOptions,
   StereoPannerOptions,
   StreamerOptions,
+  StreamerStats,
   WaveShaperOptions,
 };
 
@@ -1131,8 +1288,13 @@ export default {
 
   // Functions
   decodeAudioData,
+  decodePagedAudioData,
   decodePCMInBase64,
   changePlaybackSpeed,
+  cancelPlaybackSpeedChange,
+  getDecodedAudioCacheStats,
+  setDecodedAudioCacheBudget,
+  clearDecodedAudioCache,
   useSystemVolume,
   setMockSystemVolume,
 
@@ -1,5 +1,9 @@
 import { AudioEventEmitter, AudioEventSubscription } from '../events';
-import { SystemEventCallback, SystemEventName } from '../events/types';
+import {
+  AudioEventStats,
+  SystemEventCallback,
+  SystemEventName,
+} from '../events/types';
 import { NativeAudioAPIModule } from '../specs';
 import { parseNativeError } from './errors';
 import {
@@ -105,6 +109,14 @@ class AudioManager implements IAudioManager {
   async setInputDevice(deviceId: string): Promise<boolean> {
     return NativeAudioAPIModule.setInputDevice(deviceId);
   }
+
+  /**
+   * Returns the number of audio events dispatched, coalesced and dropped
+   * since the start of the app, per event type.
+   */
+  getEventStats(): AudioEventStats {
+    return this.audioEventEmitter.getEventStats();
+  }
 }
 
 export default new AudioManager();
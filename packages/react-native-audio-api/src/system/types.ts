@@ -1,5 +1,9 @@
 import type { AudioEventSubscription } from '../events';
-import type { SystemEventCallback, SystemEventName } from '../events/types';
+import type {
+  AudioEventStats,
+  SystemEventCallback,
+  SystemEventName,
+} from '../events/types';
 
 export type IOSCategory =
   | 'record'
@@ -86,4 +90,5 @@ export interface IAudioManager {
   checkNotificationPermissions(): Promise<PermissionStatus>;
   getDevicesInfo(): Promise<AudioDevicesInfo>;
   setInputDevice(deviceId: string): Promise<boolean>;
+  getEventStats(): AudioEventStats;
 }
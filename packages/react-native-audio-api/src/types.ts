@@ -1,6 +1,15 @@
 import AudioBuffer from './core/AudioBuffer';
+import AudioBufferSourceNode from './core/AudioBufferSourceNode';
+import AudioNode from './core/AudioNode';
+import AudioParam from './core/AudioParam';
+import BiquadFilterNode from './core/BiquadFilterNode';
+import ConstantSourceNode from './core/ConstantSourceNode';
+import DelayNode from './core/DelayNode';
+import GainNode from './core/GainNode';
+import OscillatorNode from './core/OscillatorNode';
 import PeriodicWave from './core/PeriodicWave';
-import { IAudioBuffer } from './interfaces';
+import StereoPannerNode from './core/StereoPannerNode';
+import { IAudioBuffer, IAudioNode, IAudioParam } from './interfaces';
 
 export type Result<T> =
   | ({ status: 'success' } & T)
@@ -67,6 +76,20 @@ export enum BitDepth {
   Bit32 = 2,
 }
 
+/**
+ * Kind of an event scheduled with `AudioParam.scheduleEvents` or
+ * `BaseAudioContext.scheduleParamEvents`.
+ */
+export enum AutomationEventType {
+  SetValue = 0,
+  LinearRamp = 1,
+  ExponentialRamp = 2,
+  /** The extra field of the event is the time constant. */
+  SetTarget = 3,
+  CancelScheduledValues = 4,
+  CancelAndHold = 5,
+}
+
 export enum FlacCompressionLevel {
   L0 = 0,
   L1 = 1,
@@ -189,6 +212,10 @@ export interface ConstantSourceOptions {
 
 export interface StreamerOptions {
   streamPath?: string;
+  /** Seconds of audio buffered before playback starts or resumes after an underrun. */
+  prebufferDuration?: number;
+  /** Seconds of buffered audio below which decoding resumes once the buffer is full. */
+  lowWaterDuration?: number;
 }
 
 export interface PeriodicWaveConstraints {
@@ -206,6 +233,14 @@ export interface AudioBufferOptions {
   sampleRate: number;
 }
 
+/**
+ * How the samples of an AudioBuffer are stored in memory. Compact formats take half
+ * the memory of float32 and are converted to float while playing.
+ * - 'int16' keeps 16 bits of precision for samples in [-1, 1], louder ones are clipped.
+ * - 'float16' keeps about 11 bits of precision relative to the level of the signal.
+ */
+export type AudioBufferStorageFormat = 'float32' | 'int16' | 'float16';
+
 export interface IIRFilterOptions extends AudioNodeOptions {
   feedforward: number[];
   feedback: number[];
@@ -232,6 +267,15 @@ export interface AudioRecorderCallbackOptions {
    * for stereo recordings.
    */
   channelCount: number;
+
+  /**
+   * Number of buffers reused for the delivered audio. A buffer is reused once
+   * it is garbage collected and no longer referenced by JS or an audio node,
+   * so keeping it, its channel data or playing it is safe. When every buffer
+   * is in use, a new one is allocated. Defaults to 0, where each chunk of
+   * audio gets a new buffer.
+   */
+  bufferPoolSize?: number;
 }
 
 export interface DelayOptions extends AudioNodeOptions {
@@ -244,8 +288,124 @@ export interface WaveShaperOptions extends AudioNodeOptions {
   oversample?: OverSampleType;
 }
 
+export type SubgraphNodeTemplate =
+  | { type: 'oscillator'; options?: OscillatorOptions }
+  | { type: 'constantSource'; options?: ConstantSourceOptions }
+  | { type: 'bufferSource'; options?: AudioBufferSourceOptions }
+  | { type: 'gain'; options?: GainOptions }
+  | { type: 'stereoPanner'; options?: StereoPannerOptions }
+  | { type: 'biquadFilter'; options?: BiquadFilterOptions }
+  | { type: 'delay'; options?: DelayOptions };
+
+export type SubgraphNodeType = SubgraphNodeTemplate['type'];
+
+/**
+ * Connects the node at the first index to the node at the second one, or to
+ * its param named by the third element. The destination can also be a node or
+ * param that already exists, like `context.destination`.
+ */
+export type SubgraphConnection =
+  | [from: number, to: number | AudioNode | AudioParam]
+  | [from: number, to: number, param: string];
+
+export interface SubgraphTemplate<
+  T extends readonly SubgraphNodeTemplate[] = SubgraphNodeTemplate[],
+> {
+  nodes: T;
+  connections?: SubgraphConnection[];
+  /** When set, every source node of the subgraph is started at this time. */
+  start?: number;
+}
+
+interface SubgraphNodeTypes {
+  oscillator: OscillatorNode;
+  constantSource: ConstantSourceNode;
+  bufferSource: AudioBufferSourceNode;
+  gain: GainNode;
+  stereoPanner: StereoPannerNode;
+  biquadFilter: BiquadFilterNode;
+  delay: DelayNode;
+}
+
+/** The nodes created from the templates, in the same order. */
+export type SubgraphNodes<T extends readonly SubgraphNodeTemplate[]> = {
+  -readonly [K in keyof T]: T[K] extends {
+    type: infer N extends SubgraphNodeType;
+  }
+    ? SubgraphNodeTypes[N]
+    : never;
+};
+
+// subgraph that is passed to c++ layer
+export interface ISubgraphTemplate {
+  nodes: { type: SubgraphNodeType; options?: object }[];
+  connections?: [number, number | IAudioNode | IAudioParam, string?][];
+  start?: number;
+}
+
 export type DecodeDataInput = number | string | ArrayBuffer;
 
+export type VoicePoolNodeType = 'oscillator' | 'bufferSource';
+
+export interface VoicePoolStats {
+  /** Nodes created from finished ones. */
+  hits: number;
+  /** Nodes created while no finished one was available. */
+  misses: number;
+  /** Finished nodes kept to be created again. */
+  recycled: number;
+  available: number;
+  capacity: number;
+}
+
+export interface DecodedAudioCacheStats {
+  /** Decodes served from the cache. */
+  hits: number;
+  /** Decodes that had to run the decoder. */
+  misses: number;
+  /** Decodes that waited for an identical decode already in progress. */
+  inFlightJoins: number;
+  /** Buffers dropped to stay within the budget. */
+  evictions: number;
+  entries: number;
+  sizeInBytes: number;
+  budgetInBytes: number;
+}
+
+export interface StreamerStats {
+  /** Seconds of decoded audio waiting to be played. */
+  bufferedDuration: number;
+  /** Times playback ran out of decoded audio before the end of the stream. */
+  underrunCount: number;
+  /** Seconds of silence played while buffering. */
+  underrunDuration: number;
+  isBuffering: boolean;
+}
+
+export interface RecorderAdapterStats {
+  /** Seconds of recorded audio waiting to be played. */
+  bufferedDuration: number;
+  /** Seconds of audio received from the recorder. */
+  recordedDuration: number;
+  /** Seconds of audio passed to the graph. */
+  playedDuration: number;
+  /** Seconds of recorded audio lost because the graph fell behind. */
+  overflowDuration: number;
+  /** Seconds of silence played because the recorder fell behind. */
+  underflowDuration: number;
+}
+
+export interface WorkletStats {
+  /** Seconds the output is delayed by, so the worklet can run ahead. */
+  latency: number;
+  /** Times the worklet was not done in time, see the getStats of each node. */
+  underrunCount: number;
+  /** Blocks the worklet was called with on its own thread. */
+  renderedBlockCount: number;
+  /** Late blocks dropped after underruns, to get back to the lookahead. */
+  skippedBlockCount: number;
+}
+
 export interface AudioRecorderStartOptions {
   fileNameOverride?: string;
 }
@@ -1,5 +1,6 @@
 import AudioAPIModule from '../AudioAPIModule';
 import { AudioApiError } from '../errors';
+import { IAudioNode } from '../interfaces';
 
 export function assertWorkletsEnabled() {
   if (!AudioAPIModule.areWorkletsAvailable) {
@@ -16,6 +17,21 @@ export function assertWorkletsEnabled() {
   }
 }
 
+/**
+ * Tells a node created natively, passed to a node constructor to wrap it,
+ * apart from the options of a new node.
+ */
+export function isNativeNode<T extends IAudioNode>(
+  arg: T | object | undefined
+): arg is T {
+  return (
+    typeof arg === 'object' &&
+    arg !== null &&
+    'connect' in arg &&
+    typeof (arg as IAudioNode).connect === 'function'
+  );
+}
+
 export function clamp(value: number, min: number, max: number): number {
   return Math.min(Math.max(value, min), max);
 }
@@ -29,6 +29,7 @@ class AudioManager implements IAudioManager {
     currentInputs: [],
     currentOutputs: [],
   });
+  getEventStats = mockSync({ events: {}, dropped: 0 });
 }
 
 export default new AudioManager();